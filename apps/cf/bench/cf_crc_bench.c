@@ -0,0 +1,236 @@
+/**
+ * @file
+ *
+ * Measures the CFDP file checksum and the class 2 receive checksum work
+ * that is left between EOF and FIN.
+ *
+ * The first part digests the same data, given in PDU sized pieces, with the
+ * byte at a time loop CF_CRC_Digest used to have and with the current word
+ * at a time CF_CRC_Digest from cf_crc.c, and checks that the results match.
+ *
+ * The second part receives a file in PDU sized pieces through the real OSAL
+ * into a file in the bench directory, the way the R2 receive path stores
+ * file data, and then does the read-back that CF_CFDP_R2_CalcCrcChunk does
+ * after EOF: CF_R2_CRC_CHUNK_SIZE reads, at most BENCH_BYTES_PER_WAKEUP
+ * bytes (the default rx_crc_calc_bytes_per_wakeup) per wakeup.  Three cases:
+ *
+ * - "read back all": nothing is digested on receipt and the whole file is
+ *   read back, as before the incremental receive mode;
+ * - "in order": file data that continues the file from its start is
+ *   digested as it arrives, so nothing is left to read back;
+ * - "gap at 1/2": one PDU half way is lost and only retransmitted after
+ *   EOF, which digests it, so the read-back starts just after the gap.
+ *
+ * cf_crc.c is linked as is.  Build with the CF_BENCH cmake option, or by
+ * hand with the same include paths as the cf app:
+ *
+ *   cc -O2 -I../fsw/inc -I../fsw/src -I<cfe, osal and cf config includes> cf_crc_bench.c \
+ *      ../fsw/src/cf_crc.c -L<osal build dir> -losal -losal_bsp -lpthread -lrt -o cf_crc_bench
+ *
+ * and run as "cf_crc_bench [megabytes] [directory]", by default 64 MB stored
+ * in /tmp.  The bench file is removed at the end.
+ */
+
+#include "cfe.h"
+#include "cf_platform_cfg.h"
+#include "cf_crc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_VIRT_FILE        "/bench/cf_crc_bench.dat"
+#define BENCH_PDU_SIZE         1024
+#define BENCH_BYTES_PER_WAKEUP 16384
+#define BENCH_TICKS_PER_SECOND 10
+
+typedef enum
+{
+    BENCH_READ_BACK_ALL,
+    BENCH_IN_ORDER,
+    BENCH_GAP_AT_HALF,
+    BENCH_NUM_CASES
+} Bench_Case_t;
+
+static uint8 *BenchData;
+static size_t BenchSize;
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+/* the byte at a time CF_CRC_Digest, as it was before digesting whole words */
+static void BenchDigestBytewise(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; ++i)
+    {
+        crc->working <<= 8;
+        crc->working |= data[i];
+
+        ++crc->index;
+
+        if (crc->index == 4)
+        {
+            crc->result += crc->working;
+            crc->index = 0;
+        }
+    }
+}
+
+static double RunDigest(void (*Digest)(CF_Crc_t *, const uint8 *, size_t), uint32 *ResultPtr)
+{
+    CF_Crc_t Crc;
+    double   Start;
+    size_t   Offset;
+
+    Start = Now();
+    CF_CRC_Start(&Crc);
+    for (Offset = 0; Offset < BenchSize; Offset += BENCH_PDU_SIZE)
+    {
+        Digest(&Crc, &BenchData[Offset], BENCH_PDU_SIZE);
+    }
+    CF_CRC_Finalize(&Crc);
+
+    *ResultPtr = Crc.result;
+    return Now() - Start;
+}
+
+/* store one file data PDU, digesting it if it continues the file in order, as CF_CFDP_R2_SubstateRecvFileData does */
+static void RecvFileData(osal_id_t Fd, CF_Crc_t *Crc, size_t *CalcBytes, size_t Offset, bool Incremental)
+{
+    OS_lseek(Fd, Offset, OS_SEEK_SET);
+    OS_write(Fd, &BenchData[Offset], BENCH_PDU_SIZE);
+
+    if (Incremental && Offset == *CalcBytes)
+    {
+        CF_CRC_Digest(Crc, &BenchData[Offset], BENCH_PDU_SIZE);
+        *CalcBytes += BENCH_PDU_SIZE;
+    }
+}
+
+static void RunReceive(Bench_Case_t Case, double *RecvPtr, double *FinPtr, uint32 *WakeupsPtr, uint32 *ResultPtr)
+{
+    static uint8 Buf[CF_R2_CRC_CHUNK_SIZE];
+    osal_id_t    Fd;
+    CF_Crc_t     Crc;
+    size_t       CalcBytes = 0;
+    size_t       GapOffset = (BenchSize / 2) & ~(size_t)(BENCH_PDU_SIZE - 1);
+    size_t       ReadSize;
+    size_t       Count;
+    size_t       Offset;
+    uint32       Wakeups = 0;
+    double       Start;
+
+    *RecvPtr    = 0;
+    *FinPtr     = 0;
+    *WakeupsPtr = 0;
+    *ResultPtr  = 0;
+
+    if (OS_OpenCreate(&Fd, BENCH_VIRT_FILE, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE) != OS_SUCCESS)
+    {
+        return;
+    }
+
+    CF_CRC_Start(&Crc);
+
+    Start = Now();
+    for (Offset = 0; Offset < BenchSize; Offset += BENCH_PDU_SIZE)
+    {
+        if (Case != BENCH_GAP_AT_HALF || Offset != GapOffset)
+        {
+            RecvFileData(Fd, &Crc, &CalcBytes, Offset, Case != BENCH_READ_BACK_ALL);
+        }
+    }
+    if (Case == BENCH_GAP_AT_HALF)
+    {
+        /* the NAKed PDU arrives after EOF */
+        RecvFileData(Fd, &Crc, &CalcBytes, GapOffset, true);
+    }
+    *RecvPtr = Now() - Start;
+
+    /* the EOF to FIN read-back of CF_CFDP_R2_CalcCrcChunk, one pass of the outer loop per wakeup */
+    Start = Now();
+    OS_lseek(Fd, CalcBytes, OS_SEEK_SET);
+    while (CalcBytes < BenchSize)
+    {
+        for (Count = 0; Count < BENCH_BYTES_PER_WAKEUP && CalcBytes < BenchSize; Count += ReadSize)
+        {
+            ReadSize = BenchSize - CalcBytes < sizeof(Buf) ? BenchSize - CalcBytes : sizeof(Buf);
+            if (OS_read(Fd, Buf, ReadSize) != ReadSize)
+            {
+                OS_close(Fd);
+                return;
+            }
+            CF_CRC_Digest(&Crc, Buf, ReadSize);
+            CalcBytes += ReadSize;
+        }
+        ++Wakeups;
+    }
+    CF_CRC_Finalize(&Crc);
+    *FinPtr = Now() - Start;
+
+    OS_close(Fd);
+
+    *WakeupsPtr = Wakeups;
+    *ResultPtr  = Crc.result;
+}
+
+void OS_Application_Startup(void)
+{
+    static const char *Names[BENCH_NUM_CASES] = {"read back all", "in order", "gap at 1/2"};
+    char *const *      ArgV                   = OS_BSP_GetArgV();
+    uint32             ArgC                   = OS_BSP_GetArgC();
+    const char *       Dir                    = ArgC > 2 ? ArgV[2] : "/tmp";
+    osal_id_t          FsId;
+    double             Bytewise;
+    double             Wordwise;
+    double             Recv;
+    double             Fin;
+    uint32             Wakeups;
+    uint32             Expected;
+    uint32             Result;
+    size_t             i;
+
+    BenchSize = (size_t)(ArgC > 1 ? atol(ArgV[1]) : 64) * 1024 * 1024;
+    BenchData = malloc(BenchSize);
+
+    if (BenchData == NULL || OS_API_Init() != OS_SUCCESS || OS_FileSysAddFixedMap(&FsId, Dir, "/bench") != OS_SUCCESS)
+    {
+        printf("cannot set up %lu MB of data with bench directory %s\n", (unsigned long)(BenchSize >> 20), Dir);
+        OS_ApplicationExit(1);
+    }
+
+    srand(1);
+    for (i = 0; i < BenchSize; i++)
+    {
+        BenchData[i] = rand();
+    }
+
+    Bytewise = RunDigest(BenchDigestBytewise, &Expected);
+    Wordwise = RunDigest(CF_CRC_Digest, &Result);
+
+    printf("%lu MB in %u byte PDUs\n", (unsigned long)(BenchSize >> 20), (unsigned int)BENCH_PDU_SIZE);
+    printf("digest  byte at a time %8.0f MB/s, word at a time %8.0f MB/s, results %s\n", BenchSize / Bytewise / 1e6,
+           BenchSize / Wordwise / 1e6, Result == Expected ? "match" : "DIFFER");
+
+    printf("\n%-16s %12s %14s %9s %14s %8s\n", "receive", "recv (ms)", "EOF-FIN (ms)", "wakeups", "at 10 Hz (s)",
+           "checksum");
+    for (i = 0; i < BENCH_NUM_CASES; i++)
+    {
+        RunReceive(i, &Recv, &Fin, &Wakeups, &Result);
+
+        printf("%-16s %12.1f %14.1f %9u %14.1f %8s\n", Names[i], Recv * 1e3, Fin * 1e3, (unsigned int)Wakeups,
+               (double)Wakeups / BENCH_TICKS_PER_SECOND, Result == Expected ? "ok" : "WRONG");
+    }
+
+    OS_remove(BENCH_VIRT_FILE);
+    free(BenchData);
+
+    OS_ApplicationExit(0);
+}
@@ -0,0 +1,284 @@
+/**
+ * @file
+ *
+ * Measures how the cost of matching a received PDU to its transaction, and
+ * of queueing a transaction by priority, grows with the number of active
+ * transactions on a channel.
+ *
+ * For each number of transactions, a channel is filled the way the engine
+ * does it: half receive transactions on Q_RX, the rest class 2 sends on
+ * Q_PEND (by CF_InsertSortPrio) and Q_TXW, all in the transaction index.
+ * Lookups of random active (source EID, sequence number) pairs are then
+ * timed with:
+ *
+ * - "queue scan": CF_CList_Traverse over Q_RX, Q_PEND, Q_TXA and Q_TXW, as
+ *   CF_FindTransactionBySequenceNumber did before the index;
+ * - "index": the current CF_FindTransactionBySequenceNumber.
+ *
+ * The cost per CF_InsertSortPrio on the pending queue is also given, for
+ * transactions all at one priority and at random priorities.
+ *
+ * cf_utils.c and cf_clist.c are linked as is.  The number of transactions is
+ * bounded by CF_NUM_TRANSACTIONS_PER_CHANNEL, so to look at hundreds of them
+ * raise CF_MAX_SIMULTANEOUS_RX in the cf configuration of the build.  Build
+ * with the CF_BENCH cmake option, or by hand with the same include paths as
+ * the cf app:
+ *
+ *   cc -O2 -I../fsw/inc -I../fsw/src -I<cfe, osal and cf config includes> cf_txn_bench.c \
+ *      ../fsw/src/cf_utils.c ../fsw/src/cf_clist.c -L<osal build dir> -losal -losal_bsp -lpthread -lrt -o cf_txn_bench
+ *
+ * and run as "cf_txn_bench [lookups]".
+ */
+
+#include "cfe.h"
+#include "cf_app.h"
+#include "cf_utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_LOCAL_EID   25
+#define BENCH_NUM_PEERS   4
+#define BENCH_PRIO_INSERT 1000
+
+typedef struct
+{
+    CF_TransactionSeq_t seq_num;
+    CF_EntityId_t       src_eid;
+} Bench_Key_t;
+
+typedef struct
+{
+    CF_TransactionSeq_t transaction_sequence_number;
+    CF_EntityId_t       src_eid;
+    CF_Transaction_t *  txn;
+} Bench_ScanArg_t;
+
+CF_AppData_t CF_AppData;
+
+static Bench_Key_t BenchKeys[CF_NUM_TRANSACTIONS_PER_CHANNEL];
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+/* the free and history queues of channel 0, as CF_CFDP_InitEngine leaves them */
+static void InitChannel(void)
+{
+    uint32 i;
+
+    memset(&CF_AppData.engine, 0, sizeof(CF_AppData.engine));
+    memset(&CF_AppData.hk, 0, sizeof(CF_AppData.hk));
+
+    for (i = 0; i < CF_NUM_TRANSACTIONS_PER_CHANNEL; ++i)
+    {
+        CF_AppData.engine.transactions[i].chan_num = 0;
+        CF_FreeTransaction(&CF_AppData.engine.transactions[i]);
+    }
+
+    for (i = 0; i < CF_NUM_HISTORIES_PER_CHANNEL; ++i)
+    {
+        CF_CList_InitNode(&CF_AppData.engine.histories[i].cl_node);
+        CF_CList_InsertBack_Ex(&CF_AppData.engine.channels[0], CF_QueueIdx_HIST_FREE,
+                               &CF_AppData.engine.histories[i].cl_node);
+    }
+}
+
+static void FillChannel(uint32 NumTxns)
+{
+    CF_Channel_t *    chan = &CF_AppData.engine.channels[0];
+    CF_Transaction_t *txn;
+    uint32            i;
+
+    InitChannel();
+
+    for (i = 0; i < NumTxns; ++i)
+    {
+        txn = CF_FindUnusedTransaction(chan);
+
+        if (i & 1)
+        {
+            txn->state            = CF_TxnState_R2;
+            txn->history->src_eid = 1 + (i % BENCH_NUM_PEERS);
+            txn->history->seq_num = 1000 + i;
+            CF_InsertTransactionHash(txn);
+            CF_CList_InsertBack_Ex(chan, CF_QueueIdx_RX, &txn->cl_node);
+            txn->flags.com.q_index = CF_QueueIdx_RX;
+        }
+        else
+        {
+            txn->state            = CF_TxnState_S2;
+            txn->priority         = rand() % 256;
+            txn->history->src_eid = BENCH_LOCAL_EID;
+            txn->history->seq_num = i;
+            CF_InsertTransactionHash(txn);
+            if (i & 2)
+            {
+                CF_CList_InsertBack_Ex(chan, CF_QueueIdx_TXW, &txn->cl_node);
+                txn->flags.com.q_index = CF_QueueIdx_TXW;
+            }
+            else
+            {
+                CF_InsertSortPrio(txn, CF_QueueIdx_PEND);
+            }
+        }
+
+        BenchKeys[i].seq_num = txn->history->seq_num;
+        BenchKeys[i].src_eid = txn->history->src_eid;
+    }
+}
+
+/* the queue traversal callback CF_FindTransactionBySequenceNumber used before the index */
+static CF_CListTraverse_Status_t BenchScanMatch(CF_CListNode_t *node, void *context)
+{
+    CF_Transaction_t *txn = container_of(node, CF_Transaction_t, cl_node);
+    Bench_ScanArg_t * arg = context;
+
+    if ((txn->history->src_eid == arg->src_eid) && (txn->history->seq_num == arg->transaction_sequence_number))
+    {
+        arg->txn = txn;
+        return CF_CLIST_EXIT;
+    }
+
+    return CF_CLIST_CONT;
+}
+
+static CF_Transaction_t *BenchScanLookup(CF_Channel_t *chan, CF_TransactionSeq_t transaction_sequence_number,
+                                         CF_EntityId_t src_eid)
+{
+    Bench_ScanArg_t ctx    = {transaction_sequence_number, src_eid, NULL};
+    CF_CListNode_t *ptrs[] = {chan->qs[CF_QueueIdx_RX], chan->qs[CF_QueueIdx_PEND], chan->qs[CF_QueueIdx_TXA],
+                              chan->qs[CF_QueueIdx_TXW]};
+    size_t          i;
+
+    for (i = 0; i < (sizeof(ptrs) / sizeof(ptrs[0])) && ctx.txn == NULL; ++i)
+    {
+        CF_CList_Traverse(ptrs[i], BenchScanMatch, &ctx);
+    }
+
+    return ctx.txn;
+}
+
+static double RunLookups(uint32 NumTxns, long Lookups, bool Scan, long *FoundPtr)
+{
+    CF_Channel_t *     chan  = &CF_AppData.engine.channels[0];
+    long               Found = 0;
+    const Bench_Key_t *Key;
+    CF_Transaction_t * txn;
+    double             Start;
+    long               n;
+
+    srand(2);
+    Start = Now();
+    for (n = 0; n < Lookups; ++n)
+    {
+        Key = &BenchKeys[rand() % NumTxns];
+        if (Scan)
+        {
+            txn = BenchScanLookup(chan, Key->seq_num, Key->src_eid);
+        }
+        else
+        {
+            txn = CF_FindTransactionBySequenceNumber(chan, Key->seq_num, Key->src_eid);
+        }
+        Found += (txn != NULL);
+    }
+
+    *FoundPtr = Found;
+    return (Now() - Start) / Lookups;
+}
+
+static double RunPrioInserts(uint32 NumTxns, bool SamePrio)
+{
+    CF_Channel_t *    chan = &CF_AppData.engine.channels[0];
+    CF_Transaction_t *txn;
+    double            Elapsed = 0;
+    double            Start;
+    uint32            r;
+    uint32            i;
+
+    InitChannel();
+    for (i = 0; i < NumTxns; ++i)
+    {
+        txn           = CF_FindUnusedTransaction(chan);
+        txn->state    = CF_TxnState_S2;
+        txn->priority = SamePrio ? 0 : rand() % 256;
+    }
+
+    for (r = 0; r < BENCH_PRIO_INSERT; ++r)
+    {
+        Start = Now();
+        for (i = 0; i < NumTxns; ++i)
+        {
+            CF_InsertSortPrio(&CF_AppData.engine.transactions[i], CF_QueueIdx_PEND);
+        }
+        Elapsed += Now() - Start;
+
+        for (i = 0; i < NumTxns; ++i)
+        {
+            CF_CList_Remove_Ex(chan, CF_QueueIdx_PEND, &CF_AppData.engine.transactions[i].cl_node);
+        }
+    }
+
+    return Elapsed / ((double)BENCH_PRIO_INSERT * NumTxns);
+}
+
+void OS_Application_Startup(void)
+{
+    char *const *ArgV    = OS_BSP_GetArgV();
+    uint32       ArgC    = OS_BSP_GetArgC();
+    long         Lookups = ArgC > 1 ? atol(ArgV[1]) : 1000000;
+    long         ScanFound;
+    long         IndexFound;
+    double       Scan;
+    double       Index;
+    double       SamePrio;
+    double       RandPrio;
+    uint32       NumTxns;
+
+    printf("%u transactions per channel, %ld lookups per case\n", (unsigned int)CF_NUM_TRANSACTIONS_PER_CHANNEL,
+           Lookups);
+    printf("%6s %17s %17s %20s %20s\n", "txns", "queue scan (ns)", "index (ns)", "insert one prio (ns)",
+           "insert rand prio (ns)");
+
+    for (NumTxns = 4;; NumTxns *= 2)
+    {
+        if (NumTxns > CF_NUM_TRANSACTIONS_PER_CHANNEL)
+        {
+            NumTxns = CF_NUM_TRANSACTIONS_PER_CHANNEL;
+        }
+
+        FillChannel(NumTxns);
+        Scan  = RunLookups(NumTxns, Lookups, true, &ScanFound);
+        Index = RunLookups(NumTxns, Lookups, false, &IndexFound);
+
+        SamePrio = RunPrioInserts(NumTxns, true);
+        RandPrio = RunPrioInserts(NumTxns, false);
+
+        printf("%6u %17.1f %17.1f %20.1f %20.1f%s\n", (unsigned int)NumTxns, Scan * 1e9, Index * 1e9, SamePrio * 1e9,
+               RandPrio * 1e9, (ScanFound == Lookups && IndexFound == Lookups) ? "" : "  MISSED LOOKUPS");
+
+        if (NumTxns == CF_NUM_TRANSACTIONS_PER_CHANNEL)
+        {
+            break;
+        }
+    }
+
+    OS_ApplicationExit(0);
+}
+
+/*
+ * Minimal shims for the cFE calls made by cf_utils.c
+ */
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    return CFE_SUCCESS;
+}
+
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit) {}
@@ -856,6 +856,7 @@ void CF_CFDP_RecvIdle(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
      * in this case, they are the same */
     txn->history->peer_eid = ph->pdu_header.source_eid;
     txn->history->src_eid  = ph->pdu_header.source_eid;
+    CF_InsertTransactionHash(txn);
 
     txn->chunks = CF_CFDP_FindUnusedChunks(&CF_AppData.engine.channels[txn->chan_num], CF_Direction_RX);
 
@@ -1245,6 +1246,7 @@ static void CF_CFDP_TxFile_Initiate(CF_Transaction_t *txn, CF_CFDP_Class_t cfdp_
     txn->history->seq_num  = CF_AppData.engine.seq_num;
     txn->history->src_eid  = CF_AppData.config_table->local_eid;
     txn->history->peer_eid = dest_id;
+    CF_InsertTransactionHash(txn);
 
     CF_CFDP_ArmInactTimer(txn);
 
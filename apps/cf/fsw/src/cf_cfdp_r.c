@@ -422,9 +422,16 @@ void CF_CFDP_R2_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
 
     if (ret == CFE_SUCCESS)
     {
-        /* class 2 does CRC at FIN, but track gaps */
+        /* class 2 checks the CRC at FIN, but track gaps */
         CF_ChunkListAdd(&txn->chunks->chunks, fd->offset, fd->data_len);
 
+        /* digest data that continues the file from its start now, so only the rest is read back at FIN */
+        if (fd->offset == txn->state_data.receive.r2.rx_crc_calc_bytes)
+        {
+            CF_CRC_Digest(&txn->crc, fd->data_ptr, fd->data_len);
+            txn->state_data.receive.r2.rx_crc_calc_bytes += fd->data_len;
+        }
+
         if (txn->flags.rx.fd_nak_sent)
         {
             CF_CFDP_R2_Complete(txn, 0); /* once nak-retransmit received, start checking for completion at each fd */
@@ -632,6 +639,12 @@ CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
     count_bytes = 0;
     ret         = CF_ERROR;
 
+    if (txn->state_data.receive.r2.rx_crc_calc_bytes > txn->fsize)
+    {
+        /* data past the end of the file was digested as it arrived, so start over */
+        txn->state_data.receive.r2.rx_crc_calc_bytes = 0;
+    }
+
     if (txn->state_data.receive.r2.rx_crc_calc_bytes == 0)
     {
         CF_CRC_Start(&txn->crc);
@@ -263,9 +263,11 @@ void CF_CFDP_R1_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
  * @par Description
  *       For R2, the CRC is checked after the whole file is received
  *       since there may be gaps. Instead, insert file received range
- *       data into chunks. Once NAK has been received, this function
- *       always checks for completion. This function also re-arms
- *       the ACK timer.
+ *       data into chunks. Data that continues the file in order from
+ *       its start is digested as it arrives, so the CRC check only
+ *       reads back the file from the first gap. Once NAK has been
+ *       received, this function always checks for completion. This
+ *       function also re-arms the ACK timer.
  *
  * @par Assumptions, External Events, and Notes:
  *       txn must not be NULL. ph must not be NULL.
@@ -315,8 +317,10 @@ CFE_Status_t CF_CFDP_R_SubstateSendNak(CF_Transaction_t *txn);
  * @par Description
  *       The configuration table has a number of bytes to calculate per
  *       transaction per wakeup. At each wakeup, the file is read and
- *       this number of bytes are calculated. This function will set
- *       the checksum error condition code if the final CRC does not match.
+ *       this number of bytes are calculated. The calculation resumes
+ *       after any file data that was digested on receipt. This function
+ *       will set the checksum error condition code if the final CRC does
+ *       not match.
  *
  * @par PTFO
  *       Increase throughput by consuming all CRC bytes per wakeup in
@@ -50,6 +50,14 @@
      ((CF_MAX_POLLING_DIR_PER_CHAN + CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN) * \
       CF_NUM_TRANSACTIONS_PER_PLAYBACK))
 
+/**
+ * @brief Number of buckets in the per-channel transaction index
+ *
+ * Active transactions are indexed by (source EID, sequence number) so that
+ * received PDUs can be matched to their transaction without scanning the queues.
+ */
+#define CF_TRANSACTION_HASH_SIZE (CF_NUM_TRANSACTIONS_PER_CHANNEL)
+
 /**
  * @brief Maximum possible number of transactions that may exist in the CF application
  */
@@ -251,7 +259,7 @@ typedef struct CF_RxS2_Data
 {
     uint32                    eof_crc;
     uint32                    eof_size;
-    uint32                    rx_crc_calc_bytes;
+    uint32                    rx_crc_calc_bytes; /**< \brief bytes from the start of the file digested into crc */
     CF_CFDP_FinDeliveryCode_t dc;
     CF_CFDP_FinFileStatus_t   fs;
     uint8                     eof_cc; /**< \brief remember the cc in the received EOF PDU to echo in eof-ack */
@@ -279,6 +287,7 @@ typedef struct CF_Flags_Common
     bool  suspended;
     bool  canceled;
     bool  crc_calc;
+    bool  indexed; /**< \brief set while the transaction is in the channel transaction index */
 } CF_Flags_Common_t;
 
 /**
@@ -354,6 +363,8 @@ typedef struct CF_Transaction
 
     CF_CListNode_t cl_node;
 
+    struct CF_Transaction *hash_next; /**< \brief next transaction in the same index bucket */
+
     CF_Playback_t *pb; /**< \brief NULL if transaction does not belong to a playback */
 
     CF_StateData_t state_data;
@@ -407,6 +418,8 @@ typedef struct CF_Channel
 
     const CF_Transaction_t *cur; /**< \brief current transaction during channel cycle */
 
+    CF_Transaction_t *txn_hash[CF_TRANSACTION_HASH_SIZE]; /**< \brief active transactions by (src_eid, seq_num) */
+
     uint8 tick_type;
 } CF_Channel_t;
 
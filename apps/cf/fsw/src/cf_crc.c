@@ -33,6 +33,10 @@
 #include "cf_crc.h"
 #include <string.h>
 
+/* The big-endian 32-bit word at p, as the checksum adds the data in network byte order */
+#define CF_CRC_WORD(p) \
+    (((uint32)(p)[0] << 24) | ((uint32)(p)[1] << 16) | ((uint32)(p)[2] << 8) | (uint32)(p)[3])
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -52,21 +56,49 @@ void CF_CRC_Start(CF_Crc_t *crc)
  *-----------------------------------------------------------------*/
 void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len)
 {
-    size_t i = 0;
+    uint32 working = crc->working;
+    uint32 result  = crc->result;
+    uint8  index   = crc->index;
+    size_t i       = 0;
 
-    for (; i < len; ++i)
+    /* shift in bytes until the stream is at a 4-byte word boundary */
+    for (; index != 0 && i < len; ++i)
     {
-        crc->working <<= 8;
-        crc->working |= data[i];
+        working = (working << 8) | data[i];
 
-        ++crc->index;
+        ++index;
 
-        if (crc->index == 4)
+        if (index == 4)
         {
-            crc->result += crc->working;
-            crc->index = 0;
+            result += working;
+            index = 0;
         }
     }
+
+    /* then add whole words, four at a time while there is enough data */
+    for (; (len - i) >= 16; i += 16)
+    {
+        result += CF_CRC_WORD(&data[i]) + CF_CRC_WORD(&data[i + 4]) + CF_CRC_WORD(&data[i + 8]);
+        working = CF_CRC_WORD(&data[i + 12]);
+        result += working;
+    }
+
+    for (; (len - i) >= 4; i += 4)
+    {
+        working = CF_CRC_WORD(&data[i]);
+        result += working;
+    }
+
+    /* any remaining bytes are kept in the shift register */
+    for (; i < len; ++i)
+    {
+        working = (working << 8) | data[i];
+        ++index;
+    }
+
+    crc->working = working;
+    crc->result  = result;
+    crc->index   = index;
 }
 
 /*----------------------------------------------------------------
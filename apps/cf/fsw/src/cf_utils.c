@@ -101,6 +101,7 @@ void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history)
 void CF_FreeTransaction(CF_Transaction_t *txn)
 {
     uint8 chan = txn->chan_num;
+    CF_RemoveTransactionHash(txn);
     memset(txn, 0, sizeof(*txn));
     txn->flags.com.q_index = CF_QueueIdx_FREE;
     txn->fd                = OS_OBJECT_ID_UNDEFINED;
@@ -110,24 +111,73 @@ void CF_FreeTransaction(CF_Transaction_t *txn)
     CF_CList_InsertBack_Ex(&CF_AppData.engine.channels[chan], CF_QueueIdx_FREE, &txn->cl_node);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Selects the index bucket for a (source EID, sequence number) pair.  Sequence
+ * numbers from a single source are consecutive, so they spread evenly on their own,
+ * and the multiplier keeps different sources from colliding on the same run.
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32 CF_TransactionHashIndex(CF_TransactionSeq_t transaction_sequence_number, CF_EntityId_t src_eid)
+{
+    return ((uint32)transaction_sequence_number + ((uint32)src_eid * 0x9E3779B1U)) % CF_TRANSACTION_HASH_SIZE;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_InsertTransactionHash(CF_Transaction_t *txn)
+{
+    CF_Transaction_t **bucket;
+
+    CF_Assert(txn->chan_num < CF_NUM_CHANNELS);
+    CF_Assert(!txn->flags.com.indexed);
+
+    bucket = &CF_AppData.engine.channels[txn->chan_num]
+                  .txn_hash[CF_TransactionHashIndex(txn->history->seq_num, txn->history->src_eid)];
+
+    txn->hash_next         = *bucket;
+    *bucket                = txn;
+    txn->flags.com.indexed = true;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context)
+void CF_RemoveTransactionHash(CF_Transaction_t *txn)
 {
-    CF_Transaction_t *txn = container_of(node, CF_Transaction_t, cl_node);
-    CFE_Status_t      ret = 0;
+    CF_Transaction_t **link;
 
-    if ((txn->history->src_eid == context->src_eid) && (txn->history->seq_num == context->transaction_sequence_number))
+    if (txn->flags.com.indexed)
     {
-        context->txn = txn;
-        ret          = 1; /* exit early */
-    }
+        CF_Assert(txn->chan_num < CF_NUM_CHANNELS);
 
-    return ret;
+        link = &CF_AppData.engine.channels[txn->chan_num]
+                    .txn_hash[CF_TransactionHashIndex(txn->history->seq_num, txn->history->src_eid)];
+
+        while (*link != NULL && *link != txn)
+        {
+            link = &(*link)->hash_next;
+        }
+
+        CF_Assert(*link == txn);
+
+        if (*link == txn)
+        {
+            *link = txn->hash_next;
+        }
+
+        txn->hash_next         = NULL;
+        txn->flags.com.indexed = false;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -140,27 +190,17 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
                                                      CF_TransactionSeq_t transaction_sequence_number,
                                                      CF_EntityId_t       src_eid)
 {
-    /* need to find transaction by sequence number. It will either be the active transaction (front of Q_PEND),
-     * or on Q_TX or Q_RX. Once a transaction moves to history, then it's done.
-     *
-     * Let's put CF_QueueIdx_RX up front, because most RX packets will be file data PDUs */
-    CF_Traverse_TransSeqArg_t ctx    = {transaction_sequence_number, src_eid, NULL};
-    CF_CListNode_t *          ptrs[] = {chan->qs[CF_QueueIdx_RX], chan->qs[CF_QueueIdx_PEND], chan->qs[CF_QueueIdx_TXA],
-                              chan->qs[CF_QueueIdx_TXW]};
-    int                       i;
-    CF_Transaction_t *        ret = NULL;
-
-    for (i = 0; i < (sizeof(ptrs) / sizeof(ptrs[0])); ++i)
+    /* every transaction on Q_RX, Q_PEND, Q_TXA or Q_TXW is in the index. Once a transaction moves to
+     * history, then it's done and it is no longer indexed. */
+    CF_Transaction_t *txn = chan->txn_hash[CF_TransactionHashIndex(transaction_sequence_number, src_eid)];
+
+    while (txn != NULL &&
+           (txn->history->seq_num != transaction_sequence_number || txn->history->src_eid != src_eid))
     {
-        CF_CList_Traverse(ptrs[i], (CF_CListFn_t)CF_FindTransactionBySequenceNumber_Impl, &ctx);
-        if (ctx.txn)
-        {
-            ret = ctx.txn;
-            break;
-        }
+        txn = txn->hash_next;
     }
 
-    return ret;
+    return txn;
 }
 
 /*----------------------------------------------------------------
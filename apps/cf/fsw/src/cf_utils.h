@@ -30,19 +30,6 @@
 #include "cf_app.h"
 #include "cf_assert.h"
 
-/**
- * @brief Argument structure for use with CList_Traverse()
- *
- * This identifies a specific transaction sequence number and entity ID
- * The transaction pointer is set by the implementation
- */
-typedef struct CF_Traverse_TransSeqArg
-{
-    CF_TransactionSeq_t transaction_sequence_number;
-    CF_EntityId_t       src_eid;
-    CF_Transaction_t *  txn; /**< \brief output transaction pointer */
-} CF_Traverse_TransSeqArg_t;
-
 /**
  * @brief Argument structure for use with CF_Traverse_WriteHistoryQueueEntryToFile()
  *
@@ -196,12 +183,38 @@ void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history);
  */
 void CF_FreeTransaction(CF_Transaction_t *txn);
 
+/************************************************************************/
+/** @brief Adds a transaction to the channel transaction index.
+ *
+ * @par Description
+ *       The transaction is indexed by the source EID and sequence number
+ *       in its history, so these must be set before calling this function.
+ *       The transaction remains indexed until it is freed.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. txn->history must not be NULL.
+ *
+ * @param txn Pointer to the transaction object
+ */
+void CF_InsertTransactionHash(CF_Transaction_t *txn);
+
+/************************************************************************/
+/** @brief Removes a transaction from the channel transaction index.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. Does nothing if the transaction is not indexed.
+ *
+ * @param txn Pointer to the transaction object
+ */
+void CF_RemoveTransactionHash(CF_Transaction_t *txn);
+
 /************************************************************************/
 /** @brief Finds an active transaction by sequence number.
  *
  * @par Description
- *       This function traverses the active rx, pending, txa, and txw
- *       transaction and looks for the requested transaction.
+ *       This function looks up the requested transaction in the channel
+ *       transaction index, which holds every active rx, pending, txa,
+ *       and txw transaction.
  *
  * @par Assumptions, External Events, and Notes:
  *       chan must not be NULL.
@@ -217,21 +230,6 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
                                                      CF_TransactionSeq_t transaction_sequence_number,
                                                      CF_EntityId_t       src_eid);
 
-/************************************************************************/
-/** @brief List traversal function to check if the desired sequence number matches.
- *
- * @par Assumptions, External Events, and Notes:
- *       context must not be NULL. node must not be NULL.
- *
- * @param node         Pointer to node currently being traversed
- * @param context   Pointer to state object passed through from initial call
- *
- * @retval 1 when it's found, which terminates list traversal
- * @retval 0 when it isn't found, which causes list traversal to continue
- *
- */
-CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context);
-
 /************************************************************************/
 /** @brief Write a single history to a file.
  *
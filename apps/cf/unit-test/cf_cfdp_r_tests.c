@@ -766,17 +766,33 @@ void Test_CF_CFDP_R2_SubstateRecvFileData(void)
     /* nominal */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     txn->state_data.receive.r2.acknak_count = 1; /* make nonzero so it can be checked */
+    ph->int_header.fd.data_len              = 10;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, ph->int_header.fd.data_len);
     UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
     UtAssert_STUB_COUNT(CF_ChunkListAdd, 1);
     UtAssert_ZERO(txn->state_data.receive.r2.acknak_count); /* this resets the counter */
     UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 1);
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 1); /* in order data is digested on receipt */
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.rx_crc_calc_bytes, 10);
+
+    /* out of order data is left for the CRC calculation at FIN */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->state_data.receive.r2.rx_crc_calc_bytes = 10;
+    ph->int_header.fd.offset                     = 20;
+    ph->int_header.fd.data_len                   = 10;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, ph->int_header.fd.offset);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, ph->int_header.fd.data_len);
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_ChunkListAdd, 2);
+    UtAssert_STUB_COUNT(CF_CRC_Digest, 1);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.rx_crc_calc_bytes, 10);
 
     /* with fd_nak_sent flag */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     txn->state_data.receive.r2.acknak_count = 1; /* make nonzero so it can be checked */
     txn->flags.rx.fd_nak_sent               = true;
     UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
-    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 3);
     UtAssert_ZERO(txn->state_data.receive.r2.acknak_count); /* this resets the counter */
 
     /* with rx.complete flag */
@@ -784,7 +800,7 @@ void Test_CF_CFDP_R2_SubstateRecvFileData(void)
     txn->state_data.receive.r2.acknak_count = 1; /* make nonzero so it can be checked */
     txn->flags.rx.complete                  = true;
     UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
-    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 2);            /* does NOT increment here */
+    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 3);            /* does NOT increment here */
     UtAssert_ZERO(txn->state_data.receive.r2.acknak_count); /* this resets the counter */
 
     /* failure in CF_CFDP_RecvFd (bad packet) */
@@ -956,6 +972,31 @@ void Test_CF_CFDP_R2_CalcCrcChunk(void)
     UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
     UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
 
+    /* whole file already digested as it was received, nothing to read */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, &config);
+    config->rx_crc_calc_bytes_per_wakeup         = 100;
+    txn->fsize                                   = 50;
+    txn->state_data.receive.r2.rx_crc_calc_bytes = 50;
+    UT_ResetState(UT_KEY(CF_WrappedRead));
+    UT_ResetState(UT_KEY(CF_CRC_Start));
+    UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
+    UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 0);
+    UtAssert_STUB_COUNT(CF_CRC_Start, 0);
+
+    /* data past the file size was digested on receipt, so the file is read from the start */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, &config);
+    config->rx_crc_calc_bytes_per_wakeup         = 100;
+    txn->fsize                                   = 50;
+    txn->state_data.receive.r2.rx_crc_calc_bytes = 60;
+    txn->state_data.receive.cached_pos           = 60;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, txn->fsize);
+    UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
+    UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
+    UtAssert_STUB_COUNT(CF_CRC_Start, 1);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.rx_crc_calc_bytes, 50);
+
     /* failure of read */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, &config);
     config->rx_crc_calc_bytes_per_wakeup = 100;
@@ -488,6 +488,7 @@ void Test_CF_CFDP_RecvIdle(void)
     ph->pdu_header.txm_mode = 1; /* class 1 */
     UtAssert_VOIDCALL(CF_CFDP_RecvIdle(txn, ph));
     UtAssert_INT32_EQ(txn->state, CF_TxnState_DROP);
+    UtAssert_STUB_COUNT(CF_InsertTransactionHash, 1);
 
     /* nominal call, file data, class 2 */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, &history, &txn, NULL);
@@ -928,6 +929,7 @@ void Test_CF_CFDP_TxFile(void)
     UtAssert_STRINGBUF_EQ(dest, -1, history->fnames.dst_filename, sizeof(history->fnames.dst_filename));
     UtAssert_STRINGBUF_EQ(src, -1, history->fnames.src_filename, sizeof(history->fnames.src_filename));
     UtAssert_UINT32_EQ(chan->num_cmd_tx, 1);
+    UtAssert_STUB_COUNT(CF_InsertTransactionHash, 1);
     UT_CF_AssertEventID(CF_CFDP_S_START_SEND_INF_EID);
 
     /* same but for class 2 (for branch coverage) */
@@ -57,6 +57,41 @@ void Test_CF_CRC_Digest(void)
     UtAssert_UINT32_EQ(crc.index, 1);
 }
 
+void Test_CF_CRC_Digest_Words(void)
+{
+    CF_Crc_t crc;
+    uint8    data[61];
+    uint32   expected;
+    size_t   i;
+    size_t   split;
+
+    /* Reference: each byte is added at its position within a big-endian word */
+    expected = 0;
+    for (i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = (uint8)(i * 37 + 11);
+        expected += (uint32)data[i] << (8 * (3 - (i & 3)));
+    }
+
+    /* Result must not depend on how the data is split between calls */
+    for (split = 0; split <= sizeof(data); ++split)
+    {
+        CF_CRC_Start(&crc);
+        CF_CRC_Digest(&crc, data, split);
+        CF_CRC_Digest(&crc, &data[split], sizeof(data) - split);
+        CF_CRC_Finalize(&crc);
+
+        /* In order to not "flood" with test results, only report a failure */
+        if (crc.result != expected)
+        {
+            UtAssert_Failed("CRC of data split at %lu is 0x%08lx, expected 0x%08lx", (unsigned long)split,
+                            (unsigned long)crc.result, (unsigned long)expected);
+        }
+    }
+
+    UtAssert_UINT32_EQ(crc.result, expected);
+}
+
 void Test_CF_CRC_Finalize(void)
 {
     CF_Crc_t crc;
@@ -85,5 +120,6 @@ void UtTest_Setup(void)
 {
     TEST_CF_ADD(Test_CF_CRC_Start);
     TEST_CF_ADD(Test_CF_CRC_Digest);
+    TEST_CF_ADD(Test_CF_CRC_Digest_Words);
     TEST_CF_ADD(Test_CF_CRC_Finalize);
 }
@@ -100,18 +100,6 @@ static void UT_Callback_CF_TraverseAllTransactions(CF_Transaction_t *txn, void *
     }
 }
 
-/*----------------------------------------------------------------
- *
- * A simple handler that just sets the "txn" output in the state object
- *
- *-----------------------------------------------------------------*/
-static void UT_AltHandler_CF_CList_Traverse_SeqArg_SetTxn(void *UserObj, UT_EntryKey_t FuncKey,
-                                                          const UT_StubContext_t *Context)
-{
-    CF_Traverse_TransSeqArg_t *arg = UT_Hook_GetArgValueByName(Context, "context", CF_Traverse_TransSeqArg_t *);
-    arg->txn                       = UserObj;
-}
-
 /*******************************************************************************
 **
 **  cf_utils.h function tests
@@ -179,54 +167,126 @@ void Test_CF_FreeTransaction(void)
 
     UtAssert_UINT32_EQ(txn->state, CF_TxnState_IDLE);
     UtAssert_UINT32_EQ(txn->flags.com.q_index, CF_QueueIdx_FREE);
+
+    /* an indexed transaction is no longer found once freed */
+    txn->history          = &CF_AppData.engine.histories[0];
+    txn->history->src_eid = 12;
+    txn->history->seq_num = 34;
+    CF_InsertTransactionHash(txn);
+    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(&CF_AppData.engine.channels[UT_CFDP_CHANNEL], 34, 12), txn);
+
+    UtAssert_VOIDCALL(CF_FreeTransaction(txn));
+    UtAssert_BOOL_FALSE(txn->flags.com.indexed);
+    UtAssert_NULL(CF_FindTransactionBySequenceNumber(&CF_AppData.engine.channels[UT_CFDP_CHANNEL], 34, 12));
 }
 
-void Test_CF_FindTransactionBySequenceNumber_Impl(void)
+void Test_CF_InsertTransactionHash(void)
 {
     /* Test case for:
-     * int CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context)
+     * void CF_InsertTransactionHash(CF_Transaction_t *txn)
      */
-    CF_Traverse_TransSeqArg_t ctxt;
-    CF_Transaction_t          txn;
-    CF_History_t              hist;
-
-    memset(&txn, 0, sizeof(txn));
-    memset(&hist, 0, sizeof(hist));
-    memset(&ctxt, 0, sizeof(ctxt));
+    CF_Transaction_t *txn1;
+    CF_Transaction_t *txn2;
+    CF_History_t      hist1;
+    CF_History_t      hist2;
+    CF_Channel_t *    chan;
+    uint32            i;
+    uint32            count;
 
-    txn.history = &hist;
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    memset(&hist1, 0, sizeof(hist1));
+    memset(&hist2, 0, sizeof(hist2));
+    chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    txn1 = &CF_AppData.engine.transactions[0];
+    txn2 = &CF_AppData.engine.transactions[1];
+
+    txn1->chan_num = UT_CFDP_CHANNEL;
+    txn1->history  = &hist1;
+    hist1.src_eid  = 12;
+    hist1.seq_num  = 34;
+    txn2->chan_num = UT_CFDP_CHANNEL;
+    txn2->history  = &hist2;
+    hist2.src_eid  = 12;
+    hist2.seq_num  = 34 + CF_TRANSACTION_HASH_SIZE; /* same bucket as txn1 */
+
+    UtAssert_VOIDCALL(CF_InsertTransactionHash(txn1));
+    UtAssert_BOOL_TRUE(txn1->flags.com.indexed);
+    UtAssert_NULL(txn1->hash_next);
+
+    /* colliding entries are chained at the head of the bucket */
+    UtAssert_VOIDCALL(CF_InsertTransactionHash(txn2));
+    UtAssert_BOOL_TRUE(txn2->flags.com.indexed);
+    UtAssert_ADDRESS_EQ(txn2->hash_next, txn1);
+
+    count = 0;
+    for (i = 0; i < CF_TRANSACTION_HASH_SIZE; ++i)
+    {
+        if (chan->txn_hash[i] != NULL)
+        {
+            ++count;
+            UtAssert_ADDRESS_EQ(chan->txn_hash[i], txn2);
+        }
+    }
+    UtAssert_UINT32_EQ(count, 1);
+}
 
-    /* non-matching eid and non-matching sequence */
-    hist.src_eid                     = 12;
-    ctxt.src_eid                     = 34;
-    hist.seq_num                     = 56;
-    ctxt.transaction_sequence_number = 78;
-    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.cl_node, &ctxt), 0);
-    UtAssert_NULL(ctxt.txn);
+void Test_CF_RemoveTransactionHash(void)
+{
+    /* Test case for:
+     * void CF_RemoveTransactionHash(CF_Transaction_t *txn)
+     */
+    CF_Transaction_t *txn1;
+    CF_Transaction_t *txn2;
+    CF_Transaction_t *txn3;
+    CF_History_t      hist;
+    CF_Channel_t *    chan;
 
-    /* matching eid and non-matching sequence */
-    hist.src_eid                     = 13;
-    ctxt.src_eid                     = 13;
-    hist.seq_num                     = 56;
-    ctxt.transaction_sequence_number = 78;
-    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.cl_node, &ctxt), 0);
-    UtAssert_NULL(ctxt.txn);
-
-    /* non-matching eid and matching sequence */
-    hist.src_eid                     = 12;
-    ctxt.src_eid                     = 34;
-    hist.seq_num                     = 57;
-    ctxt.transaction_sequence_number = 57;
-    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.cl_node, &ctxt), 0);
-    UtAssert_NULL(ctxt.txn);
-
-    /* matching eid and matching sequence */
-    hist.src_eid                     = 23;
-    ctxt.src_eid                     = 23;
-    hist.seq_num                     = 67;
-    ctxt.transaction_sequence_number = 67;
-    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.cl_node, &ctxt), 1);
-    UtAssert_ADDRESS_EQ(ctxt.txn, &txn);
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    memset(&hist, 0, sizeof(hist));
+    chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    txn1 = &CF_AppData.engine.transactions[0];
+    txn2 = &CF_AppData.engine.transactions[1];
+    txn3 = &CF_AppData.engine.transactions[2];
+
+    /* all share the same keys so they are chained in one bucket */
+    txn1->chan_num = UT_CFDP_CHANNEL;
+    txn1->history  = &hist;
+    txn2->chan_num = UT_CFDP_CHANNEL;
+    txn2->history  = &hist;
+    txn3->chan_num = UT_CFDP_CHANNEL;
+    txn3->history  = &hist;
+    hist.src_eid   = 56;
+    hist.seq_num   = 78;
+
+    /* not indexed, nothing to do */
+    UtAssert_VOIDCALL(CF_RemoveTransactionHash(txn1));
+    UtAssert_BOOL_FALSE(txn1->flags.com.indexed);
+
+    CF_InsertTransactionHash(txn1);
+    CF_InsertTransactionHash(txn2);
+    CF_InsertTransactionHash(txn3);
+
+    /* from the middle of the chain */
+    UtAssert_VOIDCALL(CF_RemoveTransactionHash(txn2));
+    UtAssert_BOOL_FALSE(txn2->flags.com.indexed);
+    UtAssert_NULL(txn2->hash_next);
+    UtAssert_ADDRESS_EQ(txn3->hash_next, txn1);
+
+    /* from the head of the chain */
+    UtAssert_VOIDCALL(CF_RemoveTransactionHash(txn3));
+    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 78, 56), txn1);
+
+    /* the last entry */
+    UtAssert_VOIDCALL(CF_RemoveTransactionHash(txn1));
+    UtAssert_NULL(CF_FindTransactionBySequenceNumber(chan, 78, 56));
+
+    /* flagged as indexed but missing from the bucket, must not corrupt the bucket */
+    CF_InsertTransactionHash(txn1);
+    txn2->flags.com.indexed = true;
+    UtAssert_VOIDCALL(CF_RemoveTransactionHash(txn2));
+    UtAssert_BOOL_FALSE(txn2->flags.com.indexed);
+    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 78, 56), txn1);
+    UtAssert_NULL(txn1->hash_next);
 }
 
 void Test_CF_FindTransactionBySequenceNumber(void)
@@ -236,18 +296,44 @@ void Test_CF_FindTransactionBySequenceNumber(void)
      * transaction_sequence_number, CF_EntityId_t src_eid)
      */
 
-    CF_Transaction_t *txn;
+    CF_Transaction_t *txn1;
+    CF_Transaction_t *txn2;
+    CF_History_t      hist1;
+    CF_History_t      hist2;
     CF_Channel_t *    chan;
 
     memset(&CF_AppData, 0, sizeof(CF_AppData));
+    memset(&hist1, 0, sizeof(hist1));
+    memset(&hist2, 0, sizeof(hist2));
     chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    txn1 = &CF_AppData.engine.transactions[0];
+    txn2 = &CF_AppData.engine.transactions[1];
 
     UtAssert_NULL(CF_FindTransactionBySequenceNumber(chan, 12, 34));
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 4); /* this checks 4 different queues */
 
-    txn = &CF_AppData.engine.transactions[UT_CFDP_CHANNEL];
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse), UT_AltHandler_CF_CList_Traverse_SeqArg_SetTxn, txn);
-    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 12, 34), txn);
+    txn1->chan_num = UT_CFDP_CHANNEL;
+    txn1->history  = &hist1;
+    hist1.src_eid  = 34;
+    hist1.seq_num  = 12;
+    txn2->chan_num = UT_CFDP_CHANNEL;
+    txn2->history  = &hist2;
+    hist2.src_eid  = 34;
+    hist2.seq_num  = 12 + CF_TRANSACTION_HASH_SIZE;
+    CF_InsertTransactionHash(txn1);
+    CF_InsertTransactionHash(txn2);
+
+    /* matching eid and matching sequence, behind another entry in the bucket */
+    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 12, 34), txn1);
+    UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 12 + CF_TRANSACTION_HASH_SIZE, 34), txn2);
+
+    /* matching sequence and non-matching eid */
+    UtAssert_NULL(CF_FindTransactionBySequenceNumber(chan, 12, 35));
+
+    /* matching eid and non-matching sequence */
+    UtAssert_NULL(CF_FindTransactionBySequenceNumber(chan, 13, 34));
+
+    /* not visible on other channels */
+    UtAssert_NULL(CF_FindTransactionBySequenceNumber(&CF_AppData.engine.channels[UT_CFDP_CHANNEL + 1], 12, 34));
 }
 
 /* CF_DequeueTransaction tests */
@@ -1154,8 +1240,10 @@ void add_cf_utils_h_tests(void)
     UtTest_Add(Test_CF_FindUnusedTransaction, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "CF_FindUnusedTransaction");
     UtTest_Add(Test_CF_FreeTransaction, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_FreeTransaction");
-    UtTest_Add(Test_CF_FindTransactionBySequenceNumber_Impl, cf_utils_tests_Setup, cf_utils_tests_Teardown,
-               "CF_FindTransactionBySequenceNumber_Impl");
+    UtTest_Add(Test_CF_InsertTransactionHash, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_InsertTransactionHash");
+    UtTest_Add(Test_CF_RemoveTransactionHash, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_RemoveTransactionHash");
     UtTest_Add(Test_CF_FindTransactionBySequenceNumber, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "CF_FindTransactionBySequenceNumber");
 
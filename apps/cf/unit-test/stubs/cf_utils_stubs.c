@@ -56,23 +56,6 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
     return UT_GenStub_GetReturnValue(CF_FindTransactionBySequenceNumber, CF_Transaction_t *);
 }
 
-/*
- * ----------------------------------------------------
- * Generated stub function for CF_FindTransactionBySequenceNumber_Impl()
- * ----------------------------------------------------
- */
-CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context)
-{
-    UT_GenStub_SetupReturnBuffer(CF_FindTransactionBySequenceNumber_Impl, CFE_Status_t);
-
-    UT_GenStub_AddParam(CF_FindTransactionBySequenceNumber_Impl, CF_CListNode_t *, node);
-    UT_GenStub_AddParam(CF_FindTransactionBySequenceNumber_Impl, CF_Traverse_TransSeqArg_t *, context);
-
-    UT_GenStub_Execute(CF_FindTransactionBySequenceNumber_Impl, Basic, NULL);
-
-    return UT_GenStub_GetReturnValue(CF_FindTransactionBySequenceNumber_Impl, CFE_Status_t);
-}
-
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_FindUnusedTransaction()
@@ -114,6 +97,18 @@ void CF_InsertSortPrio(CF_Transaction_t *txn, CF_QueueIdx_t queue)
     UT_GenStub_Execute(CF_InsertSortPrio, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_InsertTransactionHash()
+ * ----------------------------------------------------
+ */
+void CF_InsertTransactionHash(CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_InsertTransactionHash, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_InsertTransactionHash, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_PrioSearch()
@@ -131,6 +126,18 @@ CF_CListTraverse_Status_t CF_PrioSearch(CF_CListNode_t *node, void *context)
     return UT_GenStub_GetReturnValue(CF_PrioSearch, CF_CListTraverse_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_RemoveTransactionHash()
+ * ----------------------------------------------------
+ */
+void CF_RemoveTransactionHash(CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_RemoveTransactionHash, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_RemoveTransactionHash, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_ResetHistory()
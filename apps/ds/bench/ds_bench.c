@@ -0,0 +1,252 @@
+/**
+ * @file
+ *
+ * Measures the cost of storing packets in a DS destination file, comparing
+ * the DS write buffer with the one OS_write per packet that DS used before
+ * it.  For each packet size the same amount of data is stored:
+ *
+ * - "direct" calls OS_write once per packet on an open OSAL file, which is
+ *   what DS_FileWriteData used to do;
+ * - "buffered" calls DS_FileSetupWrite once per packet, which copies the
+ *   packet into the DS_FILE_WRITE_BUFFER_SIZE byte write buffer and writes
+ *   the buffer out when it fills, then DS_FileCloseDest writes the rest.
+ *
+ * Both go through the real OSAL to a file in the bench directory, so the
+ * OSAL ID lookup done by every OS_write call is part of the measurement.
+ * ds_file.c is linked as is, the cFE calls it makes are replaced by the
+ * minimal shims at the end of this file.  Build with the DS_BENCH cmake
+ * option, or by hand with the same include paths as the ds app:
+ *
+ *   cc -O2 -I../fsw/inc -I../fsw/src -I<cfe and osal includes> ds_bench.c \
+ *      ../fsw/src/ds_file.c -L<osal build dir> -losal -losal_bsp -lpthread -lrt -o ds_bench
+ *
+ * and run as "ds_bench [megabytes] [directory]", by default 16 MB per case
+ * stored in /tmp.  The bench files are removed after each case.
+ */
+
+#include "cfe.h"
+#include "cfe_fs.h"
+#include "ds_platform_cfg.h"
+#include "ds_appdefs.h"
+#include "ds_msg.h"
+#include "ds_app.h"
+#include "ds_file.h"
+#include "ds_table.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_VIRT_DIR "/bench"
+#define BENCH_MAX_PKT  2048
+
+typedef union
+{
+    CFE_SB_Buffer_t SBBuf;
+    uint8           Data[BENCH_MAX_PKT];
+} Bench_Pkt_t;
+
+DS_AppData_t DS_AppData;
+
+static DS_DestFileTable_t      BenchDestTbl;
+static Bench_Pkt_t             BenchPkt;
+static size_t                  BenchPktSize;
+static DS_FileCompletePktBuf_t BenchTlmBuf;
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+static double RunDirect(uint32 Packets)
+{
+    osal_id_t FileHandle;
+    double    Start;
+    double    Elapsed;
+    uint32    i;
+
+    if (OS_OpenCreate(&FileHandle, BENCH_VIRT_DIR "/ds_bench_direct.dat", OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                      OS_READ_WRITE) != OS_SUCCESS)
+    {
+        return 0;
+    }
+
+    Start = Now();
+    for (i = 0; i < Packets; i++)
+    {
+        OS_write(FileHandle, &BenchPkt, BenchPktSize);
+    }
+    OS_close(FileHandle);
+    Elapsed = Now() - Start;
+
+    OS_remove(BENCH_VIRT_DIR "/ds_bench_direct.dat");
+
+    return Elapsed;
+}
+
+static double RunBuffered(uint32 Packets)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[0];
+    char                FileName[DS_TOTAL_FNAME_BUFSIZE];
+    double              Start;
+    double              Elapsed;
+    uint32              i;
+
+    memset(FileStatus, 0, sizeof(*FileStatus));
+    FileStatus->FileHandle = OS_OBJECT_ID_UNDEFINED;
+    FileStatus->FileState  = DS_ENABLED;
+    FileStatus->FileCount  = BenchDestTbl.File[0].SequenceCount;
+
+    Start = Now();
+    for (i = 0; i < Packets; i++)
+    {
+        DS_FileSetupWrite(0, &BenchPkt.SBBuf);
+    }
+    strncpy(FileName, FileStatus->FileName, sizeof(FileName));
+    DS_FileUpdateHeader(0);
+    DS_FileCloseDest(0);
+    Elapsed = Now() - Start;
+
+    OS_remove(FileName);
+
+    return Elapsed;
+}
+
+void OS_Application_Startup(void)
+{
+    static const uint32 PktSizes[] = {64, 128, 512, 2048};
+    char *const *       ArgV       = OS_BSP_GetArgV();
+    uint32              ArgC       = OS_BSP_GetArgC();
+    uint32              Bytes      = (ArgC > 1 ? atol(ArgV[1]) : 16) * 1024 * 1024;
+    const char *        Dir        = ArgC > 2 ? ArgV[2] : "/tmp";
+    osal_id_t           FsId;
+    double              Direct;
+    double              Buffered;
+    uint32              Packets;
+    size_t              i;
+
+    if (OS_API_Init() != OS_SUCCESS || OS_FileSysAddFixedMap(&FsId, Dir, BENCH_VIRT_DIR) != OS_SUCCESS)
+    {
+        printf("cannot set up OSAL with bench directory %s\n", Dir);
+        OS_ApplicationExit(1);
+    }
+
+    strncpy(BenchDestTbl.File[0].Pathname, BENCH_VIRT_DIR, sizeof(BenchDestTbl.File[0].Pathname));
+    strncpy(BenchDestTbl.File[0].Basename, "ds_bench", sizeof(BenchDestTbl.File[0].Basename));
+    strncpy(BenchDestTbl.File[0].Extension, "dat", sizeof(BenchDestTbl.File[0].Extension));
+    BenchDestTbl.File[0].FileNameType  = DS_BY_COUNT;
+    BenchDestTbl.File[0].EnableState   = DS_ENABLED;
+    BenchDestTbl.File[0].MaxFileSize   = 0xFFFFFFFF;
+    BenchDestTbl.File[0].MaxFileAge    = 0xFFFFFFFF;
+    BenchDestTbl.File[0].SequenceCount = 1;
+    DS_AppData.DestFileTblPtr          = &BenchDestTbl;
+
+    printf("%u MB per case, %u byte write buffer\n", (unsigned int)(Bytes / (1024 * 1024)),
+           (unsigned int)DS_FILE_WRITE_BUFFER_SIZE);
+    printf("%8s %18s %18s %9s\n", "pkt size", "direct (ns/pkt)", "buffered (ns/pkt)", "speedup");
+
+    for (i = 0; i < sizeof(PktSizes) / sizeof(PktSizes[0]); i++)
+    {
+        BenchPktSize = PktSizes[i];
+        Packets      = Bytes / BenchPktSize;
+
+        Direct   = RunDirect(Packets);
+        Buffered = RunBuffered(Packets);
+
+        printf("%8u %18.1f %18.1f %8.1fx\n", (unsigned int)BenchPktSize, Direct * 1e9 / Packets,
+               Buffered * 1e9 / Packets, Buffered > 0 ? Direct / Buffered : 0);
+    }
+
+    OS_ApplicationExit(0);
+}
+
+/*
+ * Minimal shims for the cFE and DS calls made by ds_file.c
+ */
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    return CFE_SUCCESS;
+}
+
+void CFE_FS_InitHeader(CFE_FS_Header_t *Hdr, const char *Description, uint32 SubType)
+{
+    memset(Hdr, 0, sizeof(*Hdr));
+}
+
+CFE_Status_t CFE_FS_WriteHeader(osal_id_t FileDes, CFE_FS_Header_t *Hdr)
+{
+    return OS_write(FileDes, Hdr, sizeof(*Hdr));
+}
+
+CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    *Size = BenchPktSize;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetMsgTime(const CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t *Time)
+{
+    Time->Seconds    = 1;
+    Time->Subseconds = 0;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t *SeqCnt)
+{
+    *SeqCnt = 0;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
+{
+    return MsgSize <= sizeof(BenchTlmBuf) ? (CFE_SB_Buffer_t *)&BenchTlmBuf : NULL;
+}
+
+CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination)
+{
+    return CFE_SUCCESS;
+}
+
+void CFE_SB_TimeStampMsg(CFE_MSG_Message_t *MsgPtr) {}
+
+int32 CFE_SB_MessageStringGet(char *DestStringPtr, const char *SourceStringPtr, const char *DefaultString,
+                              size_t DestMaxSize, size_t SourceMaxSize)
+{
+    size_t Length = 0;
+
+    while (Length < SourceMaxSize && Length < DestMaxSize - 1 && SourceStringPtr[Length] != 0)
+    {
+        Length++;
+    }
+    memcpy(DestStringPtr, SourceStringPtr, Length);
+    DestStringPtr[Length] = 0;
+
+    return Length;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
+{
+    CFE_TIME_SysTime_t Time = {1, 0};
+    return Time;
+}
+
+void CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
+{
+    strcpy(PrintBuffer, "1980-001-00:00:01.00000");
+}
+
+int32 DS_TableFindMsgID(CFE_SB_MsgId_t MessageID)
+{
+    return DS_INDEX_NONE;
+}
+
+void DS_TableUpdateCDS(void) {}
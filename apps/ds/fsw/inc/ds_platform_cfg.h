@@ -307,6 +307,42 @@
  */
 #define DS_FILE_MIN_AGE_LIMIT 60
 
+/**
+ *  \brief Data Storage File -- write buffer size
+ *
+ *  \par Description:
+ *       This parameter defines the size (in bytes) of the write
+ *       buffer kept for each destination file.  Packets are copied
+ *       into the buffer and written to the file in one operation
+ *       when the buffer is full, when the buffered data reaches the
+ *       age set by #DS_FILE_WRITE_BUFFER_AGE and before the file
+ *       header is updated and the file is closed.  Packets larger
+ *       than the buffer are written directly to the file.
+ *
+ *  \par Limits:
+ *       The value must be greater than zero.  A value smaller than
+ *       the smallest stored packet writes every packet directly.
+ *       Note that the buffers for all #DS_DEST_FILE_CNT destinations
+ *       are part of the DS global data.
+ */
+#define DS_FILE_WRITE_BUFFER_SIZE 4096
+
+/**
+ *  \brief Data Storage File -- write buffer age limit
+ *
+ *  \par Description:
+ *       This parameter defines the age (in seconds) at which data
+ *       held in a destination file write buffer is written to the
+ *       file, even though the buffer is not yet full.  Buffer age
+ *       is tested by the file age processor, so the age is measured
+ *       in units of #DS_SECS_PER_HK_CYCLE.
+ *
+ *  \par Limits:
+ *       None -- a value of zero writes buffered data to the file on
+ *       every file age test.
+ */
+#define DS_FILE_WRITE_BUFFER_AGE 4
+
 /**
  *  \brief Application Pipe Name
  *
@@ -64,6 +64,7 @@ void DS_AppMain(void)
     CFE_SB_Buffer_t *BufPtr = NULL;
     int32            Result;
     uint32           RunStatus = CFE_ES_RunStatus_APP_RUN;
+    int32            i;
 
     /*
     ** Performance Log (start time counter)...
@@ -156,6 +157,14 @@ void DS_AppMain(void)
         CFE_ES_WriteToSysLog("DS application terminating, err = 0x%08X\n", (unsigned int)Result);
     }
 
+    /*
+    ** Write any buffered packet data to the open destination files...
+    */
+    for (i = 0; i < DS_DEST_FILE_CNT; i++)
+    {
+        DS_FileFlushBuffer(i);
+    }
+
     /*
     ** Performance Log (stop time counter)...
     */
@@ -66,6 +66,17 @@ typedef struct
     char      FileName[DS_TOTAL_FNAME_BUFSIZE]; /**< \brief Current filename (path+base+seq+ext) */
 } DS_AppFileStatus_t;
 
+/**
+ * \brief Destination file write buffer
+ */
+typedef struct
+{
+    uint32 Length;                          /**< \brief Count of bytes waiting to be written */
+    uint32 Count;                           /**< \brief Count of packets waiting to be written */
+    uint32 Age;                             /**< \brief Seconds since buffered data was last written */
+    uint8  Data[DS_FILE_WRITE_BUFFER_SIZE]; /**< \brief Packet data waiting to be written */
+} DS_AppFileBuffer_t;
+
 /**
  *  \brief DS global data structure definition
  */
@@ -101,6 +112,7 @@ typedef struct
     uint32 PassedPktCounter;   /**< \brief Count of packets that passed filter test */
 
     DS_AppFileStatus_t FileStatus[DS_DEST_FILE_CNT]; /**< \brief Current state of destination files */
+    DS_AppFileBuffer_t FileBuffer[DS_DEST_FILE_CNT]; /**< \brief Write buffers for destination files */
 
     DS_HashLink_t  HashLinks[DS_PACKETS_IN_FILTER_TABLE]; /**< \brief Hash table linked list elements */
     DS_HashLink_t *HashTable[DS_HASH_TABLE_ENTRIES];      /**< \brief Each hash table entry is a linked list */
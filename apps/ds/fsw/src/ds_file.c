@@ -343,28 +343,96 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr)
 void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength)
 {
     DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
-    int32               Result;
+    DS_AppFileBuffer_t *FileBuffer = &DS_AppData.FileBuffer[FileIndex];
+    bool                FileOpen   = true;
+    int32               Result     = DataLength;
 
-    /*
-    ** Let cFE manage the file I/O...
-    */
-    Result = OS_write(FileStatus->FileHandle, FileData, DataLength);
-    if (Result == DataLength)
+    if ((FileBuffer->Length + DataLength) > sizeof(FileBuffer->Data))
     {
         /*
-        ** Success - update file size and data rate counters...
+        ** Make room in the write buffer (a write error closes the file)...
         */
-        DS_AppData.FileWriteCounter++;
+        DS_FileFlushBuffer(FileIndex);
+        FileOpen = OS_ObjectIdDefined(FileStatus->FileHandle);
+    }
 
-        FileStatus->FileSize += DataLength;
-        FileStatus->FileGrowth += DataLength;
+    if (FileOpen)
+    {
+        if (DataLength <= sizeof(FileBuffer->Data))
+        {
+            /*
+            ** Hold the data until the write buffer is written to the file...
+            */
+            memcpy(&FileBuffer->Data[FileBuffer->Length], FileData, DataLength);
+            FileBuffer->Length += DataLength;
+            FileBuffer->Count++;
+        }
+        else
+        {
+            /*
+            ** Too large to buffer - let cFE manage the file I/O...
+            */
+            Result = OS_write(FileStatus->FileHandle, FileData, DataLength);
+        }
+
+        if (Result == DataLength)
+        {
+            /*
+            ** Success - update file size and data rate counters...
+            */
+            DS_AppData.FileWriteCounter++;
+
+            FileStatus->FileSize += DataLength;
+            FileStatus->FileGrowth += DataLength;
+        }
+        else
+        {
+            /*
+            ** Error - send event, close file and disable destination...
+            */
+            DS_FileWriteError(FileIndex, DataLength, Result);
+        }
     }
-    else
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write buffered data to destination file                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void DS_FileFlushBuffer(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus  = &DS_AppData.FileStatus[FileIndex];
+    DS_AppFileBuffer_t *FileBuffer  = &DS_AppData.FileBuffer[FileIndex];
+    uint32              DataLength  = FileBuffer->Length;
+    uint32              PacketCount = FileBuffer->Count;
+    int32               Result;
+
+    if (DataLength > 0)
     {
         /*
-        ** Error - send event, close file and disable destination...
+        ** Empty the buffer first, the error handler closes the file...
         */
-        DS_FileWriteError(FileIndex, DataLength, Result);
+        FileBuffer->Length = 0;
+        FileBuffer->Count  = 0;
+        FileBuffer->Age    = 0;
+
+        Result = OS_write(FileStatus->FileHandle, FileBuffer->Data, DataLength);
+
+        if (Result != DataLength)
+        {
+            /*
+            ** The buffered packets were counted as written, take them back...
+            */
+            DS_AppData.FileWriteCounter -= PacketCount;
+            FileStatus->FileSize -= DataLength;
+
+            /*
+            ** Error - send event, close file and disable destination...
+            */
+            DS_FileWriteError(FileIndex, DataLength, Result);
+        }
     }
 }
 
@@ -769,6 +837,19 @@ void DS_FileUpdateHeader(int32 FileIndex)
     CFE_TIME_SysTime_t  CurrentTime = CFE_TIME_GetTime();
     int32               Result;
 
+    /*
+    ** Buffered data must reach the file before seeking to the header...
+    */
+    DS_FileFlushBuffer(FileIndex);
+
+    /*
+    ** A write error will have closed the file, leaving no header to update...
+    */
+    if (!OS_ObjectIdDefined(FileStatus->FileHandle))
+    {
+        return;
+    }
+
     Result = OS_lseek(FileStatus->FileHandle, sizeof(CFE_FS_Header_t), OS_SEEK_SET);
 
     if (Result == sizeof(CFE_FS_Header_t))
@@ -801,67 +882,83 @@ void DS_FileCloseDest(int32 FileIndex)
 {
     DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
 
-#if (DS_MOVE_FILES == true)
-    /*
-    ** Move file from working directory to downlink directory...
-    */
-    int32 OS_result;
-    int32 PathLength;
-    char *FileName;
-    char  PathName[DS_TOTAL_FNAME_BUFSIZE];
-
     /*
-    ** First, close the file...
+    ** Write any buffered data, a write error will have closed the file...
     */
-    OS_close(FileStatus->FileHandle);
+    DS_FileFlushBuffer(FileIndex);
 
-    /*
-    ** Move file only if table has a downlink directory name...
-    */
-    if (DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] != '\0')
+    if (OS_ObjectIdDefined(FileStatus->FileHandle))
     {
+#if (DS_MOVE_FILES == true)
         /*
-        ** Make sure directory name does not end with slash character...
+        ** Move file from working directory to downlink directory...
         */
-        CFE_SB_MessageStringGet(PathName, DS_AppData.DestFileTblPtr->File[FileIndex].Movename, NULL, sizeof(PathName),
-                                sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
-        PathLength = strlen(PathName);
-        if (PathName[PathLength - 1] == '/')
-        {
-            PathName[PathLength - 1] = '\0';
-            PathLength--;
-        }
+        int32 OS_result;
+        int32 PathLength;
+        char *FileName;
+        char  PathName[DS_TOTAL_FNAME_BUFSIZE];
 
         /*
-        ** Get a pointer to slash character before the filename...
+        ** First, close the file...
         */
-        FileName = strrchr(FileStatus->FileName, '/');
+        OS_close(FileStatus->FileHandle);
 
-        if (FileName != NULL)
+        /*
+        ** Move file only if table has a downlink directory name...
+        */
+        if (DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] != '\0')
         {
             /*
-            ** Verify that directory name plus filename is not too large...
+            ** Make sure directory name does not end with slash character...
             */
-            if ((PathLength + strlen(FileName)) < DS_TOTAL_FNAME_BUFSIZE)
+            CFE_SB_MessageStringGet(PathName, DS_AppData.DestFileTblPtr->File[FileIndex].Movename, NULL,
+                                    sizeof(PathName), sizeof(DS_AppData.DestFileTblPtr->File[FileIndex].Movename));
+            PathLength = strlen(PathName);
+            if (PathName[PathLength - 1] == '/')
             {
-                /*
-                ** Append the filename (with slash) to the directory name...
-                */
-                strcat(PathName, FileName);
+                PathName[PathLength - 1] = '\0';
+                PathLength--;
+            }
 
+            /*
+            ** Get a pointer to slash character before the filename...
+            */
+            FileName = strrchr(FileStatus->FileName, '/');
+
+            if (FileName != NULL)
+            {
                 /*
-                ** Use OS function to move/rename the file...
+                ** Verify that directory name plus filename is not too large...
                 */
-                OS_result = OS_mv(FileStatus->FileName, PathName);
+                if ((PathLength + strlen(FileName)) < DS_TOTAL_FNAME_BUFSIZE)
+                {
+                    /*
+                    ** Append the filename (with slash) to the directory name...
+                    */
+                    strcat(PathName, FileName);
+
+                    /*
+                    ** Use OS function to move/rename the file...
+                    */
+                    OS_result = OS_mv(FileStatus->FileName, PathName);
 
-                if (OS_result != OS_SUCCESS)
+                    if (OS_result != OS_SUCCESS)
+                    {
+                        /*
+                        ** Error - send event but leave destination enabled...
+                        */
+                        CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "FILE MOVE error: src = '%s', tgt = '%s', result = %d", FileStatus->FileName,
+                                          PathName, (int)OS_result);
+                    }
+                }
+                else
                 {
                     /*
                     ** Error - send event but leave destination enabled...
                     */
                     CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "FILE MOVE error: src = '%s', tgt = '%s', result = %d", FileStatus->FileName,
-                                      PathName, (int)OS_result);
+                                      "FILE MOVE error: dir name = '%s', filename = '%s'", PathName, FileName);
                 }
             }
             else
@@ -870,44 +967,36 @@ void DS_FileCloseDest(int32 FileIndex)
                 ** Error - send event but leave destination enabled...
                 */
                 CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "FILE MOVE error: dir name = '%s', filename = '%s'", PathName, FileName);
+                                  "FILE MOVE error: dir name = '%s', filename = 'NULL'", PathName);
             }
-        }
-        else
-        {
-            /*
-            ** Error - send event but leave destination enabled...
-            */
-            CFE_EVS_SendEvent(DS_MOVE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "FILE MOVE error: dir name = '%s', filename = 'NULL'", PathName);
-        }
 
-        /* Update the path name for reporting */
-        strncpy(FileStatus->FileName, PathName, sizeof(FileStatus->FileName));
-    }
+            /* Update the path name for reporting */
+            strncpy(FileStatus->FileName, PathName, sizeof(FileStatus->FileName));
+        }
 #else
-    /*
-    ** Close the file...
-    */
-    OS_close(FileStatus->FileHandle);
+        /*
+        ** Close the file...
+        */
+        OS_close(FileStatus->FileHandle);
 #endif
 
-    /*
-    ** Transmit file information telemetry...
-    */
-    DS_FileTransmit(FileStatus);
+        /*
+        ** Transmit file information telemetry...
+        */
+        DS_FileTransmit(FileStatus);
 
-    /*
-    ** Reset status for this destination file...
-    */
-    FileStatus->FileHandle = OS_OBJECT_ID_UNDEFINED;
-    FileStatus->FileAge    = 0;
-    FileStatus->FileSize   = 0;
+        /*
+        ** Reset status for this destination file...
+        */
+        FileStatus->FileHandle = OS_OBJECT_ID_UNDEFINED;
+        FileStatus->FileAge    = 0;
+        FileStatus->FileSize   = 0;
 
-    /*
-    ** Remove previous filename from status data...
-    */
-    memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+        /*
+        ** Remove previous filename from status data...
+        */
+        memset(FileStatus->FileName, 0, sizeof(FileStatus->FileName));
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -944,6 +1033,18 @@ void DS_FileTestAge(uint32 ElapsedSeconds)
                     DS_FileUpdateHeader(FileIndex);
                     DS_FileCloseDest(FileIndex);
                 }
+                else if (DS_AppData.FileBuffer[FileIndex].Length > 0)
+                {
+                    /*
+                    ** Write buffered data that has been held long enough...
+                    */
+                    DS_AppData.FileBuffer[FileIndex].Age += ElapsedSeconds;
+
+                    if (DS_AppData.FileBuffer[FileIndex].Age >= DS_FILE_WRITE_BUFFER_AGE)
+                    {
+                        DS_FileFlushBuffer(FileIndex);
+                    }
+                }
             }
         }
     }
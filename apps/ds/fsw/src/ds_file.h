@@ -112,8 +112,11 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr);
  *  \par Description
  *       This function writes data to an existing data storage
  *       destination file and updates the associated data rate
- *       counters. If necessary, the function will invoke a
- *       file write error handler.
+ *       counters. The data is added to the write buffer for the
+ *       destination, which is first written to the file if the
+ *       data does not fit.  Data larger than the buffer is written
+ *       directly to the file.  If necessary, the function will
+ *       invoke a file write error handler.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
@@ -126,6 +129,27 @@ void DS_FileSetupWrite(int32 FileIndex, const CFE_SB_Buffer_t *BufPtr);
  */
 void DS_FileWriteData(int32 FileIndex, const void *FileData, uint32 DataLength);
 
+/**
+ *  \brief Write buffered data to file
+ *
+ *  \par Description
+ *       This function writes any packet data held in the write
+ *       buffer for a data storage destination file to the file
+ *       and empties the buffer.  If necessary, the function will
+ *       invoke the file write error handler, which closes the file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file write counter and file size were updated when the
+ *       data was added to the buffer.  If the write fails, they are
+ *       reduced again by the buffered packets before the file write
+ *       error handler is invoked.
+ *
+ *  \param[in] FileIndex Destination file index
+ *
+ *  \sa #DS_FileWriteData, #DS_AppFileBuffer_t
+ */
+void DS_FileFlushBuffer(int32 FileIndex);
+
 /**
  *  \brief Write data storage file header
  *
@@ -236,9 +260,12 @@ void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count);
  *       This function is called just before closing a data storage
  *       destination file. The purpose of the function is to update
  *       portions of the file header that cannot be known in advance,
- *       such as the file size or the file close time.  During the
- *       update process, seek and write errors are counted but
- *       otherwise ignored as the file is about to be closed.
+ *       such as the file size or the file close time.  Any buffered
+ *       packet data is written to the file before the header is
+ *       updated, and if that write fails (closing the file) the
+ *       header is not updated.  During the update process, seek and
+ *       write errors are counted but otherwise ignored as the file
+ *       is about to be closed.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
@@ -256,9 +283,12 @@ void DS_FileUpdateHeader(int32 FileIndex);
  *       This function may be called from the DS Close File command
  *       handler, from the file age processor, from the file size
  *       processor and from the file write error handler.
- *       The function closes the selected destination file and updates
- *       the file status data to indicate that the file handle is not
- *       in use and that the file age, size and name fields are reset.
+ *       The function writes any buffered packet data, closes the
+ *       selected destination file and updates the file status data
+ *       to indicate that the file handle is not in use and that the
+ *       file age, size and name fields are reset.  If writing the
+ *       buffered data fails, the file write error handler closes
+ *       the file instead.
  *
  *  \par Assumptions, External Events, and Notes:
  *       (none)
@@ -277,7 +307,9 @@ void DS_FileCloseDest(int32 FileIndex);
  *       The function increments the elapsed file age for all open
  *       data storage files by the amount specified.
  *       Files that exceed the age limit set in the destination file
- *       definition table will be closed.
+ *       definition table will be closed.  For files that remain open,
+ *       buffered packet data older than #DS_FILE_WRITE_BUFFER_AGE is
+ *       written to the file.
  *       If this destination remains enabled, another file will be
  *       opened when the next packet is written to this destination.
  *
@@ -148,6 +148,16 @@
 #error DS_APP_PIPE_NAME must be defined!
 #endif
 
+#ifndef DS_FILE_WRITE_BUFFER_SIZE
+#error DS_FILE_WRITE_BUFFER_SIZE must be defined!
+#elif (DS_FILE_WRITE_BUFFER_SIZE < 1)
+#error DS_FILE_WRITE_BUFFER_SIZE cannot be less than 1!
+#endif
+
+#ifndef DS_FILE_WRITE_BUFFER_AGE
+#error DS_FILE_WRITE_BUFFER_AGE must be defined!
+#endif
+
 #ifndef DS_APP_PIPE_DEPTH
 #error DS_APP_PIPE_DEPTH must be defined!
 #elif (DS_APP_PIPE_DEPTH < 1)
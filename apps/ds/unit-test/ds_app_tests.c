@@ -80,6 +80,7 @@ void DS_AppMain_Test_Nominal(void)
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+    UtAssert_STUB_COUNT(DS_FileFlushBuffer, DS_DEST_FILE_CNT);
 }
 
 void DS_AppMain_Test_AppInitializeError(void)
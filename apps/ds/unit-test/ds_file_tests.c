@@ -328,7 +328,54 @@ void DS_FileWriteData_Test_Nominal(void)
     UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(UT_CmdBuf.Buf));
     UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileGrowth, sizeof(UT_CmdBuf.Buf));
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, sizeof(UT_CmdBuf.Buf));
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Count, 1);
 
+    /* Data is held in the write buffer */
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileWriteData_Test_BufferFull(void)
+{
+    int32  FileIndex  = 0;
+    uint32 DataLength = 10;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    /* Leave less room in the buffer than the data needs */
+    DS_AppData.FileBuffer[FileIndex].Length = DS_FILE_WRITE_BUFFER_SIZE - DataLength + 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, DataLength);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, DataLength);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileWriteData_Test_LargeData(void)
+{
+    int32        FileIndex = 0;
+    static uint8 LargeData[DS_FILE_WRITE_BUFFER_SIZE + 1];
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileBuffer[FileIndex].Length = 10;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, LargeData, sizeof(LargeData)));
+
+    /* Verify results - buffered data is written first, then the large data directly */
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileSize, sizeof(LargeData));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -348,8 +395,9 @@ void DS_FileWriteData_Test_Error(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &forced_CmdCode, sizeof(forced_CmdCode), false);
 
-    /* Set to reach error case being tested (DS_FileWriteError) */
+    /* Set to reach error case being tested (DS_FileWriteError) when the full buffer is written */
     UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+    DS_AppData.FileBuffer[FileIndex].Length = DS_FILE_WRITE_BUFFER_SIZE;
 
     strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/",
             sizeof(DS_AppData.FileStatus[FileIndex].FileName));
@@ -358,10 +406,101 @@ void DS_FileWriteData_Test_Error(void)
     /* Execute the function being tested */
     UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, &UT_CmdBuf.Buf, DataLength));
 
+    /* Verify results - the file is closed and the data discarded */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void DS_FileWriteData_Test_LargeDataError(void)
+{
+    int32        FileIndex = 0;
+    static uint8 LargeData[DS_FILE_WRITE_BUFFER_SIZE + 1];
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    /* Set to reach error case being tested (DS_FileWriteError) */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileWriteData(FileIndex, LargeData, sizeof(LargeData)));
+
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 0);
+}
+
+void DS_FileFlushBuffer_Test_Nominal(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileBuffer[FileIndex].Length = 10;
+    DS_AppData.FileBuffer[FileIndex].Age    = 2;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileFlushBuffer(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Age, 0);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileFlushBuffer_Test_Empty(void)
+{
+    int32 FileIndex = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileFlushBuffer(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileFlushBuffer_Test_Error(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileBuffer[FileIndex].Length                = 10;
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+
+    /* Set to reach error case being tested (DS_FileWriteError) */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileFlushBuffer(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, 0);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+    UtAssert_STUB_COUNT(OS_close, 1);
 }
 
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
@@ -860,6 +999,9 @@ void DS_FileUpdateHeader_Test_PlatformConfigCFE_Nominal(void)
 {
     int32 FileIndex = 0;
 
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
     /* Execute the function being tested */
     UtAssert_VOIDCALL(DS_FileUpdateHeader(FileIndex));
 
@@ -869,11 +1011,81 @@ void DS_FileUpdateHeader_Test_PlatformConfigCFE_Nominal(void)
 }
 #endif
 
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileUpdateHeader_Test_BufferedData(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileBuffer[FileIndex].Length = 10;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileUpdateHeader(FileIndex));
+
+    /* Verify results - buffered data and then the close time are written */
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+#endif
+
+#if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
+void DS_FileUpdateHeader_Test_FlushError(void)
+{
+    int32                    FileIndex = 0;
+    DS_FileCompletePktBuf_t  PktBuf;
+    DS_FileCompletePktBuf_t *PktBufPtr = &PktBuf;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    strncpy(DS_AppData.FileStatus[FileIndex].FileName, "directory1/",
+            sizeof(DS_AppData.FileStatus[FileIndex].FileName));
+    DS_AppData.DestFileTblPtr->File[FileIndex].Movename[0] = '\0';
+
+    /* Two buffered packets, counted as written along with the file headers */
+    DS_AppData.FileBuffer[FileIndex].Length   = 10;
+    DS_AppData.FileBuffer[FileIndex].Count    = 2;
+    DS_AppData.FileWriteCounter               = 4;
+    DS_AppData.FileStatus[FileIndex].FileSize = 100;
+
+    /* capture the file info sent when the error handler closes the file */
+    memset(PktBufPtr, 0, sizeof(*PktBufPtr));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+
+    /* Set to fail writing the buffered data */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileUpdateHeader(FileIndex));
+
+    /* Verify results - the closed file is left alone */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileUpdateErrCounter, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteErrCounter, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+
+    /* and the buffered packets are no longer counted as written */
+    UtAssert_UINT32_EQ(DS_AppData.FileWriteCounter, 2);
+    UtAssert_UINT32_EQ(PktBuf.Pkt.Payload.FileSize, 90);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Count, 0);
+}
+#endif
+
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
 void DS_FileUpdateHeader_Test_WriteError(void)
 {
     int32 FileIndex = 0;
 
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
     /* Set to fail condition "if (Result == sizeof(CFE_TIME_SysTime_t))" */
     UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
 
@@ -891,6 +1103,9 @@ void DS_FileUpdateHeader_Test_PlatformConfigCFE_SeekError(void)
 {
     int32 FileIndex = 0;
 
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
     /* Set to fail condition "if (Result == sizeof(CFE_FS_Header_t))" */
     UT_SetDefaultReturnValue(UT_KEY(OS_lseek), -1);
 
@@ -1009,6 +1224,50 @@ void DS_FileCloseDest_Test_PlatformConfigMoveFiles_FilenameNull(void)
 }
 #endif
 
+void DS_FileCloseDest_Test_BufferedData(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileBuffer[FileIndex].Length = 10;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, 0);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileCloseDest_Test_BufferWriteError(void)
+{
+    int32 FileIndex = 0;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.FileBuffer[FileIndex].Length = 10;
+
+    /* Set to reach error case being tested (DS_FileWriteError) */
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileCloseDest(FileIndex));
+
+    /* Verify results - the error handler closes the file, which is only closed once */
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, DS_WRITE_FILE_ERR_EID);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_UINT32_EQ(DS_AppData.FileStatus[FileIndex].FileState, DS_DISABLED);
+}
+
 #if (DS_MOVE_FILES == false)
 void DS_FileCloseDest_Test_MoveFilesFalse(void)
 {
@@ -1054,6 +1313,52 @@ void DS_FileTestAge_Test_Nominal(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void DS_FileTestAge_Test_BufferAge(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 1;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 1000;
+    DS_AppData.FileBuffer[FileIndex].Length               = 10;
+    DS_AppData.FileBuffer[FileIndex].Age                  = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+
+    /* Verify results - buffered data is not yet old enough to write */
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Age, ElapsedSeconds);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, 10);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void DS_FileTestAge_Test_BufferAgeExceeded(void)
+{
+    int32  FileIndex      = 0;
+    uint32 ElapsedSeconds = 2;
+
+    /* Set up the handle */
+    OS_OpenCreate(&DS_AppData.FileStatus[FileIndex].FileHandle, NULL, 0, 0);
+
+    DS_AppData.DestFileTblPtr->File[FileIndex].MaxFileAge = 1000;
+    DS_AppData.FileBuffer[FileIndex].Length               = 10;
+    DS_AppData.FileBuffer[FileIndex].Age                  = DS_FILE_WRITE_BUFFER_AGE;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(DS_FileTestAge(ElapsedSeconds));
+
+    /* Verify results - buffered data is written but the file stays open */
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Length, 0);
+    UtAssert_UINT32_EQ(DS_AppData.FileBuffer[FileIndex].Age, 0);
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(DS_AppData.FileStatus[FileIndex].FileHandle));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void DS_FileTestAge_Test_NullTable(void)
 {
     uint32 ElapsedSeconds     = 2;
@@ -1281,7 +1586,14 @@ void UtTest_Setup(void)
     UT_DS_TEST_ADD(DS_FileSetupWrite_Test_MaxFileSizeExceeded);
 
     UT_DS_TEST_ADD(DS_FileWriteData_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_BufferFull);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_LargeData);
     UT_DS_TEST_ADD(DS_FileWriteData_Test_Error);
+    UT_DS_TEST_ADD(DS_FileWriteData_Test_LargeDataError);
+
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_Nominal);
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_Empty);
+    UT_DS_TEST_ADD(DS_FileFlushBuffer_Test_Error);
 
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
     UT_DS_TEST_ADD(DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal);
@@ -1319,6 +1631,8 @@ void UtTest_Setup(void)
 
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
     UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_PlatformConfigCFE_Nominal);
+    UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_BufferedData);
+    UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_FlushError);
     UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_WriteError);
     UT_DS_TEST_ADD(DS_FileUpdateHeader_Test_PlatformConfigCFE_SeekError);
 #endif
@@ -1331,9 +1645,13 @@ void UtTest_Setup(void)
 #else
     UT_DS_TEST_ADD(DS_FileCloseDest_Test_MoveFilesFalse);
 #endif
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_BufferedData);
+    UT_DS_TEST_ADD(DS_FileCloseDest_Test_BufferWriteError);
 
     UT_DS_TEST_ADD(DS_FileTestAge_Test_Nominal);
     UT_DS_TEST_ADD(DS_FileTestAge_Test_ExceedMaxAge);
+    UT_DS_TEST_ADD(DS_FileTestAge_Test_BufferAge);
+    UT_DS_TEST_ADD(DS_FileTestAge_Test_BufferAgeExceeded);
     UT_DS_TEST_ADD(DS_FileTestAge_Test_NullTable);
 
     UT_DS_TEST_ADD(DS_IsPacketFiltered_Test_AlgX0);
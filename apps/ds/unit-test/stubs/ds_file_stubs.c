@@ -76,6 +76,18 @@ void DS_FileCreateSequence(char *Buffer, uint32 Type, uint32 Count)
     UT_GenStub_Execute(DS_FileCreateSequence, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for DS_FileFlushBuffer()
+ * ----------------------------------------------------
+ */
+void DS_FileFlushBuffer(int32 FileIndex)
+{
+    UT_GenStub_AddParam(DS_FileFlushBuffer, int32, FileIndex);
+
+    UT_GenStub_Execute(DS_FileFlushBuffer, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for DS_FileSetupWrite()
@@ -80,6 +80,8 @@ typedef struct
     hk_copy_table_entry_t * CopyTablePtr;    /**< \brief Ptr to copy table entry */
     hk_runtime_tbl_entry_t *RuntimeTablePtr; /**< \brief Ptr to run-time table entry */
 
+    HK_CopyIndex_t CopyIndex; /**< \brief Copy table entries indexed by input MsgId */
+
     uint8 MemPoolBuffer[HK_NUM_BYTES_IN_MEM_POOL]; /**< \brief HK mempool buffer */
 } HK_AppData_t;
 
@@ -47,8 +47,11 @@ void HK_ProcessIncomingHkData(const CFE_SB_Buffer_t *BufPtr)
     hk_copy_table_entry_t * StartOfCopyTable = HK_AppData.CopyTablePtr;
     hk_copy_table_entry_t * CpyTblEntry      = NULL;
     hk_runtime_tbl_entry_t *StartOfRtTable   = HK_AppData.RuntimeTablePtr;
-    hk_runtime_tbl_entry_t *RtTblEntry       = NULL;
-    uint16                  Loop             = 0;
+    HK_CopyIndexSlot_t *    Slot             = NULL;
+    HK_CopyRun_t *          Run              = NULL;
+    uint16                  RunLoop          = 0;
+    uint16                  EntryLoop        = 0;
+    uint16                  EntryNum         = 0;
     CFE_SB_MsgId_t          MessageID        = CFE_SB_INVALID_MSG_ID;
     uint8 *                 DestPtr          = NULL;
     uint8 *                 SrcPtr           = NULL;
@@ -58,34 +61,62 @@ void HK_ProcessIncomingHkData(const CFE_SB_Buffer_t *BufPtr)
 
     CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
 
-    /* Spin thru the entire table looking for matches */
-    for (Loop = 0; Loop < HK_COPY_TABLE_ENTRIES; Loop++)
+    /* Only the copy runs for this MID need to be visited, rather than the entire table */
+    Slot = HK_FindCopyIndexSlot(MessageID);
+    if (Slot->NumEntries == 0)
     {
-        CpyTblEntry = &StartOfCopyTable[Loop];
-        RtTblEntry  = &StartOfRtTable[Loop];
+        return;
+    }
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &MessageLength);
 
-        /* Does the inputMID for this table entry match what we're looking for */
-        if (CFE_SB_MsgId_Equal(MessageID, CpyTblEntry->InputMid))
+    for (RunLoop = 0; RunLoop < Slot->NumRuns; RunLoop++)
+    {
+        Run = &HK_AppData.CopyIndex.Runs[Slot->FirstRun + RunLoop];
+
+        /* Ensure that we don't reference past the end of the input packet */
+        LastByteAccessed = Run->InputOffset + Run->NumBytes;
+        if (MessageLength >= LastByteAccessed)
         {
-            /* Ensure that we don't reference past the end of the input packet */
-            CFE_MSG_GetSize(&BufPtr->Msg, &MessageLength);
-            LastByteAccessed = CpyTblEntry->InputOffset + CpyTblEntry->NumBytes;
-            if (MessageLength >= LastByteAccessed)
-            {
-                /* We have a match.  Build the Source and Destination addresses
-                   and move the data */
-                DestPtr = ((uint8 *)RtTblEntry->OutputPktAddr) + CpyTblEntry->OutputOffset;
-                SrcPtr  = ((uint8 *)BufPtr) + CpyTblEntry->InputOffset;
+            /* The whole run fits.  Build the Source and Destination addresses
+               and move the data for all of its entries at once */
+            DestPtr = ((uint8 *)Run->OutputPktAddr) + Run->OutputOffset;
+            SrcPtr  = ((uint8 *)BufPtr) + Run->InputOffset;
 
-                memcpy(DestPtr, SrcPtr, CpyTblEntry->NumBytes);
+            memcpy(DestPtr, SrcPtr, Run->NumBytes);
+
+            /* Set the data present field to indicate the data is there */
+            for (EntryLoop = 0; EntryLoop < Run->NumEntries; EntryLoop++)
+            {
+                EntryNum = HK_AppData.CopyIndex.Entries[Run->FirstEntry + EntryLoop];
 
-                /* Set the data present field to indicate the data is there */
-                RtTblEntry->DataPresent = HK_DATA_PRESENT;
+                StartOfRtTable[EntryNum].DataPresent = HK_DATA_PRESENT;
             }
-            else
+        }
+        else
+        {
+            /* Part of the run is past the end of the input packet, so move
+               whichever of its entries still fit one at a time */
+            for (EntryLoop = 0; EntryLoop < Run->NumEntries; EntryLoop++)
             {
-                /* Error: copy data is past the end of the input packet */
-                MessageErrors++;
+                EntryNum    = HK_AppData.CopyIndex.Entries[Run->FirstEntry + EntryLoop];
+                CpyTblEntry = &StartOfCopyTable[EntryNum];
+
+                LastByteAccessed = CpyTblEntry->InputOffset + CpyTblEntry->NumBytes;
+                if (MessageLength >= LastByteAccessed)
+                {
+                    DestPtr = ((uint8 *)StartOfRtTable[EntryNum].OutputPktAddr) + CpyTblEntry->OutputOffset;
+                    SrcPtr  = ((uint8 *)BufPtr) + CpyTblEntry->InputOffset;
+
+                    memcpy(DestPtr, SrcPtr, CpyTblEntry->NumBytes);
+
+                    StartOfRtTable[EntryNum].DataPresent = HK_DATA_PRESENT;
+                }
+                else
+                {
+                    /* Error: copy data is past the end of the input packet */
+                    MessageErrors++;
+                }
             }
         }
     }
@@ -99,6 +130,142 @@ void HK_ProcessIncomingHkData(const CFE_SB_Buffer_t *BufPtr)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK find the copy index slot for an input MsgId                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+HK_CopyIndexSlot_t *HK_FindCopyIndexSlot(CFE_SB_MsgId_t InputMid)
+{
+    HK_CopyIndexSlot_t *Slot;
+    uint32              Hash;
+
+    /* Multiplicative hash, as MsgId values are often clustered together */
+    Hash = (uint32)CFE_SB_MsgIdToValue(InputMid) * 2654435761U;
+    Hash = (Hash >> 16) % HK_COPY_INDEX_SLOTS;
+
+    /* Linear probe, which always ends since the slots are never more than half used */
+    Slot = &HK_AppData.CopyIndex.Slots[Hash];
+    while (Slot->NumEntries != 0 && !CFE_SB_MsgId_Equal(Slot->InputMid, InputMid))
+    {
+        ++Hash;
+        if (Hash >= HK_COPY_INDEX_SLOTS)
+        {
+            Hash = 0;
+        }
+        Slot = &HK_AppData.CopyIndex.Slots[Hash];
+    }
+
+    return Slot;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* HK build the copy index from the copy and run-time tables       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HK_BuildCopyIndex(const hk_copy_table_entry_t *CpyTblPtr, const hk_runtime_tbl_entry_t *RtTblPtr)
+{
+    HK_CopyIndex_t *             Index    = &HK_AppData.CopyIndex;
+    const hk_copy_table_entry_t *CpyEntry = NULL;
+    HK_CopyIndexSlot_t *         Slot     = NULL;
+    HK_CopyRun_t *               Run      = NULL;
+    uint16                       NumRuns  = 0;
+    uint16                       NextFree = 0;
+    uint16                       EntryNum;
+    int32                        Loop1;
+    int32                        Loop2;
+
+    memset(Index, 0, sizeof(*Index));
+
+    /* Count the entries for each input MID.  Entries without an output packet
+       have nowhere to copy to, so they are left out. */
+    for (Loop1 = 0; Loop1 < HK_COPY_TABLE_ENTRIES; Loop1++)
+    {
+        CpyEntry = &CpyTblPtr[Loop1];
+
+        if (CFE_SB_IsValidMsgId(CpyEntry->InputMid) && (RtTblPtr[Loop1].OutputPktAddr != NULL))
+        {
+            Slot = HK_FindCopyIndexSlot(CpyEntry->InputMid);
+
+            Slot->InputMid = CpyEntry->InputMid;
+            Slot->NumEntries++;
+        }
+    }
+
+    /* Give each MID its own section of the entry list, leaving FirstEntry
+       pointing at the end of the section so it can be filled backwards */
+    for (Loop1 = 0; Loop1 < HK_COPY_INDEX_SLOTS; Loop1++)
+    {
+        Slot = &Index->Slots[Loop1];
+
+        if (Slot->NumEntries != 0)
+        {
+            NextFree += Slot->NumEntries;
+            Slot->FirstEntry = NextFree;
+        }
+    }
+
+    /* Fill in the entry lists in reverse, which leaves each one in table order
+       and FirstEntry back at the start of its section */
+    for (Loop1 = HK_COPY_TABLE_ENTRIES - 1; Loop1 >= 0; Loop1--)
+    {
+        CpyEntry = &CpyTblPtr[Loop1];
+
+        if (CFE_SB_IsValidMsgId(CpyEntry->InputMid) && (RtTblPtr[Loop1].OutputPktAddr != NULL))
+        {
+            Slot = HK_FindCopyIndexSlot(CpyEntry->InputMid);
+
+            Slot->FirstEntry--;
+            Index->Entries[Slot->FirstEntry] = Loop1;
+        }
+    }
+
+    /* Merge each MID's entries into runs.  Only entries next to each other in
+       table order are merged, so overlapping entries are still copied in the
+       same order as the table lists them. */
+    for (Loop1 = 0; Loop1 < HK_COPY_INDEX_SLOTS; Loop1++)
+    {
+        Slot = &Index->Slots[Loop1];
+
+        if (Slot->NumEntries == 0)
+        {
+            continue;
+        }
+
+        Slot->FirstRun = NumRuns;
+        Run            = NULL;
+
+        for (Loop2 = 0; Loop2 < Slot->NumEntries; Loop2++)
+        {
+            EntryNum = Index->Entries[Slot->FirstEntry + Loop2];
+            CpyEntry = &CpyTblPtr[EntryNum];
+
+            if (Run != NULL && RtTblPtr[EntryNum].OutputPktAddr == Run->OutputPktAddr &&
+                CpyEntry->InputOffset == Run->InputOffset + Run->NumBytes &&
+                CpyEntry->OutputOffset == Run->OutputOffset + Run->NumBytes)
+            {
+                Run->NumBytes += CpyEntry->NumBytes;
+                Run->NumEntries++;
+            }
+            else
+            {
+                Run = &Index->Runs[NumRuns];
+                NumRuns++;
+
+                Run->OutputPktAddr = RtTblPtr[EntryNum].OutputPktAddr;
+                Run->InputOffset   = CpyEntry->InputOffset;
+                Run->OutputOffset  = CpyEntry->OutputOffset;
+                Run->NumBytes      = CpyEntry->NumBytes;
+                Run->FirstEntry    = Slot->FirstEntry + Loop2;
+                Run->NumEntries    = 1;
+            }
+        }
+
+        Slot->NumRuns = NumRuns - Slot->FirstRun;
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* HK validate the copy table contents                             */
@@ -253,6 +420,9 @@ CFE_Status_t HK_ProcessNewCopyTable(hk_copy_table_entry_t *CpyTblPtr, hk_runtime
         }
     }
 
+    /* Now that the output packets are known, index the table for incoming packets */
+    HK_BuildCopyIndex(CpyTblPtr, RtTblPtr);
+
     return CFE_SUCCESS;
 }
 
@@ -285,6 +455,9 @@ CFE_Status_t HK_TearDownOldCopyTable(hk_copy_table_entry_t *CpyTblPtr, hk_runtim
         return HK_NULL_POINTER_DETECTED;
     }
 
+    /* Stop incoming packets from being copied into packets that are about to be freed */
+    memset(&HK_AppData.CopyIndex, 0, sizeof(HK_AppData.CopyIndex));
+
     StartOfCopyTable = CpyTblPtr;
     StartOfRtTable   = RtTblPtr;
 
@@ -29,6 +29,7 @@
  ************************************************************************/
 #include "cfe.h"
 #include "hk_tbldefs.h"
+#include "hk_extern_typedefs.h"
 
 /*************************************************************************
  * Macro definitions
@@ -44,6 +45,63 @@
 
 #define HK_NULL_POINTER_DETECTED (-1) /**< \brief An input table pointer was NULL */
 
+/**
+ * \brief Number of slots in the copy index MsgId hash table
+ *
+ * Twice the number of copy table entries, so the table is never more than
+ * half full and a probe sequence always ends at an unused slot.
+ */
+#define HK_COPY_INDEX_SLOTS (2 * HK_COPY_TABLE_ENTRIES)
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ * \brief HK copy run
+ *
+ * One or more copy table entries for the same input message, going to the
+ * same output packet, whose input and output byte ranges each follow on
+ * from the previous entry.  The whole run is done with a single copy.
+ */
+typedef struct
+{
+    CFE_SB_Buffer_t *OutputPktAddr; /**< \brief Addr of output packet */
+    uint32           InputOffset;   /**< \brief Byte offset into the input pkt where the run begins */
+    uint32           OutputOffset;  /**< \brief Byte offset into the output pkt where the run begins */
+    uint32           NumBytes;      /**< \brief Number of bytes copied by the run */
+    uint16           FirstEntry;    /**< \brief Index into #HK_CopyIndex_t.Entries of the first entry in the run */
+    uint16           NumEntries;    /**< \brief Number of copy table entries in the run */
+} HK_CopyRun_t;
+
+/**
+ * \brief HK copy index slot
+ *
+ * Locates the copy runs for one input MsgId.  A slot with no entries is unused.
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t InputMid;   /**< \brief Input MsgId */
+    uint16         FirstEntry; /**< \brief Index into #HK_CopyIndex_t.Entries of the first entry for this MsgId */
+    uint16         NumEntries; /**< \brief Number of copy table entries for this MsgId */
+    uint16         FirstRun;   /**< \brief Index into #HK_CopyIndex_t.Runs of the first run for this MsgId */
+    uint16         NumRuns;    /**< \brief Number of copy runs for this MsgId */
+} HK_CopyIndexSlot_t;
+
+/**
+ * \brief HK copy index
+ *
+ * Built from the copy and run-time tables when a new copy table is processed,
+ * so that an incoming packet only visits the copy table entries for its own
+ * MsgId rather than the entire copy table.
+ */
+typedef struct
+{
+    HK_CopyIndexSlot_t Slots[HK_COPY_INDEX_SLOTS];    /**< \brief Hash table of input MsgIds */
+    HK_CopyRun_t       Runs[HK_COPY_TABLE_ENTRIES];    /**< \brief Copy runs, grouped by input MsgId */
+    uint16             Entries[HK_COPY_TABLE_ENTRIES]; /**< \brief Copy table entry numbers, grouped by run */
+} HK_CopyIndex_t;
+
 /************************************************************************
  * Prototypes for functions defined in hk_utils.c
  ************************************************************************/
@@ -105,6 +163,39 @@ int32 HK_ValidateHkCopyTable(void *TblPtr);
  */
 CFE_Status_t HK_ProcessNewCopyTable(hk_copy_table_entry_t *CpyTblPtr, hk_runtime_tbl_entry_t *RtTblPtr);
 
+/**
+ * \brief Build Copy Index
+ *
+ * \par Description
+ *        Groups the copy table entries by input MsgId and merges adjacent
+ *        entries into copy runs, replacing the contents of the copy index
+ *        used by #HK_ProcessIncomingHkData.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *        The output packet addresses in the run-time table must already be
+ *        assigned.  Entries without an output packet are not indexed.
+ *
+ * \param[in] CpyTblPtr A pointer to the first entry in the copy table.
+ * \param[in] RtTblPtr  A pointer to the first entry in the run-time table.
+ */
+void HK_BuildCopyIndex(const hk_copy_table_entry_t *CpyTblPtr, const hk_runtime_tbl_entry_t *RtTblPtr);
+
+/**
+ * \brief Find Copy Index Slot
+ *
+ * \par Description
+ *        Searches the copy index for the given input MsgId.
+ *
+ * \par Assumptions, External Events, and Notes:
+ *          None
+ *
+ * \param[in] InputMid The input MsgId to search for.
+ *
+ * \return Pointer to the slot for the MsgId, or to the unused slot where it
+ *         would be added (NumEntries of 0) if the MsgId is not in the index
+ */
+HK_CopyIndexSlot_t *HK_FindCopyIndexSlot(CFE_SB_MsgId_t InputMid);
+
 /**
  * \brief Tear Down Old Copy Table
  *
@@ -86,6 +86,7 @@ void Test_HK_ProcessIncomingHkData_MidNotFound(void)
 
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_BuildCopyIndex(CopyTblPtr, RtTblPtr);
 
     /* Act */
     HK_ProcessIncomingHkData(&Buf);
@@ -135,6 +136,7 @@ void Test_HK_ProcessIncomingHkData_LengthOkEqual(void)
 
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_BuildCopyIndex(CopyTblPtr, RtTblPtr);
 
     forced_MsgID = CopyTblPtr[2].InputMid;
     forced_Size  = (CopyTblPtr[2].InputOffset + CopyTblPtr[2].NumBytes);
@@ -193,6 +195,7 @@ void Test_HK_ProcessIncomingHkData_LengthOkGreater(void)
 
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_BuildCopyIndex(CopyTblPtr, RtTblPtr);
 
     forced_MsgID = CopyTblPtr[2].InputMid;
     forced_Size  = (CopyTblPtr[2].InputOffset + CopyTblPtr[2].NumBytes) + 2;
@@ -248,6 +251,7 @@ void Test_HK_ProcessIncomingHkData_MessageError(void)
 
     HK_AppData.CopyTablePtr    = CopyTblPtr;
     HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_BuildCopyIndex(CopyTblPtr, RtTblPtr);
 
     forced_MsgID = CopyTblPtr[2].InputMid;
     forced_Size  = (CopyTblPtr[2].InputOffset + CopyTblPtr[2].NumBytes) - 2;
@@ -286,6 +290,169 @@ void Test_HK_ProcessIncomingHkData_MessageError(void)
     UtAssert_INT32_EQ(NumEntriesWithDataPresent, 0);
 }
 
+/*
+ * Function under test: HK_ProcessIncomingHkData
+ *
+ * Case: Tests that adjacent entries for the same input MID are merged into
+ *       a single copy run, and that each entry's data lands where the copy
+ *       table says it should.
+ */
+void Test_HK_ProcessIncomingHkData_CoalescedRun(void)
+{
+    /* Arrange */
+    int32               i;
+    int32               NumEntriesWithDataPresent = 0;
+    CFE_SB_MsgId_t      forced_MsgID              = HK_UT_MID_100;
+    size_t              forced_Size               = 32;
+    CFE_SB_Buffer_t     Buf[8];
+    CFE_SB_Buffer_t     OutputPkt[8];
+    uint8 *             InBytes  = (uint8 *)Buf;
+    uint8 *             OutBytes = (uint8 *)OutputPkt;
+    HK_CopyIndexSlot_t *Slot;
+
+    hk_runtime_tbl_entry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    hk_copy_table_entry_t  CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+    memset(CopyTblPtr, 0, sizeof(CopyTblPtr));
+    memset(OutputPkt, 0, sizeof(OutputPkt));
+
+    for (i = 0; i < sizeof(Buf); i++)
+    {
+        InBytes[i] = i;
+    }
+
+    /* Entries 0-2 are contiguous in both packets, entry 3 is not */
+    CopyTblPtr[0].InputOffset  = 12;
+    CopyTblPtr[0].OutputOffset = 40;
+    CopyTblPtr[0].NumBytes     = 2;
+    CopyTblPtr[1].InputOffset  = 14;
+    CopyTblPtr[1].OutputOffset = 42;
+    CopyTblPtr[1].NumBytes     = 2;
+    CopyTblPtr[2].InputOffset  = 16;
+    CopyTblPtr[2].OutputOffset = 44;
+    CopyTblPtr[2].NumBytes     = 4;
+    CopyTblPtr[3].InputOffset  = 24;
+    CopyTblPtr[3].OutputOffset = 52;
+    CopyTblPtr[3].NumBytes     = 4;
+
+    /* Entry 4 has no output packet, so has nowhere to copy to */
+    CopyTblPtr[4].InputOffset  = 12;
+    CopyTblPtr[4].OutputOffset = 60;
+    CopyTblPtr[4].NumBytes     = 4;
+
+    for (i = 0; i < 5; i++)
+    {
+        CopyTblPtr[i].InputMid    = HK_UT_MID_100;
+        CopyTblPtr[i].OutputMid   = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+        RtTblPtr[i].OutputPktAddr = OutputPkt;
+    }
+    RtTblPtr[4].OutputPktAddr = NULL;
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_BuildCopyIndex(CopyTblPtr, RtTblPtr);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Act */
+    HK_ProcessIncomingHkData(Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+
+    Slot = HK_FindCopyIndexSlot(HK_UT_MID_100);
+    UtAssert_UINT32_EQ(Slot->NumEntries, 4);
+    UtAssert_UINT32_EQ(Slot->NumRuns, 2);
+    UtAssert_UINT32_EQ(HK_AppData.CopyIndex.Runs[Slot->FirstRun].NumBytes, 8);
+    UtAssert_UINT32_EQ(HK_AppData.CopyIndex.Runs[Slot->FirstRun].NumEntries, 3);
+
+    UtAssert_MemCmp(&OutBytes[40], &InBytes[12], 8, "Coalesced run copied");
+    UtAssert_MemCmp(&OutBytes[52], &InBytes[24], 4, "Separate run copied");
+    UtAssert_ZERO(OutBytes[48]);
+    UtAssert_ZERO(OutBytes[60]);
+
+    for (i = 0; i < HK_COPY_TABLE_ENTRIES; i++)
+    {
+        if (RtTblPtr[i].DataPresent == HK_DATA_PRESENT)
+        {
+            NumEntriesWithDataPresent++;
+        }
+    }
+
+    UtAssert_INT32_EQ(NumEntriesWithDataPresent, 4);
+}
+
+/*
+ * Function under test: HK_ProcessIncomingHkData
+ *
+ * Case: Tests the case where a copy run extends past the end of the input
+ *       packet, so only the entry within the packet is copied and the
+ *       rest are counted as errors.
+ */
+void Test_HK_ProcessIncomingHkData_RunPastEnd(void)
+{
+    /* Arrange */
+    int32           i;
+    CFE_SB_MsgId_t  forced_MsgID = HK_UT_MID_100;
+    size_t          forced_Size  = 16;
+    CFE_SB_Buffer_t Buf[8];
+    CFE_SB_Buffer_t OutputPkt[8];
+    uint8 *         InBytes  = (uint8 *)Buf;
+    uint8 *         OutBytes = (uint8 *)OutputPkt;
+
+    hk_runtime_tbl_entry_t RtTblPtr[HK_COPY_TABLE_ENTRIES];
+    hk_copy_table_entry_t  CopyTblPtr[HK_COPY_TABLE_ENTRIES];
+
+    memset(RtTblPtr, 0, sizeof(RtTblPtr));
+    memset(CopyTblPtr, 0, sizeof(CopyTblPtr));
+    memset(OutputPkt, 0, sizeof(OutputPkt));
+
+    for (i = 0; i < sizeof(Buf); i++)
+    {
+        InBytes[i] = i;
+    }
+
+    /* One run of three entries, only the first of which is within the packet */
+    for (i = 0; i < 3; i++)
+    {
+        CopyTblPtr[i].InputMid     = HK_UT_MID_100;
+        CopyTblPtr[i].InputOffset  = 12 + (4 * i);
+        CopyTblPtr[i].OutputMid    = CFE_SB_ValueToMsgId(HK_COMBINED_PKT1_MID);
+        CopyTblPtr[i].OutputOffset = 40 + (4 * i);
+        CopyTblPtr[i].NumBytes     = 4;
+        RtTblPtr[i].OutputPktAddr  = OutputPkt;
+    }
+
+    HK_AppData.CopyTablePtr    = CopyTblPtr;
+    HK_AppData.RuntimeTablePtr = RtTblPtr;
+    HK_BuildCopyIndex(CopyTblPtr, RtTblPtr);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &forced_MsgID, sizeof(forced_MsgID), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &forced_Size, sizeof(forced_Size), false);
+
+    /* Act */
+    HK_ProcessIncomingHkData(Buf);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    /* Assert */
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HK_ACCESSING_PAST_PACKET_END_EID);
+
+    UtAssert_UINT32_EQ(HK_FindCopyIndexSlot(HK_UT_MID_100)->NumRuns, 1);
+
+    UtAssert_MemCmp(&OutBytes[40], &InBytes[12], 4, "Entry within packet copied");
+    UtAssert_ZERO(OutBytes[44]);
+
+    UtAssert_INT32_EQ(RtTblPtr[0].DataPresent, HK_DATA_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[1].DataPresent, HK_DATA_NOT_PRESENT);
+    UtAssert_INT32_EQ(RtTblPtr[2].DataPresent, HK_DATA_NOT_PRESENT);
+}
+
 /**********************************************************************/
 /*                                                                    */
 /* Test functions for HK_ValidateHkCopyTable                          */
@@ -903,6 +1070,9 @@ void Test_HK_TearDownOldCopyTable_Success(void)
 
     HK_Test_InitGoodCopyTable(CopyTblPtr);
     HK_Test_InitGoodRuntimeTable(RtTblPtr);
+    HK_BuildCopyIndex(CopyTblPtr, RtTblPtr);
+
+    UtAssert_UINT32_EQ(HK_FindCopyIndexSlot(CopyTblPtr[0].InputMid)->NumEntries, 2);
 
     /* Act */
     ReturnValue = HK_TearDownOldCopyTable(CopyTblPtr, RtTblPtr);
@@ -919,6 +1089,9 @@ void Test_HK_TearDownOldCopyTable_Success(void)
         UtAssert_True(RtTblPtr[i].OutputPktAddr == NULL, "RtTblPtr[%d].OutputPktAddr == NULL", i);
         UtAssert_INT32_EQ(RtTblPtr[i].InputMidSubscribed, HK_INPUTMID_NOT_SUBSCRIBED);
     }
+
+    /* incoming packets must no longer be copied into the freed packets */
+    UtAssert_ZERO(HK_FindCopyIndexSlot(CopyTblPtr[0].InputMid)->NumEntries);
 }
 
 /*
@@ -1929,6 +2102,10 @@ void UtTest_Setup(void)
                "Test_HK_ProcessIncomingHkData_LengthOkGreater");
     UtTest_Add(Test_HK_ProcessIncomingHkData_MessageError, HK_Test_Setup, HK_Test_TearDown,
                "Test_HK_ProcessIncomingHkData_MessageError");
+    UtTest_Add(Test_HK_ProcessIncomingHkData_CoalescedRun, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ProcessIncomingHkData_CoalescedRun");
+    UtTest_Add(Test_HK_ProcessIncomingHkData_RunPastEnd, HK_Test_Setup, HK_Test_TearDown,
+               "Test_HK_ProcessIncomingHkData_RunPastEnd");
 
     /* Test functions for HK_VaidateHkCopyTable */
     UtTest_Add(Test_HK_ValidateHkCopyTable_Success, HK_Test_Setup, HK_Test_TearDown,
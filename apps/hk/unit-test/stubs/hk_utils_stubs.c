@@ -26,6 +26,19 @@
 #include "hk_utils.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HK_BuildCopyIndex()
+ * ----------------------------------------------------
+ */
+void HK_BuildCopyIndex(const hk_copy_table_entry_t *CpyTblPtr, const hk_runtime_tbl_entry_t *RtTblPtr)
+{
+    UT_GenStub_AddParam(HK_BuildCopyIndex, const hk_copy_table_entry_t *, CpyTblPtr);
+    UT_GenStub_AddParam(HK_BuildCopyIndex, const hk_runtime_tbl_entry_t *, RtTblPtr);
+
+    UT_GenStub_Execute(HK_BuildCopyIndex, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_CheckForMissingData()
@@ -85,6 +98,22 @@ int32 HK_CheckStatusOfTables(void)
     return UT_GenStub_GetReturnValue(HK_CheckStatusOfTables, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for HK_FindCopyIndexSlot()
+ * ----------------------------------------------------
+ */
+HK_CopyIndexSlot_t *HK_FindCopyIndexSlot(CFE_SB_MsgId_t InputMid)
+{
+    UT_GenStub_SetupReturnBuffer(HK_FindCopyIndexSlot, HK_CopyIndexSlot_t *);
+
+    UT_GenStub_AddParam(HK_FindCopyIndexSlot, CFE_SB_MsgId_t, InputMid);
+
+    UT_GenStub_Execute(HK_FindCopyIndexSlot, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(HK_FindCopyIndexSlot, HK_CopyIndexSlot_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for HK_ProcessIncomingHkData()
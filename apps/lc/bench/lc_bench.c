@@ -0,0 +1,325 @@
+/**
+ * @file
+ *
+ * Measures the per-cycle cost of LC watchpoint and actionpoint evaluation,
+ * i.e. the work LC does at 10 Hz: every monitored message is checked against
+ * its watchpoints (LC_CheckMsgForWPs) and then all actionpoints are sampled
+ * (LC_SampleAPs).  Three cases are run:
+ *
+ * - no watchpoint results change from one cycle to the next;
+ * - the data of 2 of the 16 messages toggles, flipping 1/8 of the results;
+ * - the data of every message toggles, flipping every result.
+ *
+ * The entries of the stock lc_def_wdt.c and lc_def_adt.c tables are all
+ * unused, so the bench fills in its own tables instead: the watchpoints cover
+ * all data types and operators, and the actionpoints use the two equation
+ * shapes given as examples in the lc_def_adt.c comments.
+ *
+ * The LC sources are linked as is, the cFE calls they make are replaced by
+ * the minimal shims at the end of this file.  Build with the LC_BENCH cmake
+ * option, or by hand with the same include paths as the lc app:
+ *
+ *   cc -O2 -I../fsw/inc -I../fsw/src -I<cfe and osal includes> lc_bench.c \
+ *      ../fsw/src/lc_watch.c ../fsw/src/lc_action.c ../fsw/src/lc_custom.c -lm -o lc_bench
+ *
+ * and run as "lc_bench [cycles]".  To compare with the interpreted evaluation
+ * used before the tables were compiled at load time, build the same way
+ * against the LC sources from before that change, adding -DLC_BENCH_BASELINE.
+ */
+
+#include "lc_app.h"
+#include "lc_watch.h"
+#include "lc_action.h"
+#include "lc_tbl.h"
+#include "lc_msgdefs.h"
+#include "lc_eventids.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_NUM_MSGS     16
+#define BENCH_DATA_SIZE    64
+#define BENCH_BASE_MSGID   0x0900
+#define BENCH_WP_PER_MSG   ((LC_MAX_WATCHPOINTS + BENCH_NUM_MSGS - 1) / BENCH_NUM_MSGS)
+#define BENCH_DATA_OFFSET  sizeof(CFE_MSG_TelemetryHeader_t)
+#define BENCH_TOGGLE_FEW   2
+
+typedef union
+{
+    CFE_SB_Buffer_t SBBuf;
+    struct
+    {
+        CFE_MSG_TelemetryHeader_t Hdr;
+        uint8                     Data[BENCH_DATA_SIZE];
+    } Tlm;
+} Bench_Msg_t;
+
+LC_OperData_t LC_OperData;
+LC_AppData_t  LC_AppData;
+
+static LC_WDTEntry_t BenchWDT[LC_MAX_WATCHPOINTS];
+static LC_ADTEntry_t BenchADT[LC_MAX_ACTIONPOINTS];
+static LC_WRTEntry_t BenchWRT[LC_MAX_WATCHPOINTS];
+static LC_ARTEntry_t BenchART[LC_MAX_ACTIONPOINTS];
+static Bench_Msg_t   BenchMsgs[BENCH_NUM_MSGS];
+
+static const uint8 DataTypes[] = {LC_DATA_BYTE,     LC_DATA_UBYTE,     LC_DATA_WORD_BE,  LC_DATA_WORD_LE,
+                                  LC_DATA_UWORD_BE, LC_DATA_UWORD_LE,  LC_DATA_DWORD_BE, LC_DATA_DWORD_LE,
+                                  LC_DATA_UDWORD_BE, LC_DATA_UDWORD_LE, LC_DATA_FLOAT_BE, LC_DATA_FLOAT_LE};
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+/*
+ * Each watchpoint compares 4 bytes of its message with zero, so it flips
+ * when the message data toggles between all 0x00 and all 0x20 (positive in
+ * every data type).  Half use GT and half LE, so both results occur.
+ */
+static void FillWDT(void)
+{
+    LC_WDTEntry_t *WP;
+    uint32         i;
+
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        WP = &BenchWDT[i];
+        memset(WP, 0, sizeof(*WP));
+
+        WP->DataType           = DataTypes[i % sizeof(DataTypes)];
+        WP->OperatorID         = (i & 1) ? LC_OPER_LE : LC_OPER_GT;
+        WP->MessageID          = CFE_SB_ValueToMsgId(BENCH_BASE_MSGID + i / BENCH_WP_PER_MSG);
+        WP->WatchpointOffset   = BENCH_DATA_OFFSET + 4 * (i % BENCH_WP_PER_MSG);
+        WP->BitMask            = LC_NO_BITMASK;
+        WP->ResultAgeWhenStale = 0;
+    }
+}
+
+/* the #43 and #47 example equations of lc_def_adt.c, on successive watchpoints */
+static void FillADT(void)
+{
+    LC_ADTEntry_t *AP;
+    uint16 *       Rpn;
+    uint16         Wp;
+    uint32         i;
+
+    for (i = 0; i < LC_MAX_ACTIONPOINTS; i++)
+    {
+        AP = &BenchADT[i];
+        memset(AP, 0, sizeof(*AP));
+
+        AP->DefaultState      = LC_APSTATE_ACTIVE;
+        AP->MaxPassiveEvents  = 2;
+        AP->MaxPassFailEvents = 2;
+        AP->MaxFailPassEvents = 2;
+        AP->RTSId             = 1;
+        AP->MaxFailsBeforeRTS = 0xFFFF;
+        AP->EventType         = CFE_EVS_EventType_INFORMATION;
+        AP->EventID           = LC_BASE_AP_EID + i;
+        snprintf(AP->EventText, sizeof(AP->EventText), "AP %u", (unsigned int)i);
+
+        Wp  = i;
+        Rpn = AP->RPNEquation;
+        if (i & 1)
+        {
+            /* !WP_a && (WP_b || WP_c || WP_d || WP_e) */
+            *Rpn++ = Wp;
+            *Rpn++ = LC_RPN_NOT;
+            *Rpn++ = (Wp + 1) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = (Wp + 2) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = (Wp + 3) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = (Wp + 4) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = LC_RPN_OR;
+            *Rpn++ = LC_RPN_OR;
+            *Rpn++ = LC_RPN_OR;
+            *Rpn++ = LC_RPN_AND;
+        }
+        else
+        {
+            /* WP_a && !WP_b && !WP_c && !WP_d && WP_e && WP_f */
+            *Rpn++ = Wp;
+            *Rpn++ = (Wp + 1) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = LC_RPN_NOT;
+            *Rpn++ = LC_RPN_AND;
+            *Rpn++ = (Wp + 2) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = LC_RPN_NOT;
+            *Rpn++ = LC_RPN_AND;
+            *Rpn++ = (Wp + 3) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = LC_RPN_NOT;
+            *Rpn++ = LC_RPN_AND;
+            *Rpn++ = (Wp + 4) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = LC_RPN_AND;
+            *Rpn++ = (Wp + 5) % LC_MAX_WATCHPOINTS;
+            *Rpn++ = LC_RPN_AND;
+        }
+        *Rpn = LC_RPN_EQUAL;
+    }
+}
+
+/* what LC does when new tables are loaded, see LC_ManageTables() */
+static void LoadTables(void)
+{
+    uint32 i;
+
+    memset(&LC_OperData, 0, sizeof(LC_OperData));
+    memset(&LC_AppData, 0, sizeof(LC_AppData));
+    memset(BenchWRT, 0, sizeof(BenchWRT));
+    memset(BenchART, 0, sizeof(BenchART));
+
+    LC_OperData.WDTPtr        = BenchWDT;
+    LC_OperData.ADTPtr        = BenchADT;
+    LC_OperData.WRTPtr        = BenchWRT;
+    LC_OperData.ARTPtr        = BenchART;
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        BenchWRT[i].WatchResult = LC_WATCH_STALE;
+    }
+    for (i = 0; i < LC_MAX_ACTIONPOINTS; i++)
+    {
+        BenchART[i].ActionResult = LC_ACTION_STALE;
+        BenchART[i].CurrentState = BenchADT[i].DefaultState;
+    }
+
+    LC_CreateHashTable();
+#ifndef LC_BENCH_BASELINE
+    LC_CompileADT();
+#endif
+}
+
+static void RunCycles(long Cycles, uint32 NumToggled, double *CyclePtr, double *SamplePtr)
+{
+    double Start;
+    double SampleTime;
+    double T;
+    long   c;
+    uint32 m;
+
+    for (m = 0; m < BENCH_NUM_MSGS; m++)
+    {
+        memset(BenchMsgs[m].Tlm.Data, 0, sizeof(BenchMsgs[m].Tlm.Data));
+    }
+
+    SampleTime = 0;
+    Start      = Now();
+    for (c = 0; c < Cycles; c++)
+    {
+        for (m = 0; m < NumToggled; m++)
+        {
+            memset(BenchMsgs[m].Tlm.Data, (c & 1) ? 0x20 : 0, sizeof(BenchMsgs[m].Tlm.Data));
+        }
+
+        for (m = 0; m < BENCH_NUM_MSGS; m++)
+        {
+            LC_CheckMsgForWPs(CFE_SB_ValueToMsgId(BENCH_BASE_MSGID + m), &BenchMsgs[m].SBBuf);
+        }
+
+        T = Now();
+        LC_SampleAPs(0, LC_MAX_ACTIONPOINTS - 1);
+        SampleTime += Now() - T;
+    }
+
+    *CyclePtr  = (Now() - Start) / Cycles;
+    *SamplePtr = SampleTime / Cycles;
+}
+
+int main(int argc, char *argv[])
+{
+    static const uint32 Toggled[] = {0, BENCH_TOGGLE_FEW, BENCH_NUM_MSGS};
+    static const char * Names[]   = {"no WP changes", "1/8 of WPs change", "every WP changes"};
+    long                Cycles    = argc > 1 ? atol(argv[1]) : 20000;
+    double              CycleTime;
+    double              SampleTime;
+    size_t              i;
+
+    FillWDT();
+    FillADT();
+    LoadTables();
+
+    printf("%u watchpoints on %u messages, %u actionpoints\n", (unsigned int)LC_MAX_WATCHPOINTS,
+           (unsigned int)BENCH_NUM_MSGS, (unsigned int)LC_MAX_ACTIONPOINTS);
+    printf("%-20s %16s %16s\n", "", "cycle (us)", "SampleAPs (us)");
+
+    for (i = 0; i < sizeof(Toggled) / sizeof(Toggled[0]); i++)
+    {
+        /* one untimed cycle so that every case starts from the same results */
+        RunCycles(1, Toggled[i], &CycleTime, &SampleTime);
+        RunCycles(Cycles, Toggled[i], &CycleTime, &SampleTime);
+
+        printf("%-20s %16.2f %16.2f\n", Names[i], CycleTime * 1e6, SampleTime * 1e6);
+    }
+
+    return 0;
+}
+
+/*
+ * Minimal shims for the cFE calls made by the LC sources
+ */
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    return CFE_SUCCESS;
+}
+
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit) {}
+
+CFE_Status_t CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_SetFcnCode(CFE_MSG_Message_t *MsgPtr, CFE_MSG_FcnCode_t FcnCode)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    *MsgId = CFE_SB_ValueToMsgId(BENCH_BASE_MSGID + ((const Bench_Msg_t *)MsgPtr - BenchMsgs));
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetMsgTime(const CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t *Time)
+{
+    Time->Seconds    = 1;
+    Time->Subseconds = 0;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    *Size = sizeof(Bench_Msg_t);
+    return CFE_SUCCESS;
+}
+
+bool CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId)
+{
+    return true;
+}
+
+CFE_Status_t CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
+{
+    CFE_TIME_SysTime_t Time = {1, 0};
+    return Time;
+}
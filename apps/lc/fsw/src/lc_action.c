@@ -79,10 +79,11 @@ void LC_SampleAPs(uint16 StartIndex, uint16 EndIndex)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void LC_SampleSingleAP(uint16 APNumber)
 {
-    uint8 CurrentAPState;
-    uint8 PreviousResult;
-    uint8 CurrentResult;
-    char  EventText[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    LC_CompiledAP_t *CompiledAP = &LC_OperData.CompiledAPs[APNumber];
+    uint8            CurrentAPState;
+    uint8            PreviousResult;
+    uint8            CurrentResult;
+    char             EventText[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     /*
     ** We only do the sample if the actionpoint is active
@@ -101,7 +102,18 @@ void LC_SampleSingleAP(uint16 APNumber)
 
         PreviousResult = LC_OperData.ARTPtr[APNumber].ActionResult;
 
-        CurrentResult = LC_EvaluateRPN(APNumber);
+        /*
+        ** The equation only needs to be evaluated again when one of
+        ** the watchpoint results it uses has changed. An illegal
+        ** equation stays dirty so the error is reported every sample.
+        */
+        if (CompiledAP->IsDirty)
+        {
+            CompiledAP->Result  = LC_EvaluateRPN(APNumber);
+            CompiledAP->IsDirty = !CompiledAP->IsValid;
+        }
+
+        CurrentResult = CompiledAP->Result;
 
         LC_OperData.ARTPtr[APNumber].ActionResult = CurrentResult;
 
@@ -267,43 +279,36 @@ void LC_SampleSingleAP(uint16 APNumber)
 /* actionpoint                                                     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-
-/*
- * StackPtr is an index into an array RPNStack (see LC_EvaluateRPN)
- * which contains values to be used in an RPN function.  This macro
- * validates the StackPtr to confirm that another operand is present
- * in the RPMStack array, then returns the next element.
- */
-#define POP_RPN_DATA ((StackPtr <= 0) ? (IllegalRPN = true) : (RPNStack[--StackPtr]))
 uint8 LC_EvaluateRPN(uint16 APNumber)
 {
-    bool   Done;
-    bool   IllegalRPN;
-    bool   IllegalOperand;
-    uint8  EvalResult = LC_ACTION_ERROR;
-    int32  RPNEquationPtr;
-    int32  StackPtr;
-    uint16 RPNData;
-    uint16 RPNStack[LC_MAX_RPN_EQU_SIZE];
-    uint16 Operand1;
-    uint16 Operand2;
-
-    StackPtr       = 0;
-    RPNEquationPtr = 0;
-    IllegalRPN     = false;
-    IllegalOperand = false;
-    Done           = false;
+    const LC_CompiledAP_t *CompiledAP = &LC_OperData.CompiledAPs[APNumber];
+    uint8                  EvalResult;
+    uint16                 CodeIndex;
+    uint16                 StackPtr;
+    uint16                 RPNData;
+    uint8                  RPNStack[LC_MAX_RPN_EQU_SIZE];
+    uint8                  Operand1;
+    uint8                  Operand2;
 
     /*
-    ** Keep going till we're done or till we get an error
+    ** The equation was checked when it was compiled, so a legal
+    ** equation can neither underflow the stack nor run past the
+    ** end of the code, and always leaves exactly one result
     */
-    while ((Done == false) && (IllegalRPN == false) && (IllegalOperand == false))
+    if (CompiledAP->IsValid == false)
     {
-        /*
-        **  Pick off each piece of the RPN equation and handle
-        **  one at a time
-        */
-        RPNData = LC_OperData.ADTPtr[APNumber].RPNEquation[RPNEquationPtr++];
+        CFE_EVS_SendEvent(LC_INVALID_RPN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "AP has illegal RPN expression: AP = %d, LastOperand = %d, StackPtr = %d", APNumber,
+                          (int)CompiledAP->ErrorIndex, (int)CompiledAP->ErrorDepth);
+
+        return LC_ACTION_ERROR;
+    }
+
+    StackPtr = 0;
+
+    for (CodeIndex = 0; CodeIndex < CompiledAP->CodeLength; CodeIndex++)
+    {
+        RPNData = CompiledAP->Code[CodeIndex];
 
         /*
         **  The data is either an RPN operator or a watchpoint number
@@ -316,8 +321,8 @@ uint8 LC_EvaluateRPN(uint16 APNumber)
             **  result of a previous RPN operation
             */
             case LC_RPN_AND:
-                Operand2 = POP_RPN_DATA;
-                Operand1 = POP_RPN_DATA;
+                Operand2 = RPNStack[--StackPtr];
+                Operand1 = RPNStack[--StackPtr];
                 if ((Operand1 == LC_WATCH_FALSE) || (Operand2 == LC_WATCH_FALSE))
                 {
                     RPNStack[StackPtr++] = LC_WATCH_FALSE;
@@ -337,8 +342,8 @@ uint8 LC_EvaluateRPN(uint16 APNumber)
                 break;
 
             case LC_RPN_OR:
-                Operand2 = POP_RPN_DATA;
-                Operand1 = POP_RPN_DATA;
+                Operand2 = RPNStack[--StackPtr];
+                Operand1 = RPNStack[--StackPtr];
                 if ((Operand1 == LC_WATCH_TRUE) || (Operand2 == LC_WATCH_TRUE))
                 {
                     RPNStack[StackPtr++] = LC_WATCH_TRUE;
@@ -358,8 +363,8 @@ uint8 LC_EvaluateRPN(uint16 APNumber)
                 break;
 
             case LC_RPN_XOR:
-                Operand2 = POP_RPN_DATA;
-                Operand1 = POP_RPN_DATA;
+                Operand2 = RPNStack[--StackPtr];
+                Operand1 = RPNStack[--StackPtr];
                 if ((Operand1 == LC_WATCH_ERROR) || (Operand2 == LC_WATCH_ERROR))
                 {
                     RPNStack[StackPtr++] = LC_WATCH_ERROR;
@@ -375,7 +380,7 @@ uint8 LC_EvaluateRPN(uint16 APNumber)
                 break;
 
             case LC_RPN_NOT:
-                Operand1 = POP_RPN_DATA;
+                Operand1 = RPNStack[--StackPtr];
                 if (Operand1 == LC_WATCH_ERROR)
                 {
                     RPNStack[StackPtr++] = LC_WATCH_ERROR;
@@ -390,61 +395,21 @@ uint8 LC_EvaluateRPN(uint16 APNumber)
                 }
                 break;
 
-            case LC_RPN_EQUAL:
-                EvalResult = POP_RPN_DATA;
-                if ((EvalResult == LC_WATCH_ERROR) || (EvalResult == LC_WATCH_STALE))
-                {
-                    IllegalOperand = true;
-                }
-                else if (StackPtr == 0)
-                {
-                    Done = true;
-                }
-                else
-                {
-                    IllegalRPN = true;
-                }
-                break;
-
             /*
-            **  If the data is a watchpoint number then the operand is
-            **  the current value of that watchpoint result
+            **  Otherwise the data is a watchpoint number and the
+            **  operand is the current value of that watchpoint result
             */
             default:
-                if (RPNData < LC_MAX_WATCHPOINTS)
-                {
-                    RPNStack[StackPtr++] = LC_OperData.WRTPtr[RPNData].WatchResult;
-                }
-                else
-                {
-                    IllegalRPN = true;
-                }
+                RPNStack[StackPtr++] = LC_OperData.WRTPtr[RPNData].WatchResult;
                 break;
 
         } /* end switch */
 
-        /*
-        ** If still not done and have no errors - check for the end of the buffer
-        */
-        if ((Done == false) && (IllegalRPN == false) && (IllegalOperand == false))
-        {
-            if (RPNEquationPtr >= LC_MAX_RPN_EQU_SIZE)
-            {
-                IllegalRPN = true;
-            }
-        }
-
-    } /* end while */
+    } /* end for */
 
-    if (IllegalRPN == true)
-    {
-        CFE_EVS_SendEvent(LC_INVALID_RPN_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "AP has illegal RPN expression: AP = %d, LastOperand = %d, StackPtr = %d", APNumber,
-                          (int)(RPNEquationPtr - 1), (int)StackPtr);
+    EvalResult = RPNStack[0];
 
-        EvalResult = LC_ACTION_ERROR;
-    }
-    else if (EvalResult == LC_WATCH_ERROR)
+    if (EvalResult == LC_WATCH_ERROR)
     {
         EvalResult = LC_ACTION_ERROR;
     }
@@ -464,6 +429,120 @@ uint8 LC_EvaluateRPN(uint16 APNumber)
     return EvalResult;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the Reverse Polish Notation (RPN) equation for an       */
+/* actionpoint                                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CompileAP(uint16 APNumber)
+{
+    const uint16 *   RPNEquation = LC_OperData.ADTPtr[APNumber].RPNEquation;
+    LC_CompiledAP_t *CompiledAP  = &LC_OperData.CompiledAPs[APNumber];
+    int32            ErrorIndex  = 0;
+    int32            ErrorDepth  = 0;
+
+    memset(CompiledAP, 0, sizeof(*CompiledAP));
+
+    if (LC_ValidateRPN(RPNEquation, &ErrorIndex, &ErrorDepth) == LC_ADTVAL_ERR_NONE)
+    {
+        /*
+        ** Keep everything up to the "=" symbol, which validation
+        ** guarantees is present and leaves exactly one result
+        */
+        while (RPNEquation[CompiledAP->CodeLength] != LC_RPN_EQUAL)
+        {
+            CompiledAP->Code[CompiledAP->CodeLength] = RPNEquation[CompiledAP->CodeLength];
+            CompiledAP->CodeLength++;
+        }
+
+        CompiledAP->IsValid = true;
+    }
+    else
+    {
+        CompiledAP->ErrorIndex = (uint16)ErrorIndex;
+        CompiledAP->ErrorDepth = (int16)ErrorDepth;
+    }
+
+    /*
+    ** Nothing has been evaluated yet
+    */
+    CompiledAP->IsDirty = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the actionpoint definition table (ADT)                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CompileADT(void)
+{
+    const LC_CompiledAP_t *CompiledAP;
+    uint16                 APNumber;
+    uint16                 CodeIndex;
+    uint16                 RPNData;
+    uint32                 WatchIndex;
+
+    memset(LC_OperData.APRefStart, 0, sizeof(LC_OperData.APRefStart));
+
+    /*
+    ** Compile each equation and count the references to each watchpoint
+    */
+    for (APNumber = 0; APNumber < LC_MAX_ACTIONPOINTS; APNumber++)
+    {
+        LC_CompileAP(APNumber);
+
+        CompiledAP = &LC_OperData.CompiledAPs[APNumber];
+        for (CodeIndex = 0; CodeIndex < CompiledAP->CodeLength; CodeIndex++)
+        {
+            RPNData = CompiledAP->Code[CodeIndex];
+            if (RPNData < LC_MAX_WATCHPOINTS)
+            {
+                LC_OperData.APRefStart[RPNData]++;
+            }
+        }
+    }
+
+    /*
+    ** Turn the counts into the end of each watchpoint's section of
+    ** APRefs, then fill each section backwards so that every start
+    ** index ends up in APRefStart. The final entry is the total.
+    */
+    for (WatchIndex = 1; WatchIndex <= LC_MAX_WATCHPOINTS; WatchIndex++)
+    {
+        LC_OperData.APRefStart[WatchIndex] += LC_OperData.APRefStart[WatchIndex - 1];
+    }
+
+    for (APNumber = LC_MAX_ACTIONPOINTS; APNumber > 0; APNumber--)
+    {
+        CompiledAP = &LC_OperData.CompiledAPs[APNumber - 1];
+        for (CodeIndex = CompiledAP->CodeLength; CodeIndex > 0; CodeIndex--)
+        {
+            RPNData = CompiledAP->Code[CodeIndex - 1];
+            if (RPNData < LC_MAX_WATCHPOINTS)
+            {
+                LC_OperData.APRefs[--LC_OperData.APRefStart[RPNData]] = APNumber - 1;
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark the actionpoints using a watchpoint for evaluation         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_WatchResultChanged(uint16 WatchIndex)
+{
+    uint32 RefIndex;
+
+    for (RefIndex = LC_OperData.APRefStart[WatchIndex]; RefIndex < LC_OperData.APRefStart[WatchIndex + 1];
+         RefIndex++)
+    {
+        LC_OperData.CompiledAPs[LC_OperData.APRefs[RefIndex]].IsDirty = true;
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Validate the actionpoint definition table (ADT)                 */
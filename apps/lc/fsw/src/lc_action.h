@@ -144,6 +144,56 @@ void LC_SampleSingleAP(uint16 APNumber);
  */
 uint8 LC_EvaluateRPN(uint16 APNumber);
 
+/**
+ * \brief Compile RPN
+ *
+ *  \par Description
+ *       Support function for actionpoint processing that validates
+ *       the reverse polish notation (RPN) equation for the specified
+ *       actionpoint and copies it into the compiled actionpoint used
+ *       by #LC_EvaluateRPN. The actionpoint is marked for evaluation.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       An illegal equation is reported by #LC_EvaluateRPN each time
+ *       the actionpoint is evaluated.
+ *
+ *  \param [in]   APNumber     The actionpoint number to compile (zero
+ *                             based actionpoint definition table index)
+ */
+void LC_CompileAP(uint16 APNumber);
+
+/**
+ * \brief Compile actionpoint definition table
+ *
+ *  \par Description
+ *       Compiles every actionpoint equation with #LC_CompileAP and
+ *       builds the list of actionpoints that use each watchpoint,
+ *       which #LC_WatchResultChanged uses to find the actionpoints
+ *       that need to be evaluated again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called whenever the actionpoint definition table
+ *       is loaded.
+ */
+void LC_CompileADT(void);
+
+/**
+ * \brief Watchpoint result changed
+ *
+ *  \par Description
+ *       Marks every actionpoint whose equation uses the specified
+ *       watchpoint for evaluation the next time it is sampled.
+ *       Actionpoints that are not marked reuse their last result.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called whenever a watchpoint result is set to a
+ *       different value.
+ *
+ *  \param [in]   WatchIndex   The watchpoint number that changed (zero
+ *                             based watchpoint definition table index)
+ */
+void LC_WatchResultChanged(uint16 WatchIndex);
+
 /**
  * \brief Validate RPN expression
  *
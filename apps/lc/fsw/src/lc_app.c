@@ -465,6 +465,11 @@ CFE_Status_t LC_TableInit(void)
     {
         LC_CreateHashTable();
 
+        /*
+        ** Compile actionpoint equations and watchpoint references
+        */
+        LC_CompileADT();
+
         /*
         ** Display results of CDS initialization (if enabled at startup)
         */
@@ -123,6 +123,45 @@ typedef struct LC_MListTag
     LC_WatchPtList_t *WatchPtList; /**< \brief Watchpoint list for this MessageID */
 } LC_MessageList_t;
 
+/**
+ *  \brief Watchpoint compiled from a WDT entry
+ *
+ *  Everything needed to extract and compare the watchpoint data is
+ *  decoded once from the WDT when the table is loaded rather than for
+ *  every sample.
+ */
+typedef struct
+{
+    uint32         WatchpointOffset; /**< \brief Byte offset of the data within the message */
+    uint32         BitMask;          /**< \brief Value to be masked with watchpoint data prior to comparison */
+    uint32         ValueMask;        /**< \brief Truncates masked data back down to the watchpoint size */
+    uint32         SignBit;          /**< \brief Sign bit of an 8 or 16 bit signed data type, zero otherwise */
+    LC_MultiType_t ComparisonValue;  /**< \brief Comparison value, extended to 32 bits for integer types */
+    uint8          Extract;          /**< \brief How to read the data from the message, see #LC_WP_EXTRACT_8 */
+    uint8          Compare;          /**< \brief Which comparison to use, see #LC_WP_COMPARE_SIGNED */
+    uint8          OperatorID;       /**< \brief Comparison type (enumerated) */
+    uint8          NumBytes;         /**< \brief Size of the data in the message, zero for an invalid data type */
+} LC_CompiledWP_t;
+
+/**
+ *  \brief Actionpoint compiled from an ADT entry
+ *
+ *  The RPN equation is checked once when the table is loaded, so the
+ *  code can be evaluated without checking for stack underflow or for
+ *  running off the end of the equation.
+ */
+typedef struct
+{
+    uint16 Code[LC_MAX_RPN_EQU_SIZE]; /**< \brief RPN equation up to, but not including, #LC_RPN_EQUAL */
+    uint16 CodeLength;                /**< \brief Number of entries used in Code */
+    uint16 ErrorIndex;                /**< \brief RPN index of the error when the equation is illegal */
+    int16  ErrorDepth;                /**< \brief Stack depth at the error when the equation is illegal */
+    uint8  Result;                    /**< \brief Result of the last evaluation */
+    bool   IsValid;                   /**< \brief Equation is legal */
+    bool   IsDirty;                   /**< \brief A watchpoint result used by the equation has changed
+                                                   since the last evaluation */
+} LC_CompiledAP_t;
+
 /************************************************************************
  * Type Definitions
  ************************************************************************/
@@ -172,6 +211,15 @@ typedef struct
     LC_MessageList_t MessageLinks[LC_MAX_WATCHPOINTS]; /**< \brief Message linked list elements */
     LC_WatchPtList_t WatchPtLinks[LC_MAX_WATCHPOINTS]; /**< \brief WatchPoint linked list elements */
 
+    LC_CompiledWP_t CompiledWPs[LC_MAX_WATCHPOINTS];  /**< \brief Watchpoints compiled from the WDT */
+    LC_CompiledAP_t CompiledAPs[LC_MAX_ACTIONPOINTS]; /**< \brief Actionpoints compiled from the ADT */
+
+    uint16 APRefStart[LC_MAX_WATCHPOINTS + 1]; /**< \brief Start of the APRefs entries for each watchpoint,
+                                                           the entries for watchpoint N end at the
+                                                           start for watchpoint N + 1 */
+    uint16 APRefs[LC_MAX_ACTIONPOINTS * (LC_MAX_RPN_EQU_SIZE / 2)]; /**< \brief Actionpoints that use each
+                                                                                watchpoint in their equation */
+
     bool HaveActiveCDS; /**< \brief Critical Data Store in use flag      */
 } LC_OperData_t;
 
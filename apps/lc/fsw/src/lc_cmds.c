@@ -101,6 +101,7 @@ void LC_SampleAPReq(const CFE_SB_Buffer_t *BufPtr)
                 if (LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0)
                 {
                     LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_STALE;
+                    LC_WatchResultChanged(WatchIndex);
                 }
             }
         }
@@ -636,6 +637,7 @@ void LC_ResetResultsWP(uint32 StartIndex, uint32 EndIndex, bool ResetStatsCmd)
             /* reset WP stats command does not modify most recent test result */
             LC_OperData.WRTPtr[TableIndex].WatchResult      = LC_WATCH_STALE;
             LC_OperData.WRTPtr[TableIndex].CountdownToStale = 0;
+            LC_WatchResultChanged(TableIndex);
         }
 
         LC_OperData.WRTPtr[TableIndex].EvaluationCount      = 0;
@@ -93,6 +93,11 @@ CFE_Status_t LC_ManageTables(void)
         ** Clear actionpoint results for previous table
         */
         LC_ResetResultsAP(0, LC_MAX_ACTIONPOINTS - 1, false);
+
+        /*
+        ** Compile actionpoint equations and watchpoint references
+        */
+        LC_CompileADT();
     }
     else if (Result != CFE_SUCCESS)
     {
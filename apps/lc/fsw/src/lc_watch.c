@@ -27,6 +27,7 @@
 *************************************************************************/
 #include "lc_app.h"
 #include "lc_watch.h"
+#include "lc_action.h"
 #include "lc_eventids.h"
 #include "lc_custom.h"
 #include "lc_perfids.h"
@@ -125,6 +126,9 @@ void LC_CreateHashTable(void)
     /* Process each entry in the Watchpoint Definition Table */
     for (WatchPtTblIndex = 0; WatchPtTblIndex < LC_MAX_WATCHPOINTS; WatchPtTblIndex++)
     {
+        /* Decode the entry once here rather than for every sample */
+        LC_CompileWP(WatchPtTblIndex);
+
         /* Skip unused watchpoint table entries */
         if (LC_OperData.WDTPtr[WatchPtTblIndex].DataType != LC_DATA_WATCH_NOT_USED)
         {
@@ -353,18 +357,19 @@ void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_SysTime_t Timestamp)
 {
-    uint8 *WPDataPtr;
-    uint8  PreviousResult;
-    uint8  WPEvalResult;
-    uint32 SizedWPData;
-    uint32 MaskedWPData;
-    uint32 StaleCounter;
-    bool   SizedDataValid;
+    const LC_CompiledWP_t *CompiledWP = &LC_OperData.CompiledWPs[WatchIndex];
+    uint8 *                WPDataPtr;
+    uint8                  PreviousResult;
+    uint8                  WPEvalResult;
+    uint32                 SizedWPData;
+    uint32                 MaskedWPData;
+    uint32                 StaleCounter;
+    bool                   SizedDataValid;
 
     /*
     ** Setup the pointer and get the massaged data
     */
-    WPDataPtr = ((uint8 *)BufPtr) + LC_OperData.WDTPtr[WatchIndex].WatchpointOffset;
+    WPDataPtr = ((uint8 *)BufPtr) + CompiledWP->WatchpointOffset;
 
     SizedDataValid = LC_GetSizedWPData(WatchIndex, WPDataPtr, &SizedWPData);
     if (SizedDataValid == true)
@@ -379,9 +384,9 @@ void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_Sys
         ** call the mission defined custom function or do our own
         ** relational comparison.
         */
-        MaskedWPData = SizedWPData & LC_OperData.WDTPtr[WatchIndex].BitMask;
+        MaskedWPData = SizedWPData & CompiledWP->BitMask;
 
-        if (LC_OperData.WDTPtr[WatchIndex].OperatorID == LC_OPER_CUSTOM)
+        if (CompiledWP->OperatorID == LC_OPER_CUSTOM)
         {
             WPEvalResult =
                 LC_CustomFunction(WatchIndex, MaskedWPData, BufPtr, LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument);
@@ -396,6 +401,15 @@ void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_Sys
         */
         LC_OperData.WRTPtr[WatchIndex].WatchResult = WPEvalResult;
 
+        /*
+        ** Only actionpoints using a watchpoint whose result has
+        ** changed need to be evaluated again
+        */
+        if (WPEvalResult != PreviousResult)
+        {
+            LC_WatchResultChanged(WatchIndex);
+        }
+
         /*
         ** Update the watchpoint statistics based on the evaluation
         ** result
@@ -459,9 +473,11 @@ void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_Sys
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData)
 {
-    uint8          EvalResult;
-    LC_MultiType_t WatchpointValue;
-    LC_MultiType_t ComparisonValue;
+    const LC_CompiledWP_t *CompiledWP = &LC_OperData.CompiledWPs[WatchIndex];
+    uint8                  EvalResult;
+    uint32                 WatchpointValue;
+    LC_MultiType_t         WatchpointMultiType;
+    LC_MultiType_t         ComparisonValue;
 
     /*
      * The "ProcessedWPData" has been already normalized to be
@@ -469,79 +485,39 @@ uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData)
      * comparison, it needs to be truncated back down to the same
      * size as the reference value.
      */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType)
-    {
-        case LC_DATA_WATCH_UBYTE:
-        case LC_DATA_WATCH_BYTE:
-            WatchpointValue.Unsigned8 = ProcessedWPData & 0xFF;
-            break;
-
-        case LC_DATA_WATCH_WORD_BE:
-        case LC_DATA_WATCH_WORD_LE:
-        case LC_DATA_WATCH_UWORD_BE:
-        case LC_DATA_WATCH_UWORD_LE:
-            WatchpointValue.Unsigned16 = ProcessedWPData & 0xFFFF;
-            break;
-
-        case LC_DATA_WATCH_DWORD_BE:
-        case LC_DATA_WATCH_DWORD_LE:
-        case LC_DATA_WATCH_UDWORD_BE:
-        case LC_DATA_WATCH_UDWORD_LE:
-        case LC_DATA_WATCH_FLOAT_BE:
-        case LC_DATA_WATCH_FLOAT_LE:
-        default:
-            WatchpointValue.Unsigned32 = ProcessedWPData;
-            break;
-    }
-    memcpy(&ComparisonValue, &LC_OperData.WDTPtr[WatchIndex].ComparisonValue, sizeof(LC_MultiType_t));
+    WatchpointValue = ProcessedWPData & CompiledWP->ValueMask;
 
     /*
     ** Handle the comparison appropriately depending on the data type
     ** Any endian difference was handled when the watchpoint
-    ** data was extracted from the SB message
+    ** data was extracted from the SB message, and the comparison
+    ** value was extended to 32 bits when the watchpoint was compiled
     */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType)
+    switch (CompiledWP->Compare)
     {
         /*
         ** Signed integer types will get sign extended
         */
-        case LC_DATA_WATCH_BYTE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed8, ComparisonValue.Signed8);
-            break;
-
-        case LC_DATA_WATCH_WORD_BE:
-        case LC_DATA_WATCH_WORD_LE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed16, ComparisonValue.Signed16);
-            break;
-
-        case LC_DATA_WATCH_DWORD_BE:
-        case LC_DATA_WATCH_DWORD_LE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed32, ComparisonValue.Signed32);
+        case LC_WP_COMPARE_SIGNED:
+            WatchpointValue = (WatchpointValue ^ CompiledWP->SignBit) - CompiledWP->SignBit;
+            EvalResult =
+                LC_SignedCompare(WatchIndex, (int32)WatchpointValue, CompiledWP->ComparisonValue.Signed32);
             break;
 
         /*
         ** Unsigned integer types will get zero extended
         */
-        case LC_DATA_WATCH_UBYTE:
-            EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned8, ComparisonValue.Unsigned8);
-            break;
-
-        case LC_DATA_WATCH_UWORD_BE:
-        case LC_DATA_WATCH_UWORD_LE:
-            EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned16, ComparisonValue.Unsigned16);
-            break;
-
-        case LC_DATA_WATCH_UDWORD_BE:
-        case LC_DATA_WATCH_UDWORD_LE:
-            EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned32, ComparisonValue.Unsigned32);
+        case LC_WP_COMPARE_UNSIGNED:
+            EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue, CompiledWP->ComparisonValue.Unsigned32);
             break;
 
         /*
         ** Floating point values are handled separately
         */
-        case LC_DATA_WATCH_FLOAT_BE:
-        case LC_DATA_WATCH_FLOAT_LE:
-            EvalResult = LC_FloatCompare(WatchIndex, &WatchpointValue, &ComparisonValue);
+        case LC_WP_COMPARE_FLOAT:
+            WatchpointMultiType.Unsigned32 = WatchpointValue;
+            ComparisonValue                = CompiledWP->ComparisonValue;
+            EvalResult                     = LC_FloatCompare(WatchIndex, &WatchpointMultiType, &ComparisonValue);
             break;
 
         default:
@@ -570,7 +546,7 @@ uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue)
     uint8 EvalResult;
     uint8 OperatorID;
 
-    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
+    OperatorID = LC_OperData.CompiledWPs[WatchIndex].OperatorID;
 
     switch (OperatorID)
     {
@@ -623,7 +599,7 @@ uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue, uint32 CompareValue)
     uint8 EvalResult;
     uint8 OperatorID;
 
-    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
+    OperatorID = LC_OperData.CompiledWPs[WatchIndex].OperatorID;
 
     switch (OperatorID)
     {
@@ -679,7 +655,7 @@ uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiTy
     float CompareFloat;
     float Diff;
 
-    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
+    OperatorID = LC_OperData.CompiledWPs[WatchIndex].OperatorID;
 
     memcpy(&WPFloat, WPMultiType, sizeof(float));
     memcpy(&CompareFloat, CompareMultiType, sizeof(float));
@@ -762,61 +738,37 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr)
 {
     size_t         MsgLength = 0;
     uint32         Offset;
-    uint32         NumOfDataBytes = 0;
-    bool           OffsetValid    = true;
-    CFE_SB_MsgId_t MessageID      = CFE_SB_INVALID_MSG_ID;
+    uint32         NumOfDataBytes;
+    bool           OffsetValid = true;
+    CFE_SB_MsgId_t MessageID   = CFE_SB_INVALID_MSG_ID;
 
     /*
     ** Check the message length against the watchpoint
     ** offset and data type to make sure we won't
     ** try to read past it.
     */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType)
-    {
-        case LC_DATA_WATCH_BYTE:
-        case LC_DATA_WATCH_UBYTE:
-            NumOfDataBytes = sizeof(uint8);
-            break;
-
-        case LC_DATA_WATCH_WORD_BE:
-        case LC_DATA_WATCH_WORD_LE:
-        case LC_DATA_WATCH_UWORD_BE:
-        case LC_DATA_WATCH_UWORD_LE:
-            NumOfDataBytes = sizeof(uint16);
-            break;
-
-        case LC_DATA_WATCH_DWORD_BE:
-        case LC_DATA_WATCH_DWORD_LE:
-        case LC_DATA_WATCH_UDWORD_BE:
-        case LC_DATA_WATCH_UDWORD_LE:
-            NumOfDataBytes = sizeof(uint32);
-            break;
+    NumOfDataBytes = LC_OperData.CompiledWPs[WatchIndex].NumBytes;
 
-        case LC_DATA_WATCH_FLOAT_BE:
-        case LC_DATA_WATCH_FLOAT_LE:
-            NumOfDataBytes = sizeof(float);
-            break;
-
-        default:
-            /*
-            ** This should have been caught before now, but we'll
-            ** handle it just in case we ever get here.
-            */
-            CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "WP has undefined data type: WP = %d, DataType = %d", WatchIndex,
-                              LC_OperData.WDTPtr[WatchIndex].DataType);
-
-            LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+    if (NumOfDataBytes == 0)
+    {
+        /*
+        ** This should have been caught before now, but we'll
+        ** handle it just in case we ever get here.
+        */
+        CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "WP has undefined data type: WP = %d, DataType = %d", WatchIndex,
+                          LC_OperData.WDTPtr[WatchIndex].DataType);
 
-            return false;
-            break;
+        LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
+        LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+        LC_WatchResultChanged(WatchIndex);
 
-    } /* end switch */
+        return false;
+    }
 
     CFE_MSG_GetSize(&BufPtr->Msg, &MsgLength);
 
-    Offset = LC_OperData.WDTPtr[WatchIndex].WatchpointOffset;
+    Offset = LC_OperData.CompiledWPs[WatchIndex].WatchpointOffset;
 
     if ((Offset + NumOfDataBytes) > MsgLength)
     {
@@ -831,6 +783,7 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr)
 
         LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
         LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+        LC_WatchResultChanged(WatchIndex);
     }
 
     return OffsetValid;
@@ -838,115 +791,183 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Copy a single watchpoint datum and simultaneously byteswap it   */
+/* Get sized watchpoint data                                       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void LC_CopyBytesWithSwap(LC_MultiType_t *DestBuffer, const uint8 *SrcPtr, LC_MultiType_t *SwapMap, uint32 NumBytes)
+bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint32 *SizedDataPtr)
 {
-    uint8 *      DestPtr;
-    const uint8 *SwapMapPtr;
+    const LC_CompiledWP_t *CompiledWP = &LC_OperData.CompiledWPs[WatchIndex];
+    bool                   Success    = true;
+    uint32                 RawData;
 
-    DestPtr    = (uint8 *)DestBuffer;
-    SwapMapPtr = (const uint8 *)SwapMap;
-    while (NumBytes > 0)
+    /*
+    ** Get the watchpoint data value (which may be on a misaligned
+    ** address boundary) and put it into an unsigned 32 properly
+    ** handling endian and sign extension issues
+    */
+    switch (CompiledWP->Extract)
     {
-        --NumBytes;
-        DestPtr[NumBytes] = SrcPtr[SwapMapPtr[NumBytes] & 0x3];
-    }
+        case LC_WP_EXTRACT_8:
+            RawData = WPDataPtr[0];
+            break;
+
+        case LC_WP_EXTRACT_16BE:
+            RawData = ((uint32)WPDataPtr[0] << 8) | (uint32)WPDataPtr[1];
+            break;
+
+        case LC_WP_EXTRACT_16LE:
+            RawData = ((uint32)WPDataPtr[1] << 8) | (uint32)WPDataPtr[0];
+            break;
+
+        case LC_WP_EXTRACT_32BE:
+            RawData = ((uint32)WPDataPtr[0] << 24) | ((uint32)WPDataPtr[1] << 16) | ((uint32)WPDataPtr[2] << 8) |
+                      (uint32)WPDataPtr[3];
+            break;
+
+        case LC_WP_EXTRACT_32LE:
+            RawData = ((uint32)WPDataPtr[3] << 24) | ((uint32)WPDataPtr[2] << 16) | ((uint32)WPDataPtr[1] << 8) |
+                      (uint32)WPDataPtr[0];
+            break;
+
+        default:
+            /*
+            ** This should have been caught before now, but we'll
+            ** handle it just in case we ever get here.
+            */
+            CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "WP has undefined data type: WP = %d, DataType = %d", WatchIndex,
+                              LC_OperData.WDTPtr[WatchIndex].DataType);
+
+            LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
+            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+            LC_WatchResultChanged(WatchIndex);
+
+            Success = false;
+            RawData = 0;
+            break;
+
+    } /* end switch */
+
+    /*
+    ** Extend signed 8 and 16 bit values to 32 bits, the sign bit
+    ** is zero for all other data types so they are copied as is
+    */
+    *SizedDataPtr = (RawData ^ CompiledWP->SignBit) - CompiledWP->SignBit;
+
+    /*
+    ** Return success flag
+    */
+    return Success;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Get sized watchpoint data                                       */
+/* Compile a single watchpoint                                     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint32 *SizedDataPtr)
+void LC_CompileWP(uint16 WatchIndex)
 {
-    bool           Success = true;
-    LC_MultiType_t ConvBuffer;
-    LC_MultiType_t TempBuffer;
+    const LC_WDTEntry_t *WDTEntry   = &LC_OperData.WDTPtr[WatchIndex];
+    LC_CompiledWP_t *    CompiledWP = &LC_OperData.CompiledWPs[WatchIndex];
+
+    memset(CompiledWP, 0, sizeof(*CompiledWP));
 
-    ConvBuffer.Unsigned32 = 0;
-    TempBuffer.Unsigned32 = 0;
+    CompiledWP->WatchpointOffset = WDTEntry->WatchpointOffset;
+    CompiledWP->BitMask          = WDTEntry->BitMask;
+    CompiledWP->OperatorID       = WDTEntry->OperatorID;
 
     /*
-    ** Get the watchpoint data value (which may be on a misaligned
-    ** address boundary) and put it into an unsigned 32 properly
-    ** handling endian and sign extension issues
+    ** Decode the data type into how to extract the data from the
+    ** message and how to compare it. Integer comparison values are
+    ** extended to 32 bits here so the comparison needs no further
+    ** knowledge of the data type.
     */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType)
+    switch (WDTEntry->DataType)
     {
         case LC_DATA_WATCH_BYTE:
-            TempBuffer.Signed8 = *WPDataPtr;
-            *SizedDataPtr      = TempBuffer.Signed8; /* Extend signed 8 bit value to 32 bits */
+            CompiledWP->Extract                  = LC_WP_EXTRACT_8;
+            CompiledWP->Compare                  = LC_WP_COMPARE_SIGNED;
+            CompiledWP->SignBit                  = 0x80;
+            CompiledWP->ComparisonValue.Signed32 = WDTEntry->ComparisonValue.Signed8;
             break;
 
         case LC_DATA_WATCH_UBYTE:
-            *SizedDataPtr = *WPDataPtr; /* Extend unsigned 8 bit value to 32 bits */
+            CompiledWP->Extract                    = LC_WP_EXTRACT_8;
+            CompiledWP->Compare                    = LC_WP_COMPARE_UNSIGNED;
+            CompiledWP->ComparisonValue.Unsigned32 = WDTEntry->ComparisonValue.Unsigned8;
             break;
 
         case LC_DATA_WATCH_WORD_BE:
-            ConvBuffer.Unsigned16 = LC_16BIT_BE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(int16));
-            *SizedDataPtr = TempBuffer.Signed16; /* Extend signed 16 bit value to 32 bits */
-            break;
-
         case LC_DATA_WATCH_WORD_LE:
-            ConvBuffer.Unsigned16 = LC_16BIT_LE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(int16));
-            *SizedDataPtr = TempBuffer.Signed16; /* Extend signed 16 bit value to 32 bits */
+            CompiledWP->Extract =
+                (WDTEntry->DataType == LC_DATA_WATCH_WORD_BE) ? LC_WP_EXTRACT_16BE : LC_WP_EXTRACT_16LE;
+            CompiledWP->Compare                  = LC_WP_COMPARE_SIGNED;
+            CompiledWP->SignBit                  = 0x8000;
+            CompiledWP->ComparisonValue.Signed32 = WDTEntry->ComparisonValue.Signed16;
             break;
 
         case LC_DATA_WATCH_UWORD_BE:
-            ConvBuffer.Unsigned16 = LC_16BIT_BE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint16));
-            *SizedDataPtr = TempBuffer.Unsigned16; /* Extend unsigned 16 bit value to 32 bits */
-            break;
-
         case LC_DATA_WATCH_UWORD_LE:
-            ConvBuffer.Unsigned16 = LC_16BIT_LE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint16));
-            *SizedDataPtr = TempBuffer.Unsigned16; /* Extend unsigned 16 bit value to 32 bits */
+            CompiledWP->Extract =
+                (WDTEntry->DataType == LC_DATA_WATCH_UWORD_BE) ? LC_WP_EXTRACT_16BE : LC_WP_EXTRACT_16LE;
+            CompiledWP->Compare                    = LC_WP_COMPARE_UNSIGNED;
+            CompiledWP->ComparisonValue.Unsigned32 = WDTEntry->ComparisonValue.Unsigned16;
             break;
 
         case LC_DATA_WATCH_DWORD_BE:
-        case LC_DATA_WATCH_UDWORD_BE:
-        case LC_DATA_WATCH_FLOAT_BE:
-            ConvBuffer.Unsigned32 = LC_32BIT_BE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint32));
-            *SizedDataPtr = TempBuffer.Unsigned32; /* Straight copy - no extension (signed or unsigned) */
+        case LC_DATA_WATCH_DWORD_LE:
+            CompiledWP->Extract =
+                (WDTEntry->DataType == LC_DATA_WATCH_DWORD_BE) ? LC_WP_EXTRACT_32BE : LC_WP_EXTRACT_32LE;
+            CompiledWP->Compare                  = LC_WP_COMPARE_SIGNED;
+            CompiledWP->ComparisonValue.Signed32 = WDTEntry->ComparisonValue.Signed32;
             break;
 
-        case LC_DATA_WATCH_DWORD_LE:
+        case LC_DATA_WATCH_UDWORD_BE:
         case LC_DATA_WATCH_UDWORD_LE:
+            CompiledWP->Extract =
+                (WDTEntry->DataType == LC_DATA_WATCH_UDWORD_BE) ? LC_WP_EXTRACT_32BE : LC_WP_EXTRACT_32LE;
+            CompiledWP->Compare                    = LC_WP_COMPARE_UNSIGNED;
+            CompiledWP->ComparisonValue.Unsigned32 = WDTEntry->ComparisonValue.Unsigned32;
+            break;
+
+        case LC_DATA_WATCH_FLOAT_BE:
         case LC_DATA_WATCH_FLOAT_LE:
-            ConvBuffer.Unsigned32 = LC_32BIT_LE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint32));
-            *SizedDataPtr = TempBuffer.Unsigned32; /* Straight copy - no extension (signed or unsigned) */
+            CompiledWP->Extract =
+                (WDTEntry->DataType == LC_DATA_WATCH_FLOAT_BE) ? LC_WP_EXTRACT_32BE : LC_WP_EXTRACT_32LE;
+            CompiledWP->Compare         = LC_WP_COMPARE_FLOAT;
+            CompiledWP->ComparisonValue = WDTEntry->ComparisonValue;
             break;
 
         default:
             /*
-            ** This should have been caught before now, but we'll
-            ** handle it just in case we ever get here.
+            ** Unused or undefined data type, leave as LC_WP_EXTRACT_NONE
+            ** and LC_WP_COMPARE_NONE so it is reported if ever sampled
             */
-            CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "WP has undefined data type: WP = %d, DataType = %d", WatchIndex,
-                              LC_OperData.WDTPtr[WatchIndex].DataType);
+            break;
+    }
 
-            LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+    switch (CompiledWP->Extract)
+    {
+        case LC_WP_EXTRACT_8:
+            CompiledWP->NumBytes  = sizeof(uint8);
+            CompiledWP->ValueMask = 0xFF;
+            break;
 
-            Success       = false;
-            *SizedDataPtr = 0;
+        case LC_WP_EXTRACT_16BE:
+        case LC_WP_EXTRACT_16LE:
+            CompiledWP->NumBytes  = sizeof(uint16);
+            CompiledWP->ValueMask = 0xFFFF;
             break;
 
-    } /* end switch */
+        case LC_WP_EXTRACT_32BE:
+        case LC_WP_EXTRACT_32LE:
+            CompiledWP->NumBytes  = sizeof(uint32);
+            CompiledWP->ValueMask = 0xFFFFFFFF;
+            break;
 
-    /*
-    ** Return success flag
-    */
-    return Success;
+        default:
+            break;
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -36,13 +36,25 @@
  *************************************************************************/
 
 /**
- * \name Values used when converting watchpoint values to correctly sized data
+ * \name How compiled watchpoint data is extracted from the message
  * \{
  */
-#define LC_16BIT_BE_VAL 0x0001     /**< \brief 16 bit big endian conversion value */
-#define LC_16BIT_LE_VAL 0x0100     /**< \brief 16 bit little endian conversion value */
-#define LC_32BIT_BE_VAL 0x00010203 /**< \brief 32 bit big endian conversion value */
-#define LC_32BIT_LE_VAL 0x03020100 /**< \brief 32 bit little endian conversion value */
+#define LC_WP_EXTRACT_NONE 0 /**< \brief Unused or undefined data type */
+#define LC_WP_EXTRACT_8    1 /**< \brief Single byte */
+#define LC_WP_EXTRACT_16BE 2 /**< \brief 16 bit big endian */
+#define LC_WP_EXTRACT_16LE 3 /**< \brief 16 bit little endian */
+#define LC_WP_EXTRACT_32BE 4 /**< \brief 32 bit big endian */
+#define LC_WP_EXTRACT_32LE 5 /**< \brief 32 bit little endian */
+/**\}*/
+
+/**
+ * \name How compiled watchpoint data is compared
+ * \{
+ */
+#define LC_WP_COMPARE_NONE     0 /**< \brief Unused or undefined data type */
+#define LC_WP_COMPARE_SIGNED   1 /**< \brief Signed integer comparison */
+#define LC_WP_COMPARE_UNSIGNED 2 /**< \brief Unsigned integer comparison */
+#define LC_WP_COMPARE_FLOAT    3 /**< \brief Single precision floating point comparison */
 /**\}*/
 
 /**
@@ -290,7 +302,7 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr);
  *  \par Description
  *       Support function for watchpoint processing that will extract
  *       the watchpoint data from a software bus message based upon the
- *       data type specified in the watchpoint definition table and
+ *       data type of the compiled watchpoint and
  *       store it in a uint32. If there are any endian differences between
  *       LC and the watchpoint data, this is where it will get fixed up.
  *
@@ -313,6 +325,24 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr);
  */
 bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint32 *SizedDataPtr);
 
+/**
+ * \brief Compile a watchpoint
+ *
+ *  \par Description
+ *       Decodes a watchpoint definition table entry into the compiled
+ *       watchpoint used when the watchpoint is sampled, so the data
+ *       type is only decoded when the table is loaded rather than for
+ *       every message containing the watchpoint.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called for every watchpoint whenever the watchpoint
+ *       definition table is loaded, which #LC_CreateHashTable does.
+ *
+ *  \param [in]  WatchIndex     The watchpoint number to compile (zero
+ *                              based watchpoint definition table index)
+ */
+void LC_CompileWP(uint16 WatchIndex);
+
 /**
  * \brief Convert messageID into hash table index
  *
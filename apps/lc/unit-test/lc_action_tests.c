@@ -142,6 +142,8 @@ void LC_SampleSingleAP_Test_StateChangePassToFail(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -187,6 +189,8 @@ void LC_SampleSingleAP_Test_StateChangePassToFailMaxChange(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -233,6 +237,8 @@ void LC_SampleSingleAP_Test_ActiveRequestRTS(void)
     LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount = LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS;
     strncpy(LC_OperData.ADTPtr[APNumber].EventText, "Event Message", sizeof(LC_OperData.ADTPtr[APNumber].EventText));
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -277,6 +283,8 @@ void LC_SampleSingleAP_Test_APFailWhileLCStatePassive(void)
     LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount = LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS;
     strncpy(LC_OperData.ADTPtr[APNumber].EventText, "Event Message", sizeof(LC_OperData.ADTPtr[APNumber].EventText));
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -326,6 +334,8 @@ void LC_SampleSingleAP_Test_APFailWhilePassive(void)
 
     LC_AppData.PassiveRTSExecCount = 0;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -371,6 +381,8 @@ void LC_SampleSingleAP_Test_APFailWhilePassiveNoEvent(void)
 
     LC_AppData.PassiveRTSExecCount = 0;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -401,6 +413,8 @@ void LC_SampleSingleAP_Test_StateChangeFailToPass(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -441,6 +455,8 @@ void LC_SampleSingleAP_Test_StateChangeFailToPassNoEvent(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -472,6 +488,8 @@ void LC_SampleSingleAP_Test_ActionStale(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -502,6 +520,8 @@ void LC_SampleSingleAP_Test_ActionError(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -533,6 +553,8 @@ void LC_SampleSingleAP_Test_ConsecutivePass(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -549,6 +571,71 @@ void LC_SampleSingleAP_Test_ConsecutivePass(void)
                   "LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount == 0");
 }
 
+void LC_SampleSingleAP_Test_CachedResult(void)
+{
+    uint16 APNumber = 0;
+
+    LC_OperData.ARTPtr[APNumber].CurrentState = LC_APSTATE_PASSIVE;
+    LC_OperData.ARTPtr[APNumber].ActionResult = LC_ACTION_PASS;
+
+    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
+    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+
+    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
+
+    LC_CompileAP(APNumber);
+    LC_SampleSingleAP(APNumber);
+
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ActionResult, LC_ACTION_PASS);
+    UtAssert_BOOL_FALSE(LC_OperData.CompiledAPs[APNumber].IsDirty);
+
+    /* Result changed without notification, so the cached result is used */
+    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
+
+    /* Execute the function being tested */
+    LC_SampleSingleAP(APNumber);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_AppData.APSampleCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ActionResult, LC_ACTION_PASS);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount, 0);
+
+    /* Once notified the equation is evaluated again */
+    LC_OperData.CompiledAPs[APNumber].IsDirty = true;
+
+    LC_SampleSingleAP(APNumber);
+
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ActionResult, LC_ACTION_FAIL);
+    UtAssert_BOOL_FALSE(LC_OperData.CompiledAPs[APNumber].IsDirty);
+}
+
+void LC_SampleSingleAP_Test_IllegalRPNStaysDirty(void)
+{
+    uint16 APNumber = 0;
+
+    LC_OperData.ARTPtr[APNumber].CurrentState = LC_APSTATE_PASSIVE;
+    LC_OperData.ARTPtr[APNumber].ActionResult = LC_ACTION_ERROR;
+
+    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = LC_RPN_AND;
+
+    LC_CompileAP(APNumber);
+
+    /* Execute the function being tested */
+    LC_SampleSingleAP(APNumber);
+    LC_SampleSingleAP(APNumber);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ActionResult, LC_ACTION_ERROR);
+    UtAssert_BOOL_TRUE(LC_OperData.CompiledAPs[APNumber].IsDirty);
+
+    /* The illegal equation and the error result are reported every sample */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_INVALID_RPN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, LC_ACTION_ERROR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, LC_INVALID_RPN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventID, LC_ACTION_ERROR_ERR_EID);
+}
+
 void LC_EvaluateRPN_Test_AndWatchFalseOp1(void)
 {
     uint8  Result;
@@ -562,6 +649,8 @@ void LC_EvaluateRPN_Test_AndWatchFalseOp1(void)
     LC_OperData.WRTPtr[0].WatchResult = 0;
     LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_FALSE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -584,6 +673,8 @@ void LC_EvaluateRPN_Test_AndWatchFalseOp2(void)
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
     LC_OperData.WRTPtr[1].WatchResult = 0;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -606,6 +697,8 @@ void LC_EvaluateRPN_Test_OrWatchTrueOp1(void)
     LC_OperData.WRTPtr[0].WatchResult = 0;
     LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_TRUE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -628,6 +721,8 @@ void LC_EvaluateRPN_Test_OrWatchTrueOp2(void)
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
     LC_OperData.WRTPtr[1].WatchResult = 0;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -650,6 +745,8 @@ void LC_EvaluateRPN_Test_AndWatchErrorOp1(void)
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -672,6 +769,8 @@ void LC_EvaluateRPN_Test_AndWatchErrorOp2(void)
     LC_OperData.WRTPtr[0].WatchResult = 99;
     LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_ERROR;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -694,6 +793,8 @@ void LC_EvaluateRPN_Test_OrWatchErrorOp1(void)
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -716,6 +817,8 @@ void LC_EvaluateRPN_Test_OrWatchErrorOp2(void)
     LC_OperData.WRTPtr[0].WatchResult = 99;
     LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_ERROR;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -738,6 +841,8 @@ void LC_EvaluateRPN_Test_XorWatchErrorOp1(void)
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -760,6 +865,8 @@ void LC_EvaluateRPN_Test_XorWatchErrorOp2(void)
     LC_OperData.WRTPtr[0].WatchResult = 99;
     LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_ERROR;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -780,6 +887,8 @@ void LC_EvaluateRPN_Test_NotWatchError(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -802,6 +911,8 @@ void LC_EvaluateRPN_Test_AndStaleOp1(void)
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -824,6 +935,8 @@ void LC_EvaluateRPN_Test_AndStaleOp2(void)
     LC_OperData.WRTPtr[0].WatchResult = 99;
     LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_STALE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -846,6 +959,8 @@ void LC_EvaluateRPN_Test_OrStaleOp1(void)
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -868,6 +983,8 @@ void LC_EvaluateRPN_Test_OrStaleOp2(void)
     LC_OperData.WRTPtr[0].WatchResult = 99;
     LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_STALE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -890,6 +1007,8 @@ void LC_EvaluateRPN_Test_XorStaleOp1(void)
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -912,6 +1031,8 @@ void LC_EvaluateRPN_Test_XorStaleOp2(void)
     LC_OperData.WRTPtr[0].WatchResult = 99;
     LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_STALE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -932,6 +1053,8 @@ void LC_EvaluateRPN_Test_NotStale(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -954,6 +1077,8 @@ void LC_EvaluateRPN_Test_AndNominal(void)
     LC_OperData.WRTPtr[0].WatchResult = 77;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -976,6 +1101,8 @@ void LC_EvaluateRPN_Test_OrNominal(void)
     LC_OperData.WRTPtr[0].WatchResult = 77;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -998,6 +1125,8 @@ void LC_EvaluateRPN_Test_XorNominal(void)
     LC_OperData.WRTPtr[0].WatchResult = 77;
     LC_OperData.WRTPtr[1].WatchResult = 99;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -1018,6 +1147,8 @@ void LC_EvaluateRPN_Test_NotNominal(void)
 
     LC_OperData.WRTPtr[0].WatchResult = 77;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -1037,6 +1168,8 @@ void LC_EvaluateRPN_Test_Equal(void)
 
     LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
 
+    LC_CompileAP(APNumber);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(APNumber), LC_ACTION_PASS);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
@@ -1068,6 +1201,8 @@ void LC_EvaluateRPN_Test_Equal(void)
 
     LC_OperData.WRTPtr[0].WatchResult = 77;
 
+    LC_CompileAP(APNumber);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(APNumber), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1085,6 +1220,8 @@ void LC_EvaluateRPN_Test_WatchpointNumberNominal(void)
 
     LC_OperData.WRTPtr[0].WatchResult = 77;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -1106,6 +1243,8 @@ void LC_EvaluateRPN_Test_DefaultIllegalRPN(void)
 
     LC_OperData.ADTPtr[APNumber].RPNEquation[0] = LC_MAX_WATCHPOINTS;
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -1141,6 +1280,8 @@ void LC_EvaluateRPN_Test_EndOfBufferWhenNotDone(void)
         LC_OperData.WRTPtr[i].WatchResult = 77;
     }
 
+    LC_CompileAP(APNumber);
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -1162,6 +1303,8 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     LC_OperData.ADTPtr[0].RPNEquation[0] = 0;
     LC_OperData.ADTPtr[0].RPNEquation[1] = LC_RPN_AND;
 
+    LC_CompileAP(0);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1172,6 +1315,8 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     UT_ResetState(0);
     LC_OperData.ADTPtr[0].RPNEquation[0] = LC_RPN_AND;
 
+    LC_CompileAP(0);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1183,6 +1328,8 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     LC_OperData.ADTPtr[0].RPNEquation[0] = 0;
     LC_OperData.ADTPtr[0].RPNEquation[1] = LC_RPN_OR;
 
+    LC_CompileAP(0);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1193,6 +1340,8 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     UT_ResetState(0);
     LC_OperData.ADTPtr[0].RPNEquation[0] = LC_RPN_OR;
 
+    LC_CompileAP(0);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1204,6 +1353,8 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     LC_OperData.ADTPtr[0].RPNEquation[0] = 0;
     LC_OperData.ADTPtr[0].RPNEquation[1] = LC_RPN_XOR;
 
+    LC_CompileAP(0);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1214,6 +1365,8 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     UT_ResetState(0);
     LC_OperData.ADTPtr[0].RPNEquation[0] = LC_RPN_XOR;
 
+    LC_CompileAP(0);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1224,6 +1377,8 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     UT_ResetState(0);
     LC_OperData.ADTPtr[0].RPNEquation[0] = LC_RPN_NOT;
 
+    LC_CompileAP(0);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1234,6 +1389,8 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     UT_ResetState(0);
     LC_OperData.ADTPtr[0].RPNEquation[0] = LC_RPN_EQUAL;
 
+    LC_CompileAP(0);
+
     UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
@@ -1241,6 +1398,71 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void LC_CompileADT_Test_WatchResultChanged(void)
+{
+    uint16 APNumber;
+
+    for (APNumber = 0; APNumber < LC_MAX_ACTIONPOINTS; APNumber++)
+    {
+        LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
+        LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    }
+
+    /* AP 1 uses WP 1 and WP 2, AP 2 uses WP 2 twice, AP 3 is illegal */
+    LC_OperData.ADTPtr[1].RPNEquation[0] = 1;
+    LC_OperData.ADTPtr[1].RPNEquation[1] = 2;
+    LC_OperData.ADTPtr[1].RPNEquation[2] = LC_RPN_AND;
+    LC_OperData.ADTPtr[1].RPNEquation[3] = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[2].RPNEquation[0] = 2;
+    LC_OperData.ADTPtr[2].RPNEquation[1] = LC_RPN_NOT;
+    LC_OperData.ADTPtr[2].RPNEquation[2] = 2;
+    LC_OperData.ADTPtr[2].RPNEquation[3] = LC_RPN_OR;
+    LC_OperData.ADTPtr[2].RPNEquation[4] = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[3].RPNEquation[0] = LC_RPN_AND;
+
+    /* Execute the function being tested */
+    LC_CompileADT();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(LC_OperData.CompiledAPs[1].IsValid);
+    UtAssert_UINT32_EQ(LC_OperData.CompiledAPs[1].CodeLength, 3);
+    UtAssert_BOOL_TRUE(LC_OperData.CompiledAPs[2].IsValid);
+    UtAssert_UINT32_EQ(LC_OperData.CompiledAPs[2].CodeLength, 4);
+    UtAssert_BOOL_FALSE(LC_OperData.CompiledAPs[3].IsValid);
+
+    UtAssert_UINT32_EQ(LC_OperData.APRefStart[1] - LC_OperData.APRefStart[0], LC_MAX_ACTIONPOINTS - 3);
+    UtAssert_UINT32_EQ(LC_OperData.APRefStart[2] - LC_OperData.APRefStart[1], 1);
+    UtAssert_UINT32_EQ(LC_OperData.APRefStart[3] - LC_OperData.APRefStart[2], 3);
+    UtAssert_UINT32_EQ(LC_OperData.APRefStart[LC_MAX_WATCHPOINTS], LC_MAX_ACTIONPOINTS + 1);
+    UtAssert_UINT32_EQ(LC_OperData.APRefs[LC_OperData.APRefStart[1]], 1);
+    UtAssert_UINT32_EQ(LC_OperData.APRefs[LC_OperData.APRefStart[2]], 1);
+    UtAssert_UINT32_EQ(LC_OperData.APRefs[LC_OperData.APRefStart[2] + 1], 2);
+
+    for (APNumber = 0; APNumber < LC_MAX_ACTIONPOINTS; APNumber++)
+    {
+        LC_OperData.CompiledAPs[APNumber].IsDirty = false;
+    }
+
+    /* Only the actionpoints using the watchpoint are marked */
+    LC_WatchResultChanged(1);
+
+    UtAssert_BOOL_FALSE(LC_OperData.CompiledAPs[0].IsDirty);
+    UtAssert_BOOL_TRUE(LC_OperData.CompiledAPs[1].IsDirty);
+    UtAssert_BOOL_FALSE(LC_OperData.CompiledAPs[2].IsDirty);
+
+    LC_OperData.CompiledAPs[1].IsDirty = false;
+
+    LC_WatchResultChanged(2);
+
+    UtAssert_BOOL_FALSE(LC_OperData.CompiledAPs[0].IsDirty);
+    UtAssert_BOOL_TRUE(LC_OperData.CompiledAPs[1].IsDirty);
+    UtAssert_BOOL_TRUE(LC_OperData.CompiledAPs[2].IsDirty);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void LC_ValidateADT_Test_ActionNotUsed(void)
 {
     uint8  Result;
@@ -1764,6 +1986,10 @@ void UtTest_Setup(void)
                "LC_SampleSingleAP_Test_ActionError");
     UtTest_Add(LC_SampleSingleAP_Test_ConsecutivePass, LC_Test_Setup, LC_Test_TearDown,
                "LC_SampleSingleAP_Test_ConsecutivePass");
+    UtTest_Add(LC_SampleSingleAP_Test_CachedResult, LC_Test_Setup, LC_Test_TearDown,
+               "LC_SampleSingleAP_Test_CachedResult");
+    UtTest_Add(LC_SampleSingleAP_Test_IllegalRPNStaysDirty, LC_Test_Setup, LC_Test_TearDown,
+               "LC_SampleSingleAP_Test_IllegalRPNStaysDirty");
 
     UtTest_Add(LC_EvaluateRPN_Test_AndWatchFalseOp1, LC_Test_Setup, LC_Test_TearDown,
                "LC_EvaluateRPN_Test_AndWatchFalseOp1");
@@ -1806,6 +2032,9 @@ void UtTest_Setup(void)
                "LC_EvaluateRPN_Test_EndOfBufferWhenNotDone");
     UtTest_Add(LC_EvaluateRPN_Test_PushPopFail, LC_Test_Setup, LC_Test_TearDown, "LC_EvaluateRPN_Test_PushPopFail");
 
+    UtTest_Add(LC_CompileADT_Test_WatchResultChanged, LC_Test_Setup, LC_Test_TearDown,
+               "LC_CompileADT_Test_WatchResultChanged");
+
     UtTest_Add(LC_ValidateADT_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateADT_Test_Nominal");
     UtTest_Add(LC_ValidateADT_Test_ActionNotUsed, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateADT_Test_ActionNotUsed");
     UtTest_Add(LC_ValidateADT_Test_InvalidDefaultState, LC_Test_Setup, LC_Test_TearDown,
@@ -19,6 +19,7 @@
 
 #include "lc_cmds.h"
 #include "lc_utils.h"
+#include "lc_action.h"
 #include "lc_app.h"
 #include "lc_msg.h"
 #include "lc_tbldefs.h"
@@ -85,6 +86,7 @@ void LC_ManageTables_Test_InfoUpdated(void)
 
     UtAssert_INT32_EQ(call_count_LC_ResetResultsWP, 1);
     UtAssert_INT32_EQ(call_count_LC_ResetResultsAP, 1);
+    UtAssert_STUB_COUNT(LC_CompileADT, 1);
 }
 
 void LC_ManageTables_Test_WDTGetAddressError(void)
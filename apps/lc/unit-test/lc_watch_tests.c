@@ -27,6 +27,7 @@
  */
 
 #include "lc_watch.h"
+#include "lc_action.h"
 #include "lc_app.h"
 #include "lc_msg.h"
 #include "lc_msgdefs.h"
@@ -224,6 +225,8 @@ void LC_CheckMsgForWPs_Test_Nominal(void)
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
     LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_CUSTOM;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
@@ -288,6 +291,8 @@ void LC_CheckMsgForWPs_Test_NominalMsgTime2(void)
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = MsgSize + 1;
     LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_CUSTOM;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
@@ -354,6 +359,8 @@ void LC_ProcessWP_Test_CustomFunctionWatchFalse(void)
     LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument = 0;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 1;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -387,6 +394,8 @@ void LC_ProcessWP_Test_OperatorCompareError(void)
     LC_OperData.WDTPtr[WatchIndex].OperatorID      = 99;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -421,6 +430,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -468,6 +479,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousFalse(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -494,6 +507,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousFalse(void)
                   "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Subseconds == 5");
 
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
+
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
 }
 
 void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale(void)
@@ -515,6 +530,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -558,6 +575,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousTrue(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -580,6 +599,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousTrue(void)
                   "LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Subseconds == 5");
 
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
+
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
 }
 
 void LC_ProcessWP_Test_BadSize(void)
@@ -597,6 +618,8 @@ void LC_ProcessWP_Test_BadSize(void)
     LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument = 0;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 1;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -625,6 +648,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousTrue(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -647,6 +672,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousTrue(void)
                   "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value == 0");
 
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
+
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 0);
 }
 
 void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousFalse(void)
@@ -668,6 +695,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousFalse(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
 
@@ -686,6 +715,8 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousFalse(void)
                   "LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value == 0");
 
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
+
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 0);
 }
 
 void LC_OperatorCompare_Test_DataByte(void)
@@ -702,6 +733,8 @@ void LC_OperatorCompare_Test_DataByte(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
 
@@ -725,6 +758,8 @@ void LC_OperatorCompare_Test_DataWordLE(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed16 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount          = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
 
@@ -748,6 +783,8 @@ void LC_OperatorCompare_Test_DataDWordLE(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed32 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount          = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
 
@@ -771,6 +808,8 @@ void LC_OperatorCompare_Test_DataUByte(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount           = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
 
@@ -794,6 +833,8 @@ void LC_OperatorCompare_Test_DataUWordLE(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned16 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount            = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
 
@@ -817,6 +858,8 @@ void LC_OperatorCompare_Test_DataUDWordLE(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned32 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount            = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
 
@@ -840,6 +883,8 @@ void LC_OperatorCompare_Test_DataFloatLE(void)
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Float32 = 1.0;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
 
@@ -868,6 +913,8 @@ void LC_OperatorCompare_Test_DataTypeError(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "WP has undefined data type: WP = %%d, DataType = %%d");
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
 
@@ -892,6 +939,8 @@ void LC_SignedCompare_Test_LE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -910,6 +959,8 @@ void LC_SignedCompare_Test_LT(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LT;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -928,6 +979,8 @@ void LC_SignedCompare_Test_EQ(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_EQ;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -946,6 +999,8 @@ void LC_SignedCompare_Test_NE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -964,6 +1019,8 @@ void LC_SignedCompare_Test_GT(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GT;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -982,6 +1039,8 @@ void LC_SignedCompare_Test_GE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1005,6 +1064,8 @@ void LC_SignedCompare_Test_InvalidOperatorID(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "WP has invalid operator ID: WP = %%d, OperID = %%d");
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1029,6 +1090,8 @@ void LC_UnsignedCompare_Test_LE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1047,6 +1110,8 @@ void LC_UnsignedCompare_Test_LT(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LT;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1065,6 +1130,8 @@ void LC_UnsignedCompare_Test_EQ(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_EQ;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1083,6 +1150,8 @@ void LC_UnsignedCompare_Test_NE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1101,6 +1170,8 @@ void LC_UnsignedCompare_Test_GT(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GT;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1119,6 +1190,8 @@ void LC_UnsignedCompare_Test_GE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1142,6 +1215,8 @@ void LC_UnsignedCompare_Test_InvalidOperatorID(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
 
@@ -1169,6 +1244,8 @@ void LC_FloatCompare_Test_LE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1190,6 +1267,8 @@ void LC_FloatCompare_Test_LT(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LT;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1211,6 +1290,8 @@ void LC_FloatCompare_Test_EQ(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_EQ;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1232,6 +1313,8 @@ void LC_FloatCompare_Test_EQFail(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_EQ;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1253,6 +1336,8 @@ void LC_FloatCompare_Test_NE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1274,6 +1359,8 @@ void LC_FloatCompare_Test_NEFail(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1295,6 +1382,8 @@ void LC_FloatCompare_Test_GT(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GT;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1316,6 +1405,8 @@ void LC_FloatCompare_Test_GE(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1342,6 +1433,8 @@ void LC_FloatCompare_Test_InvalidOperatorID(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "WP has invalid operator ID: WP = %%d, OperID = %%d");
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1375,6 +1468,8 @@ void LC_FloatCompare_Test_NaN(void)
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_FloatCompare(WatchIndex, &WPMultiType, &CompareMultiType);
 
@@ -1404,6 +1499,8 @@ void LC_WPOffsetValid_Test_DataUByte(void)
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_UBYTE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf);
 
@@ -1427,6 +1524,8 @@ void LC_WPOffsetValid_Test_UWordLE(void)
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_UWORD_LE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf);
 
@@ -1450,6 +1549,8 @@ void LC_WPOffsetValid_Test_UDWordLE(void)
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_UDWORD_LE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf);
 
@@ -1473,6 +1574,8 @@ void LC_WPOffsetValid_Test_FloatLE(void)
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_FLOAT_LE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf);
 
@@ -1498,6 +1601,8 @@ void LC_WPOffsetValid_Test_DataTypeError(void)
     LC_OperData.WDTPtr[WatchIndex].DataType         = 99;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf);
 
@@ -1536,6 +1641,8 @@ void LC_WPOffsetValid_Test_OffsetError(void)
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_UBYTE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = sizeof(LC_NoopCmd_t) - 1;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf);
 
@@ -1554,6 +1661,8 @@ void LC_WPOffsetValid_Test_OffsetError(void)
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
 }
 
 void LC_GetSizedWPData_Test_DataByte(void)
@@ -1570,6 +1679,8 @@ void LC_GetSizedWPData_Test_DataByte(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_BYTE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1594,6 +1705,8 @@ void LC_GetSizedWPData_Test_DataUByte(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_UBYTE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1618,6 +1731,8 @@ void LC_GetSizedWPData_Test_DataWordBELittleEndian(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_WORD_BE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1642,6 +1757,8 @@ void LC_GetSizedWPData_Test_DataWordLELittleEndian(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_WORD_LE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1666,6 +1783,8 @@ void LC_GetSizedWPData_Test_DataUWordBELittleEndian(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_UWORD_BE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1690,6 +1809,8 @@ void LC_GetSizedWPData_Test_DataUWordLELittleEndian(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_UWORD_LE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1714,6 +1835,8 @@ void LC_GetSizedWPData_Test_DataFloatBELittleEndian(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_FLOAT_BE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1738,6 +1861,8 @@ void LC_GetSizedWPData_Test_DataFloatLELittleEndian(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_FLOAT_LE;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1768,6 +1893,8 @@ void LC_GetSizedWPData_Test_DataTypeError(void)
 
     LC_OperData.WDTPtr[WatchIndex].DataType = 99;
 
+    LC_CompileWP(WatchIndex);
+
     /* Execute the function being tested */
     Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
 
@@ -1785,6 +1912,8 @@ void LC_GetSizedWPData_Test_DataTypeError(void)
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
 }
 
 void LC_ValidateWDT_Test_UnusedTableEntry(void)
@@ -26,6 +26,28 @@
 #include "lc_action.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompileADT()
+ * ----------------------------------------------------
+ */
+void LC_CompileADT(void)
+{
+    UT_GenStub_Execute(LC_CompileADT, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompileAP()
+ * ----------------------------------------------------
+ */
+void LC_CompileAP(uint16 APNumber)
+{
+    UT_GenStub_AddParam(LC_CompileAP, uint16, APNumber);
+
+    UT_GenStub_Execute(LC_CompileAP, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_EvaluateRPN()
@@ -100,3 +122,15 @@ int32 LC_ValidateRPN(const uint16 *RPNPtr, int32 *IndexValue, int32 *StackDepthV
 
     return UT_GenStub_GetReturnValue(LC_ValidateRPN, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_WatchResultChanged()
+ * ----------------------------------------------------
+ */
+void LC_WatchResultChanged(uint16 WatchIndex)
+{
+    UT_GenStub_AddParam(LC_WatchResultChanged, uint16, WatchIndex);
+
+    UT_GenStub_Execute(LC_WatchResultChanged, Basic, NULL);
+}
@@ -55,6 +55,18 @@ void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
     UT_GenStub_Execute(LC_CheckMsgForWPs, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompileWP()
+ * ----------------------------------------------------
+ */
+void LC_CompileWP(uint16 WatchIndex)
+{
+    UT_GenStub_AddParam(LC_CompileWP, uint16, WatchIndex);
+
+    UT_GenStub_Execute(LC_CompileWP, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_CreateHashTable()
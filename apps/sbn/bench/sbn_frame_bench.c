@@ -0,0 +1,399 @@
+/**
+ * @file
+ *
+ * Measures what packing the messages relayed to a peer into SBN frames saves
+ * over sending each message on its own, over the SBN_UDP module on loopback.
+ *
+ * For each message size the same number of messages is given to
+ * SBN_SendFramedMsg in bursts of a peer pipe's depth, with SBN_FlushFrame at
+ * the end of each burst as when the peer pipe has been drained:
+ *
+ * - "per message": the peer has not offered frames, so each message goes out
+ *   as one SBN message, one datagram and one send call, as before frames;
+ * - "framed": the peer has offered frames, so the messages are packed as
+ *   records and a frame goes out when the next record does not fit or the
+ *   burst ends.
+ *
+ * A receive task on the same socket unpacks each datagram with SBN_UnpackMsg
+ * and the records of each frame with SBN_UnpackFrameRecord, and counts the
+ * messages that arrived (datagrams that UDP dropped are not counted.)  The
+ * time is taken in the send task, from the first message to the last flush;
+ * the receive task runs at a higher priority, so on a single CPU the time
+ * includes the receive side too.
+ *
+ * sbn_app.c, the rest of the SBN app and sbn_udp_if.c are linked as is, the
+ * cFE calls they make are replaced by the minimal shims at the end of this
+ * file.  Build with the SBN_BENCH cmake option, or by hand with the same
+ * include paths as the sbn app:
+ *
+ *   cc -O2 -I../fsw/platform_inc -I../fsw/src -I../modules/protocol/udp/fsw/src -I<cfe and osal includes> \
+ *      sbn_frame_bench.c ../fsw/src/sbn_*.c ../modules/protocol/udp/fsw/src/sbn_udp_if.c \
+ *      -L<osal build dir> -losal -losal_bsp -lpthread -lrt -o sbn_frame_bench
+ *
+ * and run as "sbn_frame_bench [messages] [burst]", by default 200000
+ * messages in bursts of SBN_PEER_PIPE_DEPTH.
+ */
+
+#include "cfe.h"
+#include "sbn_app.h"
+#include "sbn_udp_if.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ADDRESS       "127.0.0.1:52350"
+#define BENCH_PROCESSOR_ID  1
+#define BENCH_SPACECRAFT_ID 42
+#define BENCH_STACK_SIZE    16384
+#define BENCH_SEND_PRIORITY 100
+#define BENCH_RECV_PRIORITY 50
+#define BENCH_SETTLE_MS     200
+
+extern SBN_IfOps_t SBN_UDP_Ops;
+
+static const SBN_MsgSz_t MsgSizes[] = {32, 128, 512};
+
+static SBN_IfOps_t        BenchOps;
+static SBN_NetInterface_t BenchNet;
+static uint8              BenchMsg[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
+static SBN_MsgSz_t        BenchMsgSz;
+static uint32             BenchMsgs;
+static uint32             BenchBurst;
+static double             BenchElapsed;
+static osal_id_t          BenchDoneSem;
+static uint32             BenchSends;
+static volatile uint32    BenchRecvMsgs;
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+/* counts the sends (Peer->SendCnt is only 16 bits) */
+static SBN_Status_t BenchSend(SBN_PeerInterface_t *Peer, SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Payload)
+{
+    BenchSends++;
+    return SBN_UDP_Ops.Send(Peer, MsgType, MsgSz, Payload);
+}
+
+static void BenchSendTask(void)
+{
+    SBN_PeerInterface_t *Peer = &BenchNet.Peers[0];
+    double               Start;
+    uint32               i;
+
+    Start = Now();
+    for (i = 0; i < BenchMsgs; i++)
+    {
+        SBN_SendFramedMsg(SBN_APP_MSG, BenchMsgSz, BenchMsg, Peer);
+        if ((i + 1) % BenchBurst == 0 || i + 1 == BenchMsgs)
+        {
+            SBN_FlushFrame(Peer);
+        }
+    }
+    BenchElapsed = Now() - Start;
+
+    OS_CountSemGive(BenchDoneSem);
+}
+
+static void BenchRecvTask(void)
+{
+    SBN_UDP_Net_t *    NetData = (SBN_UDP_Net_t *)BenchNet.ModulePvt;
+    static uint8       Buf[SBN_MAX_PACKED_MSG_SZ];
+    static uint8       Payload[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
+    SBN_MsgSz_t        FrameSz;
+    SBN_MsgSz_t        MsgSz;
+    SBN_MsgSz_t        Offset;
+    SBN_MsgType_t      MsgType;
+    CFE_ProcessorID_t  ProcessorID;
+    CFE_SpacecraftID_t SpacecraftID;
+    void *             Msg;
+
+    while (OS_SocketRecvFrom(NetData->Socket, Buf, sizeof(Buf), NULL, OS_PEND) > 0)
+    {
+        if (!SBN_UnpackMsg(Buf, &FrameSz, &MsgType, &ProcessorID, &SpacecraftID, Payload))
+        {
+            continue;
+        }
+
+        if (MsgType != SBN_FRAME_MSG)
+        {
+            BenchRecvMsgs++;
+            continue;
+        }
+
+        Offset = 0;
+        while (SBN_UnpackFrameRecord(Payload, FrameSz, &Offset, &MsgSz, &MsgType, &Msg))
+        {
+            BenchRecvMsgs++;
+        }
+    }
+}
+
+static void RunCase(bool Framed, uint32 *SendsPtr, uint32 *RecvPtr)
+{
+    SBN_PeerInterface_t *Peer = &BenchNet.Peers[0];
+    osal_id_t            TaskId;
+
+    Peer->FramesOK = Framed;
+    BenchSends     = 0;
+    BenchRecvMsgs  = 0;
+    BenchElapsed   = 0;
+
+    if (OS_TaskCreate(&TaskId, "BenchSend", BenchSendTask, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(BENCH_STACK_SIZE),
+                      OSAL_PRIORITY_C(BENCH_SEND_PRIORITY), 0) != OS_SUCCESS)
+    {
+        printf("cannot create the send task\n");
+        OS_ApplicationExit(1);
+    }
+    OS_CountSemTake(BenchDoneSem);
+
+    /* let the receive task take in what is still queued, and the send task exit */
+    OS_TaskDelay(BENCH_SETTLE_MS);
+
+    *SendsPtr = BenchSends;
+    *RecvPtr  = BenchRecvMsgs;
+}
+
+void OS_Application_Startup(void)
+{
+    SBN_ProtocolOutlet_t Outlet = {.PackMsg      = SBN_PackMsg,
+                                   .UnpackMsg    = SBN_UnpackMsg,
+                                   .Connected    = SBN_Connected,
+                                   .Disconnected = SBN_Disconnected,
+                                   .SendNetMsg   = SBN_SendNetMsg,
+                                   .GetPeer      = SBN_GetPeer};
+    SBN_PeerInterface_t *Peer   = &BenchNet.Peers[0];
+    char *const *        ArgV   = OS_BSP_GetArgV();
+    uint32               ArgC   = OS_BSP_GetArgC();
+    osal_id_t            RecvTaskId;
+    uint32               PerMsgSends;
+    uint32               PerMsgRecv;
+    uint32               FramedSends;
+    uint32               FramedRecv;
+    double               PerMsg;
+    size_t               i;
+
+    BenchMsgs  = ArgC > 1 ? atol(ArgV[1]) : 200000;
+    BenchBurst = ArgC > 2 ? atol(ArgV[2]) : SBN_PEER_PIPE_DEPTH;
+
+    BenchOps           = SBN_UDP_Ops;
+    BenchOps.Send      = BenchSend;
+    BenchNet.IfOps     = &BenchOps;
+    BenchNet.PeerCnt   = 1;
+    Peer->Net          = &BenchNet;
+    Peer->ProcessorID  = BENCH_PROCESSOR_ID;
+    Peer->SpacecraftID = BENCH_SPACECRAFT_ID;
+    Peer->Connected    = true;
+
+    if (BenchMsgs == 0 || BenchBurst == 0 || OS_API_Init() != OS_SUCCESS ||
+        OS_CountSemCreate(&BenchDoneSem, "BenchDone", 0, 0) != OS_SUCCESS ||
+        SBN_UDP_Ops.InitModule(SBN_PROTOCOL_VERSION, 0, &Outlet) != SBN_SUCCESS ||
+        SBN_UDP_Ops.LoadNet(&BenchNet, BENCH_ADDRESS) != SBN_SUCCESS ||
+        SBN_UDP_Ops.LoadPeer(Peer, BENCH_ADDRESS) != SBN_SUCCESS || SBN_UDP_Ops.InitNet(&BenchNet) != SBN_SUCCESS ||
+        OS_TaskCreate(&RecvTaskId, "BenchRecv", BenchRecvTask, OSAL_TASK_STACK_ALLOCATE,
+                      OSAL_SIZE_C(BENCH_STACK_SIZE), OSAL_PRIORITY_C(BENCH_RECV_PRIORITY), 0) != OS_SUCCESS)
+    {
+        printf("cannot set up a UDP net on %s\n", BENCH_ADDRESS);
+        OS_ApplicationExit(1);
+    }
+
+    memset(BenchMsg, 0xA5, sizeof(BenchMsg));
+
+    printf("%u messages in bursts of %u, %u byte frames\n", (unsigned int)BenchMsgs, (unsigned int)BenchBurst,
+           (unsigned int)SBN_MAX_FRAME_SZ);
+    printf("%8s %14s %9s %9s %14s %9s %9s %8s\n", "msg size", "per msg (ns)", "sends", "received", "framed (ns)",
+           "sends", "received", "speedup");
+
+    for (i = 0; i < sizeof(MsgSizes) / sizeof(MsgSizes[0]); i++)
+    {
+        BenchMsgSz = MsgSizes[i];
+
+        RunCase(false, &PerMsgSends, &PerMsgRecv);
+        PerMsg = BenchElapsed;
+        RunCase(true, &FramedSends, &FramedRecv);
+
+        printf("%8u %14.1f %9u %9u %14.1f %9u %9u %7.1fx\n", (unsigned int)BenchMsgSz, PerMsg * 1e9 / BenchMsgs,
+               (unsigned int)PerMsgSends, (unsigned int)PerMsgRecv, BenchElapsed * 1e9 / BenchMsgs,
+               (unsigned int)FramedSends, (unsigned int)FramedRecv, BenchElapsed > 0 ? PerMsg / BenchElapsed : 0);
+    }
+
+    OS_ApplicationExit(0);
+}
+
+/*
+ * Minimal shims for the cFE calls made by the SBN app and sbn_udp_if.c, most
+ * of them only needed to link sbn_app.c and never called here
+ */
+
+uint32 CFE_PSP_GetProcessorId(void)
+{
+    return BENCH_PROCESSOR_ID;
+}
+
+uint32 CFE_PSP_GetSpacecraftId(void)
+{
+    return BENCH_SPACECRAFT_ID;
+}
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint16 FilterScheme)
+{
+    return CFE_SUCCESS;
+}
+
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit) {}
+
+CFE_Status_t CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName,
+                                    CFE_ES_ChildTaskMainFuncPtr_t FunctionPtr, CFE_ES_StackPointer_t StackPtr,
+                                    size_t StackSize, CFE_ES_TaskPriority_Atom_t Priority, uint32 Flags)
+{
+    return CFE_ES_ERR_CHILD_TASK_CREATE;
+}
+
+CFE_Status_t CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
+{
+    return CFE_SUCCESS;
+}
+
+void CFE_ES_ExitApp(uint32 ExitStatus) {}
+
+CFE_Status_t CFE_ES_GetAppID(CFE_ES_AppId_t *AppIdPtr)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t TaskId)
+{
+    return CFE_SUCCESS;
+}
+
+bool CFE_ES_RunLoop(uint32 *RunStatus)
+{
+    return false;
+}
+
+void CFE_ES_WaitForStartupSync(uint32 TimeOutMilliseconds) {}
+
+CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMilliseconds)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    *Size = BenchMsgSz;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetFcnCode(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_FcnCode_t *FcnCode)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_SetFcnCode(CFE_MSG_Message_t *MsgPtr, CFE_MSG_FcnCode_t FcnCode)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_DeletePipe(CFE_SB_PipeId_t PipeId)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    return CFE_SB_NO_MESSAGE;
+}
+
+CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_SubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint16 MsgLim)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination)
+{
+    return CFE_SUCCESS;
+}
+
+void CFE_SB_TimeStampMsg(CFE_MSG_Message_t *MsgPtr) {}
+
+CFE_Status_t CFE_TBL_GetAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_TBL_ERR_INVALID_HANDLE;
+}
+
+CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType, const void *SrcDataPtr)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_Manage(CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_NotifyByMessage(CFE_TBL_Handle_t TblHandle, CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t CommandCode,
+                                     uint32 Parameter)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name, size_t Size, uint16 TblOptionFlags,
+                              CFE_TBL_CallbackFuncPtr_t TblValidationFuncPtr)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_ReleaseAddress(CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_Unregister(CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_Update(CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_SUCCESS;
+}
@@ -22,8 +22,27 @@ typedef struct SBN_PeerInterface_s SBN_PeerInterface_t;
 #define SBN_PACKED_HDR_SZ (sizeof(SBN_MsgSz_t) + sizeof(SBN_MsgType_t) + sizeof(CFE_ProcessorID_t) + sizeof(CFE_SpacecraftID_t))
 #define SBN_PACKED_SUB_SZ \
     (SBN_PACKED_HDR_SZ + sizeof(SBN_SubCnt_t) + (sizeof(CFE_SB_MsgId_t) + sizeof(CFE_SB_Qos_t)) * SBN_MAX_SUBS_PER_PEER)
+/** SBN_PROTO_MSG payload: version, capabilities, the instance and epoch of the peer's subs I have. */
+#define SBN_PACKED_PROTO_SZ (sizeof(uint8) * 2 + sizeof(uint32) * 2)
+
+/**
+ * SBN_SUB_SYNC_MSG payload: ident, instance, base epoch, epoch, full flag,
+ * unsub count and MsgIDs, sub count and MsgID + QoS.
+ */
+#define SBN_PACKED_SUB_SYNC_SZ                                                                         \
+    (SBN_IDENT_LEN + sizeof(uint32) * 3 + sizeof(uint8) + sizeof(SBN_SubCnt_t) * 2 +                   \
+     (sizeof(CFE_SB_MsgId_t) * 2 + sizeof(CFE_SB_Qos_t)) * SBN_MAX_SUBS_PER_PEER)
 #define SBN_MAX_PACKED_MSG_SZ (SBN_PACKED_HDR_SZ + CFE_MISSION_SB_MAX_SB_MSG_SIZE)
 
+/**
+ * The payload of an SBN_FRAME_MSG is a sequence of records, each a MsgSz +
+ * MsgType header padded to 4 bytes followed by the message padded to 4 bytes,
+ * so each message in a frame keeps the alignment of the frame payload.
+ */
+#define SBN_PACKED_RECORD_HDR_SZ 4
+#define SBN_PACKED_RECORD_SZ(MsgSz) (SBN_PACKED_RECORD_HDR_SZ + (((MsgSz) + 3) & ~3))
+#define SBN_MAX_FRAME_PAYLOAD_SZ (SBN_MAX_FRAME_SZ - SBN_PACKED_HDR_SZ)
+
 /**
  * Filters modify messages in place, doing such things as byte swapping, packing/unpacking, etc.
  *
@@ -129,6 +148,23 @@ struct SBN_PeerInterface_s
      */
     SBN_Subs_t Subs[SBN_MAX_SUBS_PER_PEER + 1];
 
+    /** @brief Hash index of Subs by MsgID, each slot is a Subs index + 1 (0 if free.) */
+    uint16 SubIndex[SBN_SUB_HASH_SZ];
+
+    /**
+     * @brief The peer's subscription instance and epoch that Subs reflects,
+     * kept while the peer is disconnected so that when it reconnects it
+     * need only send what changed since. 0 if Subs is not from a sync.
+     */
+    uint32 SubInstance, SubEpoch;
+
+    /**
+     * @brief Set once the peer has been sent the local subscriptions since
+     * they were last reset. Until then the peer is sent all of them whatever
+     * instance it claims to have, as a new instance can repeat an old one.
+     */
+    bool SubsSynced;
+
     /**
      * @brief Filters alter message headers/bodies before sending to a peer or after
      *        receiving from the peer.
@@ -141,6 +177,19 @@ struct SBN_PeerInterface_s
 
     bool Connected;
 
+    /** @brief Set when the peer has offered to receive SBN_FRAME_MSG frames. */
+    bool FramesOK;
+
+    /**
+     * @brief Records packed for this peer but not yet sent. The frame is
+     * sent when the next record does not fit, or when the pipe has been
+     * drained and the frame is older than SBN_FRAME_LATENCY_MS.
+     */
+    uint8       Frame[SBN_MAX_FRAME_PAYLOAD_SZ];
+    SBN_MsgSz_t FrameSz;
+    uint16      FrameMsgCnt;
+    OS_time_t   FrameStart;
+
     /** @brief generic blob of bytes for the module-specific data. */
     union {
       uint8 _buf[128];
@@ -416,6 +465,20 @@ struct SBN_IfOps_s
      * @sa LoadNet, LoadPeer, UnloadNet
      */
     SBN_Status_t (*UnloadPeer)(SBN_PeerInterface_t *Peer);
+
+    /**
+     * Adds the sockets that RecvFromNet/RecvFromPeer read from to a select
+     * set, so that SBN can wait for them to become readable instead of polling
+     * the net. Optional, nets of modules that leave this NULL are polled each
+     * time the main loop wakes up.
+     *
+     * @param Net[in] Network to add the sockets of.
+     * @param FdSet[in,out] Set to add the sockets to.
+     *
+     * @return  SBN_SUCCESS if any sockets were added.
+     *          SBN_IF_EMPTY if the net has no sockets to wait on right now.
+     */
+    SBN_Status_t (*AddRecvFds)(SBN_NetInterface_t *Net, OS_FdSet *FdSet);
 };
 
 #endif /* _sbn_interfaces_h_ */
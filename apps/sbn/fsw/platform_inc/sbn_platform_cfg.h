@@ -29,26 +29,64 @@
 /** @brief Maximum number of subscriptions allowed per peer allowed. */
 #define SBN_MAX_SUBS_PER_PEER 256
 
+/**
+ * @brief Number of slots in the hash indexes of the local and each peer's
+ * subscriptions, a power of two and at least twice SBN_MAX_SUBS_PER_PEER.
+ */
+#define SBN_SUB_HASH_SZ 512
+
+/**
+ * @brief Number of local unsubscriptions remembered so that a peer that
+ * reconnects is sent only the subscriptions that changed since it last
+ * synchronized. A peer that missed more is sent all subscriptions.
+ */
+#define SBN_SUB_LOG_SZ SBN_MAX_SUBS_PER_PEER
+
 /** @brief Maximum number of incoming and outgoing message filters. */
 #define SBN_MAX_FILTERS 16
 
 /** @brief Maximum number of outgoing and incoming message filters for each peer. */
 #define SBN_MAX_FILTERS_PER_PEER 8
 
-/**
- * @brief At most process this many SB messages per peer per wakeup.
- * (To prevent starvation if a peer is babbling.)
- */
-#define SBN_MAX_MSG_PER_WAKEUP 32
-
 /**
  * @brief In the polling configuration, how long (in milliseconds) to wait for
  * a SCH wakeup message before SBN times out and processes. (Note, should
  * really be significantly longer than the expected time between SCH wakeup
- * messages.)
+ * messages.) Messages from peers on nets that can be waited on are received
+ * as they arrive, regardless of this delay.
  */
 #define SBN_MAIN_LOOP_DELAY 200
 
+/**
+ * @brief Priority of the task that receives from nets that can be waited on.
+ * Should be no higher (numerically no lower) than the SBN application's own,
+ * so that the task does not keep the main loop from running under load.
+ */
+#define SBN_RECV_POLL_TASK_PRIORITY 100
+
+/** @brief Stack size of the task that receives from nets that can be waited on. */
+#define SBN_RECV_POLL_TASK_STACK_SZ (CFE_PLATFORM_ES_DEFAULT_STACK_SIZE + sizeof(OS_FdSet))
+
+/**
+ * @brief How long (in milliseconds) the receive poll task sleeps after a pass
+ * that received messages before it receives again, letting the main loop and
+ * lower priority tasks run while peers keep sending.
+ */
+#define SBN_RECV_POLL_YIELD_MS 1
+
+/**
+ * @brief After failing to create the receive poll task, the most main loop
+ * wakeups to let pass before trying again. The wait starts at one wakeup and
+ * doubles with each failure in a row, up to this many.
+ */
+#define SBN_RECV_POLL_RETRY_MAX_WAKEUPS 64
+
+/**
+ * @brief Most messages received from a net (or from each peer on a net) in one
+ * pass, so that a peer that keeps sending does not hold up the other nets.
+ */
+#define SBN_RECV_MAX_MSGS_PER_PASS 100
+
 /**
  * @brief For each peer, a pipe is created to receive messages that the peer has
  * subscribed to. The pipe should be deep enough to handle all messages that
@@ -115,4 +153,25 @@
 
 #define SBN_CONF_TBL_FILENAME "/cf/sbn_conf_tbl.tbl"
 
+/**
+ * @brief If defined, SBN offers to aggregate messages into frames when
+ * connecting to a peer, and packs the messages it sends to peers that
+ * offered the same into frames.
+ */
+#define SBN_FRAMES_ENABLED
+
+/**
+ * @brief The maximum size of a packed frame (SBN header and records) sent to
+ * a peer. Should not exceed the path MTU of the nets, 1472 is an Ethernet
+ * MTU less the IP and UDP headers.
+ */
+#define SBN_MAX_FRAME_SZ 1472
+
+/**
+ * @brief How long (in milliseconds) a message may wait in a partially filled
+ * frame for more messages to the same peer. When 0, frames are sent as soon
+ * as the peer pipe has been drained.
+ */
+#define SBN_FRAME_LATENCY_MS 0
+
 #endif /* _sbn_platform_cfg_h_ */
@@ -69,6 +69,8 @@ typedef enum
     SBN_UNSUB_MSG = 0x02, /**< @brief payload is unsubs */
     SBN_APP_MSG   = 0x03, /**< @brief payload is SB msg */
     SBN_PROTO_MSG = 0x04, /**< @brief payload is SBN proto */
+    SBN_FRAME_MSG = 0x05, /**< @brief payload is a frame of packed SBN records */
+    SBN_SUB_SYNC_MSG = 0x06, /**< @brief payload is the subs changed since an epoch */
 } SBN_MsgTypeEnum_t;
 
 /**
@@ -87,12 +89,26 @@ typedef enum
 
 #define SBN_PROTO_VER 11
 
+/**
+ * Capability flags sent in the byte following the version in an SBN_PROTO_MSG.
+ * Peers that predate the flags only send the version byte, which reads as no
+ * capabilities.
+ */
+#define SBN_PROTO_CAP_FRAMES   (0x01) /**< @brief peer can unpack SBN_FRAME_MSG frames */
+#define SBN_PROTO_CAP_SUB_SYNC (0x02) /**< @brief peer sends and takes SBN_SUB_SYNC_MSG */
+
 /* used in local and peer subscription tables */
 typedef struct
 {
     uint32         InUseCtr;
     CFE_SB_MsgId_t MsgID;
     CFE_SB_Qos_t   QoS;
+
+    /**
+     * For local subs, the SBN.SubEpoch that added the sub. For peer subs,
+     * set when a full sync from the peer confirms the sub.
+     */
+    uint32 Epoch;
 } SBN_Subs_t;
 
 /* most/all scalars should be typedef'd for readability and type checking */
@@ -105,6 +121,7 @@ typedef uint32            CFE_ProcessorID_t;
 typedef uint32            CFE_SpacecraftID_t;
 typedef uint32            OS_TaskID_t;
 typedef uint32            OS_MutexID_t;
+typedef uint32            OS_BinSemID_t;
 typedef int32             OS_SocketPort_t;
 typedef uint32            OS_SocketID_t;
 typedef int32             OS_FileDes_t;
@@ -32,6 +32,11 @@
 #include "cfe_msgids.h"
 #include "cfe_version.h"
 
+/* the UDP module receives whole datagrams into a buffer of this size */
+#if SBN_MAX_FRAME_SZ > CFE_MISSION_SB_MAX_SB_MSG_SIZE
+#error SBN_MAX_FRAME_SZ must not be larger than CFE_MISSION_SB_MAX_SB_MSG_SIZE
+#endif
+
 /** \brief SBN global application data, indexed by AppID. */
 SBN_App_t SBN;
 
@@ -148,6 +153,98 @@ bool SBN_UnpackMsg(void *SBNBuf, SBN_MsgSz_t *MsgSzPtr, SBN_MsgType_t *MsgTypePt
     return true;
 } /* end SBN_UnpackMsg */
 
+/**
+ * Packs a message as a record at the end of a frame (the payload of an
+ * SBN_FRAME_MSG.)
+ *
+ * \param Frame[in/out] The frame payload to append to.
+ * \param FrameSzPtr[in/out] The number of bytes of the frame in use, updated
+ *                           to include the new record.
+ * \param FrameBufSz[in] The size of the frame buffer.
+ * \param MsgSz[in] The size of the message.
+ * \param MsgType[in] The SBN message type.
+ * \param Msg[in] The message.
+ * \return true if the record fit in the frame.
+ */
+bool SBN_PackFrameRecord(void *Frame, SBN_MsgSz_t *FrameSzPtr, size_t FrameBufSz, SBN_MsgSz_t MsgSz,
+                         SBN_MsgType_t MsgType, void *Msg)
+{
+    size_t RecordSz = SBN_PACKED_RECORD_SZ(MsgSz);
+    Pack_t Pack;
+
+    if (*FrameSzPtr + RecordSz > FrameBufSz)
+    {
+        return false;
+    } /* end if */
+
+    Pack_Init(&Pack, (uint8 *)Frame + *FrameSzPtr, RecordSz, false);
+
+    Pack_Int16(&Pack, MsgSz);
+    Pack_UInt8(&Pack, MsgType);
+    Pack_UInt8(&Pack, 0);
+
+    if (Msg && MsgSz)
+    {
+        Pack_Data(&Pack, Msg, MsgSz);
+    } /* end if */
+
+    /* zero the padding rather than leak stale buffer contents onto the net */
+    memset((uint8 *)Pack.Buf + Pack.BufUsed, 0, RecordSz - Pack.BufUsed);
+
+    *FrameSzPtr += RecordSz;
+
+    return true;
+} /* end SBN_PackFrameRecord */
+
+/**
+ * Unpacks the next record of a frame (the payload of an SBN_FRAME_MSG.)
+ *
+ * \param Frame[in] The frame payload.
+ * \param FrameSz[in] The size of the frame payload.
+ * \param OffsetPtr[in/out] The offset of the record to unpack, advanced to the
+ *                          next record.
+ * \param MsgSzPtr[out] The size of the message.
+ * \param MsgTypePtr[out] The SBN message type.
+ * \param MsgPtr[out] Points to the message within the frame.
+ * \return true if a record was unpacked, false at the end of the frame or if
+ *         the record is truncated (*OffsetPtr is then short of FrameSz.)
+ */
+bool SBN_UnpackFrameRecord(void *Frame, SBN_MsgSz_t FrameSz, SBN_MsgSz_t *OffsetPtr, SBN_MsgSz_t *MsgSzPtr,
+                           SBN_MsgType_t *MsgTypePtr, void **MsgPtr)
+{
+    uint8  t = 0;
+    Pack_t Pack;
+
+    if (*OffsetPtr + SBN_PACKED_RECORD_HDR_SZ > FrameSz)
+    {
+        return false;
+    } /* end if */
+
+    Pack_Init(&Pack, (uint8 *)Frame + *OffsetPtr, FrameSz - *OffsetPtr, false);
+    Unpack_Int16(&Pack, MsgSzPtr);
+    Unpack_UInt8(&Pack, &t);
+    *MsgTypePtr = t;
+
+    if (*MsgSzPtr < 0 || *OffsetPtr + SBN_PACKED_RECORD_HDR_SZ + *MsgSzPtr > FrameSz)
+    {
+        return false;
+    } /* end if */
+
+    *MsgPtr = (uint8 *)Frame + *OffsetPtr + SBN_PACKED_RECORD_HDR_SZ;
+
+    /* the padding of the last record may have been left off */
+    if (*OffsetPtr + SBN_PACKED_RECORD_SZ(*MsgSzPtr) < FrameSz)
+    {
+        *OffsetPtr += SBN_PACKED_RECORD_SZ(*MsgSzPtr);
+    }
+    else
+    {
+        *OffsetPtr = FrameSz;
+    } /* end if */
+
+    return true;
+} /* end SBN_UnpackFrameRecord */
+
 /**
  * Called by a protocol module to signal that a peer has been connected.
  *
@@ -156,9 +253,10 @@ bool SBN_UnpackMsg(void *SBNBuf, SBN_MsgSz_t *MsgSzPtr, SBN_MsgType_t *MsgTypePt
  */
 SBN_Status_t SBN_Connected(SBN_PeerInterface_t *Peer)
 {
-    static const char FAIL_PREFIX[] = "ERROR: could not disconnect peer:";
+    static const char FAIL_PREFIX[] = "ERROR: could not connect peer:";
     SBN_Status_t SBN_Status = SBN_SUCCESS;
     CFE_Status_t CFE_Status;
+    int          SubIdx = 0;
 
     if (Peer->Connected != 0)
     {
@@ -174,7 +272,7 @@ SBN_Status_t SBN_Connected(SBN_PeerInterface_t *Peer)
 
     if (CFE_Status != CFE_SUCCESS)
     {
-        EVSSendErr(SBN_PEER_EID, "%s: could not create peer pipe '%s'", FAIL_PREFIX, PipeName);
+        EVSSendErr(SBN_PEER_EID, "%s could not create peer pipe '%s'", FAIL_PREFIX, PipeName);
 
         return SBN_ERROR;
     } /* end if */
@@ -184,15 +282,38 @@ SBN_Status_t SBN_Connected(SBN_PeerInterface_t *Peer)
     CFE_Status = CFE_SB_SetPipeOpts(Peer->Pipe, CFE_SB_PIPEOPTS_IGNOREMINE);
     if (CFE_Status != CFE_SUCCESS)
     {
-        EVSSendErr(SBN_PEER_EID, "%s: could not set pipe options '%s'", FAIL_PREFIX, PipeName);
+        EVSSendErr(SBN_PEER_EID, "%s could not set pipe options '%s'", FAIL_PREFIX, PipeName);
 
         return SBN_ERROR;
     } /* end if */
 
     EVSSendInfo(SBN_PEER_EID, "Peer %d:%d connected.", Peer->SpacecraftID, (int)(Peer->ProcessorID));
 
-    uint8 ProtocolVer = SBN_PROTO_VER;
-    SBN_Status        = SBN_SendNetMsg(SBN_PROTO_MSG, sizeof(ProtocolVer), &ProtocolVer, Peer);
+    /* the subs kept from before the peer disconnected go on the new pipe, the peer syncs any changes */
+    for (SubIdx = 0; SubIdx < Peer->SubCnt; SubIdx++)
+    {
+        if (CFE_SB_SubscribeLocal(Peer->Subs[SubIdx].MsgID, Peer->Pipe, SBN_DEFAULT_MSG_LIM) != CFE_SUCCESS)
+        {
+            EVSSendErr(SBN_PEER_EID, "unable to resubscribe to MID 0x%04X for peer %d:%d, dropping its subs",
+                       CFE_SB_MsgIdToValue(Peer->Subs[SubIdx].MsgID), Peer->SpacecraftID, (int)(Peer->ProcessorID));
+            SBN_RemoveAllSubsFromPeer(Peer);
+            break;
+        } /* end if */
+    }     /* end for */
+
+    /* version, capabilities, then the instance and epoch of the peer's subs I have */
+    uint8  Proto[SBN_PACKED_PROTO_SZ];
+    uint8  Caps = SBN_PROTO_CAP_SUB_SYNC;
+    Pack_t Pack;
+#ifdef SBN_FRAMES_ENABLED
+    Caps |= SBN_PROTO_CAP_FRAMES;
+#endif /* SBN_FRAMES_ENABLED */
+    Pack_Init(&Pack, Proto, sizeof(Proto), 0);
+    Pack_UInt8(&Pack, SBN_PROTO_VER);
+    Pack_UInt8(&Pack, Caps);
+    Pack_UInt32(&Pack, Peer->SubInstance);
+    Pack_UInt32(&Pack, Peer->SubEpoch);
+    SBN_Status = SBN_SendNetMsg(SBN_PROTO_MSG, Pack.BufUsed, Proto, Peer);
     if (SBN_Status != SBN_SUCCESS)
     {
         return SBN_Status;
@@ -201,13 +322,51 @@ SBN_Status_t SBN_Connected(SBN_PeerInterface_t *Peer)
     /* set this to current time so we don't think we've already timed out */
     OS_GetLocalTime(&Peer->LastRecv);
 
-    SBN_Status = SBN_SendLocalSubsToPeer(Peer);
-
+    /* my subs are sent when the peer's proto message says what it has */
     Peer->Connected = 1;
 
+    /* wake the send task waiting for this peer, and SBN_RecvPollTask() if it has a new socket to wait on */
+    OS_BinSemFlush(SBN.WakeSem);
+    OS_BinSemGive(SBN.WakeSem);
+
     return SBN_Status;
 } /* end SBN_Connected() */
 
+/**
+ * Takes the send mutex if the peer has a send task, which may be sending or
+ * gathering the peer's frame while another task disconnects the peer.
+ *
+ * @param Peer The peer about to be sent to or have its frame changed.
+ * @return SBN_SUCCESS if the peer may be used, SBN_ERROR otherwise.
+ */
+static SBN_Status_t LockPeerSend(SBN_PeerInterface_t *Peer)
+{
+    if (Peer->SendTaskID && OS_MutSemTake(SBN.SendMutex) != OS_SUCCESS)
+    {
+        EVSSendErr(SBN_PEER_EID, "unable to take send mutex");
+        return SBN_ERROR;
+    } /* end if */
+
+    return SBN_SUCCESS;
+} /* end LockPeerSend() */
+
+/**
+ * Gives the send mutex taken by LockPeerSend().
+ *
+ * @param Peer The peer passed to LockPeerSend().
+ * @return SBN_SUCCESS, or SBN_ERROR if the mutex could not be given.
+ */
+static SBN_Status_t UnlockPeerSend(SBN_PeerInterface_t *Peer)
+{
+    if (Peer->SendTaskID && OS_MutSemGive(SBN.SendMutex) != OS_SUCCESS)
+    {
+        EVSSendErr(SBN_PEER_EID, "unable to give send mutex");
+        return SBN_ERROR;
+    } /* end if */
+
+    return SBN_SUCCESS;
+} /* end UnlockPeerSend() */
+
 /**
  * Called by a protocol module to signal that a peer has been disconnected.
  *
@@ -241,7 +400,28 @@ SBN_Status_t SBN_Disconnected(SBN_PeerInterface_t *Peer)
     Peer->SendErrCnt = 0;
     Peer->RecvErrCnt = 0;
 
-    Peer->SubCnt = 0; /* reset sub count, in case this is a reconnection */
+    /*
+     * Deleting the pipe unsubscribed it from everything, but the peer's subs
+     * are kept so that when it reconnects it need only send what changed.
+     */
+
+    /*
+     * The peer offers frames again when it reconnects. The send task may be
+     * flushing the frame right now, so drop it under the send mutex.
+     */
+    if (LockPeerSend(Peer) != SBN_SUCCESS)
+    {
+        return SBN_ERROR;
+    } /* end if */
+
+    Peer->FramesOK    = false;
+    Peer->FrameSz     = 0;
+    Peer->FrameMsgCnt = 0;
+
+    if (UnlockPeerSend(Peer) != SBN_SUCCESS)
+    {
+        return SBN_ERROR;
+    } /* end if */
 
     EVSSendInfo(SBN_PEER_EID, "Disconnected from peer %d:%d.", Peer->SpacecraftID, (int)(Peer->ProcessorID));
 
@@ -418,6 +598,119 @@ void SBN_RecvNetTask(void)
     D.Net->RecvTaskID = 0;
 } /* end SBN_RecvNetTask() */
 
+/**
+ * Whether a net is received from by SBN_RecvPollTask(), rather than by its own
+ * receive task or by the main loop: the net is polled and its module can tell
+ * which sockets to wait on.
+ */
+static bool RecvByPollTask(SBN_NetInterface_t *Net)
+{
+    return Net->Configured && !(Net->TaskFlags & SBN_TASK_RECV) && Net->IfOps && Net->IfOps->AddRecvFds;
+} /* end RecvByPollTask() */
+
+/**
+ * Receives messages from one net, injecting them onto the local software bus.
+ * At most SBN_RECV_MAX_MSGS_PER_PASS messages are taken from the net (or from
+ * each of its peers) so that other nets get their turn.
+ *
+ * @param Net The net to receive from.
+ * @param NetIdx Index of the net, for events.
+ * @return The number of messages successfully received.
+ */
+static int RecvNet(SBN_NetInterface_t *Net, SBN_NetIdx_t NetIdx)
+{
+    SBN_Status_t       SBN_Status = 0;
+    SBN_MsgType_t      MsgType;
+    SBN_MsgSz_t        MsgSz;
+    CFE_ProcessorID_t  ProcessorID;
+    CFE_SpacecraftID_t SpacecraftID;
+    int                Received = 0;
+
+    if (Net->IfOps->RecvFromNet)
+    {
+        int MsgCnt = 0;
+        for (MsgCnt = 0; MsgCnt < SBN_RECV_MAX_MSGS_PER_PASS; MsgCnt++)
+        {
+            /*memset(SBN.MsgBuffer, 0, sizeof(SBN.MsgBuffer));*/
+
+            SBN_Status = Net->IfOps->RecvFromNet(Net, &MsgType, &MsgSz, &ProcessorID, &SpacecraftID, SBN.MsgBuffer);
+
+            if (SBN_Status == SBN_IF_EMPTY)
+            {
+                break; /* no (more) messages for this net, continue to next net */
+            }          /* end if */
+
+            if (SBN_Status == SBN_SUCCESS)
+            {
+                Received++;
+            } /* end if */
+
+            /* for UDP, the message received may not be from the peer
+             * expected.
+             */
+            SBN_PeerInterface_t *Peer = SBN_GetPeer(Net, ProcessorID, SpacecraftID);
+
+            if (!Peer)
+            {
+                EVSSendInfo(SBN_PEERTASK_EID, "unknown peer (ProcessorID=%d)", (int)ProcessorID);
+                /* may be a misconfiguration on my part...? continue processing msgs... */
+                continue;
+            } /* end if */
+
+            OS_GetLocalTime(&Peer->LastRecv);
+            SBN_ProcessNetMsg(Net, MsgType, ProcessorID, SpacecraftID, MsgSz, SBN.MsgBuffer); /* ignore errors */
+        }                                                             /* end for */
+    }
+    else if (Net->IfOps->RecvFromPeer)
+    {
+        SBN_PeerIdx_t PeerIdx = 0;
+        for (PeerIdx = 0; PeerIdx < Net->PeerCnt; PeerIdx++)
+        {
+            SBN_PeerInterface_t *Peer = &Net->Peers[PeerIdx];
+
+            int MsgCnt = 0;
+            for (MsgCnt = 0; MsgCnt < SBN_RECV_MAX_MSGS_PER_PASS; MsgCnt++)
+            {
+                ProcessorID  = 0;
+                SpacecraftID = 0;
+                MsgType      = 0;
+                MsgSz        = 0;
+
+                memset(SBN.MsgBuffer, 0, sizeof(SBN.MsgBuffer));
+
+                SBN_Status = Net->IfOps->RecvFromPeer(Net, Peer, &MsgType, &MsgSz, &ProcessorID, &SpacecraftID, SBN.MsgBuffer);
+
+                if (SBN_Status == SBN_IF_EMPTY)
+                {
+                    break; /* no (more) messages for this peer, continue to next peer */
+                }          /* end if */
+
+                if (SBN_Status == SBN_SUCCESS)
+                {
+                    Received++;
+                } /* end if */
+
+                OS_GetLocalTime(&Peer->LastRecv);
+
+                SBN_Status = SBN_ProcessNetMsg(Net, MsgType, ProcessorID, SpacecraftID, MsgSz, SBN.MsgBuffer);
+
+                if (SBN_Status != SBN_SUCCESS)
+                {
+                    break; /* continue to next peer */
+                }          /* end if */
+            }              /* end for */
+        }                  /* end for */
+    }
+    else
+    {
+        EVSSendErr(SBN_PEER_EID, "neither RecvFromPeer nor RecvFromNet defined for net #%d", (int)NetIdx);
+
+        /* meanwhile, continue to next net... */
+    } /* end if */
+
+    return Received;
+} /* end RecvNet() */
+
 /**
  * Checks all interfaces for messages from peers.
  * Receive messages from the specified peer, injecting them onto the local
@@ -425,99 +718,103 @@ void SBN_RecvNetTask(void)
  */
 SBN_Status_t SBN_RecvNetMsgs(void)
 {
-    SBN_Status_t SBN_Status = 0;
-
     SBN_NetIdx_t NetIdx = 0;
     for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
     {
         SBN_NetInterface_t *Net = &SBN.Nets[NetIdx];
-        SBN_MsgType_t       MsgType;
-        SBN_MsgSz_t         MsgSz;
-        CFE_ProcessorID_t   ProcessorID;
-        CFE_SpacecraftID_t  SpacecraftID;
 
         if (Net->TaskFlags & SBN_TASK_RECV)
         {
             continue; /* separate task handles receiving from a net */
         }             /* end if */
 
-        if (Net->IfOps->RecvFromNet)
+        if (SBN.RecvPollTaskID && RecvByPollTask(Net))
         {
-            int MsgCnt = 0;
-            // TODO: make configurable
-            for (MsgCnt = 0; MsgCnt < 100; MsgCnt++) /* read at most 100 messages from the net */
-            {
-                /*memset(SBN.MsgBuffer, 0, sizeof(SBN.MsgBuffer));*/
-
-                SBN_Status = Net->IfOps->RecvFromNet(Net, &MsgType, &MsgSz, &ProcessorID, &SpacecraftID, SBN.MsgBuffer);
+            continue; /* SBN_RecvPollTask() receives as soon as the net is readable */
+        }             /* end if */
 
-                if (SBN_Status == SBN_IF_EMPTY)
-                {
-                    break; /* no (more) messages for this net, continue to next net */
-                }          /* end if */
+        RecvNet(Net, NetIdx);
+    }     /* end for */
 
-                /* for UDP, the message received may not be from the peer
-                 * expected.
-                 */
-                SBN_PeerInterface_t *Peer = SBN_GetPeer(Net, ProcessorID, SpacecraftID);
+    return SBN_SUCCESS;
+} /* end SBN_RecvNetMsgs */
 
-                if (!Peer)
-                {
-                    EVSSendInfo(SBN_PEERTASK_EID, "unknown peer (ProcessorID=%d)", (int)ProcessorID);
-                    /* may be a misconfiguration on my part...? continue processing msgs... */
-                    continue;
-                } /* end if */
+/**
+ * \brief Receive task for the polled nets whose modules can say which sockets
+ * they receive on (see AddRecvFds.) Rather than leaving those nets for the
+ * main loop to poll when it next wakes up, it waits for any of their sockets
+ * to become readable and then receives until they are all empty.
+ * Spawned from PeerPoll()
+ */
+void SBN_RecvPollTask(void)
+{
+    OS_FdSet     FdSet;
+    SBN_NetIdx_t NetIdx   = 0;
+    int          Received = 0;
+    bool         CanWait  = false;
+    OS_Status_t  Status   = OS_SUCCESS;
 
-                OS_GetLocalTime(&Peer->LastRecv);
-                SBN_ProcessNetMsg(Net, MsgType, ProcessorID, SpacecraftID, MsgSz, SBN.MsgBuffer); /* ignore errors */
-            }                                                             /* end for */
-        }
-        else if (Net->IfOps->RecvFromPeer)
+    while (1)
+    {
+        if (OS_MutSemTake(SBN.ConfMutex) != OS_SUCCESS)
         {
-            SBN_PeerIdx_t PeerIdx = 0;
-            for (PeerIdx = 0; PeerIdx < Net->PeerCnt; PeerIdx++)
-            {
-                SBN_PeerInterface_t *Peer = &Net->Peers[PeerIdx];
+            EVSSendErr(SBN_PEERTASK_EID, "receive poll task unable to take configuration mutex");
+            break;
+        } /* end if */
 
-                int MsgCnt = 0;
-                // TODO: make configurable
-                for (MsgCnt = 0; MsgCnt < 100; MsgCnt++) /* read at most 100 messages from peer */
-                {
-                    CFE_ProcessorID_t ProcessorID = 0;
-                    CFE_SpacecraftID_t SpacecraftID = 0;
-                    SBN_MsgType_t     MsgType     = 0;
-                    SBN_MsgSz_t       MsgSz       = 0;
+        Received = 0;
+        CanWait  = false;
+        OS_SelectFdZero(&FdSet);
 
-                    memset(SBN.MsgBuffer, 0, sizeof(SBN.MsgBuffer));
+        for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
+        {
+            SBN_NetInterface_t *Net = &SBN.Nets[NetIdx];
 
-                    SBN_Status = Net->IfOps->RecvFromPeer(Net, Peer, &MsgType, &MsgSz, &ProcessorID, &SpacecraftID, SBN.MsgBuffer);
+            if (!RecvByPollTask(Net))
+            {
+                continue;
+            } /* end if */
 
-                    if (SBN_Status == SBN_IF_EMPTY)
-                    {
-                        break; /* no (more) messages for this peer, continue to next peer */
-                    }          /* end if */
+            Received += RecvNet(Net, NetIdx);
 
-                    OS_GetLocalTime(&Peer->LastRecv);
+            if (Net->IfOps->AddRecvFds(Net, &FdSet) == SBN_SUCCESS)
+            {
+                CanWait = true;
+            } /* end if */
+        }     /* end for */
 
-                    SBN_Status = SBN_ProcessNetMsg(Net, MsgType, ProcessorID, SpacecraftID, MsgSz, SBN.MsgBuffer);
+        if (OS_MutSemGive(SBN.ConfMutex) != OS_SUCCESS)
+        {
+            EVSSendErr(SBN_PEERTASK_EID, "receive poll task unable to give configuration mutex");
+            break;
+        } /* end if */
 
-                    if (SBN_Status != SBN_SUCCESS)
-                    {
-                        break; /* continue to next peer */
-                    }          /* end if */
-                }              /* end for */
-            }                  /* end for */
-        }
-        else
+        if (Received)
         {
-            EVSSendErr(SBN_PEER_EID, "neither RecvFromPeer nor RecvFromNet defined for net #%d", (int)NetIdx);
+            /* one pass takes a bounded number of messages from each net, go
+             * again until they are empty, but sleep first so that the main
+             * loop gets the configuration mutex and the CPU in between.
+             */
+            OS_TaskDelay(SBN_RECV_POLL_YIELD_MS);
+            continue;
+        } /* end if */
+
+        /*
+         * The timeout picks up sockets that were opened since the set was
+         * built. A set that cannot be waited on (nothing connected, or a
+         * socket closed under it) waits for a peer to connect instead.
+         */
+        Status = CanWait ? OS_SelectMultiple(&FdSet, NULL, SBN_MAIN_LOOP_DELAY) : OS_ERR_INVALID_ID;
 
-            /* meanwhile, continue to next net... */
+        if (Status != OS_SUCCESS && Status != OS_ERROR_TIMEOUT)
+        {
+            OS_BinSemTimedWait(SBN.WakeSem, SBN_MAIN_LOOP_DELAY);
         } /* end if */
-    }     /* end for */
+    }     /* end while */
 
-    return SBN_SUCCESS;
-} /* end SBN_RecvNetMsgs */
+    /* Unset the task id so that the main loop receives from the nets again */
+    SBN.RecvPollTaskID = 0;
+} /* end SBN_RecvPollTask() */
 
 /**
  * Sends a message to a peer using the module's send API.
@@ -534,14 +831,10 @@ SBN_Status_t SBN_SendNetMsg(SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Msg,
     SBN_NetInterface_t *Net        = Peer->Net;
     SBN_Status_t        SBN_Status = SBN_SUCCESS;
 
-    if (Peer->SendTaskID)
+    if (LockPeerSend(Peer) != SBN_SUCCESS)
     {
-        if (OS_MutSemTake(SBN.SendMutex) != OS_SUCCESS)
-        {
-            EVSSendErr(SBN_PEER_EID, "unable to take send mutex");
-            return SBN_ERROR;
-        } /* end if */
-    }     /* end if */
+        return SBN_ERROR;
+    } /* end if */
 
     SBN_Status = Net->IfOps->Send(Peer, MsgType, MsgSz, Msg);
 
@@ -555,17 +848,131 @@ SBN_Status_t SBN_SendNetMsg(SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Msg,
     /* for clients that need a poll or heartbeat, update time even when failing */
     OS_GetLocalTime(&Peer->LastSend);
 
-    if (Peer->SendTaskID)
+    if (UnlockPeerSend(Peer) != SBN_SUCCESS)
+    {
+        return SBN_ERROR;
+    } /* end if */
+
+    return SBN_Status;
+} /* end SBN_SendNetMsg */
+
+/**
+ * Sends the records gathered in a peer's frame. A frame holding a single
+ * record is sent as that message alone.
+ *
+ * @param Peer The peer to send the frame to.
+ * @return SBN_SUCCESS if the frame was sent or was empty, SBN_ERROR otherwise.
+ */
+SBN_Status_t SBN_FlushFrame(SBN_PeerInterface_t *Peer)
+{
+    SBN_Status_t  SBN_Status = SBN_SUCCESS;
+    SBN_MsgSz_t   Offset     = 0;
+    SBN_MsgSz_t   MsgSz      = 0;
+    SBN_MsgType_t MsgType    = 0;
+    void *        Msg        = NULL;
+
+    /* the send mutex is recursive, SBN_SendNetMsg() takes it again */
+    if (LockPeerSend(Peer) != SBN_SUCCESS)
+    {
+        return SBN_ERROR;
+    } /* end if */
+
+    if (Peer->FrameMsgCnt == 1)
+    {
+        SBN_UnpackFrameRecord(Peer->Frame, Peer->FrameSz, &Offset, &MsgSz, &MsgType, &Msg);
+        SBN_Status = SBN_SendNetMsg(MsgType, MsgSz, Msg, Peer);
+    }
+    else if (Peer->FrameMsgCnt > 1)
     {
-        if (OS_MutSemGive(SBN.SendMutex) != OS_SUCCESS)
+        SBN_Status = SBN_SendNetMsg(SBN_FRAME_MSG, Peer->FrameSz, Peer->Frame, Peer);
+    } /* end if */
+
+    Peer->FrameSz     = 0;
+    Peer->FrameMsgCnt = 0;
+
+    if (UnlockPeerSend(Peer) != SBN_SUCCESS)
+    {
+        return SBN_ERROR;
+    } /* end if */
+
+    return SBN_Status;
+} /* end SBN_FlushFrame */
+
+/**
+ * Adds a message to a peer's frame, sending the frame first if the message
+ * does not fit. Messages to peers that have not offered to receive frames,
+ * and messages too large for a frame, are sent on their own.
+ *
+ * @param MsgType SBN type of the message
+ * @param MsgSz Size of the message
+ * @param Msg Message to send
+ * @param Peer The peer to send the message to.
+ * @return SBN_SUCCESS on success, SBN_ERROR if a send failed.
+ */
+SBN_Status_t SBN_SendFramedMsg(SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Msg, SBN_PeerInterface_t *Peer)
+{
+    SBN_Status_t SBN_Status = SBN_SUCCESS;
+
+    if (LockPeerSend(Peer) != SBN_SUCCESS)
+    {
+        return SBN_ERROR;
+    } /* end if */
+
+    if (!Peer->FramesOK || SBN_PACKED_RECORD_SZ(MsgSz) > SBN_MAX_FRAME_PAYLOAD_SZ)
+    {
+        /* send anything gathered first so the peer sees messages in order */
+        SBN_Status = SBN_FlushFrame(Peer);
+        if (SBN_Status == SBN_SUCCESS)
         {
-            EVSSendErr(SBN_PEER_EID, "unable to give send mutex");
-            return SBN_ERROR;
+            SBN_Status = SBN_SendNetMsg(MsgType, MsgSz, Msg, Peer);
         } /* end if */
-    }     /* end if */
+    }
+    else
+    {
+        if (!SBN_PackFrameRecord(Peer->Frame, &Peer->FrameSz, sizeof(Peer->Frame), MsgSz, MsgType, Msg))
+        {
+            /* frame is full, the record always fits in an empty one */
+            SBN_Status = SBN_FlushFrame(Peer);
+            SBN_PackFrameRecord(Peer->Frame, &Peer->FrameSz, sizeof(Peer->Frame), MsgSz, MsgType, Msg);
+        } /* end if */
+
+        if (Peer->FrameMsgCnt++ == 0)
+        {
+            OS_GetLocalTime(&Peer->FrameStart);
+        } /* end if */
+    } /* end if */
+
+    if (UnlockPeerSend(Peer) != SBN_SUCCESS)
+    {
+        return SBN_ERROR;
+    } /* end if */
 
     return SBN_Status;
-} /* end SBN_SendNetMsg */
+} /* end SBN_SendFramedMsg */
+
+/**
+ * How long to wait for more messages to add to a peer's frame before sending
+ * it, given that its first record may wait up to SBN_FRAME_LATENCY_MS.
+ *
+ * @param Peer The peer with a frame in progress.
+ * @return The time to wait in milliseconds, or CFE_SB_POLL once the latency
+ *         budget is spent.
+ */
+static int32 FrameTimeout(SBN_PeerInterface_t *Peer)
+{
+    OS_time_t Now;
+    int64     Waited;
+
+    OS_GetLocalTime(&Now);
+    Waited = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(Now, Peer->FrameStart));
+
+    if (Waited >= SBN_FRAME_LATENCY_MS)
+    {
+        return CFE_SB_POLL;
+    } /* end if */
+
+    return (int32)(SBN_FRAME_LATENCY_MS - Waited);
+} /* end FrameTimeout() */
 
 typedef struct
 {
@@ -577,6 +984,8 @@ typedef struct
     CFE_SB_MsgId_t       MsgID;
     SBN_NetInterface_t  *Net;
     SBN_PeerInterface_t *Peer;
+    CFE_Status_t         CFE_Status;
+    int32                Timeout;
 } SendTaskData_t;
 
 /**
@@ -626,11 +1035,27 @@ void SBN_SendTask(void)
 
         if (!D.Peer->Connected)
         {
-            OS_TaskDelay(SBN_MAIN_LOOP_DELAY);
+            /* woken when a peer connects, the timeout covers a connect just before the wait */
+            OS_BinSemTimedWait(SBN.WakeSem, SBN_MAIN_LOOP_DELAY);
+            continue;
+        } /* end if */
+
+        /* with a frame in progress, only wait as long as its latency budget allows */
+        D.Timeout = D.Peer->FrameMsgCnt ? FrameTimeout(D.Peer) : CFE_SB_PEND_FOREVER;
+
+        D.CFE_Status = CFE_SB_ReceiveBuffer((CFE_SB_Buffer_t **)&D.MsgPtr, D.Peer->Pipe, D.Timeout);
+
+        if (D.CFE_Status == CFE_SB_NO_MESSAGE || D.CFE_Status == CFE_SB_TIME_OUT)
+        {
+            if (SBN_FlushFrame(D.Peer) == SBN_ERROR)
+            {
+                break;
+            } /* end if */
+
             continue;
         } /* end if */
 
-        if (CFE_SB_ReceiveBuffer((CFE_SB_Buffer_t **)&D.MsgPtr, D.Peer->Pipe, CFE_SB_PEND_FOREVER) != CFE_SUCCESS)
+        if (D.CFE_Status != CFE_SUCCESS)
         {
             break;
         } /* end if */
@@ -668,7 +1093,7 @@ void SBN_SendTask(void)
             continue;
         } /* end if */
 
-        D.Status = SBN_SendNetMsg(SBN_APP_MSG, MsgSz, D.MsgPtr, D.Peer);
+        D.Status = SBN_SendFramedMsg(SBN_APP_MSG, MsgSz, D.MsgPtr, D.Peer);
 
         if (D.Status == SBN_ERROR)
         {
@@ -680,6 +1105,35 @@ void SBN_SendTask(void)
     D.Peer->SendTaskID = 0;
 } /* end SBN_SendTask() */
 
+/**
+ * Once the peer pipes have been drained, send the frames that have used up
+ * their latency budget. (Peers with a send task send their own frames.)
+ */
+static void FlushFrames(void)
+{
+    SBN_NetIdx_t NetIdx = 0;
+    for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
+    {
+        SBN_NetInterface_t *Net = &SBN.Nets[NetIdx];
+
+        SBN_PeerIdx_t PeerIdx = 0;
+        for (PeerIdx = 0; PeerIdx < Net->PeerCnt; PeerIdx++)
+        {
+            SBN_PeerInterface_t *Peer = &Net->Peers[PeerIdx];
+
+            if ((Peer->TaskFlags & SBN_TASK_SEND) || !Peer->Connected || !Peer->FrameMsgCnt)
+            {
+                continue;
+            } /* end if */
+
+            if (FrameTimeout(Peer) == CFE_SB_POLL)
+            {
+                SBN_FlushFrame(Peer);
+            } /* end if */
+        }     /* end for */
+    }         /* end for */
+} /* end FlushFrames() */
+
 /**
  * Iterate through all peers, examining the pipe to see if there are messages
  * I need to send to that peer.
@@ -697,10 +1151,12 @@ static SBN_Status_t CheckPeerPipes(void)
 
     /**
      * \note This processes one message per peer, then start again until no
-     * peers have pending messages. At max only process SBN_MAX_MSG_PER_WAKEUP
-     * per peer per wakeup otherwise I will starve other processing.
+     * peers have pending messages, so a babbling peer does not hold up the
+     * others. A pipe holds at most SBN_PEER_PIPE_DEPTH messages, so that many
+     * rounds empty every pipe of what was in it at the start; anything that
+     * arrives faster than that waits for the next wakeup.
      */
-    for (iter = 0; iter < SBN_MAX_MSG_PER_WAKEUP; iter++)
+    for (iter = 0; iter < SBN_PEER_PIPE_DEPTH; iter++)
     {
         ReceivedFlag = 0;
 
@@ -715,8 +1171,8 @@ static SBN_Status_t CheckPeerPipes(void)
                 SBN_ModuleIdx_t      FilterIdx = 0;
                 SBN_PeerInterface_t *Peer      = &Net->Peers[PeerIdx];
 
-                // Poll peer here to detect disconnections and to reconnect
-                if(Net->IfOps->PollPeer(Peer) != SBN_SUCCESS) {
+                // Poll peer here (once per wakeup) to detect disconnections and to reconnect
+                if(iter == 0 && Net->IfOps->PollPeer(Peer) != SBN_SUCCESS) {
                   EVSSendErr(SBN_PEERTASK_EID, "failed to poll peer %d:%d", Peer->SpacecraftID, Peer->ProcessorID);
                 }
 
@@ -795,7 +1251,7 @@ static SBN_Status_t CheckPeerPipes(void)
                     continue;
                 } /* end if */
 
-                SBN_SendNetMsg(SBN_APP_MSG, MsgSz, MsgPtr, Peer);
+                SBN_SendFramedMsg(SBN_APP_MSG, MsgSz, MsgPtr, Peer);
             } /* end for */
         }     /* end for */
 
@@ -804,6 +1260,9 @@ static SBN_Status_t CheckPeerPipes(void)
             break;
         } /* end if */
     }     /* end for */
+
+    FlushFrames();
+
     return SBN_SUCCESS;
 } /* end CheckPeerPipes */
 
@@ -813,7 +1272,16 @@ static SBN_Status_t CheckPeerPipes(void)
 static SBN_Status_t PeerPoll(void)
 {
     CFE_Status_t CFE_Status;
-    SBN_NetIdx_t NetIdx = 0;
+    SBN_NetIdx_t NetIdx         = 0;
+    bool         CreatePollTask = true;
+
+    if (SBN.RecvPollRetryWait > 0)
+    {
+        /* still backing off after failing to create the receive poll task */
+        SBN.RecvPollRetryWait--;
+        CreatePollTask = false;
+    } /* end if */
+
     for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
     {
         SBN_NetInterface_t *Net = &SBN.Nets[NetIdx];
@@ -870,7 +1338,33 @@ static SBN_Status_t PeerPoll(void)
                 } /* end if */
             }     /* end for */
         }         /* end if */
-    }             /* end for */
+
+        if (CreatePollTask && !SBN.RecvPollTaskID && RecvByPollTask(Net))
+        {
+            EVSSendInfo(SBN_PEER_EID, "Creating recv poll task");
+
+            CFE_Status = CFE_ES_CreateChildTask(
+                &(SBN.RecvPollTaskID), "sbn_recv_poll", (CFE_ES_ChildTaskMainFuncPtr_t)&SBN_RecvPollTask, NULL,
+                SBN_RECV_POLL_TASK_STACK_SZ, SBN_RECV_POLL_TASK_PRIORITY, 0);
+
+            if (CFE_Status != CFE_SUCCESS)
+            {
+                /* the main loop keeps receiving from the nets meanwhile */
+                SBN.RecvPollRetryBackoff = SBN.RecvPollRetryBackoff ? SBN.RecvPollRetryBackoff * 2 : 1;
+                if (SBN.RecvPollRetryBackoff > SBN_RECV_POLL_RETRY_MAX_WAKEUPS)
+                {
+                    SBN.RecvPollRetryBackoff = SBN_RECV_POLL_RETRY_MAX_WAKEUPS;
+                } /* end if */
+                SBN.RecvPollRetryWait = SBN.RecvPollRetryBackoff;
+
+                EVSSendErr(SBN_PEER_EID, "error creating recv poll task, retrying in %u wakeups",
+                           (unsigned int)SBN.RecvPollRetryWait);
+                return SBN_ERROR;
+            } /* end if */
+
+            SBN.RecvPollRetryBackoff = 0;
+        }     /* end if */
+    }         /* end for */
 
     return SBN_SUCCESS;
 } /* end PeerPoll */
@@ -928,20 +1422,52 @@ static SBN_Status_t InitInterfaces(void)
 } /* end InitInterfaces */
 
 /**
- * This function waits for the scheduler (SCH) to wake this code up, so that
- * nothing transpires until the cFE is fully operational.
+ * How long the main loop may wait for a command before it has to run again:
+ * SBN_MAIN_LOOP_DELAY, or less when a frame to a polled peer is due sooner.
  *
- * @param[in] iTimeOut The time to wait for the scheduler to notify this code.
- * @return CFE_SUCCESS on success, otherwise an error value.
+ * @return The time to wait in milliseconds, or CFE_SB_POLL.
  */
-static SBN_Status_t WaitForWakeup(int32 iTimeOut)
+static int32 MainLoopTimeout(void)
 {
-    CFE_Status_t       CFE_Status = CFE_SUCCESS;
-    SBN_Status_t       SBN_Status = SBN_SUCCESS;
-    CFE_MSG_Message_t *MsgPtr    = 0;
+    int32        Timeout = SBN_MAIN_LOOP_DELAY, FrameWait = 0;
+    SBN_NetIdx_t NetIdx  = 0;
 
-    /* Wait for WakeUp messages from scheduler */
-    CFE_Status = CFE_SB_ReceiveBuffer((CFE_SB_Buffer_t **)&MsgPtr, SBN.CmdPipe, iTimeOut);
+    for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
+    {
+        SBN_NetInterface_t *Net = &SBN.Nets[NetIdx];
+
+        SBN_PeerIdx_t PeerIdx = 0;
+        for (PeerIdx = 0; PeerIdx < Net->PeerCnt; PeerIdx++)
+        {
+            SBN_PeerInterface_t *Peer = &Net->Peers[PeerIdx];
+
+            if ((Peer->TaskFlags & SBN_TASK_SEND) || !Peer->Connected || !Peer->FrameMsgCnt)
+            {
+                continue;
+            } /* end if */
+
+            FrameWait = FrameTimeout(Peer);
+            if (FrameWait < Timeout)
+            {
+                Timeout = FrameWait;
+            } /* end if */
+        }     /* end for */
+    }         /* end for */
+
+    return Timeout;
+} /* end MainLoopTimeout() */
+
+/**
+ * Handles what woke the main loop up: a command, a wakeup message from the
+ * scheduler (SCH), or the timeout; then does the cyclic processing.
+ *
+ * @param[in] CFE_Status The result of receiving from the command pipe.
+ * @param[in] MsgPtr The message received, if any.
+ * @return SBN_SUCCESS on success, otherwise SBN_ERROR.
+ */
+static SBN_Status_t HandleWakeup(CFE_Status_t CFE_Status, CFE_MSG_Message_t *MsgPtr)
+{
+    SBN_Status_t SBN_Status = SBN_SUCCESS;
 
     switch (CFE_Status)
     {
@@ -956,7 +1482,7 @@ static SBN_Status_t WaitForWakeup(int32 iTimeOut)
     } /* end switch */
 
     /* For sbn, we still want to perform cyclic processing
-    ** if the WaitForWakeup time out
+    ** if the wait for a wakeup times out
     ** cyclic processing at timeout rate
     */
     CFE_ES_PerfLogEntry(SBN_PERF_RECV_ID);
@@ -982,7 +1508,7 @@ static SBN_Status_t WaitForWakeup(int32 iTimeOut)
     CFE_ES_PerfLogExit(SBN_PERF_RECV_ID);
 
     return SBN_SUCCESS;
-} /* end WaitForWakeup */
+} /* end HandleWakeup */
 
 /**
  * Load Protocol or Filter Module from the table
@@ -1275,6 +1801,16 @@ static SBN_Status_t UnloadNets(void)
 {
     uint32 Status;
 
+    if (SBN.RecvPollTaskID != 0)
+    {
+        if (CFE_ES_DeleteChildTask(SBN.RecvPollTaskID) != CFE_SUCCESS)
+        {
+            EVSSendCrit(SBN_TBL_EID, "unable to delete recv poll task");
+        } /* end if */
+
+        SBN.RecvPollTaskID = 0;
+    } /* end if */
+
     int NetIdx = 0;
     for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
     {
@@ -1401,6 +1937,9 @@ static SBN_Status_t Init(void)
 {
     static const char FAIL_PREFIX[] = "ERROR: could not initialize SBN:";
 
+    /* peers replace their copy of my subs with those SB reports from here on */
+    SBN_ResetLocalSubs();
+
     /* Load the configuration from the table */
     if(LoadConf() != SBN_SUCCESS)
     {
@@ -1465,9 +2004,7 @@ static SBN_Status_t Cleanup(void)
     } /* end if */
 
     // cleanup subs
-    memset(SBN.Subs, 0, sizeof(SBN.Subs));
-
-    SBN.SubCnt = 0;
+    SBN_ResetLocalSubs();
 
     if (CFE_TBL_Update(SBN.ConfTblHandle) != CFE_SUCCESS)
     {
@@ -1482,9 +2019,12 @@ static SBN_Status_t Cleanup(void)
 void SBN_AppMain(void)
 {
     static const char FAIL_PREFIX[] = "ERROR: could not start SBN:";
-    CFE_ES_TaskInfo_t TaskInfo;
-    uint32            Status    = CFE_SUCCESS;
-    uint32            RunStatus = CFE_ES_RunStatus_APP_RUN, AppID = 0;
+    CFE_ES_TaskInfo_t  TaskInfo;
+    uint32             Status    = CFE_SUCCESS;
+    uint32             RunStatus = CFE_ES_RunStatus_APP_RUN, AppID = 0;
+    CFE_Status_t       CFE_Status;
+    CFE_MSG_Message_t *MsgPtr  = NULL;
+    int32              Timeout = SBN_MAIN_LOOP_DELAY;
 
     if (CFE_EVS_Register(NULL, 0, CFE_EVS_NO_FILTER != CFE_SUCCESS))
         return;
@@ -1525,6 +2065,14 @@ void SBN_AppMain(void)
         return;
     }
 
+    /** Create semaphore for waking tasks when peers connect **/
+    Status = OS_BinSemCreate(&(SBN.WakeSem), "sbn_wake_sem", 0, 0);
+    if (Status != OS_SUCCESS)
+    {
+        EVSSendErr(SBN_INIT_EID, "%s error creating wake semaphore", FAIL_PREFIX);
+        return;
+    }
+
     /* Create pipe for HK requests and gnd commands */
     /* TODO: make configurable depth */
     Status = CFE_SB_CreatePipe(&SBN.CmdPipe, 20, "SBNCmdPipe");
@@ -1562,13 +2110,20 @@ void SBN_AppMain(void)
     /* Loop Forever */
     while (CFE_ES_RunLoop(&RunStatus))
     {
+        /* Wait for WakeUp messages from scheduler, without holding the
+         * configuration mutex so that SBN_RecvPollTask() can run meanwhile.
+         */
+        CFE_Status = CFE_SB_ReceiveBuffer((CFE_SB_Buffer_t **)&MsgPtr, SBN.CmdPipe, Timeout);
+
         if (OS_MutSemTake(SBN.ConfMutex) != OS_SUCCESS)
         {
             EVSSendErr(SBN_PEER_EID, "ERROR: SBN run loop unable to take configuration mutex");
             break;
         } /* end if */
 
-        WaitForWakeup(SBN_MAIN_LOOP_DELAY);
+        HandleWakeup(CFE_Status, MsgPtr);
+
+        Timeout = MainLoopTimeout();
 
         if (OS_MutSemGive(SBN.ConfMutex) != OS_SUCCESS) {
             EVSSendErr(SBN_PEER_EID, "ERROR: SBN run loop unable to give configuration mutex");
@@ -1583,6 +2138,49 @@ void SBN_AppMain(void)
     CFE_ES_ExitApp(RunStatus);
 } /* end SBN_AppMain */
 
+/**
+ * Processes each record of a frame received from a peer as a message from
+ * that peer. A record that fails to process does not stop the records after
+ * it from being processed.
+ *
+ * @return SBN_SUCCESS if all records were processed, SBN_ERROR otherwise
+ */
+static SBN_Status_t ProcessFrame(SBN_NetInterface_t *Net, CFE_ProcessorID_t ProcessorID,
+                                 CFE_SpacecraftID_t SpacecraftID, SBN_MsgSz_t FrameSz, void *Frame)
+{
+    static const char FAIL_PREFIX[] = "ERROR: could not process peer frame:";
+    SBN_Status_t      SBN_Status    = SBN_SUCCESS;
+    SBN_MsgSz_t       Offset        = 0;
+    SBN_MsgSz_t       MsgSz         = 0;
+    SBN_MsgType_t     MsgType       = 0;
+    void *            Msg           = NULL;
+
+    while (SBN_UnpackFrameRecord(Frame, FrameSz, &Offset, &MsgSz, &MsgType, &Msg))
+    {
+        if (MsgType == SBN_FRAME_MSG)
+        {
+            EVSSendErr(SBN_PEERTASK_EID, "%s frame nested in a frame", FAIL_PREFIX);
+            SBN_Status = SBN_ERROR;
+            continue;
+        } /* end if */
+
+        /* SBN_IF_EMPTY only means a filter dropped the message */
+        if (SBN_ProcessNetMsg(Net, MsgType, ProcessorID, SpacecraftID, MsgSz, Msg) == SBN_ERROR)
+        {
+            SBN_Status = SBN_ERROR;
+        } /* end if */
+    }     /* end while */
+
+    if (Offset != FrameSz)
+    {
+        EVSSendErr(SBN_PEERTASK_EID, "%s truncated record at offset %d of %d", FAIL_PREFIX, (int)Offset,
+                   (int)FrameSz);
+        return SBN_ERROR;
+    } /* end if */
+
+    return SBN_Status;
+} /* end ProcessFrame() */
+
 /**
  * Sends a message to a peer.
  * @param[in] MsgType The type of the message (application data, SBN protocol)
@@ -1617,7 +2215,17 @@ SBN_Status_t SBN_ProcessNetMsg(SBN_NetInterface_t *Net, SBN_MsgType_t MsgType, C
     {
         case SBN_PROTO_MSG:
         {
-            uint8 Ver = ((uint8 *)Msg)[0];
+            uint8  Ver = 0, Caps = 0;
+            uint32 SubInstance = 0, SubEpoch = 0;
+            Pack_t Pack;
+
+            /* older peers send less, what is missing reads as 0 */
+            Pack_Init(&Pack, Msg, MsgSize, false);
+            Unpack_UInt8(&Pack, &Ver);
+            Unpack_UInt8(&Pack, &Caps);
+            Unpack_UInt32(&Pack, &SubInstance);
+            Unpack_UInt32(&Pack, &SubEpoch);
+
             if (Ver != SBN_PROTO_VER)
             {
                 EVSSendErr(SBN_SB_EID,
@@ -1630,8 +2238,21 @@ SBN_Status_t SBN_ProcessNetMsg(SBN_NetInterface_t *Net, SBN_MsgType_t MsgType, C
             else
             {
                 EVSSendInfo(SBN_SB_EID, "SBN protocol version match with peer %d:%d", (int)Peer->SpacecraftID, (int)Peer->ProcessorID);
+
+#ifdef SBN_FRAMES_ENABLED
+                Peer->FramesOK = (Caps & SBN_PROTO_CAP_FRAMES) != 0;
+#endif /* SBN_FRAMES_ENABLED */
+
+                if (Caps & SBN_PROTO_CAP_SUB_SYNC)
+                {
+                    return SBN_SendSubSyncToPeer(Peer, SubInstance, SubEpoch);
+                } /* end if */
             } /* end if */
-            break;
+
+            /* the peer sends all its subs without syncing, forget those kept from before */
+            SBN_RemoveAllSubsFromPeer(Peer);
+
+            return SBN_SendLocalSubsToPeer(Peer);
         } /* end case */
         case SBN_APP_MSG:
         {
@@ -1674,6 +2295,12 @@ SBN_Status_t SBN_ProcessNetMsg(SBN_NetInterface_t *Net, SBN_MsgType_t MsgType, C
         case SBN_UNSUB_MSG:
             return SBN_ProcessUnsubsFromPeer(Peer, Msg);
 
+        case SBN_SUB_SYNC_MSG:
+            return SBN_ProcessSubSyncFromPeer(Peer, Msg);
+
+        case SBN_FRAME_MSG:
+            return ProcessFrame(Net, ProcessorID, SpacecraftID, MsgSize, Msg);
+
         case SBN_NO_MSG:
             return SBN_SUCCESS;
         default:
@@ -62,6 +62,15 @@ SBN_Status_t SBN_RecvNetMsgs(void);
 
 void SBN_CheckPeerPipes(void);
 
+/**
+ * \brief A local unsubscription and the epoch it happened in.
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MsgID;
+    uint32         Epoch;
+} SBN_UnsubLog_t;
+
 /**
  * \brief SBN global data structure definition
  */
@@ -102,6 +111,28 @@ typedef struct
      */
     SBN_Subs_t Subs[SBN_MAX_SUBS_PER_PEER + 1];
 
+    /** \brief Hash index of Subs by MsgID, each slot is a Subs index + 1 (0 if free.) */
+    uint16 SubIndex[SBN_SUB_HASH_SZ];
+
+    /**
+     * \brief Identifies this set of local subscriptions, chosen anew each time
+     * SBN (re)initializes so that peers know their copy is from another run.
+     */
+    uint32 SubInstance;
+
+    /** \brief Incremented by every change to the local subscriptions. */
+    uint32 SubEpoch;
+
+    /**
+     * \brief The most recent unsubscriptions, a ring of SubLogCnt entries
+     * ending before SubLogNext. Peers that synchronized before SubLogFloor
+     * (the epoch of the newest unsubscription dropped from the ring) are sent
+     * all subscriptions.
+     */
+    SBN_UnsubLog_t SubLog[SBN_SUB_LOG_SZ];
+    uint16         SubLogCnt, SubLogNext;
+    uint32         SubLogFloor;
+
     /** \brief CFE scheduling pipe */
     CFE_SB_PipeId_t SchPipe;
 
@@ -125,6 +156,20 @@ typedef struct
     /** Global mutex for reconfiguring. */
     CFE_ES_MutexID_t ConfMutex;
 
+    /**
+     * Flushed (and given) when a peer connects, for the tasks that have
+     * nothing to do until one does.
+     */
+    OS_BinSemID_t WakeSem;
+
+    /** Task receiving from the polled nets that can be waited on, 0 if none. */
+    OS_TaskID_t RecvPollTaskID;
+
+    /** Wakeups left to wait before trying to create the receive poll task again,
+     * and how many were waited after the last failure (0 if it did not fail.)
+     */
+    uint32 RecvPollRetryWait, RecvPollRetryBackoff;
+
     SBN_HKTlm_t CmdCnt, CmdErrCnt;
 
     CFE_TBL_Handle_t ConfTblHandle;
@@ -148,12 +193,17 @@ SBN_PeerInterface_t *SBN_GetPeer(SBN_NetInterface_t *Net, CFE_ProcessorID_t Proc
 SBN_Status_t         SBN_ReloadConfTbl(void);
 void                 SBN_RecvNetTask(void);
 void                 SBN_RecvPeerTask(void);
+void                 SBN_RecvPollTask(void);
 void                 SBN_SendTask(void);
 SBN_Status_t         SBN_Connected(SBN_PeerInterface_t *Peer);
 SBN_Status_t         SBN_Disconnected(SBN_PeerInterface_t *Peer);
 void                 SBN_PackMsg(void *SBNBuf, SBN_MsgSz_t MsgSz, SBN_MsgType_t MsgType, CFE_ProcessorID_t ProcessorID, CFE_SpacecraftID_t SpacecraftID, void *Msg);
 bool                 SBN_UnpackMsg(void *SBNBuf, SBN_MsgSz_t *MsgSzPtr, SBN_MsgType_t *MsgTypePtr, CFE_ProcessorID_t *ProcessorIDPtr, CFE_SpacecraftID_t *SpacecraftIDPtr, void *Msg);
 SBN_Status_t         SBN_SendNetMsg(SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Msg, SBN_PeerInterface_t *Peer);
+bool                 SBN_PackFrameRecord(void *Frame, SBN_MsgSz_t *FrameSzPtr, size_t FrameBufSz, SBN_MsgSz_t MsgSz, SBN_MsgType_t MsgType, void *Msg);
+bool                 SBN_UnpackFrameRecord(void *Frame, SBN_MsgSz_t FrameSz, SBN_MsgSz_t *OffsetPtr, SBN_MsgSz_t *MsgSzPtr, SBN_MsgType_t *MsgTypePtr, void **MsgPtr);
+SBN_Status_t         SBN_SendFramedMsg(SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Msg, SBN_PeerInterface_t *Peer);
+SBN_Status_t         SBN_FlushFrame(SBN_PeerInterface_t *Peer);
 SBN_PeerInterface_t *SBN_GetPeer(SBN_NetInterface_t *Net, CFE_ProcessorID_t ProcessorID, CFE_SpacecraftID_t SpacecraftID);
 
 #endif /* _sbn_app_ */
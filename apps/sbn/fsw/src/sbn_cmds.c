@@ -433,7 +433,7 @@ static void MySubsCmd(CFE_MSG_Message_t *MsgPtr)
  */
 static void ReloadTblCmd(CFE_MSG_Message_t *MsgPtr)
 {
-    if (!VerifyMsgLen(MsgPtr, sizeof(CFE_MSG_CommandHeader_t), "reloadtbl"))
+    if (VerifyMsgLen(MsgPtr, sizeof(CFE_MSG_CommandHeader_t), "reloadtbl"))
     {
         EVSSendInfo(SBN_CMD_EID, "reload tbl command");
         SBN_ReloadConfTbl();
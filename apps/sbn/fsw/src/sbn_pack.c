@@ -53,11 +53,8 @@ bool Pack_UInt32(Pack_t *PackPtr, uint32 Data)
 
 bool Pack_Time(Pack_t *PackPtr, OS_time_t Data)
 {
-    OS_time_t D;
-    OS_TimeAssembleFromMicroseconds(
-        CFE_MAKE_BIG32(OS_TimeGetTotalSeconds(Data)),
-        CFE_MAKE_BIG32(OS_TimeGetMicrosecondsPart(Data)));
-    return Pack_Data(PackPtr, &D, sizeof(D));
+    return Pack_UInt32(PackPtr, (uint32)OS_TimeGetTotalSeconds(Data)) &&
+           Pack_UInt32(PackPtr, OS_TimeGetMicrosecondsPart(Data));
 } /* end Pack_Time() */
 
 bool Pack_MsgID(Pack_t *PackPtr, CFE_SB_MsgId_t Data)
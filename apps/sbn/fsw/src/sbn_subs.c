@@ -82,20 +82,22 @@ static SBN_Status_t SendLocalSubToPeer(int SubType, CFE_SB_MsgId_t MsgID, CFE_SB
 } /* end SendLocalSubToPeer */
 
 /**
- * \brief Sends all local subscriptions over the wire to a peer.
+ * \brief Sends the local subscriptions from FirstIdx on (in SBN.Subs) over the
+ *        wire to a peer.
  *
  * @param[in] Peer The peer interface.
+ * @param[in] FirstIdx The first subscription to send.
  */
-SBN_Status_t SBN_SendLocalSubsToPeer(SBN_PeerInterface_t *Peer)
+static SBN_Status_t SendLocalSubsFromToPeer(SBN_PeerInterface_t *Peer, int FirstIdx)
 {
-    uint8  Buf[SBN_PACKED_SUB_SZ];
+    uint8  Buf[SBN_IDENT_LEN + SBN_PACKED_SUB_SZ];
     Pack_t Pack;
-    Pack_Init(&Pack, &Buf, SBN_PACKED_SUB_SZ, 0);
+    Pack_Init(&Pack, &Buf, sizeof(Buf), 0);
     Pack_Data(&Pack, (void *)SBN_IDENT, SBN_IDENT_LEN);
-    Pack_UInt16(&Pack, SBN.SubCnt);
+    Pack_UInt16(&Pack, SBN.SubCnt - FirstIdx);
 
     int i = 0;
-    for (i = 0; i < SBN.SubCnt; i++)
+    for (i = FirstIdx; i < SBN.SubCnt; i++)
     {
         Pack_MsgID(&Pack, SBN.Subs[i].MsgID);
         /* 2 uint8's */
@@ -104,62 +106,288 @@ SBN_Status_t SBN_SendLocalSubsToPeer(SBN_PeerInterface_t *Peer)
 
     EVSSendDbg(SBN_PEER_EID, "send local subs to peer %d:%d", Peer->SpacecraftID, Peer->ProcessorID);
     return SBN_SendNetMsg(SBN_SUB_MSG, Pack.BufUsed, Buf, Peer);
+} /* end SendLocalSubsFromToPeer */
+
+/**
+ * \brief Sends all local subscriptions over the wire to a peer.
+ *
+ * @param[in] Peer The peer interface.
+ */
+SBN_Status_t SBN_SendLocalSubsToPeer(SBN_PeerInterface_t *Peer)
+{
+    return SendLocalSubsFromToPeer(Peer, 0);
 } /* end SBN_SendLocalSubsToPeer */
 
 /**
- * Utility to find the subscription index (SBN.Subs)
- * that is subscribed to the CCSDS message ID.
+ * \brief Sends a peer what changed in the local subscriptions since the peer
+ *        last synchronized, or all of them if the peer's copy is from another
+ *        instance or older than the unsubscription log remembers, or if the
+ *        peer has not been sent them since they were reset.
  *
- * @param[out] IdxPtr The subscription index found.
- * @param[in] MsgID The CCSDS message ID of the subscription being sought.
- * @return true if found.
+ * @param[in] Peer The peer interface.
+ * @param[in] PeerInstance The instance of the local subscriptions the peer has.
+ * @param[in] PeerEpoch The epoch of the local subscriptions the peer has.
  */
-static int IsMsgIDSub(int *IdxPtr, CFE_SB_MsgId_t MsgID)
+SBN_Status_t SBN_SendSubSyncToPeer(SBN_PeerInterface_t *Peer, uint32 PeerInstance, uint32 PeerEpoch)
 {
-    int i = 0;
+    uint8  Buf[SBN_PACKED_SUB_SYNC_SZ];
+    Pack_t Pack;
+    uint16 UnsubCnt = 0, SubCnt = 0, LogIdx = 0;
+    int    i = 0;
+    bool   Full = !Peer->SubsSynced || PeerInstance != SBN.SubInstance || PeerEpoch < SBN.SubLogFloor ||
+               PeerEpoch > SBN.SubEpoch;
 
-    for (i = 0; i < SBN.SubCnt; i++)
+    if (!Full)
     {
-        if (CFE_SB_MsgId_Equal(SBN.Subs[i].MsgID, MsgID))
+        for (i = 0; i < SBN.SubLogCnt; i++)
+        {
+            LogIdx = (SBN.SubLogNext + SBN_SUB_LOG_SZ - SBN.SubLogCnt + i) % SBN_SUB_LOG_SZ;
+            if (SBN.SubLog[LogIdx].Epoch > PeerEpoch)
+            {
+                UnsubCnt++;
+            } /* end if */
+        }     /* end for */
+
+        for (i = 0; i < SBN.SubCnt; i++)
         {
-            if (IdxPtr)
+            if (SBN.Subs[i].Epoch > PeerEpoch)
             {
-                *IdxPtr = i;
+                SubCnt++;
             } /* end if */
+        }     /* end for */
+
+        /* a delta no smaller than the whole set may as well replace it */
+        Full = UnsubCnt + SubCnt >= SBN.SubCnt && SBN.SubCnt > 0;
+    } /* end if */
+
+    if (Full)
+    {
+        PeerEpoch = 0;
+        UnsubCnt  = 0;
+        SubCnt    = SBN.SubCnt;
+    } /* end if */
 
-            return true;
+    Pack_Init(&Pack, &Buf, sizeof(Buf), 0);
+    Pack_Data(&Pack, (void *)SBN_IDENT, SBN_IDENT_LEN);
+    Pack_UInt32(&Pack, SBN.SubInstance);
+    Pack_UInt32(&Pack, PeerEpoch);
+    Pack_UInt32(&Pack, SBN.SubEpoch);
+    Pack_UInt8(&Pack, Full);
+
+    Pack_UInt16(&Pack, UnsubCnt);
+    for (i = 0; i < SBN.SubLogCnt && UnsubCnt > 0; i++)
+    {
+        LogIdx = (SBN.SubLogNext + SBN_SUB_LOG_SZ - SBN.SubLogCnt + i) % SBN_SUB_LOG_SZ;
+        if (SBN.SubLog[LogIdx].Epoch > PeerEpoch)
+        {
+            Pack_MsgID(&Pack, SBN.SubLog[LogIdx].MsgID);
+        } /* end if */
+    }     /* end for */
+
+    Pack_UInt16(&Pack, SubCnt);
+    for (i = 0; i < SBN.SubCnt; i++)
+    {
+        if (Full || SBN.Subs[i].Epoch > PeerEpoch)
+        {
+            Pack_MsgID(&Pack, SBN.Subs[i].MsgID);
+            Pack_Data(&Pack, &SBN.Subs[i].QoS, sizeof(SBN.Subs[i].QoS)); /* 2 uint8's */
         } /* end if */
     }     /* end for */
 
-    return false;
-} /* end IsMsgIDSub */
+    EVSSendDbg(SBN_PEER_EID, "sync %s subs with peer %d:%d (%d unsubs, %d subs)", Full ? "all" : "changed",
+               Peer->SpacecraftID, Peer->ProcessorID, UnsubCnt, SubCnt);
+
+    if (SBN_SendNetMsg(SBN_SUB_SYNC_MSG, Pack.BufUsed, Buf, Peer) != SBN_SUCCESS)
+    {
+        return SBN_ERROR;
+    } /* end if */
+
+    Peer->SubsSynced = true;
+
+    return SBN_SUCCESS;
+} /* end SBN_SendSubSyncToPeer */
+
+#if (SBN_SUB_HASH_SZ & (SBN_SUB_HASH_SZ - 1)) != 0 || SBN_SUB_HASH_SZ < 2 * SBN_MAX_SUBS_PER_PEER || \
+    SBN_SUB_HASH_SZ > 65536
+#error SBN_SUB_HASH_SZ must be a power of two, at least twice SBN_MAX_SUBS_PER_PEER and at most 65536
+#endif
+
+#define SUB_HASH_MASK (SBN_SUB_HASH_SZ - 1)
+
+/**
+ * The slot a message ID would occupy in a subscription index if there were no
+ * collisions (Fibonacci hashing, as message ID values are often sequential.)
+ */
+static uint32 SubHash(CFE_SB_MsgId_t MsgID)
+{
+    return ((CFE_SB_MsgIdToValue(MsgID) * 2654435761U) >> 16) & SUB_HASH_MASK;
+} /* end SubHash() */
 
 /**
- * \brief Is this peer subscribed to this message ID? If so, what is the index
- *        of the subscription?
+ * \brief Finds the subscription to a message ID in a subscription table
+ *        (SBN.Subs or a Peer->Subs) through its hash index.
  *
- * @param[out] SubIdxPtr The pointer to the subscription index value.
+ * @param[in] Subs The subscription table.
+ * @param[in] SubIndex The hash index of the table.
  * @param[in] MsgID The CCSDS message ID of the subscription being sought.
- * @param[in] Peer The peer interface.
  *
- * @return true if found.
+ * @return The index of the subscription in Subs, or -1 if not found.
  */
-static int IsPeerSubMsgID(int *SubIdxPtr, CFE_SB_MsgId_t MsgID, SBN_PeerInterface_t *Peer)
+int SBN_FindSub(SBN_Subs_t *Subs, uint16 *SubIndex, CFE_SB_MsgId_t MsgID)
 {
-    int i = 0;
+    uint32 Slot = 0;
 
-    for (i = 0; i < Peer->SubCnt; i++)
+    /* the index is never more than half full, so there is always a free slot */
+    for (Slot = SubHash(MsgID); SubIndex[Slot] != 0; Slot = (Slot + 1) & SUB_HASH_MASK)
     {
-        if (CFE_SB_MsgId_Equal(Peer->Subs[i].MsgID, MsgID))
+        if (CFE_SB_MsgId_Equal(Subs[SubIndex[Slot] - 1].MsgID, MsgID))
         {
-            *SubIdxPtr = i;
-            return true;
+            return SubIndex[Slot] - 1;
         } /* end if */
     }     /* end for */
 
-    return false;
+    return -1;
+} /* end SBN_FindSub() */
 
-} /* end IsPeerSubMsgID */
+/**
+ * \brief Appends a subscription to a subscription table and its hash index.
+ *        The caller checks that the table has room and does not already
+ *        hold the message ID, and counts the new subscription.
+ *
+ * @param[in] Subs The subscription table.
+ * @param[in] SubIndex The hash index of the table.
+ * @param[in] SubIdx The index of the new subscription, the number of subscriptions in the table.
+ * @param[in] MsgID The CCSDS message ID of the subscription.
+ * @param[in] QoS The CCSDS quality of service of the subscription.
+ */
+void SBN_InsertSub(SBN_Subs_t *Subs, uint16 *SubIndex, int SubIdx, CFE_SB_MsgId_t MsgID, CFE_SB_Qos_t QoS)
+{
+    uint32 Slot = 0;
+
+    for (Slot = SubHash(MsgID); SubIndex[Slot] != 0; Slot = (Slot + 1) & SUB_HASH_MASK)
+        ;
+
+    SubIndex[Slot] = SubIdx + 1;
+
+    memset(&Subs[SubIdx], 0, sizeof(Subs[SubIdx]));
+    Subs[SubIdx].MsgID = MsgID;
+    Subs[SubIdx].QoS   = QoS;
+} /* end SBN_InsertSub() */
+
+/**
+ * Finds the index slot that refers to the subscription at SubIdx.
+ */
+static uint32 FindSubSlot(SBN_Subs_t *Subs, uint16 *SubIndex, int SubIdx)
+{
+    uint32 Slot = 0;
+
+    for (Slot = SubHash(Subs[SubIdx].MsgID); SubIndex[Slot] != SubIdx + 1; Slot = (Slot + 1) & SUB_HASH_MASK)
+        ;
+
+    return Slot;
+} /* end FindSubSlot() */
+
+/**
+ * \brief Removes a subscription from a subscription table and its hash index.
+ *        The last subscription in the table takes its place, so the order of
+ *        the table is not kept. The caller uncounts the subscription.
+ *
+ * @param[in] Subs The subscription table.
+ * @param[in] SubIndex The hash index of the table.
+ * @param[in] SubCnt The number of subscriptions in the table.
+ * @param[in] SubIdx The index of the subscription to remove.
+ */
+void SBN_DeleteSub(SBN_Subs_t *Subs, uint16 *SubIndex, int SubCnt, int SubIdx)
+{
+    uint32 Hole = FindSubSlot(Subs, SubIndex, SubIdx);
+    uint32 Slot = Hole, Home = 0;
+    int    LastIdx = SubCnt - 1;
+
+    /* close the hole by moving back any later entry of the probe sequence that may live in it */
+    for (Slot = (Slot + 1) & SUB_HASH_MASK; SubIndex[Slot] != 0; Slot = (Slot + 1) & SUB_HASH_MASK)
+    {
+        Home = SubHash(Subs[SubIndex[Slot] - 1].MsgID);
+        if (((Slot - Home) & SUB_HASH_MASK) >= ((Slot - Hole) & SUB_HASH_MASK))
+        {
+            SubIndex[Hole] = SubIndex[Slot];
+            Hole           = Slot;
+        } /* end if */
+    }     /* end for */
+
+    SubIndex[Hole] = 0;
+
+    if (SubIdx != LastIdx)
+    {
+        SubIndex[FindSubSlot(Subs, SubIndex, LastIdx)] = SubIdx + 1;
+        memcpy(&Subs[SubIdx], &Subs[LastIdx], sizeof(Subs[SubIdx]));
+    } /* end if */
+
+    memset(&Subs[LastIdx], 0, sizeof(Subs[LastIdx]));
+} /* end SBN_DeleteSub() */
+
+/**
+ * \brief Clears the local subscriptions and starts a new subscription
+ *        instance, so that peers replace all of their copy when they next sync.
+ */
+void SBN_ResetLocalSubs(void)
+{
+    OS_time_t     Now;
+    SBN_NetIdx_t  NetIdx  = 0;
+    SBN_PeerIdx_t PeerIdx = 0;
+
+    memset(SBN.Subs, 0, sizeof(SBN.Subs));
+    memset(SBN.SubIndex, 0, sizeof(SBN.SubIndex));
+    SBN.SubCnt = 0;
+
+    SBN.SubEpoch    = 0;
+    SBN.SubLogCnt   = 0;
+    SBN.SubLogNext  = 0;
+    SBN.SubLogFloor = 0;
+
+    /*
+     * The time only makes it unlikely that a peer holds a copy from another
+     * run with the same instance (the clock may restart at the same value on
+     * each boot), so each peer's first sync is a full one regardless.
+     */
+    OS_GetLocalTime(&Now);
+    SBN.SubInstance = (uint32)OS_TimeGetTotalMicroseconds(Now);
+    if (SBN.SubInstance == 0)
+    {
+        /* 0 means "none" to peers */
+        SBN.SubInstance = 1;
+    } /* end if */
+
+    for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
+    {
+        for (PeerIdx = 0; PeerIdx < SBN.Nets[NetIdx].PeerCnt; PeerIdx++)
+        {
+            SBN.Nets[NetIdx].Peers[PeerIdx].SubsSynced = false;
+        } /* end for */
+    }     /* end for */
+} /* end SBN_ResetLocalSubs() */
+
+/**
+ * Records a local unsubscription for later delta syncs, forgetting the oldest
+ * if the log is full.
+ */
+static void LogLocalUnsub(CFE_SB_MsgId_t MsgID)
+{
+    SBN_UnsubLog_t *Entry = &SBN.SubLog[SBN.SubLogNext];
+
+    if (SBN.SubLogCnt == SBN_SUB_LOG_SZ)
+    {
+        SBN.SubLogFloor = Entry->Epoch;
+    }
+    else
+    {
+        SBN.SubLogCnt++;
+    } /* end if */
+
+    Entry->MsgID = MsgID;
+    Entry->Epoch = ++SBN.SubEpoch;
+
+    SBN.SubLogNext = (SBN.SubLogNext + 1) % SBN_SUB_LOG_SZ;
+} /* end LogLocalUnsub() */
 
 /**
  * \brief I have seen a local subscription, send it on to peers if this is the
@@ -168,7 +396,7 @@ static int IsPeerSubMsgID(int *SubIdxPtr, CFE_SB_MsgId_t MsgID, SBN_PeerInterfac
  * @param[in] MsgID The CCSDS Message ID of the local subscription.
  * @param[in] QoS The CCSDS quality of service of the local subscription.
  */
-static SBN_Status_t ProcessLocalSub(CFE_SB_MsgId_t MsgID, CFE_SB_Qos_t QoS)
+static SBN_Status_t ProcessLocalSub(CFE_SB_MsgId_t MsgID, CFE_SB_Qos_t QoS, bool SendToPeers)
 {
     SBN_Status_t SBN_Status = SBN_SUCCESS;
     /* don't send event messages */
@@ -180,10 +408,10 @@ static SBN_Status_t ProcessLocalSub(CFE_SB_MsgId_t MsgID, CFE_SB_Qos_t QoS)
             || CFE_SB_MsgId_Equal(MsgID, CFE_SB_ValueToMsgId(SBN_TLM_MID)))
         return SBN_SUCCESS;
 
-    int SubIdx = 0;
+    int SubIdx = SBN_FindSub(SBN.Subs, SBN.SubIndex, MsgID);
 
     /* if there is already an entry for this msg id,just incr InUseCtr */
-    if (IsMsgIDSub(&SubIdx, MsgID))
+    if (SubIdx >= 0)
     {
         SBN.Subs[SubIdx].InUseCtr++;
         EVSSendDbg(SBN_SUB_EID, "local sub already exists: in use: %d", SBN.Subs[SubIdx].InUseCtr);
@@ -199,10 +427,15 @@ static SBN_Status_t ProcessLocalSub(CFE_SB_MsgId_t MsgID, CFE_SB_Qos_t QoS)
     } /* end if */
 
     /* log new entry into Subs array */
-    SBN.Subs[SBN.SubCnt].InUseCtr = 1;
-    SBN.Subs[SBN.SubCnt].MsgID    = MsgID;
-    SBN.Subs[SBN.SubCnt].QoS      = QoS;
-    SBN.SubCnt++;
+    SubIdx = SBN.SubCnt++;
+    SBN_InsertSub(SBN.Subs, SBN.SubIndex, SubIdx, MsgID, QoS);
+    SBN.Subs[SubIdx].InUseCtr = 1;
+    SBN.Subs[SubIdx].Epoch    = ++SBN.SubEpoch;
+
+    if (!SendToPeers)
+    {
+        return SBN_SUCCESS;
+    } /* end if */
 
     int NetIdx = 0, PeerIdx = 0;
     for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
@@ -236,10 +469,11 @@ static SBN_Status_t ProcessLocalSub(CFE_SB_MsgId_t MsgID, CFE_SB_Qos_t QoS)
 static SBN_Status_t ProcessLocalUnsub(CFE_SB_MsgId_t MsgID)
 {
     SBN_Status_t SBN_Status = SBN_SUCCESS;
-    int          SubIdx;
+    CFE_SB_Qos_t QoS;
+    int          SubIdx = SBN_FindSub(SBN.Subs, SBN.SubIndex, MsgID);
 
     /* find idx of matching subscription */
-    if (!IsMsgIDSub(&SubIdx, MsgID))
+    if (SubIdx < 0)
     {
         return SBN_SUCCESS; /* or should this be error? */
     }                       /* end if */
@@ -254,17 +488,11 @@ static SBN_Status_t ProcessLocalUnsub(CFE_SB_MsgId_t MsgID)
         return SBN_SUCCESS;
     } /* end if */
 
-    /* remove sub from array for and
-    ** shift all subscriptions in higher elements to fill the gap
-    ** note that the Subs[] array has one extra element to allow for an
-    ** unsub from a full table.
-    */
-    for (; SubIdx < SBN.SubCnt; SubIdx++)
-    {
-        memcpy(&SBN.Subs[SubIdx], &SBN.Subs[SubIdx + 1], sizeof(SBN_Subs_t));
-    } /* end for */
+    QoS = SBN.Subs[SubIdx].QoS;
 
-    SBN.SubCnt--;
+    SBN_DeleteSub(SBN.Subs, SBN.SubIndex, SBN.SubCnt--, SubIdx);
+
+    LogLocalUnsub(MsgID);
 
     /* send unsubscription to all peers if peer state is heartbeating and */
     /* only if no more local subs (InUseCtr = 0)  */
@@ -277,7 +505,7 @@ static SBN_Status_t ProcessLocalUnsub(CFE_SB_MsgId_t MsgID)
             SBN_PeerInterface_t *Peer = &Net->Peers[PeerIdx];
 
             EVSSendInfo(SBN_PEER_EID, "process local unsub %d:%d", Peer->SpacecraftID, Peer->ProcessorID);
-            SBN_Status = SendLocalSubToPeer(SBN_UNSUB_MSG, SBN.Subs[PeerIdx].MsgID, SBN.Subs[PeerIdx].QoS, Peer);
+            SBN_Status = SendLocalSubToPeer(SBN_UNSUB_MSG, MsgID, QoS, Peer);
 
             if (SBN_Status != SBN_SUCCESS)
             {
@@ -320,7 +548,7 @@ SBN_Status_t SBN_CheckSubscriptionPipe(void)
                 switch (SingleMsgPtr->Payload.SubType)
                 {
                     case CFE_SB_SUBSCRIPTION:
-                        return ProcessLocalSub(SingleMsgPtr->Payload.MsgId, SingleMsgPtr->Payload.Qos);
+                        return ProcessLocalSub(SingleMsgPtr->Payload.MsgId, SingleMsgPtr->Payload.Qos, true);
                     case CFE_SB_UNSUBSCRIPTION:
                         return ProcessLocalUnsub(SingleMsgPtr->Payload.MsgId);
                     default:
@@ -363,12 +591,13 @@ SBN_Status_t SBN_CheckSubscriptionPipe(void)
  */
 static SBN_Status_t AddSub(SBN_PeerInterface_t *Peer, CFE_SB_MsgId_t MsgID, CFE_SB_Qos_t QoS)
 {
-    int          idx        = 0;
+    int          idx        = SBN_FindSub(Peer->Subs, Peer->SubIndex, MsgID);
     CFE_Status_t CFE_Status = SBN_SUCCESS;
 
     /* if msg id already in the list, ignore */
-    if (IsPeerSubMsgID(&idx, MsgID, Peer))
+    if (idx >= 0)
     {
+        Peer->Subs[idx].Epoch = 1; /* confirmed, see SBN_ProcessSubSyncFromPeer() */
         return SBN_SUCCESS;
     } /* end if */
 
@@ -389,10 +618,9 @@ static SBN_Status_t AddSub(SBN_PeerInterface_t *Peer, CFE_SB_MsgId_t MsgID, CFE_
     } /* end if */
 
     /* log the subscription in the peer table */
-    Peer->Subs[Peer->SubCnt].MsgID = MsgID;
-    Peer->Subs[Peer->SubCnt].QoS   = QoS;
-
-    Peer->SubCnt++;
+    idx = Peer->SubCnt++;
+    SBN_InsertSub(Peer->Subs, Peer->SubIndex, idx, MsgID, QoS);
+    Peer->Subs[idx].Epoch = 1;
 
     return SBN_SUCCESS;
 } /* end AddSub */
@@ -481,6 +709,34 @@ SBN_Status_t SBN_ProcessSubsFromPeer(SBN_PeerInterface_t *Peer, void *Msg)
     return SBN_SUCCESS;
 } /* SBN_ProcessSubsFromPeer */
 
+/**
+ * \brief Removes a subscription from a peer's table and unsubscribes the
+ *        peer pipe from it.
+ *
+ * @param[in] Peer The peer interface
+ * @param[in] SubIdx The index of the subscription in the peer's table.
+ *
+ * @return SBN_SUCCESS on successful unsubscription, otherwise SBN_ERROR
+ */
+static SBN_Status_t RemovePeerSub(SBN_PeerInterface_t *Peer, int SubIdx)
+{
+    CFE_Status_t   CFE_Status;
+    CFE_SB_MsgId_t MsgID = Peer->Subs[SubIdx].MsgID;
+
+    /* remove sub from the table for that peer */
+    SBN_DeleteSub(Peer->Subs, Peer->SubIndex, Peer->SubCnt--, SubIdx);
+
+    /* unsubscribe to the msg id on the peer pipe */
+    if ((CFE_Status = CFE_SB_UnsubscribeLocal(MsgID, Peer->Pipe)) != CFE_SUCCESS)
+    {
+        EVSSendErr(SBN_SUB_EID, "unable to unsubscribe from MID 0x%04X: %d",
+            CFE_SB_MsgIdToValue(MsgID), CFE_Status);
+        return SBN_ERROR;
+    } /* end if */
+
+    return SBN_SUCCESS;
+} /* end RemovePeerSub */
+
 /**
  * \brief Process an unsubscription message from a peer.
  *
@@ -491,12 +747,11 @@ SBN_Status_t SBN_ProcessSubsFromPeer(SBN_PeerInterface_t *Peer, void *Msg)
  */
 static SBN_Status_t ProcessUnsubFromPeer(SBN_PeerInterface_t *Peer, CFE_SB_MsgId_t MsgID)
 {
-    CFE_Status_t     CFE_Status;
     SBN_ModuleIdx_t  FilterIdx;
     SBN_Filter_Ctx_t Filter_Context;
     SBN_Status_t     SBN_Status;
 
-    int i = 0, idx = 0;
+    int idx = 0;
 
     Filter_Context.MyProcessorID   = CFE_PSP_GetProcessorId();
     Filter_Context.MySpacecraftID  = CFE_PSP_GetSpacecraftId();
@@ -519,35 +774,15 @@ static SBN_Status_t ProcessUnsubFromPeer(SBN_PeerInterface_t *Peer, CFE_SB_MsgId
         } /* end if */
     }     /* end for */
 
-    if (!IsPeerSubMsgID(&idx, MsgID, Peer))
+    idx = SBN_FindSub(Peer->Subs, Peer->SubIndex, MsgID);
+    if (idx < 0)
     {
         EVSSendInfo(SBN_SUB_EID, "cannot process unsubscription from ProcessorID %d, msg 0x%04X not found",
             Peer->ProcessorID, CFE_SB_MsgIdToValue(MsgID));
         return SBN_SUCCESS;
     } /* end if */
 
-    /* remove sub from array for that peer and
-    ** shift all subscriptions in higher elements to fill the gap
-    ** note that the Subs[] array has one extra element to allow for an
-    ** unsub from a full table.
-    */
-    for (i = idx; i < Peer->SubCnt; i++)
-    {
-        memcpy(&Peer->Subs[i], &Peer->Subs[i + 1], sizeof(SBN_Subs_t));
-    } /* end for */
-
-    /* decrement sub cnt */
-    Peer->SubCnt--;
-
-    /* unsubscribe to the msg id on the peer pipe */
-    if ((CFE_Status = CFE_SB_UnsubscribeLocal(MsgID, Peer->Pipe)) != CFE_SUCCESS)
-    {
-        EVSSendErr(SBN_SUB_EID, "unable to unsubscribe from MID 0x%04X: %d",
-            CFE_SB_MsgIdToValue(MsgID), CFE_Status);
-        return SBN_ERROR;
-    } /* end if */
-
-    return SBN_SUCCESS;
+    return RemovePeerSub(Peer, idx);
 } /* end ProcessUnsubFromPeer */
 
 /**
@@ -590,6 +825,104 @@ SBN_Status_t SBN_ProcessUnsubsFromPeer(SBN_PeerInterface_t *Peer, void *Msg)
     return SBN_SUCCESS;
 } /* end SBN_ProcessUnsubsFromPeer() */
 
+/**
+ * \brief Process a subscription sync message from a peer, applying the
+ *        unsubscriptions and then the subscriptions it holds. A full sync
+ *        replaces everything I had from the peer (without unsubscribing and
+ *        resubscribing what it keeps.)
+ *
+ * @param[in] Peer The peer interface
+ * @param[in] Msg The subscription sync SBN message.
+ *
+ * @return SBN_SUCCESS on successfully handling the sync from peer, otherwise SBN_ERROR
+ */
+SBN_Status_t SBN_ProcessSubSyncFromPeer(SBN_PeerInterface_t *Peer, void *Msg)
+{
+    SBN_Status_t SBN_Status = SBN_SUCCESS;
+    Pack_t       Pack;
+    char         VersionHash[SBN_IDENT_LEN];
+    uint32       Instance = 0, BaseEpoch = 0, Epoch = 0;
+    uint8        Full   = 0;
+    uint16       SubCnt = 0;
+    int          i      = 0;
+
+    Pack_Init(&Pack, Msg, CFE_MISSION_SB_MAX_SB_MSG_SIZE, false);
+
+    Unpack_Data(&Pack, VersionHash, SBN_IDENT_LEN);
+
+    if (strncmp(VersionHash, SBN_IDENT, SBN_IDENT_LEN))
+    {
+        EVSSendErr(SBN_PROTO_EID, "version number mismatch with peer CpuID %d", Peer->ProcessorID);
+        return SBN_ERROR;
+    } /* end if */
+
+    Unpack_UInt32(&Pack, &Instance);
+    Unpack_UInt32(&Pack, &BaseEpoch);
+    Unpack_UInt32(&Pack, &Epoch);
+    Unpack_UInt8(&Pack, &Full);
+
+    if (!Full && (Instance != Peer->SubInstance || BaseEpoch != Peer->SubEpoch))
+    {
+        /* still apply it, a delta from an older epoch only repeats changes */
+        EVSSendDbg(SBN_SUB_EID, "subscription sync from ProcessorID %d is from epoch %u, I have %u",
+                   Peer->ProcessorID, (unsigned int)BaseEpoch, (unsigned int)Peer->SubEpoch);
+    } /* end if */
+
+    Unpack_UInt16(&Pack, &SubCnt);
+    for (i = 0; i < SubCnt; i++)
+    {
+        CFE_SB_MsgId_t MsgID;
+        Unpack_MsgID(&Pack, &MsgID);
+
+        ProcessUnsubFromPeer(Peer, MsgID); /* ignore return value, I want to unsub as much as I can */
+    }                                      /* end for */
+
+    if (Full)
+    {
+        /* AddSub() marks the subs the peer still has */
+        for (i = 0; i < Peer->SubCnt; i++)
+        {
+            Peer->Subs[i].Epoch = 0;
+        } /* end for */
+    }     /* end if */
+
+    Unpack_UInt16(&Pack, &SubCnt);
+    for (i = 0; i < SubCnt; i++)
+    {
+        CFE_SB_MsgId_t MsgID;
+        Unpack_MsgID(&Pack, &MsgID);
+        CFE_SB_Qos_t QoS;
+        Unpack_Data(&Pack, &QoS, sizeof(QoS));
+
+        SBN_Status = ProcessSubFromPeer(Peer, MsgID, QoS);
+
+        if (SBN_Status != SBN_SUCCESS)
+        {
+            /* my copy is incomplete, have the peer send everything next time */
+            Peer->SubInstance = 0;
+            Peer->SubEpoch    = 0;
+            return SBN_Status;
+        } /* end if */
+    }     /* end for */
+
+    if (Full)
+    {
+        /* the table shrinks from the end as subs are removed */
+        for (i = Peer->SubCnt - 1; i >= 0; i--)
+        {
+            if (Peer->Subs[i].Epoch == 0)
+            {
+                RemovePeerSub(Peer, i); /* ignore return value, as above */
+            } /* end if */
+        }     /* end for */
+    }         /* end if */
+
+    Peer->SubInstance = Instance;
+    Peer->SubEpoch    = Epoch;
+
+    return SBN_SUCCESS;
+} /* end SBN_ProcessSubSyncFromPeer() */
+
 /**
  * When SBN starts, it queries for all existing subscriptions. This method
  * processes those subscriptions.
@@ -601,7 +934,7 @@ SBN_Status_t SBN_ProcessUnsubsFromPeer(SBN_PeerInterface_t *Peer, void *Msg)
 SBN_Status_t SBN_ProcessAllSubscriptions(CFE_SB_AllSubscriptionsTlm_t *Ptr)
 {
     SBN_Status_t SBN_Status = SBN_SUCCESS;
-    int          i          = 0;
+    int          i = 0, FirstNewIdx = SBN.SubCnt, NetIdx = 0, PeerIdx = 0;
 
     if (Ptr->Payload.Entries > CFE_SB_SUB_ENTRIES_PER_PKT)
     {
@@ -613,14 +946,28 @@ SBN_Status_t SBN_ProcessAllSubscriptions(CFE_SB_AllSubscriptionsTlm_t *Ptr)
     EVSSendInfo(SBN_SUB_EID, "Processing all subscriptions...");
 
 
-    for (i = 0; i < Ptr->Payload.Entries; i++)
+    /* new subs are appended to SBN.Subs, tell each peer about them in one message */
+    for (i = 0; i < Ptr->Payload.Entries && SBN_Status == SBN_SUCCESS; i++)
     {
-        SBN_Status = ProcessLocalSub(Ptr->Payload.Entry[i].MsgId, Ptr->Payload.Entry[i].Qos);
-        if (SBN_Status != SBN_SUCCESS)
+        SBN_Status = ProcessLocalSub(Ptr->Payload.Entry[i].MsgId, Ptr->Payload.Entry[i].Qos, false);
+    } /* end for */
+
+    if (SBN.SubCnt == FirstNewIdx)
+    {
+        return SBN_Status;
+    } /* end if */
+
+    for (NetIdx = 0; NetIdx < SBN.NetCnt; NetIdx++)
+    {
+        SBN_NetInterface_t *Net = &SBN.Nets[NetIdx];
+        for (PeerIdx = 0; PeerIdx < Net->PeerCnt; PeerIdx++)
         {
-            return SBN_Status;
-        } /* end if */
-    }     /* end for */
+            if (SendLocalSubsFromToPeer(&Net->Peers[PeerIdx], FirstNewIdx) != SBN_SUCCESS)
+            {
+                return SBN_ERROR;
+            } /* end if */
+        }     /* end for */
+    }         /* end for */
 
     return SBN_Status;
 } /* end SBN_ProcessAllSubscriptions */
@@ -652,7 +999,13 @@ SBN_Status_t SBN_RemoveAllSubsFromPeer(SBN_PeerInterface_t *Peer)
 
     EVSSendInfo(SBN_SUB_EID, "unsubscribed %d message id's from ProcessorID %d", (int)Peer->SubCnt, Peer->ProcessorID);
 
+    memset(Peer->Subs, 0, sizeof(Peer->Subs));
+    memset(Peer->SubIndex, 0, sizeof(Peer->SubIndex));
     Peer->SubCnt = 0;
 
+    /* the peer has to send all of its subscriptions again */
+    Peer->SubInstance = 0;
+    Peer->SubEpoch    = 0;
+
     return SBN_SUCCESS;
 } /* end SBN_RemoveAllSubsFromPeer */
@@ -26,10 +26,17 @@
 
 #include "sbn_app.h"
 
+int  SBN_FindSub(SBN_Subs_t *Subs, uint16 *SubIndex, CFE_SB_MsgId_t MsgID);
+void SBN_InsertSub(SBN_Subs_t *Subs, uint16 *SubIndex, int SubIdx, CFE_SB_MsgId_t MsgID, CFE_SB_Qos_t QoS);
+void SBN_DeleteSub(SBN_Subs_t *Subs, uint16 *SubIndex, int SubCnt, int SubIdx);
+void SBN_ResetLocalSubs(void);
+
 SBN_Status_t SBN_SendLocalSubsToPeer(SBN_PeerInterface_t *Peer);
+SBN_Status_t SBN_SendSubSyncToPeer(SBN_PeerInterface_t *Peer, uint32 PeerInstance, uint32 PeerEpoch);
 SBN_Status_t SBN_CheckSubscriptionPipe(void);
 SBN_Status_t SBN_ProcessSubsFromPeer(SBN_PeerInterface_t *Peer, void *submsg);
 SBN_Status_t SBN_ProcessUnsubsFromPeer(SBN_PeerInterface_t *Peer, void *submsg);
+SBN_Status_t SBN_ProcessSubSyncFromPeer(SBN_PeerInterface_t *Peer, void *submsg);
 SBN_Status_t SBN_ProcessAllSubscriptions(CFE_SB_AllSubscriptionsTlm_t *Ptr);
 SBN_Status_t SBN_RemoveAllSubsFromPeer(SBN_PeerInterface_t *Peer);
 SBN_Status_t SBN_SendSubsRequests(void);
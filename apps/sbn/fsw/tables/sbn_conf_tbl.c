@@ -5,8 +5,13 @@ SBN_ConfTbl_t SBN_ConfTbl = {.ProtocolModules = {{/* [0] */
                                                   .Name        = "UDP",
                                                   .LibFileName = "/cf/sbn_udp.so",
                                                   .LibSymbol   = "SBN_UDP_Ops",
-                                                  .BaseEID     = 0x0100}},
-                             .ProtocolCnt     = 1,
+                                                  .BaseEID     = 0x0100},
+                                                 {/* [1] */
+                                                  .Name        = "SHMEM",
+                                                  .LibFileName = "/cf/sbn_shmem.so",
+                                                  .LibSymbol   = "SBN_SHMEM_Ops",
+                                                  .BaseEID     = 0x0200}},
+                             .ProtocolCnt     = 2,
                              .FilterModules   = {{/* [0] */
                                                 .Name        = "Remap",
                                                 .LibFileName = "/cf/sbn_f_remap.so",
@@ -0,0 +1,269 @@
+/**
+ * @file
+ *
+ * Compares the shared memory rings used by the SBN_SHMEM module with loopback
+ * UDP (as used by the SBN_UDP module) between two processes on the same host:
+ *
+ * - latency: one message bounced back and forth, half the round trip time;
+ * - throughput: messages streamed one way as fast as the reader keeps up
+ *   (for UDP, only the datagrams that were not dropped are counted.)
+ *
+ * Only the transports are measured, not SBN itself. Build with the
+ * SBN_SHMEM_BENCH cmake option, or by hand:
+ *
+ *   cc -O2 -I../fsw/src -I../fsw/platform_inc -I<osal>/src/os/inc \
+ *      sbn_shmem_bench.c ../fsw/src/sbn_shmem_ring.c -o sbn_shmem_bench
+ *
+ * and run as "sbn_shmem_bench [iterations]".
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "sbn_shmem_ring.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <sys/time.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#define BENCH_SEG_NAME "/sbn_shmem_bench"
+#define BENCH_UDP_PORT 52340
+
+static const uint32 MsgSizes[] = {32, 128, 512, 1400};
+
+typedef struct
+{
+    SBN_SHMEM_Ring_t Rings[2];
+} Bench_Segment_t;
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+/* the blocking read a SBN_SHMEM receive task does */
+static uint8 *RingRead(SBN_SHMEM_Ring_t *Ring, uint32 *SzPtr)
+{
+    uint8 *Rec;
+
+    while ((Rec = SBN_SHMEM_RingPeek(Ring, SzPtr)) == NULL)
+    {
+        SBN_SHMEM_RingWait(Ring, 1000);
+    }
+
+    return Rec;
+}
+
+static void RingWrite(SBN_SHMEM_Ring_t *Ring, const uint8 *Buf, uint32 Sz)
+{
+    uint8 *Rec;
+
+    while ((Rec = SBN_SHMEM_RingReserve(Ring, Sz)) == NULL)
+    {
+        /* full, let the reader catch up */
+        sched_yield();
+    }
+
+    memcpy(Rec, Buf, Sz);
+    SBN_SHMEM_RingCommit(Ring, Sz);
+}
+
+static Bench_Segment_t *MapSegment(void)
+{
+    Bench_Segment_t *Seg;
+    int              Fd;
+
+    shm_unlink(BENCH_SEG_NAME);
+    Fd = shm_open(BENCH_SEG_NAME, O_RDWR | O_CREAT, 0600);
+    if (Fd < 0 || ftruncate(Fd, sizeof(*Seg)) != 0)
+    {
+        perror("shm_open");
+        exit(1);
+    }
+
+    Seg = mmap(NULL, sizeof(*Seg), PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+    close(Fd);
+    if (Seg == MAP_FAILED)
+    {
+        perror("mmap");
+        exit(1);
+    }
+
+    return Seg;
+}
+
+static void BenchShmem(uint32 MsgSz, long Iters, double *LatencyPtr, double *RatePtr)
+{
+    Bench_Segment_t *Seg = MapSegment();
+    uint8            Buf[2048];
+    uint8 *          Rec;
+    uint32           RecSz;
+    long             i;
+    double           Start;
+    pid_t            Child;
+
+    memset(Buf, 0xA5, sizeof(Buf));
+
+    Child = fork();
+    if (Child == 0)
+    {
+        /* echo every message of the latency run, then sink the throughput run */
+        for (i = 0; i < Iters; i++)
+        {
+            Rec = RingRead(&Seg->Rings[0], &RecSz);
+            memcpy(Buf, Rec, RecSz);
+            SBN_SHMEM_RingRelease(&Seg->Rings[0], RecSz);
+            RingWrite(&Seg->Rings[1], Buf, RecSz);
+        }
+
+        for (i = 0; i < Iters; i++)
+        {
+            Rec = RingRead(&Seg->Rings[0], &RecSz);
+            memcpy(Buf, Rec, RecSz);
+            SBN_SHMEM_RingRelease(&Seg->Rings[0], RecSz);
+        }
+
+        RingWrite(&Seg->Rings[1], Buf, 1);
+        _exit(0);
+    }
+
+    Start = Now();
+    for (i = 0; i < Iters; i++)
+    {
+        RingWrite(&Seg->Rings[0], Buf, MsgSz);
+        Rec = RingRead(&Seg->Rings[1], &RecSz);
+        SBN_SHMEM_RingRelease(&Seg->Rings[1], RecSz);
+    }
+    *LatencyPtr = (Now() - Start) / Iters / 2;
+
+    Start = Now();
+    for (i = 0; i < Iters; i++)
+    {
+        RingWrite(&Seg->Rings[0], Buf, MsgSz);
+    }
+    Rec = RingRead(&Seg->Rings[1], &RecSz);
+    *RatePtr = Iters / (Now() - Start);
+
+    waitpid(Child, NULL, 0);
+    munmap(Seg, sizeof(*Seg));
+    shm_unlink(BENCH_SEG_NAME);
+}
+
+static int UdpSocket(int Port)
+{
+    struct sockaddr_in Addr;
+    int                Sock = socket(AF_INET, SOCK_DGRAM, 0);
+    int                BufSz = 4 * 1024 * 1024;
+    struct timeval     Timeout = {2, 0};
+
+    setsockopt(Sock, SOL_SOCKET, SO_RCVBUF, &BufSz, sizeof(BufSz));
+    setsockopt(Sock, SOL_SOCKET, SO_RCVTIMEO, &Timeout, sizeof(Timeout));
+
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.sin_family      = AF_INET;
+    Addr.sin_port        = htons(Port);
+    Addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (bind(Sock, (struct sockaddr *)&Addr, sizeof(Addr)) != 0)
+    {
+        perror("bind");
+        exit(1);
+    }
+
+    Addr.sin_port = htons(Port ^ 1);
+    connect(Sock, (struct sockaddr *)&Addr, sizeof(Addr));
+
+    return Sock;
+}
+
+static void BenchUdp(uint32 MsgSz, long Iters, double *LatencyPtr, double *RatePtr)
+{
+    uint8  Buf[2048];
+    long   i, Received;
+    double Start;
+    pid_t  Child;
+    int    Sock;
+
+    memset(Buf, 0xA5, sizeof(Buf));
+
+    Child = fork();
+    if (Child == 0)
+    {
+        ssize_t Sz       = 0;
+        long    Received = 0;
+
+        Sock = UdpSocket(BENCH_UDP_PORT + 1);
+
+        for (i = 0; i < Iters; i++)
+        {
+            Sz = recv(Sock, Buf, sizeof(Buf), 0);
+            send(Sock, Buf, Sz, 0);
+        }
+
+        /* datagrams may be dropped, so count those that arrive until the end marker (or a timeout) */
+        while ((Sz = recv(Sock, Buf, sizeof(Buf), 0)) > 1)
+        {
+            Received++;
+        }
+
+        send(Sock, &Received, sizeof(Received), 0);
+        _exit(0);
+    }
+
+    Sock = UdpSocket(BENCH_UDP_PORT);
+
+    /* let the child bind before the first datagram goes out */
+    usleep(100000);
+
+    Start = Now();
+    for (i = 0; i < Iters; i++)
+    {
+        send(Sock, Buf, MsgSz, 0);
+        recv(Sock, Buf, sizeof(Buf), 0);
+    }
+    *LatencyPtr = (Now() - Start) / Iters / 2;
+
+    Start = Now();
+    for (i = 0; i < Iters; i++)
+    {
+        send(Sock, Buf, MsgSz, 0);
+    }
+    send(Sock, Buf, 1, 0);
+    Received = 0;
+    recv(Sock, &Received, sizeof(Received), 0);
+    *RatePtr = Received / (Now() - Start);
+
+    waitpid(Child, NULL, 0);
+    close(Sock);
+}
+
+int main(int argc, char *argv[])
+{
+    long   Iters = argc > 1 ? atol(argv[1]) : 100000;
+    double ShmLat, ShmRate, UdpLat, UdpRate;
+    size_t i;
+
+    printf("%6s %14s %14s %16s %16s\n", "bytes", "shmem lat(us)", "udp lat(us)", "shmem (msg/s)", "udp (msg/s)");
+
+    for (i = 0; i < sizeof(MsgSizes) / sizeof(MsgSizes[0]); i++)
+    {
+        BenchShmem(MsgSizes[i], Iters, &ShmLat, &ShmRate);
+        BenchUdp(MsgSizes[i], Iters, &UdpLat, &UdpRate);
+
+        printf("%6u %14.2f %14.2f %16.0f %16.0f\n", (unsigned int)MsgSizes[i], ShmLat * 1e6, UdpLat * 1e6, ShmRate,
+               UdpRate);
+    }
+
+    return 0;
+}
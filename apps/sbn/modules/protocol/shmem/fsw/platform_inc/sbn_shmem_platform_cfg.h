@@ -0,0 +1,46 @@
+/**
+ * @file
+ *
+ * This file contains the user-configurable parameters of the SBN
+ * shared memory protocol module.
+ */
+#ifndef _sbn_shmem_platform_cfg_h_
+#define _sbn_shmem_platform_cfg_h_
+
+/**
+ * \brief Size in bytes of each direction's ring in a peer pair's segment,
+ * must be a power of two and hold several of the largest SBN messages.
+ */
+#define SBN_SHMEM_RING_SZ (256 * 1024)
+
+/**
+ * \brief Maximum length of the shared memory segment names, built from the
+ * net's address and the spacecraft and processor IDs of the peer pair.
+ */
+#define SBN_SHMEM_MAX_NAME_LEN 64
+
+/**
+ * \brief How long (in milliseconds) a receive task sleeps waiting for the
+ * peer to write before returning to SBN empty-handed.
+ */
+#define SBN_SHMEM_RECV_TIMEOUT_MS 1000
+
+/**
+ * \brief Number of seconds since I've last sent the peer a message when
+ * I send an empty heartbeat message.
+ */
+#define SBN_SHMEM_PEER_HEARTBEAT 5
+
+/**
+ * \brief Number of seconds since I've last heard from the peer when I consider
+ * the peer connection to be dropped.
+ */
+#define SBN_SHMEM_PEER_TIMEOUT 10
+
+/**
+ * \brief If we're not connected, send peer occasional messages to wake
+ * them up and tell them "I'm here".
+ */
+#define SBN_SHMEM_ANNOUNCE_TIMEOUT 10
+
+#endif /* _sbn_shmem_platform_cfg_h_ */
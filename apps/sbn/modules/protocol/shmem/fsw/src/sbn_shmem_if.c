@@ -0,0 +1,422 @@
+#include "sbn_shmem_events.h"
+#include "sbn_shmem_if.h"
+#include "sbn_platform_cfg.h"
+#include "cfe_endian.h"
+#include <string.h>
+#include <errno.h>
+
+/* at some point this will be replaced by an OSAL shared memory interface */
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "sbn_interfaces.h"
+#include "cfe.h"
+
+CFE_EVS_EventID_t SBN_SHMEM_FIRST_EID;
+
+#define EXP_VERSION 6
+
+CompileTimeAssert(sizeof(SBN_SHMEM_Peer_t) <= sizeof(((SBN_PeerInterface_t *)0)->ModulePvt), ShmemPeerDataTooBig);
+CompileTimeAssert(sizeof(SBN_SHMEM_Net_t) <= sizeof(((SBN_NetInterface_t *)0)->ModulePvt), ShmemNetDataTooBig);
+
+static SBN_ProtocolOutlet_t SBN;
+
+/**
+ * Segments stay mapped for the life of the module: a receive task may still be
+ * sleeping on a ring while its peer is unloaded, and a reloaded configuration
+ * maps the same segments again. The same goes for the mutex guarding each
+ * segment's send ring.
+ */
+static struct
+{
+    char                 Name[SBN_SHMEM_MAX_NAME_LEN];
+    SBN_SHMEM_Segment_t *Segment;
+    osal_id_t            SendMutex;
+} Segments[SBN_MAX_PEER_CNT];
+
+static SBN_Status_t Init(int Version, CFE_EVS_EventID_t BaseEID, SBN_ProtocolOutlet_t *Outlet)
+{
+    SBN_SHMEM_FIRST_EID = BaseEID;
+
+    if (Version != EXP_VERSION)
+    {
+        OS_printf("SBN_SHMEM version mismatch: expected %d, got %d\n", EXP_VERSION, Version);
+        return SBN_ERROR;
+    } /* end if */
+
+    if (Outlet == NULL)
+    {
+        OS_printf("SBN_SHMEM outlet is NULL\n");
+        return SBN_ERROR;
+    } /* end if */
+
+    /* copy outlet pointers to a local buffer for later use */
+    memcpy(&SBN, Outlet, sizeof(SBN));
+
+    OS_printf("SBN_SHMEM Lib Initialized.\n");
+    return SBN_SUCCESS;
+} /* end Init() */
+
+static SBN_Status_t InitNet(SBN_NetInterface_t *Net)
+{
+    /* segments are per peer pair, see InitPeer() */
+    return SBN_SUCCESS;
+} /* end InitNet() */
+
+/**
+ * Opens (creating it if this is the first of the pair to start) and maps the
+ * segment shared with a peer.
+ *
+ * @param SegName[in] The name of the segment.
+ * @param SendMutexPtr[out] The mutex to hold while writing the send ring.
+ * @return The mapped segment, or NULL on error.
+ */
+static SBN_SHMEM_Segment_t *MapSegment(const char *SegName, osal_id_t *SendMutexPtr)
+{
+    SBN_SHMEM_Segment_t *Segment = NULL;
+    struct stat          Stat;
+    uint32               Magic = 0;
+    int                  SegIdx, Fd;
+    char                 MutexName[OS_MAX_API_NAME];
+    int32                Status;
+
+    for (SegIdx = 0; SegIdx < SBN_MAX_PEER_CNT && Segments[SegIdx].Segment; SegIdx++)
+    {
+        if (strcmp(Segments[SegIdx].Name, SegName) == 0)
+        {
+            *SendMutexPtr = Segments[SegIdx].SendMutex;
+            return Segments[SegIdx].Segment;
+        } /* end if */
+    }     /* end for */
+
+    if (SegIdx == SBN_MAX_PEER_CNT)
+    {
+        EVSSendErr(SBN_SHMEM_SHM_EID, "too many segments to map %s", SegName);
+        return NULL;
+    } /* end if */
+
+    Fd = shm_open(SegName, O_RDWR | O_CREAT, 0660);
+    if (Fd < 0)
+    {
+        EVSSendErr(SBN_SHMEM_SHM_EID, "unable to open segment %s (errno=%d)", SegName, errno);
+        return NULL;
+    } /* end if */
+
+    /* a fresh segment is zero-filled, which is two empty rings */
+    if (fstat(Fd, &Stat) != 0 || (Stat.st_size != 0 && Stat.st_size != sizeof(SBN_SHMEM_Segment_t)) ||
+        ftruncate(Fd, sizeof(SBN_SHMEM_Segment_t)) != 0)
+    {
+        EVSSendErr(SBN_SHMEM_SHM_EID, "unable to size segment %s (errno=%d)", SegName, errno);
+        close(Fd);
+        return NULL;
+    } /* end if */
+
+    Segment = mmap(NULL, sizeof(SBN_SHMEM_Segment_t), PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+    close(Fd);
+
+    if (Segment == MAP_FAILED)
+    {
+        EVSSendErr(SBN_SHMEM_SHM_EID, "unable to map segment %s (errno=%d)", SegName, errno);
+        return NULL;
+    } /* end if */
+
+    if (!__atomic_compare_exchange_n(&Segment->Magic, &Magic, SBN_SHMEM_MAGIC, false, __ATOMIC_SEQ_CST,
+                                     __ATOMIC_SEQ_CST) &&
+        Magic != SBN_SHMEM_MAGIC)
+    {
+        EVSSendErr(SBN_SHMEM_SHM_EID, "segment %s has an incompatible layout (magic=0x%08X)", SegName,
+                   (unsigned int)Magic);
+        munmap(Segment, sizeof(SBN_SHMEM_Segment_t));
+        return NULL;
+    } /* end if */
+
+    snprintf(MutexName, sizeof(MutexName), "sbn_shm_%d", SegIdx);
+    Status = OS_MutSemCreate(&Segments[SegIdx].SendMutex, MutexName, 0);
+    if (Status != OS_SUCCESS)
+    {
+        EVSSendErr(SBN_SHMEM_SHM_EID, "unable to create send mutex for segment %s (status=%d)", SegName,
+                   (int)Status);
+        munmap(Segment, sizeof(SBN_SHMEM_Segment_t));
+        return NULL;
+    } /* end if */
+
+    strncpy(Segments[SegIdx].Name, SegName, sizeof(Segments[SegIdx].Name) - 1);
+    Segments[SegIdx].Segment = Segment;
+
+    *SendMutexPtr = Segments[SegIdx].SendMutex;
+
+    return Segment;
+} /* end MapSegment() */
+
+/**
+ * Maps the segment shared with the peer, named for the net's address and the
+ * IDs of the two peers (lower first, so both peers agree on the name.)
+ *
+ * @param  Interface data structure containing the file entry
+ * @return SBN_SUCCESS on success, error code otherwise
+ */
+static SBN_Status_t InitPeer(SBN_PeerInterface_t *Peer)
+{
+    SBN_SHMEM_Peer_t * PeerData       = (SBN_SHMEM_Peer_t *)Peer->ModulePvt;
+    SBN_SHMEM_Net_t *  NetData        = (SBN_SHMEM_Net_t *)Peer->Net->ModulePvt;
+    CFE_SpacecraftID_t MySpacecraftID = CFE_PSP_GetSpacecraftId();
+    CFE_ProcessorID_t  MyProcessorID  = CFE_PSP_GetProcessorId();
+    char               SegName[SBN_SHMEM_MAX_NAME_LEN];
+    bool               Lower;
+
+    Lower = MySpacecraftID < Peer->SpacecraftID ||
+            (MySpacecraftID == Peer->SpacecraftID && MyProcessorID < Peer->ProcessorID);
+
+    if (Lower)
+    {
+        snprintf(SegName, sizeof(SegName), "%s_%u_%u_%u_%u", NetData->Name, (unsigned int)MySpacecraftID,
+                 (unsigned int)MyProcessorID, (unsigned int)Peer->SpacecraftID, (unsigned int)Peer->ProcessorID);
+    }
+    else
+    {
+        snprintf(SegName, sizeof(SegName), "%s_%u_%u_%u_%u", NetData->Name, (unsigned int)Peer->SpacecraftID,
+                 (unsigned int)Peer->ProcessorID, (unsigned int)MySpacecraftID, (unsigned int)MyProcessorID);
+    } /* end if */
+
+    PeerData->Segment = MapSegment(SegName, &PeerData->SendMutex);
+    if (PeerData->Segment == NULL)
+    {
+        return SBN_ERROR;
+    } /* end if */
+
+    PeerData->SendRing = &PeerData->Segment->Rings[Lower ? 0 : 1];
+    PeerData->RecvRing = &PeerData->Segment->Rings[Lower ? 1 : 0];
+
+    /* anything waiting was sent to a previous run of this processor */
+    SBN_SHMEM_RingDrain(PeerData->RecvRing);
+
+    EVSSendInfo(SBN_SHMEM_SHM_EID, "mapped segment %s for peer %d:%d", SegName, Peer->SpacecraftID,
+                Peer->ProcessorID);
+
+    return SBN_SUCCESS;
+} /* end InitPeer() */
+
+static SBN_Status_t LoadNet(SBN_NetInterface_t *Net, const char *Address)
+{
+    SBN_SHMEM_Net_t *NetData = (SBN_SHMEM_Net_t *)Net->ModulePvt;
+
+    EVSSendInfo(SBN_SHMEM_CONFIG_EID, "configuring net (NetData=0x%lx, Address=%s)", (long unsigned int)NetData,
+                Address);
+
+    /* shm_open() names start with a slash, and leave room for the peer IDs */
+    if (Address[0] != '/' || strlen(Address) >= sizeof(NetData->Name) / 2)
+    {
+        EVSSendErr(SBN_SHMEM_CONFIG_EID, "invalid address (Address=%s)", Address);
+        return SBN_ERROR;
+    } /* end if */
+
+    strncpy(NetData->Name, Address, sizeof(NetData->Name) - 1);
+
+    return SBN_SUCCESS;
+} /* end LoadNet */
+
+static SBN_Status_t LoadPeer(SBN_PeerInterface_t *Peer, const char *Address)
+{
+    /* the peer's segment is named for the net address and the peer IDs */
+    EVSSendInfo(SBN_SHMEM_CONFIG_EID, "configured peer (SC=%d, CPU=%d)", Peer->SpacecraftID, Peer->ProcessorID);
+
+    return SBN_SUCCESS;
+} /* end LoadPeer() */
+
+static SBN_Status_t PollPeer(SBN_PeerInterface_t *Peer)
+{
+    OS_time_t CurrentTime;
+    OS_GetLocalTime(&CurrentTime);
+
+    EVSSendDbg(SBN_SHMEM_DEBUG_EID, "polling peer %d:%d", Peer->SpacecraftID, Peer->ProcessorID);
+
+    if (Peer->Connected)
+    {
+        if (OS_TimeGetTotalSeconds(OS_TimeSubtract(CurrentTime, Peer->LastRecv)) > SBN_SHMEM_PEER_TIMEOUT)
+        {
+            EVSSendInfo(SBN_SHMEM_DEBUG_EID, "disconnected peer %d:%d", Peer->SpacecraftID, Peer->ProcessorID);
+
+            SBN.Disconnected(Peer);
+            return SBN_SUCCESS;
+        } /* end if */
+
+        if (OS_TimeGetTotalSeconds(OS_TimeSubtract(CurrentTime, Peer->LastSend)) > SBN_SHMEM_PEER_HEARTBEAT)
+        {
+            OS_GetLocalTime(&Peer->LastSend);
+            EVSSendDbg(SBN_SHMEM_DEBUG_EID, "sending heartbeat to peer %d:%d", Peer->SpacecraftID,
+                       Peer->ProcessorID);
+            return SBN.SendNetMsg(SBN_SHMEM_HEARTBEAT_MSG, 0, NULL, Peer);
+        } /* end if */
+    }
+    else
+    {
+        if (OS_TimeGetTotalSeconds(OS_TimeSubtract(CurrentTime, Peer->LastSend)) > SBN_SHMEM_ANNOUNCE_TIMEOUT)
+        {
+            OS_GetLocalTime(&Peer->LastSend);
+            EVSSendInfo(SBN_SHMEM_DEBUG_EID, "announce to peer %d:%d", Peer->SpacecraftID, Peer->ProcessorID);
+            return SBN.SendNetMsg(SBN_SHMEM_ANNOUNCE_MSG, 0, NULL, Peer);
+        } /* end if */
+    }     /* end if */
+
+    return SBN_SUCCESS;
+} /* end PollPeer() */
+
+/**
+ * Packs the message straight into the ring shared with the peer, the only
+ * copy made between the sender's pipe and the receiver's buffer.
+ *
+ * A peer with its own receive task is sent to from that task (protocol
+ * messages, subscriptions) as well as from the main loop, so the
+ * reserve/commit pair is made under the segment's send mutex.
+ */
+static SBN_Status_t Send(SBN_PeerInterface_t *Peer, SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Payload)
+{
+    SBN_SHMEM_Peer_t *PeerData = (SBN_SHMEM_Peer_t *)Peer->ModulePvt;
+    uint32            RecSz    = MsgSz + SBN_PACKED_HDR_SZ;
+    uint8 *           Rec      = NULL;
+
+    if (PeerData->SendRing == NULL)
+    {
+        return SBN_ERROR;
+    } /* end if */
+
+    if (OS_MutSemTake(PeerData->SendMutex) != OS_SUCCESS)
+    {
+        EVSSendErr(SBN_SHMEM_SHM_EID, "unable to take send mutex for peer %d:%d", Peer->SpacecraftID,
+                   Peer->ProcessorID);
+        return SBN_ERROR;
+    } /* end if */
+
+    Rec = SBN_SHMEM_RingReserve(PeerData->SendRing, RecSz);
+    if (Rec != NULL)
+    {
+        SBN.PackMsg(Rec, MsgSz, MsgType, CFE_PSP_GetProcessorId(), CFE_PSP_GetSpacecraftId(), Payload);
+
+        SBN_SHMEM_RingCommit(PeerData->SendRing, RecSz);
+    } /* end if */
+
+    OS_MutSemGive(PeerData->SendMutex);
+
+    if (Rec == NULL)
+    {
+        /* the peer is not keeping up, or not running */
+        EVSSendDbg(SBN_SHMEM_SHM_EID, "ring to peer %d:%d is full, dropped %d bytes", Peer->SpacecraftID,
+                   Peer->ProcessorID, (int)RecSz);
+        return SBN_ERROR;
+    } /* end if */
+
+    return SBN_SUCCESS;
+} /* end Send() */
+
+/**
+ * Receives the next message the peer wrote to its ring. Receive tasks sleep
+ * until the peer writes, polled peers return SBN_IF_EMPTY straight away.
+ */
+static SBN_Status_t Recv(SBN_NetInterface_t *Net, SBN_PeerInterface_t *Peer, SBN_MsgType_t *MsgTypePtr,
+                         SBN_MsgSz_t *MsgSzPtr, CFE_ProcessorID_t *ProcessorIDPtr,
+                         CFE_SpacecraftID_t *SpacecraftIDPtr, void *Payload)
+{
+    SBN_SHMEM_Peer_t *PeerData = (SBN_SHMEM_Peer_t *)Peer->ModulePvt;
+    uint8 *           Rec      = NULL;
+    uint32            RecSz    = 0;
+    bool              Unpacked = false;
+
+    if (PeerData->RecvRing == NULL)
+    {
+        if (Peer->TaskFlags & SBN_TASK_RECV)
+        {
+            /* don't spin the receive task on a peer that failed to map */
+            OS_TaskDelay(SBN_SHMEM_RECV_TIMEOUT_MS);
+        } /* end if */
+
+        return SBN_IF_EMPTY;
+    } /* end if */
+
+    Rec = SBN_SHMEM_RingPeek(PeerData->RecvRing, &RecSz);
+
+    if (Rec == NULL && (Peer->TaskFlags & SBN_TASK_RECV) &&
+        SBN_SHMEM_RingWait(PeerData->RecvRing, SBN_SHMEM_RECV_TIMEOUT_MS))
+    {
+        Rec = SBN_SHMEM_RingPeek(PeerData->RecvRing, &RecSz);
+    } /* end if */
+
+    if (Rec == NULL)
+    {
+        return SBN_IF_EMPTY;
+    } /* end if */
+
+    /* the record must hold the whole message its header claims */
+    if (RecSz >= SBN_PACKED_HDR_SZ && CFE_MAKE_BIG16(*(uint16 *)Rec) + SBN_PACKED_HDR_SZ <= RecSz)
+    {
+        Unpacked = SBN.UnpackMsg(Rec, MsgSzPtr, MsgTypePtr, ProcessorIDPtr, SpacecraftIDPtr, Payload);
+    } /* end if */
+
+    SBN_SHMEM_RingRelease(PeerData->RecvRing, RecSz);
+
+    if (!Unpacked)
+    {
+        EVSSendErr(SBN_SHMEM_DEBUG_EID, "ERROR: could not unpack message from peer %d:%d", Peer->SpacecraftID,
+                   Peer->ProcessorID);
+        return SBN_ERROR;
+    } /* end if */
+
+    if (!Peer->Connected)
+    {
+        EVSSendInfo(SBN_SHMEM_DEBUG_EID, "connecting to peer %d:%d", Peer->SpacecraftID, Peer->ProcessorID);
+        SBN.Connected(Peer);
+    } /* end if */
+
+    if (*MsgTypePtr == SBN_SHMEM_DISCONN_MSG)
+    {
+        SBN.Disconnected(Peer);
+    } /* end if */
+
+    return SBN_SUCCESS;
+} /* end Recv() */
+
+static SBN_Status_t UnloadPeer(SBN_PeerInterface_t *Peer)
+{
+    if (Peer->Connected)
+    {
+        EVSSendInfo(SBN_SHMEM_DEBUG_EID, "peer %d:%d - sending disconnect", Peer->SpacecraftID, Peer->ProcessorID);
+        SBN.SendNetMsg(SBN_SHMEM_DISCONN_MSG, 0, NULL, Peer);
+        SBN.Disconnected(Peer);
+    } /* end if */
+
+    return SBN_SUCCESS;
+} /* end UnloadPeer() */
+
+static SBN_Status_t UnloadNet(SBN_NetInterface_t *Net)
+{
+    SBN_Status_t Status = SBN_SUCCESS;
+
+    SBN_PeerIdx_t PeerIdx = 0;
+    for (PeerIdx = 0; PeerIdx < Net->PeerCnt; PeerIdx++)
+    {
+        if (UnloadPeer(&Net->Peers[PeerIdx]) != SBN_SUCCESS)
+        {
+            EVSSendInfo(SBN_SHMEM_DEBUG_EID, "failed to unload peer: %d\n", PeerIdx);
+            Status = SBN_ERROR;
+        }
+        else
+        {
+            EVSSendInfo(SBN_SHMEM_DEBUG_EID, "unloaded peer: %d\n", PeerIdx);
+        } /* end if */
+    }     /* end for */
+
+    return Status;
+} /* end UnloadNet() */
+
+SBN_IfOps_t SBN_SHMEM_Ops = {.InitModule   = Init,
+                             .InitNet      = InitNet,
+                             .InitPeer     = InitPeer,
+                             .LoadNet      = LoadNet,
+                             .LoadPeer     = LoadPeer,
+                             .PollPeer     = PollPeer,
+                             .Send         = Send,
+                             .RecvFromPeer = Recv,
+                             .RecvFromNet  = NULL,
+                             .UnloadNet    = UnloadNet,
+                             .UnloadPeer   = UnloadPeer};
@@ -0,0 +1,57 @@
+#ifndef _SBN_SHMEM_IF_H_
+#define _SBN_SHMEM_IF_H_
+
+#include "sbn_shmem_events.h"
+#include "sbn_shmem_platform_cfg.h"
+#include "sbn_shmem_ring.h"
+#include "sbn_platform_cfg.h"
+#include <string.h>
+#include <errno.h>
+
+#include "sbn_interfaces.h"
+#include "cfe.h"
+
+/**
+ * Shared-memory-specific message types.
+ */
+#define SBN_SHMEM_HEARTBEAT_MSG 0xA0
+#define SBN_SHMEM_ANNOUNCE_MSG  0xA1
+#define SBN_SHMEM_DISCONN_MSG   0xA2
+
+/** \brief Identifies an initialized segment of this layout. */
+#define SBN_SHMEM_MAGIC (0x53484D00 | SBN_PROTO_VER)
+
+/**
+ * Each pair of peers shares one segment holding a ring for each direction.
+ */
+typedef struct
+{
+    uint32 Magic;
+    uint32 Spare;
+
+    /**
+     * \brief [0] carries messages from the peer with the lower
+     * spacecraft/processor ID to the higher, [1] the other way.
+     */
+    SBN_SHMEM_Ring_t Rings[2];
+} SBN_SHMEM_Segment_t;
+
+typedef struct
+{
+    SBN_SHMEM_Segment_t *Segment;
+    SBN_SHMEM_Ring_t *   SendRing, *RecvRing;
+
+    /**
+     * \brief Serializes the tasks sending to the peer (its receive task, the
+     * main loop and any send task), as the send ring takes a single writer.
+     */
+    osal_id_t SendMutex;
+} SBN_SHMEM_Peer_t;
+
+typedef struct
+{
+    /** \brief Prefix of the names of the segments of this net's peers. */
+    char Name[SBN_SHMEM_MAX_NAME_LEN];
+} SBN_SHMEM_Net_t;
+
+#endif /* _SBN_SHMEM_IF_H_ */
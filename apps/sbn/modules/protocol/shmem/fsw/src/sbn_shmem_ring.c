@@ -0,0 +1,154 @@
+/* for syscall(), the futex calls have no C library wrapper */
+#define _DEFAULT_SOURCE
+
+#include "sbn_shmem_ring.h"
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif /* __linux__ */
+
+#if (SBN_SHMEM_RING_SZ & (SBN_SHMEM_RING_SZ - 1)) != 0
+#error SBN_SHMEM_RING_SZ must be a power of two
+#endif
+
+#define RING_MASK      (SBN_SHMEM_RING_SZ - 1)
+#define RING_LEN_SZ    sizeof(uint32)
+#define RING_WRAP      0xFFFFFFFF
+#define RING_RECORD_SZ(Sz) ((RING_LEN_SZ + (Sz) + 7) & ~7U)
+
+/*
+ * Head and Tail are free-running byte counts. The orderings below pair the
+ * writer's release of Head with the reader's acquire of it (and the same for
+ * Tail), so a record's bytes are visible before the index that covers them.
+ * Head and Waiting are sequentially consistent so that a reader going to sleep
+ * and a writer committing always see each other's update.
+ */
+
+uint8 *SBN_SHMEM_RingReserve(SBN_SHMEM_Ring_t *Ring, uint32 Sz)
+{
+    uint32 Head   = Ring->Head;
+    uint32 Tail   = __atomic_load_n(&Ring->Tail, __ATOMIC_ACQUIRE);
+    uint32 RecSz  = RING_RECORD_SZ(Sz);
+    uint32 Contig = SBN_SHMEM_RING_SZ - (Head & RING_MASK);
+    uint32 Needed = RecSz;
+
+    if (RecSz > Contig)
+    {
+        /* the rest of the ring is skipped by a wrap marker */
+        Needed += Contig;
+    } /* end if */
+
+    if (SBN_SHMEM_RING_SZ - (Head - Tail) < Needed)
+    {
+        return NULL;
+    } /* end if */
+
+    if (RecSz > Contig)
+    {
+        *(uint32 *)&Ring->Data[Head & RING_MASK] = RING_WRAP;
+        Head += Contig;
+        __atomic_store_n(&Ring->Head, Head, __ATOMIC_RELEASE);
+    } /* end if */
+
+    return &Ring->Data[(Head & RING_MASK) + RING_LEN_SZ];
+} /* end SBN_SHMEM_RingReserve() */
+
+void SBN_SHMEM_RingCommit(SBN_SHMEM_Ring_t *Ring, uint32 Sz)
+{
+    uint32 Head = Ring->Head;
+
+    *(uint32 *)&Ring->Data[Head & RING_MASK] = Sz;
+
+    __atomic_store_n(&Ring->Head, Head + RING_RECORD_SZ(Sz), __ATOMIC_SEQ_CST);
+
+#ifdef __linux__
+    if (__atomic_load_n(&Ring->Waiting, __ATOMIC_SEQ_CST))
+    {
+        syscall(SYS_futex, &Ring->Head, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    } /* end if */
+#endif /* __linux__ */
+} /* end SBN_SHMEM_RingCommit() */
+
+uint8 *SBN_SHMEM_RingPeek(SBN_SHMEM_Ring_t *Ring, uint32 *SzPtr)
+{
+    uint32 Tail = Ring->Tail;
+    uint32 Head = __atomic_load_n(&Ring->Head, __ATOMIC_ACQUIRE);
+    uint32 Sz   = 0;
+
+    if (Head == Tail)
+    {
+        return NULL;
+    } /* end if */
+
+    Sz = *(uint32 *)&Ring->Data[Tail & RING_MASK];
+
+    if (Sz == RING_WRAP)
+    {
+        Tail += SBN_SHMEM_RING_SZ - (Tail & RING_MASK);
+        __atomic_store_n(&Ring->Tail, Tail, __ATOMIC_RELEASE);
+
+        if (Head == Tail)
+        {
+            return NULL;
+        } /* end if */
+
+        Sz = *(uint32 *)&Ring->Data[Tail & RING_MASK];
+    } /* end if */
+
+    /* the length is checked before rounding it up, which would wrap near UINT32_MAX */
+    if (Sz > SBN_SHMEM_RING_SZ - RING_LEN_SZ || (Tail & RING_MASK) + RING_RECORD_SZ(Sz) > SBN_SHMEM_RING_SZ ||
+        RING_RECORD_SZ(Sz) > Head - Tail)
+    {
+        /* corrupt, give up on everything written so far */
+        __atomic_store_n(&Ring->Tail, Head, __ATOMIC_RELEASE);
+        return NULL;
+    } /* end if */
+
+    *SzPtr = Sz;
+
+    return &Ring->Data[(Tail & RING_MASK) + RING_LEN_SZ];
+} /* end SBN_SHMEM_RingPeek() */
+
+void SBN_SHMEM_RingRelease(SBN_SHMEM_Ring_t *Ring, uint32 Sz)
+{
+    __atomic_store_n(&Ring->Tail, Ring->Tail + RING_RECORD_SZ(Sz), __ATOMIC_RELEASE);
+} /* end SBN_SHMEM_RingRelease() */
+
+void SBN_SHMEM_RingDrain(SBN_SHMEM_Ring_t *Ring)
+{
+    __atomic_store_n(&Ring->Tail, __atomic_load_n(&Ring->Head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+} /* end SBN_SHMEM_RingDrain() */
+
+bool SBN_SHMEM_RingWait(SBN_SHMEM_Ring_t *Ring, int32 TimeoutMs)
+{
+    struct timespec Timeout;
+    uint32          Head;
+
+    Timeout.tv_sec  = TimeoutMs / 1000;
+    Timeout.tv_nsec = (TimeoutMs % 1000) * 1000000L;
+
+    __atomic_store_n(&Ring->Waiting, 1, __ATOMIC_SEQ_CST);
+
+    Head = __atomic_load_n(&Ring->Head, __ATOMIC_SEQ_CST);
+    if (Head == Ring->Tail)
+    {
+#ifdef __linux__
+        /* returns straight away if the writer moved Head since it was read */
+        syscall(SYS_futex, &Ring->Head, FUTEX_WAIT, Head, &Timeout, NULL, 0);
+#else
+        /* no cross-process wakeup, poll at a modest rate instead */
+        Timeout.tv_sec  = 0;
+        Timeout.tv_nsec = 1000000L;
+        nanosleep(&Timeout, NULL);
+#endif /* __linux__ */
+    } /* end if */
+
+    __atomic_store_n(&Ring->Waiting, 0, __ATOMIC_SEQ_CST);
+
+    return __atomic_load_n(&Ring->Head, __ATOMIC_ACQUIRE) != Ring->Tail;
+} /* end SBN_SHMEM_RingWait() */
@@ -0,0 +1,102 @@
+#ifndef _sbn_shmem_ring_h_
+#define _sbn_shmem_ring_h_
+
+/**
+ * A single-producer, single-consumer ring of variable sized records that
+ * lives in memory shared by two processes. Only the writer advances Head
+ * and only the reader advances Tail, so neither side takes a lock; a reader
+ * that finds the ring empty may sleep on Head (a futex on Linux) until the
+ * writer commits a record.
+ *
+ * Each end of a ring has a single process, but that process may have several
+ * tasks sending to the peer: they must serialize from SBN_SHMEM_RingReserve
+ * through SBN_SHMEM_RingCommit themselves.
+ *
+ * Records are a 4-byte length followed by the record, padded to 8 bytes, and
+ * never straddle the end of the ring: a writer that does not have room before
+ * the end writes a wrap marker and continues at the start.
+ *
+ * This file only depends on the C library so that it can be benchmarked
+ * outside of cFS.
+ */
+
+#include "common_types.h"
+#include "sbn_shmem_platform_cfg.h"
+
+typedef struct
+{
+    /** @brief Bytes ever committed by the writer (the futex word readers sleep on.) */
+    volatile uint32 Head;
+
+    /** @brief Set by a reader about to sleep on Head, so the writer knows to wake it. */
+    volatile uint32 Waiting;
+
+    /* keep the reader's index off the writer's cache line */
+    uint8 Spare1[56];
+
+    /** @brief Bytes ever released by the reader. */
+    volatile uint32 Tail;
+
+    uint8 Spare2[60];
+
+    uint8 Data[SBN_SHMEM_RING_SZ];
+} SBN_SHMEM_Ring_t;
+
+/**
+ * Reserves room for a record of Sz bytes at the head of the ring.
+ *
+ * @param Ring[in] The ring to write to.
+ * @param Sz[in] The size of the record.
+ * @return Where to write the record, or NULL if the ring is too full.
+ *
+ * @sa SBN_SHMEM_RingCommit
+ */
+uint8 *SBN_SHMEM_RingReserve(SBN_SHMEM_Ring_t *Ring, uint32 Sz);
+
+/**
+ * Makes the record written to the space returned by SBN_SHMEM_RingReserve
+ * visible to the reader, waking it if it is asleep.
+ *
+ * @param Ring[in] The ring to write to.
+ * @param Sz[in] The size of the record (as reserved.)
+ */
+void SBN_SHMEM_RingCommit(SBN_SHMEM_Ring_t *Ring, uint32 Sz);
+
+/**
+ * Gets the record at the tail of the ring without removing it.
+ *
+ * @param Ring[in] The ring to read from.
+ * @param SzPtr[out] The size of the record.
+ * @return The record, or NULL if the ring is empty.
+ *
+ * @sa SBN_SHMEM_RingRelease
+ */
+uint8 *SBN_SHMEM_RingPeek(SBN_SHMEM_Ring_t *Ring, uint32 *SzPtr);
+
+/**
+ * Removes the record returned by SBN_SHMEM_RingPeek, making its space
+ * available to the writer.
+ *
+ * @param Ring[in] The ring to read from.
+ * @param Sz[in] The size of the record.
+ */
+void SBN_SHMEM_RingRelease(SBN_SHMEM_Ring_t *Ring, uint32 Sz);
+
+/**
+ * Discards everything in the ring, such as records left by a previous run of
+ * the writer. Only the reader may call this.
+ *
+ * @param Ring[in] The ring to empty.
+ */
+void SBN_SHMEM_RingDrain(SBN_SHMEM_Ring_t *Ring);
+
+/**
+ * Sleeps until the ring is not empty.
+ *
+ * @param Ring[in] The ring to wait on.
+ * @param TimeoutMs[in] The longest time to sleep, in milliseconds.
+ * @return true if the ring has a record to read.
+ */
+bool SBN_SHMEM_RingWait(SBN_SHMEM_Ring_t *Ring, int32 TimeoutMs);
+
+#endif /* _sbn_shmem_ring_h_ */
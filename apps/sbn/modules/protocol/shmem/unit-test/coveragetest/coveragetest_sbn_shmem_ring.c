@@ -0,0 +1,295 @@
+#include "utassert.h"
+#include "uttest.h"
+#include "sbn_shmem_ring.h"
+#include <string.h>
+
+#define ADD_TEST(test) UtTest_Add((Test_##test), UT_Setup, UT_TearDown, #test)
+
+/* records are a 4-byte length and the record, padded to 8 bytes */
+#define REC_SZ(Sz) ((4 + (Sz) + 7) & ~7U)
+
+static SBN_SHMEM_Ring_t Ring;
+
+/* Empties the ring and moves both indices back to its start. */
+static void Reset(void)
+{
+    memset(&Ring, 0, sizeof(Ring));
+} /* end Reset() */
+
+/* Writes a record of Sz bytes of Fill, returning false if it does not fit. */
+static bool Write(uint32 Sz, uint8 Fill)
+{
+    uint8 *Rec = SBN_SHMEM_RingReserve(&Ring, Sz);
+
+    if (Rec == NULL)
+    {
+        return false;
+    } /* end if */
+
+    memset(Rec, Fill, Sz);
+    SBN_SHMEM_RingCommit(&Ring, Sz);
+
+    return true;
+} /* end Write() */
+
+/* Moves both indices to Offset bytes into an empty ring. */
+static void Skip(uint32 Offset)
+{
+    Ring.Head = Offset;
+    Ring.Tail = Offset;
+} /* end Skip() */
+
+static void RingRW_Nominal(void)
+{
+    uint8 *Rec = NULL;
+    uint32 Sz  = 0;
+
+    Reset();
+
+    UtAssert_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+
+    UtAssert_BOOL_TRUE(Write(5, 0xA5));
+    UtAssert_BOOL_TRUE(Write(8, 0x5A));
+    UtAssert_UINT32_EQ(Ring.Head, REC_SZ(5) + REC_SZ(8));
+
+    UtAssert_NOT_NULL(Rec = SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Sz, 5);
+    UtAssert_MemCmpValue(Rec, 0xA5, Sz, "first record");
+
+    /* peeking again without releasing gets the same record */
+    UtAssert_ADDRESS_EQ(SBN_SHMEM_RingPeek(&Ring, &Sz), Rec);
+    SBN_SHMEM_RingRelease(&Ring, Sz);
+
+    UtAssert_NOT_NULL(Rec = SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Sz, 8);
+    UtAssert_MemCmpValue(Rec, 0x5A, Sz, "second record");
+    SBN_SHMEM_RingRelease(&Ring, Sz);
+
+    UtAssert_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Ring.Tail, Ring.Head);
+} /* end RingRW_Nominal() */
+
+static void RingRW_Wrap(void)
+{
+    uint8 *Rec = NULL;
+    uint32 Sz  = 0;
+
+    Reset();
+
+    /* 16 bytes left before the end, too few for a 20 byte record */
+    Skip(SBN_SHMEM_RING_SZ - 16);
+
+    UtAssert_BOOL_TRUE(Write(20, 0x11));
+
+    /* the rest of the ring is skipped, the record starts over at the front */
+    UtAssert_UINT32_EQ(Ring.Head, SBN_SHMEM_RING_SZ + REC_SZ(20));
+    UtAssert_UINT32_EQ(*(uint32 *)&Ring.Data[SBN_SHMEM_RING_SZ - 16], 0xFFFFFFFF);
+
+    UtAssert_NOT_NULL(Rec = SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_ADDRESS_EQ(Rec, &Ring.Data[4]);
+    UtAssert_UINT32_EQ(Sz, 20);
+    UtAssert_MemCmpValue(Rec, 0x11, Sz, "wrapped record");
+    SBN_SHMEM_RingRelease(&Ring, Sz);
+
+    UtAssert_UINT32_EQ(Ring.Tail, Ring.Head);
+} /* end RingRW_Wrap() */
+
+static void RingRW_WrapExact(void)
+{
+    uint32 Sz = 0;
+
+    Reset();
+
+    /* a record that exactly fills the end of the ring does not wrap */
+    Skip(SBN_SHMEM_RING_SZ - REC_SZ(12));
+
+    UtAssert_BOOL_TRUE(Write(12, 0x22));
+    UtAssert_UINT32_EQ(Ring.Head, SBN_SHMEM_RING_SZ);
+
+    UtAssert_NOT_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Sz, 12);
+    SBN_SHMEM_RingRelease(&Ring, Sz);
+
+    UtAssert_UINT32_EQ(Ring.Tail, SBN_SHMEM_RING_SZ);
+} /* end RingRW_WrapExact() */
+
+static void RingRW_WrapMarkerOnly(void)
+{
+    uint32 Sz = 0;
+
+    Reset();
+
+    /* the reader steps over a wrap marker the writer left before filling up */
+    Skip(SBN_SHMEM_RING_SZ - 16);
+    *(uint32 *)&Ring.Data[SBN_SHMEM_RING_SZ - 16] = 0xFFFFFFFF;
+    Ring.Head = SBN_SHMEM_RING_SZ;
+
+    UtAssert_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Ring.Tail, SBN_SHMEM_RING_SZ);
+} /* end RingRW_WrapMarkerOnly() */
+
+static void RingRW_Full(void)
+{
+    uint32 Head = 0;
+    uint32 Sz   = 0;
+    int    Cnt  = 0;
+
+    Reset();
+
+    while (Write(1020, 0x33))
+    {
+        Cnt++;
+    } /* end while */
+
+    UtAssert_INT32_EQ(Cnt, SBN_SHMEM_RING_SZ / REC_SZ(1020));
+    UtAssert_UINT32_EQ(Ring.Head - Ring.Tail, SBN_SHMEM_RING_SZ);
+
+    /* a full ring is left as it was */
+    Head = Ring.Head;
+    UtAssert_NULL(SBN_SHMEM_RingReserve(&Ring, 1));
+    UtAssert_UINT32_EQ(Ring.Head, Head);
+
+    /* releasing one record makes room for one more */
+    UtAssert_NOT_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    SBN_SHMEM_RingRelease(&Ring, Sz);
+    UtAssert_BOOL_TRUE(Write(1020, 0x44));
+    UtAssert_BOOL_FALSE(Write(1, 0x44));
+} /* end RingRW_Full() */
+
+static void RingRW_FullWrap(void)
+{
+    Reset();
+
+    /* 16 bytes before the end, but the start of the ring is still unread */
+    Skip(SBN_SHMEM_RING_SZ - 16);
+    Ring.Tail = 8;
+
+    UtAssert_NULL(SBN_SHMEM_RingReserve(&Ring, 20));
+
+    /* neither the marker nor the head were written */
+    UtAssert_UINT32_EQ(Ring.Head, SBN_SHMEM_RING_SZ - 16);
+    UtAssert_UINT32_EQ(*(uint32 *)&Ring.Data[SBN_SHMEM_RING_SZ - 16], 0);
+} /* end RingRW_FullWrap() */
+
+static void RingRW_Corrupt(void)
+{
+    uint32 Sz = 0;
+
+    Reset();
+
+    UtAssert_BOOL_TRUE(Write(8, 0x55));
+    UtAssert_BOOL_TRUE(Write(8, 0x66));
+
+    /* a length running past what was committed */
+    *(uint32 *)&Ring.Data[0] = 1000;
+
+    UtAssert_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+
+    /* everything written so far is given up on */
+    UtAssert_UINT32_EQ(Ring.Tail, Ring.Head);
+
+    /* and the ring is usable again */
+    UtAssert_BOOL_TRUE(Write(8, 0x77));
+    UtAssert_NOT_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Sz, 8);
+} /* end RingRW_Corrupt() */
+
+static void RingRW_CorruptAfterWrap(void)
+{
+    uint32 Sz = 0;
+
+    Reset();
+
+    Skip(SBN_SHMEM_RING_SZ - 16);
+    UtAssert_BOOL_TRUE(Write(20, 0x88));
+
+    /* the record after the wrap marker claims more than was written */
+    *(uint32 *)&Ring.Data[0] = 0x7FFFFFFF;
+
+    UtAssert_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Ring.Tail, Ring.Head);
+} /* end RingRW_CorruptAfterWrap() */
+
+static void RingRW_CorruptHugeLen(void)
+{
+    uint32 Sz = 0;
+
+    Reset();
+
+    UtAssert_BOOL_TRUE(Write(8, 0xBB));
+    UtAssert_BOOL_TRUE(Write(8, 0xBB));
+
+    /* a length whose padded record size wraps around to zero */
+    *(uint32 *)&Ring.Data[0] = 0xFFFFFFF8;
+
+    UtAssert_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Ring.Tail, Ring.Head);
+} /* end RingRW_CorruptHugeLen() */
+
+static void RingRW_CorruptPastEnd(void)
+{
+    uint32 Sz = 0;
+
+    Reset();
+
+    /* enough was committed, but the record would run off the end of the ring */
+    Skip(SBN_SHMEM_RING_SZ - 16);
+    Ring.Head = SBN_SHMEM_RING_SZ + 64;
+    *(uint32 *)&Ring.Data[SBN_SHMEM_RING_SZ - 16] = 40;
+
+    UtAssert_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Ring.Tail, Ring.Head);
+} /* end RingRW_CorruptPastEnd() */
+
+void Test_SBN_SHMEM_RingRW(void)
+{
+    RingRW_Nominal();
+    RingRW_Wrap();
+    RingRW_WrapExact();
+    RingRW_WrapMarkerOnly();
+    RingRW_Full();
+    RingRW_FullWrap();
+    RingRW_Corrupt();
+    RingRW_CorruptAfterWrap();
+    RingRW_CorruptHugeLen();
+    RingRW_CorruptPastEnd();
+} /* end Test_SBN_SHMEM_RingRW() */
+
+void Test_SBN_SHMEM_RingDrain(void)
+{
+    uint32 Sz = 0;
+
+    UtAssert_BOOL_TRUE(Write(8, 0x99));
+    UtAssert_BOOL_TRUE(Write(8, 0x99));
+
+    SBN_SHMEM_RingDrain(&Ring);
+
+    UtAssert_NULL(SBN_SHMEM_RingPeek(&Ring, &Sz));
+    UtAssert_UINT32_EQ(Ring.Tail, Ring.Head);
+} /* end Test_SBN_SHMEM_RingDrain() */
+
+void Test_SBN_SHMEM_RingWait(void)
+{
+    /* nothing is written, so this times out */
+    UtAssert_BOOL_FALSE(SBN_SHMEM_RingWait(&Ring, 1));
+    UtAssert_UINT32_EQ(Ring.Waiting, 0);
+
+    /* a record is already there, so this does not sleep */
+    UtAssert_BOOL_TRUE(Write(8, 0xAA));
+    UtAssert_BOOL_TRUE(SBN_SHMEM_RingWait(&Ring, 1000));
+    UtAssert_UINT32_EQ(Ring.Waiting, 0);
+} /* end Test_SBN_SHMEM_RingWait() */
+
+void UT_Setup(void)
+{
+    Reset();
+} /* end UT_Setup() */
+
+void UT_TearDown(void) {} /* end UT_TearDown() */
+
+void UtTest_Setup(void)
+{
+    ADD_TEST(SBN_SHMEM_RingRW);
+    ADD_TEST(SBN_SHMEM_RingDrain);
+    ADD_TEST(SBN_SHMEM_RingWait);
+}
@@ -544,6 +544,24 @@ static SBN_Status_t UnloadNet(SBN_NetInterface_t *Net)
     return SBN_SUCCESS;
 } /* end UnloadNet() */
 
+static SBN_Status_t AddRecvFds(SBN_NetInterface_t *Net, OS_FdSet *FdSet)
+{
+    SBN_Status_t   Status  = SBN_IF_EMPTY;
+    int            ConnID  = 0;
+    SBN_TCP_Net_t *NetData = (SBN_TCP_Net_t *)Net->ModulePvt;
+
+    /* only the connections Recv() reads, the server socket is accepted on by PollPeer() */
+    for (ConnID = 0; ConnID < SBN_MAX_PEER_CNT; ConnID++)
+    {
+        if (NetData->Conns[ConnID].InUse && OS_SelectFdAdd(FdSet, NetData->Conns[ConnID].Socket) == OS_SUCCESS)
+        {
+            Status = SBN_SUCCESS;
+        } /* end if */
+    }     /* end for */
+
+    return Status;
+} /* end AddRecvFds() */
+
 SBN_IfOps_t SBN_TCP_Ops = {
     .InitModule = Init,
     .InitNet = InitNet,
@@ -555,5 +573,6 @@ SBN_IfOps_t SBN_TCP_Ops = {
     .RecvFromPeer = NULL,
     .RecvFromNet = Recv,
     .UnloadNet = UnloadNet,
-    .UnloadPeer = UnloadPeer
+    .UnloadPeer = UnloadPeer,
+    .AddRecvFds = AddRecvFds
                               };
\ No newline at end of file
@@ -336,6 +336,19 @@ static SBN_Status_t UnloadNet(SBN_NetInterface_t *Net)
     return Status;
 } /* end UnloadNet() */
 
+static SBN_Status_t AddRecvFds(SBN_NetInterface_t *Net, OS_FdSet *FdSet)
+{
+    SBN_UDP_Net_t *NetData = (SBN_UDP_Net_t *)Net->ModulePvt;
+
+    /* one socket receives from all peers */
+    if (OS_SelectFdAdd(FdSet, NetData->Socket) != OS_SUCCESS)
+    {
+        return SBN_IF_EMPTY;
+    } /* end if */
+
+    return SBN_SUCCESS;
+} /* end AddRecvFds() */
+
 SBN_IfOps_t SBN_UDP_Ops = {
     .InitModule = Init,
     .InitNet = InitNet,
@@ -347,5 +360,6 @@ SBN_IfOps_t SBN_UDP_Ops = {
     .RecvFromPeer = NULL,
     .RecvFromNet = Recv,
     .UnloadNet = UnloadNet,
-    .UnloadPeer = UnloadPeer
+    .UnloadPeer = UnloadPeer,
+    .AddRecvFds = AddRecvFds
                               };
\ No newline at end of file
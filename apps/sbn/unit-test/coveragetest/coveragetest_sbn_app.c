@@ -1,22 +1,11 @@
 #include "sbn_coveragetest_common.h"
 #include "sbn_app.h"
 #include "cfe_msgids.h"
-#include "cfe_sb_events.h"
 #include "sbn_pack.h"
 
 /* #define STUB_TASKID 1073807361 *//* TODO: should be replaced with a call to a stub util fn */
-CFE_SB_MsgId_t MsgID = 0x1818;
+CFE_SB_MsgId_t MsgID = CFE_SB_MSGID_WRAP_VALUE(0x1818);
 /********************************** tests ************************************/
-static void AppMain_ESRegisterErr(void)
-{
-    START();
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterApp), 1, -1);
-
-    SBN_AppMain();
-
-    UtAssert_STUB_COUNT(CFE_EVS_Register, 0);
-} /* end AppMain_ESRegisterErr() */
-
 static void AppMain_EVSRegisterErr(void)
 {
     START();
@@ -32,7 +21,7 @@ static void AppMain_AppIdErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_INIT_EID, "unable to get AppID");
+    UT_CheckEvent_Setup(SBN_INIT_EID, "ERROR: could not start SBN: unable to get AppID");
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, -1);
 
     SBN_AppMain();
@@ -45,7 +34,7 @@ static void AppMain_TaskInfoErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_INIT_EID, "SBN failed to get task info (");
+    UT_CheckEvent_Setup(SBN_INIT_EID, "ERROR: could not start SBN: SBN failed to get task info (");
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskInfo), 1, -1);
 
     SBN_AppMain();
@@ -171,8 +160,6 @@ static void LoadConf_Module_SymLookErr(void)
 
     SBN_AppMain();
 
-    UT_DEFAULT_IMPL(OS_SymbolLookup);
-
     EVENT_CNT(1);
 } /* end LoadConf_Module_SymLookErr() */
 
@@ -248,8 +235,6 @@ static void LoadConf_ProtoNameErr(void)
     char o                                  = NominalTblPtr->Peers[0].ProtocolName[0];
     NominalTblPtr->Peers[0].ProtocolName[0] = 'X'; /* temporary make it "XDP" */
 
-    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -1); /* fail just after LoadConfTbl() */
-
     SBN_AppMain();
 
     NominalTblPtr->Peers[0].ProtocolName[0] = o;
@@ -268,8 +253,6 @@ static void LoadConf_FiltNameErr(void)
     char o                                = NominalTblPtr->Peers[0].Filters[0][0];
     NominalTblPtr->Peers[0].Filters[0][0] = 'X';
 
-    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -1); /* fail just after LoadConfTbl() */
-
     SBN_AppMain();
 
     NominalTblPtr->Peers[0].Filters[0][0] = o;
@@ -281,9 +264,7 @@ static void LoadConf_TooManyNets(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_TBL_EID, "too many networks");
-
-    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -1); /* fail just after LoadConfTbl() */
+    UT_CheckEvent_Setup(SBN_TBL_EID, "network index too large (");
 
     NominalTblPtr->Peers[0].NetNum = SBN_MAX_NETS + 1;
 
@@ -313,20 +294,19 @@ static void LoadConf_NetCntInc(void)
 
     SBN.NetCnt = 0;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -1); /* fail just after LoadConfTbl() */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_DeletePipe), 1, -1); /* keep the configuration at cleanup */
 
     SBN_AppMain();
 
     UtAssert_INT32_EQ(SBN.NetCnt, 1);
+    UtAssert_INT32_EQ(SBN.Nets[0].PeerCnt, 1);
 } /* end LoadConf_NetCntInc() */
 
 static void LoadConf_Nominal(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_INIT_EID, "error creating mutex for send tasks");
-
-    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -1); /* fail just after LoadConfTbl() */
+    UT_CheckEvent_Setup(SBN_INIT_EID, "SBN initialized.");
 
     SBN_AppMain();
 
@@ -350,13 +330,12 @@ static void AppMain_MutSemCrErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_INIT_EID, "error creating mutex for send tasks");
+    UT_CheckEvent_Setup(SBN_INIT_EID, "ERROR: could not start SBN: error creating mutex for send tasks");
 
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, -1);
 
     SBN_AppMain();
 
-    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 0, 0);
     EVENT_CNT(1);
 } /* end AppMain_MutSemCrErr() */
 
@@ -372,7 +351,7 @@ static void InitInt_NoNets(void)
 
     UT_CheckEvent_Setup(SBN_PEER_EID, "no networks configured");
 
-    UT_SetHookFunction(UT_KEY(OS_MutSemCreate), NoNetsHook, NULL);
+    UT_SetHookFunction(UT_KEY(CFE_TBL_ReleaseAddress), NoNetsHook, NULL);
 
     SBN_AppMain();
 
@@ -391,7 +370,7 @@ static void InitInt_NetConfErr(void)
 
     UT_CheckEvent_Setup(SBN_PEER_EID, "network #0 not configured");
 
-    UT_SetHookFunction(UT_KEY(OS_MutSemCreate), NetConfHook, NULL);
+    UT_SetHookFunction(UT_KEY(CFE_TBL_ReleaseAddress), NetConfHook, NULL);
 
     SBN_AppMain();
 
@@ -399,7 +378,8 @@ static void InitInt_NetConfErr(void)
 } /* end InitInt_NetConfErr() */
 
 static SBN_Status_t RecvFromPeer_Nominal(SBN_NetInterface_t *Net, SBN_PeerInterface_t *Peer, SBN_MsgType_t *MsgTypePtr,
-                                         SBN_MsgSz_t *MsgSzPtr, CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer)
+                                         SBN_MsgSz_t *MsgSzPtr, CFE_ProcessorID_t *ProcessorIDPtr,
+                                         CFE_SpacecraftID_t *SpacecraftIDPtr, void *PayloadBuffer)
 {
     return SBN_SUCCESS;
 } /* end RecvFromPeer_Nominal() */
@@ -416,7 +396,7 @@ static void AppMain_SubPipeCrErr(void)
 
     UT_CheckEvent_Setup(SBN_INIT_EID, "failed to create subscription pipe (Status=");
 
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, CFE_SB_BAD_ARGUMENT); /* fail just after InitInterfaces() */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 2, CFE_SB_BAD_ARGUMENT); /* fail just after InitInterfaces() */
 
     SBN_AppMain();
 
@@ -453,9 +433,9 @@ static void AppMain_CmdPipeCrErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_INIT_EID, "failed to create command pipe (");
+    UT_CheckEvent_Setup(SBN_INIT_EID, "ERROR: could not start SBN: failed to create command pipe (");
 
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 2, CFE_SB_BAD_ARGUMENT);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, CFE_SB_BAD_ARGUMENT);
 
     SBN_AppMain();
 
@@ -466,7 +446,7 @@ static void AppMain_CmdPipeSubErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_INIT_EID, "failed to subscribe to command pipe (");
+    UT_CheckEvent_Setup(SBN_INIT_EID, "ERROR: could not start SBN: failed to subscribe to command pipe (");
 
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 1, CFE_SB_BAD_ARGUMENT);
 
@@ -475,187 +455,24 @@ static void AppMain_CmdPipeSubErr(void)
     EVENT_CNT(1);
 } /* end AppMain_CmdPipeSubErr() */
 
-static void SBStart_CrPipeErr(void)
-{
-    START();
-
-    UT_CheckEvent_Setup(SBN_INIT_EID, "failed to create event pipe (");
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 3, CFE_SB_BAD_ARGUMENT);
-
-    SBN_AppMain();
-
-    EVENT_CNT(1);
-} /* end SBStart_CrPipeErr() */
-
-static void SBStart_SubErr(void)
-{
-    START();
-
-    UT_CheckEvent_Setup(SBN_INIT_EID, "failed to subscribe to event pipe (");
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 2, CFE_SB_BAD_ARGUMENT);
-
-    SBN_AppMain();
-
-    EVENT_CNT(1);
-} /* end SBStart_SubErr() */
-
-static void SBStart_RcvMsgErr(void)
-{
-    START();
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
-
-    UT_CheckEvent_Setup(SBN_MSG_EID, "err from rcvmsg on sub pipe");
-
-    /* first time through, CheckSubscriptionPipe should generate an error */
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_PIPE_RD_ERR);
-
-    /* second time through CheckSubscriptionPipe will be nominal operation */
-    CFE_SB_SingleSubscriptionTlm_t Msg, *MsgPtr;
-    MsgPtr = &Msg;
-    memset(MsgPtr, 0, sizeof(Msg));
-    Msg.Payload.SubType = CFE_SB_SUBSCRIPTION;
-    Msg.Payload.MsgId   = CFE_SB_ONESUB_TLM_MID;
-    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SUCCESS);
-
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
-    /* second call to SBN_CheckSubscriptionPipe should succeed to return a sub msg */
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Unsubscribe), 1, CFE_SB_BAD_ARGUMENT); /* fail out of WaitForSBStartup() */
-
-    SBN_AppMain();
-
-    EVENT_CNT(1);
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
-} /* end SBStart_RcvMsgErr() */
-
-static void SBStart_UnsubErr(void)
-{
-    START();
-
-    UT_CheckEvent_Setup(SBN_INIT_EID, "unable to unsubscribe from event messages");
-
-    /* SBN_CheckSubscriptionPipe()... */
-    /* ...RcvMsg() should succeed */
-    CFE_SB_SingleSubscriptionTlm_t SubRprt, *SubRprtPtr;
-    SubRprtPtr = &SubRprt;
-    memset(SubRprtPtr, 0, sizeof(SubRprt));
-    SubRprt.Payload.SubType = CFE_SB_SUBSCRIPTION;
-    SubRprt.Payload.MsgId   = MsgID;
-    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
-
-    /* ...GetMsgId() -> sub msg */
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
-
-    /* WaitForSBStartup()... */
-    /* ...CFE_SB_ReceiveBuffer() should succeed */
-    CFE_EVS_LongEventTlm_t EvtMsg, *EvtMsgPtr;
-    EvtMsgPtr = &EvtMsg;
-    memset(EvtMsgPtr, 0, sizeof(EvtMsg));
-    strcpy(EvtMsg.Payload.PacketID.AppName, "CFE_SB");
-    EvtMsg.Payload.PacketID.EventID = CFE_SB_INIT_EID;
-    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &EvtMsgPtr, sizeof(EvtMsgPtr), false);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
-
-    /* ...GetMsgId() -> event msg */
-    mid = CFE_EVS_LONG_EVENT_MSG_MID;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Unsubscribe), 1, CFE_SB_BAD_ARGUMENT); /* fail out of WaitForSBStartup() */
-
-    SBN_AppMain();
-
-    EVENT_CNT(1);
-} /* end SBStart_UnsubErr() */
-
-static void SBStart_RcvMsgSucc(void)
+static void AppMain_WaitOperational(void)
 {
     START();
 
-    /* call to SBN_CheckSubscriptionPipe should fail, giving us the event we are looking for */
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_PIPE_RD_ERR); /* sub pipe err */
-
-    /* ...CFE_SB_ReceiveBuffer() should succeed */
-    CFE_EVS_LongEventTlm_t EvtMsg, *EvtMsgPtr;
-    EvtMsgPtr = &EvtMsg;
-    memset(EvtMsgPtr, 0, sizeof(EvtMsg));
-    strcpy(EvtMsg.Payload.PacketID.AppName, "CFE_SB");
-    EvtMsg.Payload.PacketID.EventID = CFE_SB_INIT_EID;
-    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &EvtMsgPtr, sizeof(EvtMsgPtr), false);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
-
-    /* ...GetMsgId() -> event msg */
-    CFE_SB_MsgId_t mid = CFE_EVS_LONG_EVENT_MSG_MID;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
+    UT_CheckEvent_Setup(SBN_INIT_EID, "SBN initialized.");
 
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Unsubscribe), 1, CFE_SB_BAD_ARGUMENT); /* fail out of WaitForSBStartup() */
-
-    SBN_AppMain();
-} /* end SBStart_RcvMsgSucc() */
-
-static void SBStart_DelPipeErr(void)
-{
-    START();
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
-
-    /* SBN_CheckSubscriptionPipe() ...*/
-    /* ...RcvMsg() should succeed */
-    CFE_SB_SingleSubscriptionTlm_t SubRprt, *SubRprtPtr;
-    SubRprtPtr = &SubRprt;
-    memset(SubRprtPtr, 0, sizeof(SubRprt));
-    SubRprt.Payload.SubType = CFE_SB_SUBSCRIPTION;
-    SubRprt.Payload.MsgId   = MsgID;
-    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
-    /* ...GetMsgId() -> sub msg */
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
-
-    /* WaitForSBStartup()...*/
-    /* ...CFE_SB_ReceiveBuffer() should succeed */
-    CFE_EVS_LongEventTlm_t EvtMsg, *EvtMsgPtr;
-    EvtMsgPtr = &EvtMsg;
-    memset(EvtMsgPtr, 0, sizeof(EvtMsg));
-    strcpy(EvtMsg.Payload.PacketID.AppName, "CFE_SB");
-    EvtMsg.Payload.PacketID.EventID = CFE_SB_INIT_EID;
-    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &EvtMsgPtr, sizeof(EvtMsgPtr), false);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
-
-    /* ...GetMsgId() -> event msg */
-    mid = CFE_EVS_LONG_EVENT_MSG_MID;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_DeletePipe), 1, CFE_SB_BAD_ARGUMENT);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_WaitForSystemState), 1, CFE_ES_OPERATION_TIMED_OUT);
 
     SBN_AppMain();
 
+    UtAssert_STUB_COUNT(CFE_ES_WaitForSystemState, 2);
     EVENT_CNT(1);
-} /* end SBStart_DelPipeErr() */
-
-static void Test_SBStart(void)
-{
-    SBStart_CrPipeErr();
-    SBStart_SubErr();
-    SBStart_RcvMsgErr();
-    SBStart_UnsubErr();
-    SBStart_RcvMsgSucc();
-    SBStart_DelPipeErr();
-} /* end Test_SBStart() */
+} /* end AppMain_WaitOperational() */
 
 static void W4W_NoMsg(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_INIT_EID, "unable to delete event pipe");
-
     /* CFE_SB_ReceiveBuffer() in SBN_CheckSubscriptionPipe() should succeed */
     CFE_SB_SingleSubscriptionTlm_t SubRprt, *SubRprtPtr;
     SubRprtPtr = &SubRprt;
@@ -665,7 +482,7 @@ static void W4W_NoMsg(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -703,7 +520,7 @@ static void CheckPP_SendTask(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -737,7 +554,7 @@ static void CheckPP_SendTaskErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -771,7 +588,7 @@ static void CheckPP_RecvErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -819,7 +636,7 @@ static void CheckPP_FilterEmpty(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -861,7 +678,7 @@ static void CheckPP_FilterErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -903,7 +720,7 @@ static void CheckPP_Nominal(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -929,7 +746,7 @@ static void W4W_RcvMsgErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -963,7 +780,7 @@ static void PeerPoll_RecvNetTask_ChildTaskErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -1003,7 +820,7 @@ static void PeerPoll_RecvNetTask_Nominal(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -1044,7 +861,7 @@ static void PeerPoll_RecvPeerTask_ChildTaskErr(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -1096,7 +913,7 @@ static void PeerPoll_RecvPeerTask_Nominal(void)
     OS_TaskCreate(&PeerPtr->RecvTaskID, "coverage", test_osal_task_entry, NULL, 0, 0, 0);
     /* PeerPtr->RecvTaskID = STUB_TASKID; */
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
@@ -1113,6 +930,44 @@ static void PeerPoll_RecvPeerTask_Nominal(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
 } /* end PeerPoll_RecvPeerTask() */
 
+static SBN_Status_t AddRecvFds_Nominal(SBN_NetInterface_t *Net, OS_FdSet *FdSet)
+{
+    return SBN_SUCCESS;
+} /* end AddRecvFds_Nominal() */
+
+static void PeerPoll_RecvPollTask_Backoff(void)
+{
+    int i = 0;
+
+    START();
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), -1);
+
+    SBN.NetCnt          = 0;
+    SBN.Nets[0].PeerCnt = 0;
+
+    IfOpsPtr->AddRecvFds = AddRecvFds_Nominal;
+
+    /* go through main loop ten times */
+    for (i = 0; i < 10; i++)
+    {
+        UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, 1);
+    } /* end for */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, 0);
+
+    SBN_AppMain();
+
+    /* tried on wakeups 1, 3 and 6, waiting one, two and then four wakeups */
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 3);
+    UtAssert_UINT32_EQ(SBN.RecvPollRetryBackoff, 4);
+    UtAssert_UINT32_EQ(SBN.RecvPollRetryWait, 0);
+
+    IfOpsPtr->AddRecvFds = NULL;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
+} /* end PeerPoll_RecvPollTask_Backoff() */
+
 static void Test_WaitForWakeup(void)
 {
     W4W_NoMsg();
@@ -1127,6 +982,7 @@ static void Test_WaitForWakeup(void)
     PeerPoll_RecvNetTask_Nominal();
     PeerPoll_RecvPeerTask_ChildTaskErr();
     PeerPoll_RecvPeerTask_Nominal();
+    PeerPoll_RecvPollTask_Backoff();
 } /* end Test_SBStart() */
 
 static void AppMain_Nominal(void)
@@ -1144,22 +1000,10 @@ static void AppMain_Nominal(void)
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &SubRprtPtr, sizeof(SubRprtPtr), false);
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     /* SBN_CheckSubscriptionPipe should succeed to return a sub msg */
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
 
-    /* CFE_SB_ReceiveBuffer() in WaitForSBStartup() should succeed */
-    CFE_EVS_LongEventTlm_t EvtMsg, *EvtMsgPtr;
-    EvtMsgPtr = &EvtMsg;
-    memset(EvtMsgPtr, 0, sizeof(EvtMsg));
-    strcpy(EvtMsg.Payload.PacketID.AppName, "CFE_SB");
-    EvtMsg.Payload.PacketID.EventID = CFE_SB_INIT_EID;
-    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &EvtMsgPtr, sizeof(EvtMsgPtr), false);
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
-
-    mid = CFE_EVS_LONG_EVENT_MSG_MID;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), true);
-
     /* go through main loop once */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, 1);
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, 0);
@@ -1171,7 +1015,6 @@ static void AppMain_Nominal(void)
 
 static void Test_SBN_AppMain(void)
 {
-    AppMain_ESRegisterErr();
     AppMain_EVSRegisterErr();
     AppMain_AppIdErr();
     AppMain_TaskInfoErr();
@@ -1193,7 +1036,7 @@ static void Test_SBN_AppMain(void)
 
     AppMain_CmdPipeSubErr();
 
-    Test_SBStart();
+    AppMain_WaitOperational();
 
     Test_WaitForWakeup();
 
@@ -1204,9 +1047,9 @@ static void ProcessNetMsg_PeerErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEERTASK_EID, "unknown peer (ProcessorID=");
+    UT_CheckEvent_Setup(SBN_PEERTASK_EID, "ERROR: could not process peer message: unknown peer (ProcessorID=");
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_PROTO_MSG, ProcessorID + 1, 0, NULL), SBN_ERROR);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_PROTO_MSG, ProcessorID + 1, SpacecraftID, 0, NULL), SBN_ERROR);
 
     EVENT_CNT(1);
 } /* ProcessNetMsg_PeerErr() */
@@ -1215,11 +1058,11 @@ static void ProcessNetMsg_ProtoMsg_VerErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_SB_EID, "SBN protocol version mismatch with ProcessorID ");
+    UT_CheckEvent_Setup(SBN_SB_EID, "ERROR: could not process peer message: SBN protocol version mismatch with peer ");
 
     uint8 ver = SBN_PROTO_VER + 1;
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_PROTO_MSG, ProcessorID, sizeof(ver), &ver), SBN_SUCCESS);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_PROTO_MSG, ProcessorID, SpacecraftID, sizeof(ver), &ver), SBN_SUCCESS);
 
     EVENT_CNT(1);
 } /* end ProcessNetMsg_ProtoMsg_VerErr() */
@@ -1228,11 +1071,11 @@ static void ProcessNetMsg_ProtoMsg_Nominal(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_SB_EID, "SBN protocol version match with ProcessorID ");
+    UT_CheckEvent_Setup(SBN_SB_EID, "SBN protocol version match with peer ");
 
     uint8 ver = SBN_PROTO_VER;
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_PROTO_MSG, ProcessorID, sizeof(ver), &ver), SBN_SUCCESS);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_PROTO_MSG, ProcessorID, SpacecraftID, sizeof(ver), &ver), SBN_SUCCESS);
 
     EVENT_CNT(1);
 } /* end ProcessNetMsg_ProtoMsg_Nominal() */
@@ -1256,7 +1099,7 @@ static void ProcessNetMsg_AppMsg_FiltErr(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetProcessorId), 1, ProcessorID);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetSpacecraftId), 1, SpacecraftID);
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_APP_MSG, ProcessorID, 0, NULL), SBN_ERROR);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_APP_MSG, ProcessorID, SpacecraftID, 0, NULL), SBN_ERROR);
 } /* end ProcessNetMsg_AppMsg_FiltErr() */
 
 static SBN_Status_t RecvFilter_Out(void *Data, SBN_Filter_Ctx_t *CtxPtr)
@@ -1280,7 +1123,7 @@ static void ProcessNetMsg_AppMsg_FiltOut(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetProcessorId), 1, ProcessorID);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetSpacecraftId), 1, SpacecraftID);
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_APP_MSG, ProcessorID, 0, NULL), SBN_IF_EMPTY);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_APP_MSG, ProcessorID, SpacecraftID, 0, NULL), SBN_IF_EMPTY);
 } /* end ProcessNetMsg_AppMsg_FiltOut() */
 
 static SBN_Status_t RecvFilter_Nominal(void *Data, SBN_Filter_Ctx_t *CtxPtr)
@@ -1292,14 +1135,14 @@ static void ProcessNetMsg_AppMsg_PassMsgErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_SB_EID, "CFE_SB_PassMsg error (Status=");
+    UT_CheckEvent_Setup(SBN_SB_EID, "ERROR: could not process peer message: CFE_SB_PassMsg error (Status=");
 
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetProcessorId), 1, ProcessorID);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetSpacecraftId), 1, SpacecraftID);
 
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_TransmitMsg), 1, -1);
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_APP_MSG, ProcessorID, 0, NULL), SBN_ERROR);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_APP_MSG, ProcessorID, SpacecraftID, 0, NULL), SBN_ERROR);
 
     EVENT_CNT(1);
 } /* end ProcessNetMsg_AppMsg_PassMsgErr() */
@@ -1321,7 +1164,7 @@ static void ProcessNetMsg_AppMsg_Nominal(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetProcessorId), 1, ProcessorID);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetSpacecraftId), 1, SpacecraftID);
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_APP_MSG, ProcessorID, 0, NULL), SBN_SUCCESS);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_APP_MSG, ProcessorID, SpacecraftID, 0, NULL), SBN_SUCCESS);
 } /* end ProcessNetMsg_AppMsg_Nominal() */
 
 static void ProcessNetMsg_SubMsg_Nominal(void)
@@ -1340,8 +1183,8 @@ static void ProcessNetMsg_SubMsg_Nominal(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetProcessorId), 1, ProcessorID);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetSpacecraftId), 1, SpacecraftID);
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_SUB_MSG, ProcessorID, sizeof(Buf), &Buf), SBN_SUCCESS);
-    UtAssert_INT32_EQ(PeerPtr->Subs[0].MsgID, MsgID);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_SUB_MSG, ProcessorID, SpacecraftID, sizeof(Buf), &Buf), SBN_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(PeerPtr->Subs[0].MsgID), CFE_SB_MsgIdToValue(MsgID));
 } /* end ProcessNetMsg_SubMsg_Nominal() */
 
 static void ProcessNetMsg_UnSubMsg_Nominal(void)
@@ -1361,10 +1204,10 @@ static void ProcessNetMsg_UnSubMsg_Nominal(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetProcessorId), 1, ProcessorID);
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_GetSpacecraftId), 1, SpacecraftID);
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_SUB_MSG, ProcessorID, sizeof(Buf), &Buf), SBN_SUCCESS);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_SUB_MSG, ProcessorID, SpacecraftID, sizeof(Buf), &Buf), SBN_SUCCESS);
     UtAssert_INT32_EQ(PeerPtr->SubCnt, 1);
-    UtAssert_INT32_EQ(PeerPtr->Subs[0].MsgID, MsgID);
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_UNSUB_MSG, ProcessorID, sizeof(Buf), &Buf), SBN_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(PeerPtr->Subs[0].MsgID), CFE_SB_MsgIdToValue(MsgID));
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_UNSUB_MSG, ProcessorID, SpacecraftID, sizeof(Buf), &Buf), SBN_SUCCESS);
     UtAssert_INT32_EQ(PeerPtr->SubCnt, 0);
 } /* end ProcessNetMsg_UnSubMsg_Nominal() */
 
@@ -1372,7 +1215,7 @@ static void ProcessNetMsg_NoMsg_Nominal(void)
 {
     START();
 
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_NO_MSG, ProcessorID, 0, NULL), SBN_SUCCESS);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_NO_MSG, ProcessorID, SpacecraftID, 0, NULL), SBN_SUCCESS);
 } /* end ProcessNetMsg_NoMsg_Nominal() */
 
 static void ProcessNetMsg_MsgErr(void)
@@ -1380,7 +1223,7 @@ static void ProcessNetMsg_MsgErr(void)
     START();
 
     /* send a net message of an invalid type */
-    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_NO_MSG + 100, ProcessorID, 0, NULL), SBN_ERROR);
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_NO_MSG + 100, ProcessorID, SpacecraftID, 0, NULL), SBN_ERROR);
 } /* end ProcessNetMsg_MsgErr() */
 
 static void Test_SBN_ProcessNetMsg(void)
@@ -1403,7 +1246,7 @@ static void Connected_AlreadyErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEER_EID, "CPU 1234 already connected");
+    UT_CheckEvent_Setup(SBN_PEER_EID, "ERROR: could not connect peer: peer 5678:1234 already connected");
 
     PeerPtr->Connected = 1;
 
@@ -1416,7 +1259,7 @@ static void Connected_PipeOptErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEER_EID, "failed to set pipe options '");
+    UT_CheckEvent_Setup(SBN_PEER_EID, "ERROR: could not connect peer: could not set pipe options '");
 
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_SetPipeOpts), 1, -1);
 
@@ -1439,7 +1282,7 @@ static void Connected_CrPipeErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEER_EID, "failed to create pipe '");
+    UT_CheckEvent_Setup(SBN_PEER_EID, "ERROR: could not connect peer: could not create peer pipe '");
 
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, -1);
 
@@ -1469,7 +1312,7 @@ static void Disconnected_ConnErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEER_EID, "CPU 1234 not connected");
+    UT_CheckEvent_Setup(SBN_PEER_EID, "ERROR: could not disconnect peer: already not connected to peer 5678:1234");
 
     SBN_PeerInterface_t *PeerPtr = &SBN.Nets[0].Peers[0];
 
@@ -1483,7 +1326,7 @@ static void Disconnected_Nominal(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEER_EID, "CPU 1234 disconnected");
+    UT_CheckEvent_Setup(SBN_PEER_EID, "Disconnected from peer 5678:1234.");
 
     SBN_PeerInterface_t *PeerPtr = &SBN.Nets[0].Peers[0];
 
@@ -1495,10 +1338,54 @@ static void Disconnected_Nominal(void)
     EVENT_CNT(1);
 } /* end Disconnected_Nominal() */
 
+static void Disconnected_SendTask(void)
+{
+    START();
+
+    SBN_PeerInterface_t *PeerPtr = &SBN.Nets[0].Peers[0];
+
+    PeerPtr->ProcessorID = ProcessorID;
+    PeerPtr->Connected   = 1;
+    PeerPtr->FramesOK    = true;
+    PeerPtr->FrameSz     = 10;
+    PeerPtr->FrameMsgCnt = 1;
+    OS_TaskCreate(&PeerPtr->SendTaskID, "coverage", test_osal_task_entry, NULL, 0, 0, 0);
+
+    UtAssert_INT32_EQ(SBN_Disconnected(PeerPtr), SBN_SUCCESS);
+
+    /* the frame is dropped while holding the mutex the send task flushes under */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_INT32_EQ(PeerPtr->FramesOK, false);
+    UtAssert_INT32_EQ(PeerPtr->FrameSz, 0);
+    UtAssert_INT32_EQ(PeerPtr->FrameMsgCnt, 0);
+} /* end Disconnected_SendTask() */
+
+static void Disconnected_MutexTakeErr(void)
+{
+    START();
+
+    UT_CheckEvent_Setup(SBN_PEER_EID, "unable to take send mutex");
+
+    SBN_PeerInterface_t *PeerPtr = &SBN.Nets[0].Peers[0];
+
+    PeerPtr->ProcessorID = ProcessorID;
+    PeerPtr->Connected   = 1;
+    PeerPtr->FrameMsgCnt = 1;
+    OS_TaskCreate(&PeerPtr->SendTaskID, "coverage", test_osal_task_entry, NULL, 0, 0, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, -1);
+
+    UtAssert_INT32_EQ(SBN_Disconnected(PeerPtr), SBN_ERROR);
+    UtAssert_INT32_EQ(PeerPtr->FrameMsgCnt, 1);
+    EVENT_CNT(1);
+} /* end Disconnected_MutexTakeErr() */
+
 static void Test_SBN_Disconnected(void)
 {
     Disconnected_ConnErr();
     Disconnected_Nominal();
+    Disconnected_SendTask();
+    Disconnected_MutexTakeErr();
 } /* end Test_SBN_Disconnected() */
 
 static SBN_Status_t UnloadNet_Err(SBN_NetInterface_t *Net)
@@ -1586,26 +1473,29 @@ static void Unpack_Empty(void)
 {
     START();
 
-    uint8             Buf[SBN_MAX_PACKED_MSG_SZ] = {0}, Payload[1] = {0};
-    SBN_MsgSz_t       MsgSz;
-    SBN_MsgType_t     MsgType;
-    CFE_ProcessorID_t ProcID;
+    uint8              Buf[SBN_MAX_PACKED_MSG_SZ] = {0}, Payload[1] = {0};
+    SBN_MsgSz_t        MsgSz;
+    SBN_MsgType_t      MsgType;
+    CFE_ProcessorID_t  ProcID;
+    CFE_SpacecraftID_t ScID;
 
-    SBN_PackMsg(Buf, 0, SBN_APP_MSG, ProcessorID, NULL);
-    UtAssert_True(SBN_UnpackMsg(Buf, &MsgSz, &MsgType, &ProcID, Payload), "unpack of an empty pack");
+    SBN_PackMsg(Buf, 0, SBN_APP_MSG, ProcessorID, SpacecraftID, NULL);
+    UtAssert_True(SBN_UnpackMsg(Buf, &MsgSz, &MsgType, &ProcID, &ScID, Payload), "unpack of an empty pack");
     UtAssert_INT32_EQ(MsgSz, 0);
     UtAssert_INT32_EQ(MsgType, SBN_APP_MSG);
     UtAssert_INT32_EQ(ProcID, ProcessorID);
+    UtAssert_INT32_EQ(ScID, SpacecraftID);
 } /* end Unpack_Empty() */
 
 static void Unpack_Err(void)
 {
     START();
 
-    uint8             Buf[SBN_MAX_PACKED_MSG_SZ] = {0}, Payload[1] = {0};
-    SBN_MsgSz_t       MsgSz;
-    SBN_MsgType_t     MsgType;
-    CFE_ProcessorID_t ProcID;
+    uint8              Buf[SBN_MAX_PACKED_MSG_SZ] = {0}, Payload[1] = {0};
+    SBN_MsgSz_t        MsgSz;
+    SBN_MsgType_t      MsgType;
+    CFE_ProcessorID_t  ProcID;
+    CFE_SpacecraftID_t ScID;
 
     Pack_t Pack;
     Pack_Init(&Pack, Buf, SBN_MAX_PACKED_MSG_SZ + SBN_PACKED_HDR_SZ, 0);
@@ -1613,26 +1503,28 @@ static void Unpack_Err(void)
     Pack_UInt8(&Pack, SBN_APP_MSG);
     Pack_UInt32(&Pack, ProcessorID);
 
-    UtAssert_True(!SBN_UnpackMsg(Buf, &MsgSz, &MsgType, &ProcID, Payload), "unpack of invalid pack");
+    UtAssert_True(!SBN_UnpackMsg(Buf, &MsgSz, &MsgType, &ProcID, &ScID, Payload), "unpack of invalid pack");
 } /* end Unpack_Err() */
 
 static void Unpack_Nominal(void)
 {
     START();
 
-    uint8             Buf[SBN_MAX_PACKED_MSG_SZ] = {0}, Payload[1] = {0};
-    uint8             TestData = 123;
-    SBN_MsgSz_t       MsgSz;
-    SBN_MsgType_t     MsgType;
-    CFE_ProcessorID_t ProcID;
+    uint8              Buf[SBN_MAX_PACKED_MSG_SZ] = {0}, Payload[1] = {0};
+    uint8              TestData = 123;
+    SBN_MsgSz_t        MsgSz;
+    SBN_MsgType_t      MsgType;
+    CFE_ProcessorID_t  ProcID;
+    CFE_SpacecraftID_t ScID;
 
-    SBN_PackMsg(Buf, 1, SBN_APP_MSG, ProcessorID, &TestData);
+    SBN_PackMsg(Buf, 1, SBN_APP_MSG, ProcessorID, SpacecraftID, &TestData);
 
-    UtAssert_True(SBN_UnpackMsg(Buf, &MsgSz, &MsgType, &ProcID, Payload), "unpack of a pack");
+    UtAssert_True(SBN_UnpackMsg(Buf, &MsgSz, &MsgType, &ProcID, &ScID, Payload), "unpack of a pack");
 
     UtAssert_INT32_EQ(MsgSz, 1);
     UtAssert_INT32_EQ(MsgType, SBN_APP_MSG);
     UtAssert_INT32_EQ(ProcID, ProcessorID);
+    UtAssert_INT32_EQ(ScID, SpacecraftID);
     UtAssert_INT32_EQ((int32)TestData, (int32)Payload[0]);
 } /* end Unpack_Nominal() */
 
@@ -1653,9 +1545,11 @@ void RecvNetMsgs_TaskRecv(void)
 } /* end RecvNetMsgs_TaskRecv() */
 
 static SBN_Status_t RecvFromNet_Empty(SBN_NetInterface_t *Net, SBN_MsgType_t *MsgTypePtr, SBN_MsgSz_t *MsgSzPtr,
-                                      CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer)
+                                      CFE_ProcessorID_t *ProcessorIDPtr,
+                                      CFE_SpacecraftID_t *SpacecraftIDPtr, void *PayloadBuffer)
 {
-    *ProcessorIDPtr = 1235;
+    *ProcessorIDPtr  = 1235;
+    *SpacecraftIDPtr = SpacecraftID;
 
     return SBN_IF_EMPTY;
 } /* end RecvFromNet_Empty() */
@@ -1701,6 +1595,59 @@ void RecvNetMsgs_NoRecv(void)
     EVENT_CNT(1);
 } /* end RecvNetMsgs_NoRecv() */
 
+static int RecvFromNet_Cnt = 0;
+
+static SBN_Status_t RecvFromNet_Count(SBN_NetInterface_t *Net, SBN_MsgType_t *MsgTypePtr, SBN_MsgSz_t *MsgSzPtr,
+                                      CFE_ProcessorID_t *ProcessorIDPtr,
+                                      CFE_SpacecraftID_t *SpacecraftIDPtr, void *PayloadBuffer)
+{
+    RecvFromNet_Cnt++;
+
+    return SBN_IF_EMPTY;
+} /* end RecvFromNet_Count() */
+
+void RecvNetMsgs_PollTask(void)
+{
+    START();
+
+    IfOpsPtr->RecvFromNet = RecvFromNet_Count;
+    IfOpsPtr->AddRecvFds  = AddRecvFds_Nominal;
+    RecvFromNet_Cnt       = 0;
+
+    /* left to the receive poll task while it runs */
+    SBN.RecvPollTaskID = 1;
+    UtAssert_INT32_EQ(SBN_RecvNetMsgs(), SBN_SUCCESS);
+    UtAssert_INT32_EQ(RecvFromNet_Cnt, 0);
+
+    /* received by the main loop again once it is gone */
+    SBN.RecvPollTaskID = 0;
+    UtAssert_INT32_EQ(SBN_RecvNetMsgs(), SBN_SUCCESS);
+    UtAssert_INT32_EQ(RecvFromNet_Cnt, 1);
+
+    IfOpsPtr->RecvFromNet = RecvFromNet_Nominal;
+    IfOpsPtr->AddRecvFds  = NULL;
+} /* end RecvNetMsgs_PollTask() */
+
+void RecvNetMsgs_PollTaskYield(void)
+{
+    START();
+
+    IfOpsPtr->AddRecvFds = AddRecvFds_Nominal;
+    SBN.RecvPollTaskID   = 1;
+
+    /* the first pass receives, the second cannot start */
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 2, -1);
+
+    SBN_RecvPollTask();
+
+    /* sleeps between passes rather than going straight back for the mutex */
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(OS_SelectMultiple, 0);
+    UtAssert_INT32_EQ(SBN.RecvPollTaskID, 0);
+
+    IfOpsPtr->AddRecvFds = NULL;
+} /* end RecvNetMsgs_PollTaskYield() */
+
 void RecvNetMsgs_Nominal(void)
 {
     START();
@@ -1714,22 +1661,11 @@ void Test_SBN_RecvNetMsgs(void)
     RecvNetMsgs_TaskRecv();
     RecvNetMsgs_PeerRecv();
     RecvNetMsgs_NoRecv();
+    RecvNetMsgs_PollTask();
+    RecvNetMsgs_PollTaskYield();
     RecvNetMsgs_Nominal();
 } /* end Test_SBN_RecvNetMsgs() */
 
-static void RecvPeerTask_RegChildErr(void)
-{
-    START();
-
-    UT_CheckEvent_Setup(SBN_PEERTASK_EID, "unable to register child task");
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterChildTask), 1, -1);
-
-    SBN_RecvPeerTask();
-
-    EVENT_CNT(1);
-} /* end RecvPeerTask_RegChildErr() */
-
 static void RecvPeerTask_NetConfErr(void)
 {
     START();
@@ -1744,7 +1680,8 @@ static void RecvPeerTask_NetConfErr(void)
 } /* end RecvPeerTask_NetConfErr() */
 
 static SBN_Status_t RecvFromPeer_EmptyOne(SBN_NetInterface_t *Net, SBN_PeerInterface_t *Peer, SBN_MsgType_t *MsgTypePtr,
-                                          SBN_MsgSz_t *MsgSzPtr, CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer)
+                                          SBN_MsgSz_t *MsgSzPtr, CFE_ProcessorID_t *ProcessorIDPtr,
+                                          CFE_SpacecraftID_t *SpacecraftIDPtr, void *PayloadBuffer)
 {
     static int c = 0;
 
@@ -1769,7 +1706,8 @@ static void RecvPeerTask_Empty(void)
 } /* end RecvPeerTask_Empty() */
 
 static SBN_Status_t RecvFromPeer_One(SBN_NetInterface_t *Net, SBN_PeerInterface_t *Peer, SBN_MsgType_t *MsgTypePtr,
-                                     SBN_MsgSz_t *MsgSzPtr, CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer)
+                                     SBN_MsgSz_t *MsgSzPtr, CFE_ProcessorID_t *ProcessorIDPtr,
+                                     CFE_SpacecraftID_t *SpacecraftIDPtr, void *PayloadBuffer)
 {
     static int c = 0;
 
@@ -1795,30 +1733,16 @@ static void RecvPeerTask_Nominal(void)
 
 static void Test_SBN_RecvPeerTask(void)
 {
-    RecvPeerTask_RegChildErr();
     RecvPeerTask_NetConfErr();
     RecvPeerTask_Empty();
     RecvPeerTask_Nominal();
 } /* end Test_SBN_RecvPeerTask() */
 
-static void RecvNetTask_RegChildErr(void)
-{
-    START();
-
-    UT_CheckEvent_Setup(SBN_PEERTASK_EID, "unable to register child task");
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterChildTask), 1, -1);
-
-    SBN_RecvNetTask();
-
-    EVENT_CNT(1);
-} /* end RecvNetTask_RegChildErr() */
-
 static void RecvNetTask_NetConfErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEERTASK_EID, "unable to connect task to net struct");
+    UT_CheckEvent_Setup(SBN_PEERTASK_EID, "ERROR: could not start SBN Receive Net Task: unable to connect task to net struct");
 
     NetPtr->Configured = false;
 
@@ -1828,7 +1752,8 @@ static void RecvNetTask_NetConfErr(void)
 } /* end RecvNetTask_NetConfErr() */
 
 static SBN_Status_t RecvFromNet_EmptyOne(SBN_NetInterface_t *Net, SBN_MsgType_t *MsgTypePtr, SBN_MsgSz_t *MsgSzPtr,
-                                         CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer)
+                                         CFE_ProcessorID_t *ProcessorIDPtr,
+                                         CFE_SpacecraftID_t *SpacecraftIDPtr, void *PayloadBuffer)
 {
     static int c = 0;
 
@@ -1851,9 +1776,11 @@ static void RecvNetTask_Empty(void)
 } /* end RecvNetTask_Empty() */
 
 static SBN_Status_t RecvFromNet_BadPeer(SBN_NetInterface_t *Net, SBN_MsgType_t *MsgTypePtr, SBN_MsgSz_t *MsgSzPtr,
-                                        CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer)
+                                        CFE_ProcessorID_t *ProcessorIDPtr,
+                                        CFE_SpacecraftID_t *SpacecraftIDPtr, void *PayloadBuffer)
 {
-    *ProcessorIDPtr = 0;
+    *ProcessorIDPtr  = 0;
+    *SpacecraftIDPtr = SpacecraftID;
 
     return SBN_SUCCESS;
 } /* end RecvFromNet_BadPeer() */
@@ -1876,14 +1803,16 @@ static void RecvNetTask_PeerErr(void)
 } /* end RecvNetTask_PeerErr() */
 
 static SBN_Status_t RecvFromNet_One(SBN_NetInterface_t *Net, SBN_MsgType_t *MsgTypePtr, SBN_MsgSz_t *MsgSzPtr,
-                                    CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer)
+                                    CFE_ProcessorID_t *ProcessorIDPtr,
+                                    CFE_SpacecraftID_t *SpacecraftIDPtr, void *PayloadBuffer)
 {
     static int c = 0;
 
     if (c++ == 0)
     {
         *MsgTypePtr     = SBN_NO_MSG + 10; /* bogus type */
-        *ProcessorIDPtr = 1234;
+        *ProcessorIDPtr  = 1234;
+        *SpacecraftIDPtr = SpacecraftID;
         return SBN_SUCCESS;
     } /* end if */
     return SBN_ERROR;
@@ -1904,26 +1833,12 @@ static void RecvNetTask_Nominal(void)
 
 static void Test_SBN_RecvNetTask(void)
 {
-    RecvNetTask_RegChildErr();
     RecvNetTask_NetConfErr();
     RecvNetTask_Empty();
     RecvNetTask_PeerErr();
     RecvNetTask_Nominal();
 } /* end Test_SBN_RecvNetTask() */
 
-static void SendTask_RegChildErr(void)
-{
-    START();
-
-    UT_CheckEvent_Setup(SBN_PEERTASK_EID, "unable to register child task");
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterChildTask), 1, -1);
-
-    SBN_SendTask();
-
-    EVENT_CNT(1);
-} /* end SendTask_RegChildErr() */
-
 static void SendTask_ConnTaskErr(void)
 {
     START();
@@ -1940,7 +1855,7 @@ static void SendTask_ConnTaskErr(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
 } /* end SendTask_ConnTaskErr() */
 
-static int32 TaskDelayConn(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+static int32 WakeConn(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
 {
     static int c = 0;
 
@@ -1963,7 +1878,7 @@ static void SendTask_PeerNotConn(void)
 
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, -1);
 
-    UT_SetHookFunction(UT_KEY(OS_TaskDelay), TaskDelayConn, NULL);
+    UT_SetHookFunction(UT_KEY(OS_BinSemTimedWait), WakeConn, NULL);
 
     SBN_SendTask();
 
@@ -2032,9 +1947,11 @@ static void SendTask_Filters(void)
 
 static void SendTask_SendNetMsgErr(void)
 {
+    CFE_MSG_Size_t MsgSz = sizeof(CFE_MSG_Message_t);
+
     START();
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSz, sizeof(MsgSz), false);
 
     PeerPtr->Connected  = true;
     OS_TaskCreate(&PeerPtr->SendTaskID, "coverage", test_osal_task_entry, NULL, 0, 0, 0);
@@ -2043,11 +1960,10 @@ static void SendTask_SendNetMsgErr(void)
 
     SBN_SendTask();
 
-    UtAssert_INT32_EQ(PeerPtr->SendTaskID, OS_TaskGetId());
+    /* the task gives up the peer, to be started again */
+    UtAssert_INT32_EQ(PeerPtr->SendTaskID, 0);
 
     IfOpsPtr->Send = Send_Nominal;
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
 } /* end SendTask_SendNetMsgErr() */
 
 static void SendTask_Nominal(void)
@@ -2068,7 +1984,6 @@ static void SendTask_Nominal(void)
 
 static void Test_SBN_SendTask(void)
 {
-    SendTask_RegChildErr();
     SendTask_ConnTaskErr();
     SendTask_PeerNotConn();
     SendTask_FiltErr();
@@ -2081,7 +1996,7 @@ void SendNetMsg_MutexTakeErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEER_EID, "unable to take mutex");
+    UT_CheckEvent_Setup(SBN_PEER_EID, "unable to take send mutex");
 
     OS_TaskCreate(&PeerPtr->SendTaskID, "coverage", test_osal_task_entry, NULL, 0, 0, 0);
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemTake), 1, -1);
@@ -2095,7 +2010,7 @@ void SendNetMsg_MutexGiveErr(void)
 {
     START();
 
-    UT_CheckEvent_Setup(SBN_PEER_EID, "unable to give mutex");
+    UT_CheckEvent_Setup(SBN_PEER_EID, "unable to give send mutex");
 
     OS_TaskCreate(&PeerPtr->SendTaskID, "coverage", test_osal_task_entry, NULL, 0, 0, 0);
     UT_SetDeferredRetcode(UT_KEY(OS_MutSemGive), 1, -1);
@@ -2129,6 +2044,135 @@ void Test_SBN_SendNetMsg(void)
     SendNetMsg_SendErr();
 } /* end Test_SBN_SendNetMsg() */
 
+static SBN_MsgType_t SentMsgType;
+static SBN_MsgSz_t   SentMsgSz;
+
+static SBN_Status_t Send_Record(SBN_PeerInterface_t *Peer, SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Payload)
+{
+    SentMsgType = MsgType;
+    SentMsgSz   = MsgSz;
+
+    return SBN_SUCCESS;
+} /* end Send_Record() */
+
+static void Frames_PackUnpack(void)
+{
+    START();
+
+    uint8         Frame[64], Data[5] = {1, 2, 3, 4, 5};
+    void *        Msg     = NULL;
+    SBN_MsgSz_t   FrameSz = 0, Offset = 0, MsgSz = 0;
+    SBN_MsgType_t MsgType = 0;
+
+    UtAssert_True(SBN_PackFrameRecord(Frame, &FrameSz, sizeof(Frame), sizeof(Data), SBN_APP_MSG, Data),
+                  "pack first record");
+    UtAssert_INT32_EQ(FrameSz, SBN_PACKED_RECORD_SZ(sizeof(Data)));
+    UtAssert_True(SBN_PackFrameRecord(Frame, &FrameSz, sizeof(Frame), 0, SBN_NO_MSG, NULL), "pack empty record");
+    UtAssert_True(!SBN_PackFrameRecord(Frame, &FrameSz, sizeof(Frame), sizeof(Frame), SBN_APP_MSG, Frame),
+                  "pack of a record that does not fit");
+
+    UtAssert_True(SBN_UnpackFrameRecord(Frame, FrameSz, &Offset, &MsgSz, &MsgType, &Msg), "unpack first record");
+    UtAssert_INT32_EQ(MsgSz, sizeof(Data));
+    UtAssert_INT32_EQ(MsgType, SBN_APP_MSG);
+    UtAssert_MemCmp(Msg, Data, sizeof(Data), "first record payload");
+    UtAssert_True(SBN_UnpackFrameRecord(Frame, FrameSz, &Offset, &MsgSz, &MsgType, &Msg), "unpack empty record");
+    UtAssert_INT32_EQ(MsgSz, 0);
+    UtAssert_INT32_EQ(MsgType, SBN_NO_MSG);
+    UtAssert_True(!SBN_UnpackFrameRecord(Frame, FrameSz, &Offset, &MsgSz, &MsgType, &Msg), "unpack at end of frame");
+    UtAssert_INT32_EQ(Offset, FrameSz);
+
+    /* a record claiming more than is left of the frame */
+    Offset = 0;
+    UtAssert_True(!SBN_UnpackFrameRecord(Frame, SBN_PACKED_RECORD_HDR_SZ + 1, &Offset, &MsgSz, &MsgType, &Msg),
+                  "unpack of a truncated record");
+    UtAssert_INT32_EQ(Offset, 0);
+} /* end Frames_PackUnpack() */
+
+static void Frames_ProcessNetMsg(void)
+{
+    START();
+
+    uint8       Frame[64], Data[8] = {0};
+    SBN_MsgSz_t FrameSz = 0;
+
+    SBN_PackFrameRecord(Frame, &FrameSz, sizeof(Frame), sizeof(Data), SBN_APP_MSG, Data);
+    SBN_PackFrameRecord(Frame, &FrameSz, sizeof(Frame), sizeof(Data), SBN_APP_MSG, Data);
+    SBN_PackFrameRecord(Frame, &FrameSz, sizeof(Frame), 0, SBN_NO_MSG, NULL);
+
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_FRAME_MSG, ProcessorID, SpacecraftID, FrameSz, Frame),
+                      SBN_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+
+    UT_CheckEvent_Setup(SBN_PEERTASK_EID, "ERROR: could not process peer frame: truncated record");
+
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_FRAME_MSG, ProcessorID, SpacecraftID, FrameSz - 1, Frame),
+                      SBN_ERROR);
+
+    EVENT_CNT(1);
+} /* end Frames_ProcessNetMsg() */
+
+static void Frames_ProtoMsg(void)
+{
+    START();
+
+    uint8 Proto[2] = {SBN_PROTO_VER, SBN_PROTO_CAP_FRAMES};
+
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_PROTO_MSG, ProcessorID, SpacecraftID, 1, Proto), SBN_SUCCESS);
+    UtAssert_True(!PeerPtr->FramesOK, "peer without capabilities does not get frames");
+
+    UtAssert_INT32_EQ(SBN_ProcessNetMsg(NetPtr, SBN_PROTO_MSG, ProcessorID, SpacecraftID, sizeof(Proto), Proto),
+                      SBN_SUCCESS);
+    UtAssert_True(PeerPtr->FramesOK, "peer offering frames gets frames");
+} /* end Frames_ProtoMsg() */
+
+static void Frames_Send(void)
+{
+    START();
+
+    uint8 Data[100] = {0};
+    int   i         = 0;
+
+    IfOpsPtr->Send    = Send_Record;
+    PeerPtr->FramesOK = true;
+    PeerPtr->SendCnt  = 0;
+
+    /* a single queued message goes out as itself */
+    UtAssert_INT32_EQ(SBN_SendFramedMsg(SBN_APP_MSG, sizeof(Data), Data, PeerPtr), SBN_SUCCESS);
+    UtAssert_INT32_EQ(PeerPtr->SendCnt, 0);
+    UtAssert_INT32_EQ(SBN_FlushFrame(PeerPtr), SBN_SUCCESS);
+    UtAssert_INT32_EQ(PeerPtr->SendCnt, 1);
+    UtAssert_INT32_EQ(SentMsgType, SBN_APP_MSG);
+    UtAssert_INT32_EQ(SentMsgSz, sizeof(Data));
+
+    /* fill a frame, the message that does not fit sends it */
+    for (i = 0; i < SBN_MAX_FRAME_PAYLOAD_SZ / SBN_PACKED_RECORD_SZ(sizeof(Data)); i++)
+    {
+        UtAssert_INT32_EQ(SBN_SendFramedMsg(SBN_APP_MSG, sizeof(Data), Data, PeerPtr), SBN_SUCCESS);
+    } /* end for */
+    UtAssert_INT32_EQ(PeerPtr->SendCnt, 1);
+    UtAssert_INT32_EQ(SBN_SendFramedMsg(SBN_APP_MSG, sizeof(Data), Data, PeerPtr), SBN_SUCCESS);
+    UtAssert_INT32_EQ(PeerPtr->SendCnt, 2);
+    UtAssert_INT32_EQ(SentMsgType, SBN_FRAME_MSG);
+    UtAssert_INT32_EQ(SentMsgSz, i * SBN_PACKED_RECORD_SZ(sizeof(Data)));
+    UtAssert_INT32_EQ(PeerPtr->FrameMsgCnt, 1);
+
+    /* messages to a peer that does not take frames are sent after what was gathered */
+    PeerPtr->FramesOK = false;
+    UtAssert_INT32_EQ(SBN_SendFramedMsg(SBN_APP_MSG, sizeof(Data), Data, PeerPtr), SBN_SUCCESS);
+    UtAssert_INT32_EQ(PeerPtr->SendCnt, 4);
+    UtAssert_INT32_EQ(PeerPtr->FrameMsgCnt, 0);
+
+    IfOpsPtr->Send = Send_Nominal;
+} /* end Frames_Send() */
+
+static void Test_SBN_Frames(void)
+{
+    Frames_PackUnpack();
+    Frames_ProcessNetMsg();
+    Frames_ProtoMsg();
+    Frames_Send();
+} /* end Test_SBN_Frames() */
+
 void UT_Setup(void) {} /* end UT_Setup() */
 
 void UT_TearDown(void) {} /* end UT_TearDown() */
@@ -2146,4 +2190,5 @@ void UtTest_Setup(void)
     ADD_TEST(SBN_RecvNetTask);
     ADD_TEST(SBN_SendTask);
     ADD_TEST(SBN_SendNetMsg);
+    ADD_TEST(SBN_Frames);
 }
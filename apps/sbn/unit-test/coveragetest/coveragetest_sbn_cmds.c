@@ -1,14 +1,14 @@
 #include "sbn_coveragetest_common.h"
 #include "sbn_app.h"
 #include "cfe_msgids.h"
-#include "cfe_sb_events.h"
+#include "cfe_sb_eventids.h"
 #include "sbn_pack.h"
 
 uint8 Buffer[1024];
 
 CFE_MSG_Message_t *CmdPktPtr = (CFE_MSG_Message_t *)Buffer;
 CFE_MSG_Size_t MsgSz = sizeof(CFE_MSG_CommandHeader_t);
-CFE_SB_MsgId_t MsgId = SBN_CMD_MID;
+CFE_SB_MsgId_t MsgId = CFE_SB_MSGID_WRAP_VALUE(SBN_CMD_MID);
 CFE_MSG_FcnCode_t FcnCode = SBN_NOOP_CC;
 
 #define MSGINIT() CFE_MSG_Init(CmdPktPtr, MsgId, MsgSz); UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false); UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSz, sizeof(MsgSz), false); UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false); UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
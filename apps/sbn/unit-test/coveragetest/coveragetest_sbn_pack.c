@@ -4,17 +4,19 @@
 
 uint8     Buf[22];
 Pack_t    Pack;
-OS_time_t Time = {0xa, 0xb};
+OS_time_t Time;
 
 void Test_Pack(void)
 {
+    Time = OS_TimeAssembleFromMicroseconds(0xa, 0xb);
+
     UtAssert_True(Pack_Init(&Pack, Buf, sizeof(Buf), true), "pack init");
     UtAssert_True(Pack_UInt8(&Pack, (uint8)1), "pack uint8");               // 1 byte
     UtAssert_True(Pack_UInt8(&Pack, (uint8)255), "pack uint8");             // 2 bytes
     UtAssert_True(Pack_UInt16(&Pack, (uint16)2), "pack uint16");            // 4 bytes
     UtAssert_True(Pack_Int16(&Pack, (int16)-2), "pack int16");              // 6 bytes
     UtAssert_True(Pack_UInt32(&Pack, (uint32)3), "pack uint32");            // 10 bytes
-    UtAssert_True(Pack_MsgID(&Pack, (CFE_SB_MsgId_t)0xdead), "pack msgid"); // 14 bytes
+    UtAssert_True(Pack_MsgID(&Pack, CFE_SB_ValueToMsgId(0xdead)), "pack msgid"); // 14 bytes
     UtAssert_True(Pack_Time(&Pack, Time), "pack time");                     // 22 bytes
     UtAssert_True(!Pack_Time(&Pack, Time), "pack time 2");                  // should fail, out of space
 
@@ -41,13 +43,12 @@ void Test_Pack(void)
 
     CFE_SB_MsgId_t MsgID;
     UtAssert_True(Unpack_MsgID(&Pack, &MsgID), "unpack msgid"); // 12 bytes
-    UtAssert_UINT32_EQ(MsgID, 0xdead);
+    UtAssert_UINT32_EQ(CFE_SB_MsgIdToValue(MsgID), 0xdead);
 
-    OS_time_t T;
-    UtAssert_True(Unpack_UInt32(&Pack, &T.seconds), "unpack time"); // 16 bytes
-    UtAssert_UINT32_EQ(T.seconds, 0xa);
-    UtAssert_True(Unpack_UInt32(&Pack, &T.microsecs), "unpack time"); // 120 bytes
-    UtAssert_UINT32_EQ(T.microsecs, 0xb);
+    UtAssert_True(Unpack_UInt32(&Pack, &u32), "unpack time"); // 18 bytes
+    UtAssert_UINT32_EQ(u32, 0xa);
+    UtAssert_True(Unpack_UInt32(&Pack, &u32), "unpack time"); // 22 bytes
+    UtAssert_UINT32_EQ(u32, 0xb);
 
     UtAssert_True(!Unpack_UInt8(&Pack, &u8), "unpack uint8");
     UtAssert_True(!Unpack_UInt16(&Pack, &u16), "unpack uint16");
@@ -2,7 +2,8 @@
 #include "cfe_msgids.h"
 #include "sbn_pack.h"
 
-CFE_SB_MsgId_t MsgID = 0xDEAD;
+CFE_SB_MsgId_t MsgID      = CFE_SB_MSGID_WRAP_VALUE(0xDEAD);
+CFE_SB_MsgId_t StaleMsgID = CFE_SB_MSGID_WRAP_VALUE(0xBEEF);
 
 static void SendSubsRequests_SendMsg1Err(void)
 {
@@ -38,8 +39,7 @@ static void SLS2P_SendNetMsgErr(void)
 {
     START();
 
-    SBN.SubCnt        = 1;
-    SBN.Subs[0].MsgID = MsgID;
+    SBN_InsertSub(SBN.Subs, SBN.SubIndex, SBN.SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
 
     SBN.Nets[0].Peers[1].Net = NetPtr;
 
@@ -67,10 +67,10 @@ static void CSP_PLS_MaxSubsErr(void)
     MsgPtr = &Msg;
     memset(MsgPtr, 0, sizeof(Msg));
     Msg.Payload.SubType = CFE_SB_SUBSCRIPTION;
-    Msg.Payload.MsgId   = CFE_SB_ONESUB_TLM_MID;
+    Msg.Payload.MsgId   = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_ERROR);
@@ -82,9 +82,8 @@ static void CSP_PLS_AddlSubs(void)
 {
     START();
 
-    SBN.SubCnt           = 1;
+    SBN_InsertSub(SBN.Subs, SBN.SubIndex, SBN.SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
     SBN.Subs[0].InUseCtr = 1;
-    SBN.Subs[0].MsgID    = MsgID;
 
     CFE_SB_SingleSubscriptionTlm_t Msg, *MsgPtr;
     MsgPtr = &Msg;
@@ -93,7 +92,7 @@ static void CSP_PLS_AddlSubs(void)
     Msg.Payload.MsgId   = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_SUCCESS);
@@ -114,7 +113,7 @@ static void CSP_PLS_SendErr(void)
     Msg.Payload.MsgId   = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_ERROR);
@@ -134,10 +133,10 @@ static void CSP_PLS_EvtMsg(void)
     MsgPtr = &Msg;
     memset(MsgPtr, 0, sizeof(Msg));
     Msg.Payload.SubType = CFE_SB_SUBSCRIPTION;
-    Msg.Payload.MsgId   = CFE_EVS_LONG_EVENT_MSG_MID;
+    Msg.Payload.MsgId   = CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID);
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_SUCCESS);
@@ -157,10 +156,10 @@ static void CSP_PLS_SbnMsg(void)
     MsgPtr = &Msg;
     memset(MsgPtr, 0, sizeof(Msg));
     Msg.Payload.SubType = CFE_SB_SUBSCRIPTION;
-    Msg.Payload.MsgId   = SBN_CMD_MID;
+    Msg.Payload.MsgId   = CFE_SB_ValueToMsgId(SBN_CMD_MID);
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_SUCCESS);
@@ -179,7 +178,7 @@ static void CSP_PLU_NotSub(void)
     Msg.Payload.MsgId   = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_SUCCESS);
@@ -189,9 +188,8 @@ static void CSP_PLU_OtherSub(void)
 {
     START();
 
-    SBN.SubCnt           = 1;
+    SBN_InsertSub(SBN.Subs, SBN.SubIndex, SBN.SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
     SBN.Subs[0].InUseCtr = 2;
-    SBN.Subs[0].MsgID    = MsgID;
 
     CFE_SB_SingleSubscriptionTlm_t Msg, *MsgPtr;
     MsgPtr = &Msg;
@@ -200,7 +198,7 @@ static void CSP_PLU_OtherSub(void)
     Msg.Payload.MsgId   = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_SUCCESS);
@@ -213,9 +211,8 @@ static void CSP_PLU_SLS2PErr(void)
 {
     START();
 
-    SBN.SubCnt           = 1;
+    SBN_InsertSub(SBN.Subs, SBN.SubIndex, SBN.SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
     SBN.Subs[0].InUseCtr = 1;
-    SBN.Subs[0].MsgID    = MsgID;
 
     CFE_SB_SingleSubscriptionTlm_t Msg, *MsgPtr;
     MsgPtr = &Msg;
@@ -224,7 +221,7 @@ static void CSP_PLU_SLS2PErr(void)
     Msg.Payload.MsgId   = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     IfOpsPtr->Send = Send_Err;
@@ -238,9 +235,8 @@ static void CSP_PLU_Nominal(void)
 {
     START();
 
-    SBN.SubCnt           = 1;
+    SBN_InsertSub(SBN.Subs, SBN.SubIndex, SBN.SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
     SBN.Subs[0].InUseCtr = 1;
-    SBN.Subs[0].MsgID    = MsgID;
 
     CFE_SB_SingleSubscriptionTlm_t Msg, *MsgPtr;
     MsgPtr = &Msg;
@@ -249,7 +245,7 @@ static void CSP_PLU_Nominal(void)
     Msg.Payload.MsgId   = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_SUCCESS);
@@ -271,7 +267,7 @@ static void CSP_SubTypeErr(void)
     Msg.Payload.MsgId   = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ONESUB_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ONESUB_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_ERROR);
@@ -294,7 +290,7 @@ static void CSP_AllSubs_EntryCntErr(void)
     Msg.Payload.Entries = CFE_SB_SUB_ENTRIES_PER_PKT + 1;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ALLSUBS_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_ERROR);
@@ -321,7 +317,7 @@ static void CSP_AllSubs_PLSErr(void)
     Msg.Payload.Entry[0].MsgId = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ALLSUBS_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_ERROR);
@@ -340,7 +336,7 @@ static void CSP_AllSubs_Nominal(void)
     Msg.Payload.Entry[0].MsgId = MsgID;
     UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &MsgPtr, sizeof(MsgPtr), false);
 
-    CFE_SB_MsgId_t mid = CFE_SB_ALLSUBS_TLM_MID;
+    CFE_SB_MsgId_t mid = CFE_SB_ValueToMsgId(CFE_SB_ALLSUBS_TLM_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &mid, sizeof(mid), false);
 
     UtAssert_INT32_EQ(SBN_CheckSubscriptionPipe(), SBN_SUCCESS);
@@ -411,8 +407,7 @@ static void PSFP_PFP_AlreadySub(void)
 {
     START();
 
-    PeerPtr->SubCnt        = 1;
-    PeerPtr->Subs[0].MsgID = MsgID;
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
 
     uint8  Buf[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
     Pack_t Pack;
@@ -534,8 +529,7 @@ static void PUSFP_PUFP_FiltErr(void)
 {
     START();
 
-    PeerPtr->SubCnt        = 1;
-    PeerPtr->Subs[0].MsgID = MsgID;
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
     PeerPtr->FilterCnt     = 2;
     SBN_FilterInterface_t Filter1, Filter2;
     memset(&Filter1, 0, sizeof(Filter1));
@@ -587,8 +581,7 @@ static void PUSFP_PUFP_UnsubErr(void)
 
     UT_CheckEvent_Setup(SBN_SUB_EID, "unable to unsubscribe from MID 0x");
 
-    PeerPtr->SubCnt        = 1;
-    PeerPtr->Subs[0].MsgID = MsgID;
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
 
     uint8  Buf[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
     Pack_t Pack;
@@ -614,8 +607,7 @@ static void PUSFP_IdentWarn(void)
 
     UT_CheckEvent_Setup(SBN_PROTO_EID, "version number mismatch with peer CpuID ");
 
-    PeerPtr->SubCnt        = 1;
-    PeerPtr->Subs[0].MsgID = MsgID;
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
 
     uint8 Buf[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
     char  tmpident[SBN_IDENT_LEN];
@@ -639,8 +631,7 @@ static void PUSFP_Nominal(void)
 {
     START();
 
-    PeerPtr->SubCnt        = 1;
-    PeerPtr->Subs[0].MsgID = MsgID;
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
 
     uint8  Buf[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
     Pack_t Pack;
@@ -671,8 +662,7 @@ static void RASFP_UnsubErr(void)
 
     UT_CheckEvent_Setup(SBN_SUB_EID, "unable to unsubscribe from message id 0x");
 
-    PeerPtr->SubCnt        = 1;
-    PeerPtr->Subs[0].MsgID = MsgID;
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
 
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_UnsubscribeLocal), 1, -1);
 
@@ -688,8 +678,7 @@ static void RASFP_Nominal(void)
 
     UT_CheckEvent_Setup(SBN_SUB_EID, "unsubscribed 1 message id's from ProcessorID ");
 
-    PeerPtr->SubCnt        = 1;
-    PeerPtr->Subs[0].MsgID = MsgID;
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
 
     UtAssert_INT32_EQ(SBN_RemoveAllSubsFromPeer(PeerPtr), SBN_SUCCESS);
 
@@ -702,6 +691,160 @@ void Test_SBN_RemoveAllSubsFromPeer(void)
     RASFP_Nominal();
 } /* end Test_SBN_RemoveAllSubsFromPeer() */
 
+static void PackSubSync(Pack_t *Pack, void *Buf, size_t BufSz, uint32 BaseEpoch, uint32 Epoch, uint8 Full,
+                        uint16 UnsubCnt, uint16 SubCnt)
+{
+    CFE_SB_Qos_t QoS = {0};
+    int          i   = 0;
+
+    Pack_Init(Pack, Buf, BufSz, 0);
+    Pack_Data(Pack, (void *)SBN_IDENT, SBN_IDENT_LEN);
+    Pack_UInt32(Pack, 1234); /* instance */
+    Pack_UInt32(Pack, BaseEpoch);
+    Pack_UInt32(Pack, Epoch);
+    Pack_UInt8(Pack, Full);
+    Pack_UInt16(Pack, UnsubCnt);
+    for (i = 0; i < UnsubCnt; i++)
+    {
+        Pack_MsgID(Pack, MsgID);
+    } /* end for */
+    Pack_UInt16(Pack, SubCnt);
+    for (i = 0; i < SubCnt; i++)
+    {
+        Pack_MsgID(Pack, MsgID);
+        Pack_Data(Pack, (void *)&QoS, sizeof(QoS));
+    } /* end for */
+} /* end PackSubSync() */
+
+static void PSSFP_FullRemovesStale(void)
+{
+    START();
+
+    uint8  Buf[SBN_PACKED_SUB_SYNC_SZ];
+    Pack_t Pack;
+
+    /* kept from before the disconnect, no longer subscribed by the peer */
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, StaleMsgID, CFE_SB_DEFAULT_QOS);
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
+
+    PackSubSync(&Pack, Buf, sizeof(Buf), 0, 5, 1, 0, 1);
+
+    UtAssert_INT32_EQ(SBN_ProcessSubSyncFromPeer(PeerPtr, Buf), SBN_SUCCESS);
+
+    UtAssert_INT32_EQ(PeerPtr->SubCnt, 1);
+    UtAssert_INT32_EQ(CFE_SB_MsgIdToValue(PeerPtr->Subs[0].MsgID), CFE_SB_MsgIdToValue(MsgID));
+    UtAssert_INT32_EQ(SBN_FindSub(PeerPtr->Subs, PeerPtr->SubIndex, MsgID), 0);
+    UtAssert_INT32_EQ(SBN_FindSub(PeerPtr->Subs, PeerPtr->SubIndex, StaleMsgID), -1);
+    UtAssert_INT32_EQ(PeerPtr->SubInstance, 1234);
+    UtAssert_INT32_EQ(PeerPtr->SubEpoch, 5);
+    /* the sub that was already there was not subscribed again */
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeLocal, 0);
+    UtAssert_STUB_COUNT(CFE_SB_UnsubscribeLocal, 1);
+} /* end PSSFP_FullRemovesStale() */
+
+static void PSSFP_Delta(void)
+{
+    START();
+
+    uint8  Buf[SBN_PACKED_SUB_SYNC_SZ];
+    Pack_t Pack;
+
+    PeerPtr->SubInstance = 1234;
+    PeerPtr->SubEpoch    = 5;
+    SBN_InsertSub(PeerPtr->Subs, PeerPtr->SubIndex, PeerPtr->SubCnt++, MsgID, CFE_SB_DEFAULT_QOS);
+
+    PackSubSync(&Pack, Buf, sizeof(Buf), 5, 7, 0, 1, 0);
+
+    UtAssert_INT32_EQ(SBN_ProcessSubSyncFromPeer(PeerPtr, Buf), SBN_SUCCESS);
+
+    UtAssert_INT32_EQ(PeerPtr->SubCnt, 0);
+    UtAssert_INT32_EQ(PeerPtr->SubEpoch, 7);
+} /* end PSSFP_Delta() */
+
+static void PSSFP_IdentErr(void)
+{
+    START();
+
+    uint8  Buf[SBN_PACKED_SUB_SYNC_SZ];
+    Pack_t Pack;
+
+    PackSubSync(&Pack, Buf, sizeof(Buf), 0, 5, 1, 0, 1);
+    Buf[0]++;
+
+    UtAssert_INT32_EQ(SBN_ProcessSubSyncFromPeer(PeerPtr, Buf), SBN_ERROR);
+    UtAssert_INT32_EQ(PeerPtr->SubCnt, 0);
+} /* end PSSFP_IdentErr() */
+
+void Test_SBN_ProcessSubSyncFromPeer(void)
+{
+    PSSFP_FullRemovesStale();
+    PSSFP_Delta();
+    PSSFP_IdentErr();
+} /* end Test_SBN_ProcessSubSyncFromPeer() */
+
+static uint8 SyncFull = 0;
+
+static SBN_Status_t Send_SubSync(SBN_PeerInterface_t *Peer, SBN_MsgType_t MsgType, SBN_MsgSz_t MsgSz, void *Payload)
+{
+    /* the full flag follows the ident, instance, base epoch and epoch */
+    SyncFull = ((uint8 *)Payload)[SBN_IDENT_LEN + sizeof(uint32) * 3];
+
+    return SBN_SUCCESS;
+} /* end Send_SubSync() */
+
+static void SSSTP_FirstFull(void)
+{
+    START();
+
+    IfOpsPtr->Send      = Send_SubSync;
+    SBN.SubInstance     = 1234;
+    SBN.SubEpoch        = 5;
+    PeerPtr->SubsSynced = false;
+
+    /* the peer claims the current instance, but it may be from another run */
+    UtAssert_INT32_EQ(SBN_SendSubSyncToPeer(PeerPtr, 1234, 5), SBN_SUCCESS);
+    UtAssert_INT32_EQ(SyncFull, 1);
+    UtAssert_BOOL_TRUE(PeerPtr->SubsSynced);
+
+    /* once it has been sent them, only what changed */
+    UtAssert_INT32_EQ(SBN_SendSubSyncToPeer(PeerPtr, 1234, 5), SBN_SUCCESS);
+    UtAssert_INT32_EQ(SyncFull, 0);
+
+    IfOpsPtr->Send = Send_Nominal;
+} /* end SSSTP_FirstFull() */
+
+static void SSSTP_SendErr(void)
+{
+    START();
+
+    IfOpsPtr->Send      = Send_Err;
+    PeerPtr->SubsSynced = false;
+
+    UtAssert_INT32_EQ(SBN_SendSubSyncToPeer(PeerPtr, 0, 0), SBN_ERROR);
+    UtAssert_BOOL_FALSE(PeerPtr->SubsSynced);
+
+    IfOpsPtr->Send = Send_Nominal;
+} /* end SSSTP_SendErr() */
+
+static void SSSTP_ResetForgets(void)
+{
+    START();
+
+    PeerPtr->SubsSynced = true;
+
+    SBN_ResetLocalSubs();
+
+    UtAssert_BOOL_FALSE(PeerPtr->SubsSynced);
+    UtAssert_True(SBN.SubInstance != 0, "SBN.SubInstance (%lu) != 0", (unsigned long)SBN.SubInstance);
+} /* end SSSTP_ResetForgets() */
+
+void Test_SBN_SendSubSyncToPeer(void)
+{
+    SSSTP_FirstFull();
+    SSSTP_SendErr();
+    SSSTP_ResetForgets();
+} /* end Test_SBN_SendSubSyncToPeer() */
+
 void UT_Setup(void) {} /* end UT_Setup() */
 
 void UT_TearDown(void) {} /* end UT_TearDown() */
@@ -714,4 +857,6 @@ void UtTest_Setup(void)
     ADD_TEST(SBN_ProcessSubsFromPeer);
     ADD_TEST(SBN_ProcessUnsubsFromPeer);
     ADD_TEST(SBN_RemoveAllSubsFromPeer);
+    ADD_TEST(SBN_ProcessSubSyncFromPeer);
+    ADD_TEST(SBN_SendSubSyncToPeer);
 }
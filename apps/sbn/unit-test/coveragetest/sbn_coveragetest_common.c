@@ -82,9 +82,11 @@ SBN_Status_t InitPeer_Nominal(SBN_PeerInterface_t *Peer)
 } /* end InitPeer_Nominal() */
 
 SBN_Status_t RecvFromNet_Nominal(SBN_NetInterface_t *Net, SBN_MsgType_t *MsgTypePtr, SBN_MsgSz_t *MsgSzPtr,
-                                 CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer)
+                                 CFE_ProcessorID_t *ProcessorIDPtr, CFE_SpacecraftID_t *SpacecraftIDPtr,
+                                 void *PayloadBuffer)
 {
-    *ProcessorIDPtr = 1235;
+    *ProcessorIDPtr  = 1235;
+    *SpacecraftIDPtr = 5678;
 
     return SBN_SUCCESS;
 } /* end RecvFromNet_Nominal() */
@@ -195,7 +197,7 @@ SBN_PeerInterface_t *PeerPtr      = NULL;
 int32 SymLookHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
 {
     static char LastSeen[32] = {0};
-    char *      SymbolName   = (char *)Context->ArgPtr[1];
+    const char *SymbolName   = UT_Hook_GetArgValueByName(Context, "symbol_name", const char *);
 
     /* this forces the LoadConf_Module() function to call ModuleLoad */
 
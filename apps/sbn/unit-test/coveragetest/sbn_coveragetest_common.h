@@ -77,7 +77,8 @@ SBN_Status_t InitNet_Nominal(SBN_NetInterface_t *Net);
 SBN_Status_t LoadNet_Nominal(SBN_NetInterface_t *Net, const char *Address);
 SBN_Status_t InitPeer_Nominal(SBN_PeerInterface_t *Peer);
 SBN_Status_t RecvFromNet_Nominal(SBN_NetInterface_t *Net, SBN_MsgType_t *MsgTypePtr, SBN_MsgSz_t *MsgSzPtr,
-                                 CFE_ProcessorID_t *ProcessorIDPtr, void *PayloadBuffer);
+                                 CFE_ProcessorID_t *ProcessorIDPtr, CFE_SpacecraftID_t *SpacecraftIDPtr,
+                                 void *PayloadBuffer);
 SBN_Status_t LoadPeer_Nominal(SBN_PeerInterface_t *Peer, const char *Address);
 SBN_Status_t UnloadNet_Nominal(SBN_NetInterface_t *Net);
 SBN_Status_t UnloadPeer_Nominal(SBN_PeerInterface_t *Net);
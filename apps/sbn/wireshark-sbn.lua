@@ -16,7 +16,9 @@ local proto_sbn_types = {
     [1] = "SUB",
     [2] = "UNSUB",
     [3] = "APP",
-    [4] = "PROTO"
+    [4] = "PROTO",
+    [5] = "FRAME",
+    [6] = "SUB_SYNC"
 }
 
 local proto_sbn_msgsz = ProtoField.uint16("cfs_sbn.MsgSz", "MsgSz", base.DEC)
@@ -0,0 +1,343 @@
+/**
+ * @file
+ *
+ * Measures the cost of building the ATS time index when an ATS is loaded,
+ * and of updating it when an append table is added, at the maximum ATS
+ * size (SC_MAX_ATS_CMDS commands of SC_PACKET_MIN_SIZE bytes).
+ *
+ * - "load" times SC_LoadAts, and the index build on its own with the
+ *   insertion sort (SC_Insert for each command) that SC_BuildTimeIndexTable
+ *   used before and with the current merge sort;
+ * - "append" loads 90% of the commands, then times adding the other 10%
+ *   from the append table with the SC_ProcessAppend that rebuilt the whole
+ *   index by insertion, and with the current one that sorts the appended
+ *   commands and merges them into the index.
+ *
+ * The command times are random with many ties, and each case checks that
+ * the old and new code put the commands in the same order.
+ *
+ * sc_loads.c and sc_utils.c are linked as is, the cFE calls they make are
+ * replaced by the minimal shims at the end of this file.  To look at ATS
+ * loads of several thousand commands, raise SC_MAX_ATS_CMDS and
+ * SC_ATS_BUFF_SIZE in the sc configuration of the build.  Build with the
+ * SC_BENCH cmake option, or by hand with the same include paths as the sc app:
+ *
+ *   cc -O2 -I../fsw/inc -I../fsw/src -I<cfe, osal and sc config includes> sc_bench.c \
+ *      ../fsw/src/sc_loads.c ../fsw/src/sc_utils.c -L<osal build dir> -losal -losal_bsp -lpthread -lrt -o sc_bench
+ *
+ * and run as "sc_bench [repeats]".
+ */
+
+#include "cfe.h"
+#include "sc_app.h"
+#include "sc_loads.h"
+#include "sc_atsrq.h"
+#include "sc_utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ENTRY_WORDS ((SC_ATS_HEADER_SIZE + SC_PACKET_MIN_SIZE) / SC_BYTES_IN_WORD)
+#define BENCH_FIT_CMDS    (SC_ATS_BUFF_SIZE32 / BENCH_ENTRY_WORDS)
+#define BENCH_NUM_CMDS    ((SC_MAX_ATS_CMDS < BENCH_FIT_CMDS) ? SC_MAX_ATS_CMDS : BENCH_FIT_CMDS)
+#define BENCH_NUM_APPEND  (BENCH_NUM_CMDS / 10)
+
+SC_AppData_t  SC_AppData;
+SC_OperData_t SC_OperData;
+
+static uint32                 BenchAts[SC_ATS_BUFF_SIZE32];
+static uint32                 BenchAtsSaved[SC_ATS_BUFF_SIZE32];
+static uint32                 BenchAppend[SC_APPEND_BUFF_SIZE32];
+static SC_AtsInfoTable_t      BenchAtsInfo[SC_NUMBER_OF_ATS];
+static SC_AtsCmdStatusEntry_t BenchAtsStatus[SC_MAX_ATS_CMDS];
+static SC_AtpControlBlock_t   BenchAtpCtrl;
+static SC_AtsCmdNumRecord_t   BenchIndex[SC_MAX_ATS_CMDS];
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+/* commands from index FirstCmd up, in a table of minimum size entries with random times */
+static void FillTable(uint32 *Table, uint32 TableWords, uint32 FirstCmd, uint32 NumCmds)
+{
+    SC_AtsEntryHeader_t *Header;
+    uint32               Time;
+    uint32               i;
+
+    memset(Table, 0, TableWords * sizeof(*Table));
+
+    for (i = 0; i < NumCmds; i++)
+    {
+        Header = (SC_AtsEntryHeader_t *)&Table[i * BENCH_ENTRY_WORDS];
+        Time   = 1000 + rand() % (BENCH_NUM_CMDS / 2);
+
+        Header->CmdNumber  = SC_CommandIndexToNum(SC_COMMAND_IDX_C(FirstCmd + i));
+        Header->TimeTag_MS = Time >> 16;
+        Header->TimeTag_LS = Time & 0xFFFF;
+    }
+}
+
+/* the insertion that SC_BuildTimeIndexTable did for each command before the merge sort */
+static void BenchInsert(SC_AtsIndex_t AtsIndex, SC_CommandIndex_t NewCmdIndex, uint32 ListLength)
+{
+    SC_AbsTimeTag_t NewCmdTime = 0;
+    SC_SeqIndex_t   TimeBufIndex;
+    SC_SeqIndex_t   NextIndex;
+
+    if (ListLength > 0)
+    {
+        NewCmdTime = SC_GetAtsCommandTime(AtsIndex, SC_CommandIndexToNum(NewCmdIndex));
+    }
+
+    TimeBufIndex = SC_SEQUENCE_IDX_C(ListLength - 1);
+
+    while (SC_IDX_WITHIN_LIMIT(TimeBufIndex, ListLength))
+    {
+        if (SC_CompareAbsTime(SC_GetAtsCommandTime(AtsIndex, SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex)->CmdNum),
+                              NewCmdTime))
+        {
+            NextIndex = TimeBufIndex;
+            SC_IDX_INCREMENT(NextIndex);
+
+            SC_GetAtsCommandNumAtSeq(AtsIndex, NextIndex)->CmdNum =
+                SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex)->CmdNum;
+
+            SC_IDX_DECREMENT(TimeBufIndex);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    SC_IDX_INCREMENT(TimeBufIndex);
+    SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex)->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
+}
+
+static void BenchBuildTimeIndexInsertion(SC_AtsIndex_t AtsIndex)
+{
+    SC_CommandIndex_t CmdIdx;
+    uint32            ListLength = 0;
+    uint32            i;
+
+    for (i = 0; i < SC_MAX_ATS_CMDS; i++)
+    {
+        SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i))->CmdNum = SC_INVALID_CMD_NUMBER;
+
+        CmdIdx = SC_COMMAND_IDX_C(i);
+        if (!SC_IDX_EQUAL(SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIdx)->Offset, SC_ENTRY_OFFSET_INVALID))
+        {
+            BenchInsert(AtsIndex, CmdIdx, ListLength);
+            ListLength++;
+        }
+    }
+}
+
+/* SC_ProcessAppend as it was, rebuilding the whole index after adding the appended commands */
+static void BenchProcessAppendRebuild(SC_AtsIndex_t AtsIndex)
+{
+    SC_AtsInfoTable_t *           AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
+    SC_EntryOffset_t              EntryIndex = SC_ENTRY_OFFSET_C(AtsInfoPtr->AtsSize);
+    SC_AtsEntry_t *               EntryPtr;
+    SC_CommandIndex_t             CmdIndex;
+    SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;
+    CFE_MSG_Size_t                CommandBytes = 0;
+    int32                         i;
+
+    memcpy(SC_GetAtsEntryAtOffset(AtsIndex, EntryIndex), SC_OperData.AppendTblAddr,
+           SC_AppData.AppendWordCount * SC_BYTES_IN_WORD);
+    AtsInfoPtr->AtsSize += SC_AppData.AppendWordCount;
+
+    for (i = 0; i < SC_OperData.HkPacket.Payload.AppendEntryCount; i++)
+    {
+        EntryPtr       = SC_GetAtsEntryAtOffset(AtsIndex, EntryIndex);
+        CmdIndex       = SC_CommandNumToIndex(EntryPtr->Header.CmdNumber);
+        StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, CmdIndex);
+        CmdOffsetRec   = SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex);
+
+        if (StatusEntryPtr->Status == SC_Status_EMPTY)
+        {
+            AtsInfoPtr->NumberOfCommands++;
+        }
+
+        CmdOffsetRec->Offset   = EntryIndex;
+        StatusEntryPtr->Status = SC_Status_LOADED;
+
+        CFE_MSG_GetSize(CFE_MSG_PTR(EntryPtr->Msg), &CommandBytes);
+        EntryIndex = SC_EntryOffsetAdvance(EntryIndex, CommandBytes + SC_ATS_HEADER_SIZE);
+    }
+
+    BenchBuildTimeIndexInsertion(AtsIndex);
+
+    CFE_TBL_Modified(SC_OperData.AtsTblHandle[SC_IDX_AS_UINT(AtsIndex)]);
+}
+
+static bool SameOrder(SC_AtsIndex_t AtsIndex)
+{
+    return memcmp(BenchIndex, SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_FIRST), sizeof(BenchIndex)) == 0;
+}
+
+static void SaveOrder(SC_AtsIndex_t AtsIndex)
+{
+    memcpy(BenchIndex, SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_FIRST), sizeof(BenchIndex));
+}
+
+/* load the saved ATS table, with the append table (if any) ready to be processed */
+static void LoadSavedAts(SC_AtsIndex_t AtsIndex)
+{
+    memcpy(BenchAts, BenchAtsSaved, sizeof(BenchAts));
+    SC_LoadAts(AtsIndex);
+}
+
+void OS_Application_Startup(void)
+{
+    char *const * ArgV       = OS_BSP_GetArgV();
+    uint32        ArgC       = OS_BSP_GetArgC();
+    long          Repeats    = ArgC > 1 ? atol(ArgV[1]) : 100;
+    SC_AtsIndex_t AtsIndex   = SC_ATS_IDX_C(0);
+    double        Load       = 0;
+    double        Insertion  = 0;
+    double        Merge      = 0;
+    double        Rebuild    = 0;
+    double        Append     = 0;
+    bool          LoadSame   = true;
+    bool          AppendSame = true;
+    double        Start;
+    long          r;
+
+    SC_OperData.AtsTblAddr[0]          = BenchAts;
+    SC_OperData.AppendTblAddr          = BenchAppend;
+    SC_OperData.AtsInfoTblAddr         = BenchAtsInfo;
+    SC_OperData.AtsCmdStatusTblAddr[0] = BenchAtsStatus;
+    SC_OperData.AtsCtrlBlckAddr        = &BenchAtpCtrl;
+    BenchAtpCtrl.AtpState              = SC_Status_IDLE;
+
+    printf("%u commands of %u bytes, %u appended, %ld repeats\n", (unsigned int)BENCH_NUM_CMDS,
+           (unsigned int)SC_PACKET_MIN_SIZE, (unsigned int)BENCH_NUM_APPEND, Repeats);
+
+    /* a full ATS */
+    srand(1);
+    FillTable(BenchAtsSaved, SC_ATS_BUFF_SIZE32, 0, BENCH_NUM_CMDS);
+
+    for (r = 0; r < Repeats; r++)
+    {
+        memcpy(BenchAts, BenchAtsSaved, sizeof(BenchAts));
+        Start = Now();
+        SC_LoadAts(AtsIndex);
+        Load += Now() - Start;
+
+        Start = Now();
+        BenchBuildTimeIndexInsertion(AtsIndex);
+        Insertion += Now() - Start;
+        SaveOrder(AtsIndex);
+
+        Start = Now();
+        SC_BuildTimeIndexTable(AtsIndex);
+        Merge += Now() - Start;
+        LoadSame = LoadSame && SameOrder(AtsIndex);
+    }
+
+    /* 90% of the ATS, and the rest in the append table */
+    FillTable(BenchAtsSaved, SC_ATS_BUFF_SIZE32, 0, BENCH_NUM_CMDS - BENCH_NUM_APPEND);
+    FillTable(BenchAppend, SC_APPEND_BUFF_SIZE32, BENCH_NUM_CMDS - BENCH_NUM_APPEND, BENCH_NUM_APPEND);
+    SC_UpdateAppend();
+
+    for (r = 0; r < Repeats; r++)
+    {
+        LoadSavedAts(AtsIndex);
+        Start = Now();
+        BenchProcessAppendRebuild(AtsIndex);
+        Rebuild += Now() - Start;
+        SaveOrder(AtsIndex);
+
+        LoadSavedAts(AtsIndex);
+        Start = Now();
+        SC_ProcessAppend(AtsIndex);
+        Append += Now() - Start;
+        AppendSame = AppendSame && SameOrder(AtsIndex);
+    }
+
+    printf("load    SC_LoadAts %9.1f us, index by insertion %9.1f us, by merge sort %9.1f us, order %s\n",
+           Load * 1e6 / Repeats, Insertion * 1e6 / Repeats, Merge * 1e6 / Repeats, LoadSame ? "same" : "DIFFERS");
+    printf("append  rebuild by insertion %9.1f us, sort and merge %9.1f us, order %s\n", Rebuild * 1e6 / Repeats,
+           Append * 1e6 / Repeats, AppendSame ? "same" : "DIFFERS");
+
+    OS_ApplicationExit(0);
+}
+
+/*
+ * Minimal shims for the cFE and SC calls made by sc_loads.c and sc_utils.c
+ */
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    *Size = SC_PACKET_MIN_SIZE;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    *MsgId = CFE_SB_INVALID_MSG_ID;
+    return CFE_SUCCESS;
+}
+
+bool CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId)
+{
+    return true;
+}
+
+CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
+{
+    return CFE_SUCCESS;
+}
+
+CFE_TIME_Compare_t CFE_TIME_Compare(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t TimeB)
+{
+    if (TimeA.Seconds != TimeB.Seconds)
+    {
+        return TimeA.Seconds > TimeB.Seconds ? CFE_TIME_A_GT_B : CFE_TIME_A_LT_B;
+    }
+    if (TimeA.Subseconds != TimeB.Subseconds)
+    {
+        return TimeA.Subseconds > TimeB.Subseconds ? CFE_TIME_A_GT_B : CFE_TIME_A_LT_B;
+    }
+    return CFE_TIME_EQUAL;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_Add(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
+{
+    Time1.Seconds += Time2.Seconds;
+    return Time1;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
+{
+    CFE_TIME_SysTime_t Time = {0, 0};
+    return Time;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetTAI(void)
+{
+    return CFE_TIME_GetTime();
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetUTC(void)
+{
+    return CFE_TIME_GetTime();
+}
+
+bool SC_BeginAts(SC_AtsIndex_t AtsIndex, uint16 TimeOffset)
+{
+    return true;
+}
@@ -1285,17 +1285,6 @@
  */
 #define SC_BUILD_TIME_IDXTBL_ERR_EID 132
 
-/**
- * \brief SC ATS Insert ATS Index Invalid Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *  This event message is issued when an invalid ATS index is received
- *  in the SC_Insert function
- */
-#define SC_INSERTATS_INV_INDEX_ERR_EID 133
-
 /**
  * \brief SC ATS Table Initialization Error ATS Index Invalid Event ID
  *
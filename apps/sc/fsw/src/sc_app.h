@@ -364,6 +364,10 @@ typedef struct
          These offsets correspond to the addresses of ATS commands located in the ATS table.
          The index used is the ATS command index with values from 0 to SC_MAX_ATS_CMDS-1 */
 
+    SC_AtsCmdNumRecord_t AtsTimeIndexScratch[SC_MAX_ATS_CMDS];
+    /**< \brief  Work area used while sorting and merging the time ordered
+         listings of ATS commands */
+
     SC_TimeAccessor_t TimeRef; /**< \brief Configured time reference */
 
     bool EnableHeaderUpdate; /**< \brief whether to update headers in outgoing messages */
@@ -223,104 +223,156 @@ void SC_BuildTimeIndexTable(SC_AtsIndex_t AtsIndex)
     /* initialize sorted list length */
     ListLength = 0;
 
-    /* initialize sorted list contents */
+    /* gather in-use command entries in command number order */
     for (i = 0; i < SC_MAX_ATS_CMDS; i++)
     {
-        AtsCmdNumRec         = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i));
-        AtsCmdNumRec->CmdNum = SC_INVALID_CMD_NUMBER;
-
-        /* add in-use command entries to time sorted list */
         CmdIdx = SC_COMMAND_IDX_C(i);
         if (!SC_IDX_EQUAL(SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIdx)->Offset, SC_ENTRY_OFFSET_INVALID))
         {
-            SC_Insert(AtsIndex, CmdIdx, ListLength);
+            AtsCmdNumRec         = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(ListLength));
+            AtsCmdNumRec->CmdNum = SC_CommandIndexToNum(CmdIdx);
             ListLength++;
         }
     }
+
+    /* clear the unused remainder of the list */
+    for (i = ListLength; i < SC_MAX_ATS_CMDS; i++)
+    {
+        AtsCmdNumRec         = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i));
+        AtsCmdNumRec->CmdNum = SC_INVALID_CMD_NUMBER;
+    }
+
+    /* then put them in time order */
+    SC_SortTimeIndex(AtsIndex, SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_FIRST), ListLength);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/*  Inserts and element into a sorted list                         */
+/*  Sorts a list of ATS commands by execution time                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void SC_Insert(SC_AtsIndex_t AtsIndex, SC_CommandIndex_t NewCmdIndex, uint32 ListLength)
+void SC_SortTimeIndex(SC_AtsIndex_t AtsIndex, SC_AtsCmdNumRecord_t *List, uint32 ListLength)
 {
-    SC_AtsEntryHeader_t *         EntryHeader;    /* ATS table entry pointer */
-    SC_AbsTimeTag_t               NewCmdTime = 0; /* new command execution time */
-    SC_AbsTimeTag_t               ListCmdTime;    /* list entry execution time */
-    SC_CommandIndex_t             CmdIndex;       /* ATS command index (cmd num - 1) */
-    SC_SeqIndex_t                 TimeBufIndex;
-    SC_SeqIndex_t                 NextIndex;
-    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
-    SC_AtsCmdNumRecord_t *        AtsCmdNumRec;
+    SC_AtsCmdNumRecord_t *Src;   /* runs being merged */
+    SC_AtsCmdNumRecord_t *Dest;  /* merged runs */
+    SC_AtsCmdNumRecord_t *Swap;
+    uint32                Width; /* length of the sorted runs in Src */
+    uint32                Left;
+    uint32                Mid;
+    uint32                Right;
 
-    /* validate ATS array index */
-    if (!SC_AtsIndexIsValid(AtsIndex))
+    /*
+    ** Bottom-up merge sort, with the scratch list as the other half of
+    ** each pass.  Every list entry starts as a sorted run of one, and
+    ** each pass merges adjacent runs into runs of twice the width.
+    */
+    Src  = List;
+    Dest = SC_AppData.AtsTimeIndexScratch;
+
+    for (Width = 1; Width < ListLength; Width *= 2)
     {
-        CFE_EVS_SendEvent(SC_INSERTATS_INV_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "ATS insert error: invalid ATS index %u", SC_IDX_AS_UINT(AtsIndex));
-        return;
+        for (Left = 0; Left < ListLength; Left += 2 * Width)
+        {
+            Mid   = (Width < ListLength - Left) ? (Left + Width) : ListLength;
+            Right = (2 * Width < ListLength - Left) ? (Left + 2 * Width) : ListLength;
+
+            SC_MergeTimeIndex(AtsIndex, &Dest[Left], &Src[Left], Mid - Left, &Src[Mid], Right - Mid);
+        }
+
+        Swap = Src;
+        Src  = Dest;
+        Dest = Swap;
     }
 
-    /* get execution time for new list entry */
-    if (ListLength > 0)
+    /* after an odd number of passes the sorted list is in the scratch list */
+    if (Src != List)
     {
-        /* first get the entry index in the selected ATS table for the new command */
-        CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, NewCmdIndex);
-        /* then get a pointer to the ATS entry */
-        EntryHeader = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
-        /* then get the execution time from the ATS entry for the new command */
-        NewCmdTime = SC_GetAtsEntryTime(EntryHeader);
+        memcpy(List, Src, ListLength * sizeof(*List));
     }
+}
 
-    /* start at last element in the sorted by time list */
-    TimeBufIndex = SC_SEQUENCE_IDX_C(ListLength - 1);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Merges two time sorted lists of ATS commands                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_MergeTimeIndex(SC_AtsIndex_t AtsIndex, SC_AtsCmdNumRecord_t *Dest, const SC_AtsCmdNumRecord_t *Left,
+                       uint32 LeftLength, const SC_AtsCmdNumRecord_t *Right, uint32 RightLength)
+{
+    SC_AbsTimeTag_t LeftCmdTime  = 0; /* execution time of the next left list entry */
+    SC_AbsTimeTag_t RightCmdTime = 0; /* execution time of the next right list entry */
+    uint32          LeftIndex    = 0;
+    uint32          RightIndex   = 0;
 
-    while (SC_IDX_WITHIN_LIMIT(TimeBufIndex, ListLength))
+    if (LeftLength > 0)
+    {
+        LeftCmdTime = SC_GetAtsCommandTime(AtsIndex, Left[0].CmdNum);
+    }
+    if (RightLength > 0)
     {
-        /* first get the cmd index for this list entry */
-        CmdIndex = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex)->CmdNum);
-        /* then get the entry index from the ATS table */
-        CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex);
-        /* then get a pointer to the ATS entry data */
-        EntryHeader = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
-        /* then get cmd execution time from the ATS entry */
-        ListCmdTime = SC_GetAtsEntryTime(EntryHeader);
+        RightCmdTime = SC_GetAtsCommandTime(AtsIndex, Right[0].CmdNum);
+    }
 
-        /* compare time for this list entry to time for new cmd */
-        if (SC_CompareAbsTime(ListCmdTime, NewCmdTime))
+    while (LeftIndex < LeftLength && RightIndex < RightLength)
+    {
+        /*
+        ** Commands with the same time execute in command number order,
+        ** so that merging new entries into an existing list gives the
+        ** same order as sorting the whole list again
+        */
+        if (SC_CompareAbsTime(LeftCmdTime, RightCmdTime) ||
+            (LeftCmdTime == RightCmdTime &&
+             SC_IDNUM_AS_UINT(Left[LeftIndex].CmdNum) > SC_IDNUM_AS_UINT(Right[RightIndex].CmdNum)))
         {
-            /* new cmd will execute before this list entry */
-
-            /* move this list entry to make room for new cmd */
-            NextIndex = TimeBufIndex;
-            SC_IDX_INCREMENT(NextIndex);
-
-            SC_GetAtsCommandNumAtSeq(AtsIndex, NextIndex)->CmdNum =
-                SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex)->CmdNum;
-
-            /* back up to previous list entry (ok if -1) */
-            SC_IDX_DECREMENT(TimeBufIndex);
+            /* right entry executes first */
+            *Dest = Right[RightIndex];
+            ++RightIndex;
+            if (RightIndex < RightLength)
+            {
+                RightCmdTime = SC_GetAtsCommandTime(AtsIndex, Right[RightIndex].CmdNum);
+            }
         }
         else
         {
-            /* new cmd will execute at same time or after this list entry */
-            break;
+            *Dest = Left[LeftIndex];
+            ++LeftIndex;
+            if (LeftIndex < LeftLength)
+            {
+                LeftCmdTime = SC_GetAtsCommandTime(AtsIndex, Left[LeftIndex].CmdNum);
+            }
         }
+        ++Dest;
     }
 
-    /*
-    ** TimeBufIndex is now one slot before the target slot...
-    **   if new cmd time is earlier than all other entries
-    **     then TimeBufIndex is -1 and all others have been moved
-    **   else only entries with later times have been moved
-    ** In either case, there is an empty slot next to TimeBufIndex
-    */
-    SC_IDX_INCREMENT(TimeBufIndex);
+    /* at most one of the lists has entries left, and those are already in order */
+    while (LeftIndex < LeftLength)
+    {
+        *Dest = Left[LeftIndex];
+        ++LeftIndex;
+        ++Dest;
+    }
+    while (RightIndex < RightLength)
+    {
+        *Dest = Right[RightIndex];
+        ++RightIndex;
+        ++Dest;
+    }
+}
 
-    AtsCmdNumRec         = SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex);
-    AtsCmdNumRec->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Gets the execution time of a loaded ATS command                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+SC_AbsTimeTag_t SC_GetAtsCommandTime(SC_AtsIndex_t AtsIndex, SC_CommandNum_t CmdNum)
+{
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
+
+    /* first get the entry index in the selected ATS table for the command */
+    CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_CommandNumToIndex(CmdNum));
+
+    /* then get the execution time from the ATS entry */
+    return SC_GetAtsEntryTime(&SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -643,6 +695,11 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
     SC_AtsInfoTable_t *           AtsInfoPtr;
     SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
     SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;
+    SC_AtsCmdNumRecord_t *        TimeIndex;     /* time sorted list of commands */
+    uint32                        OldAtsSize;    /* size of ATS table data before the append */
+    uint32                        NewCount = 0;  /* number of appended commands not already listed */
+    uint32                        KeptCount = 0; /* number of listed commands not replaced by the append */
+    uint32                        OldCount;      /* number of listed commands before the append */
 
     /* validate ATS array index */
     if (!SC_AtsIndexIsValid(AtsIndex))
@@ -655,6 +712,7 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
     /* save index of free area at end of ATS table data */
     AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
     EntryIndex = SC_ENTRY_OFFSET_C(AtsInfoPtr->AtsSize);
+    OldAtsSize = AtsInfoPtr->AtsSize;
 
     /* copy Append table data to end of ATS table data */
     memcpy(SC_GetAtsEntryAtOffset(AtsIndex, EntryIndex), SC_OperData.AppendTblAddr,
@@ -681,6 +739,14 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
             AtsInfoPtr->NumberOfCommands++;
         }
 
+        /* note the command for the time sorted list, unless an earlier entry of this append already did */
+        if (SC_IDX_EQUAL(CmdOffsetRec->Offset, SC_ENTRY_OFFSET_INVALID) ||
+            SC_IDX_AS_UINT(CmdOffsetRec->Offset) < OldAtsSize)
+        {
+            SC_AppData.AtsTimeIndexScratch[NewCount].CmdNum = EntryPtr->Header.CmdNumber;
+            NewCount++;
+        }
+
         /* update array of pointers to ats entries */
         CmdOffsetRec->Offset   = EntryIndex;
         StatusEntryPtr->Status = SC_Status_LOADED;
@@ -690,8 +756,30 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
         EntryIndex = SC_EntryOffsetAdvance(EntryIndex, CommandBytes + SC_ATS_HEADER_SIZE);
     }
 
-    /* rebuild time sorted list of commands */
-    SC_BuildTimeIndexTable(AtsIndex);
+    /*
+    ** Update the time sorted list of commands.  Commands replaced by the
+    ** append now have an entry past the old end of the ATS table data and
+    ** are dropped from the list, the appended commands are sorted on their
+    ** own and the two sorted lists are then merged.  Each replaced command
+    ** is also one of the appended commands, so the list never gets shorter.
+    */
+    TimeIndex = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_FIRST);
+
+    for (OldCount = 0; OldCount < SC_MAX_ATS_CMDS && !SC_IDNUM_IS_NULL(TimeIndex[OldCount].CmdNum); OldCount++)
+    {
+        CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_CommandNumToIndex(TimeIndex[OldCount].CmdNum));
+        if (SC_IDX_AS_UINT(CmdOffsetRec->Offset) < OldAtsSize)
+        {
+            TimeIndex[KeptCount] = TimeIndex[OldCount];
+            KeptCount++;
+        }
+    }
+
+    memcpy(&TimeIndex[KeptCount], SC_AppData.AtsTimeIndexScratch, NewCount * sizeof(*TimeIndex));
+    SC_SortTimeIndex(AtsIndex, &TimeIndex[KeptCount], NewCount);
+    SC_MergeTimeIndex(AtsIndex, SC_AppData.AtsTimeIndexScratch, TimeIndex, KeptCount, &TimeIndex[KeptCount],
+                      NewCount);
+    memcpy(TimeIndex, SC_AppData.AtsTimeIndexScratch, (KeptCount + NewCount) * sizeof(*TimeIndex));
 
     /* did we just append to an ats that was executing? */
     if ((SC_OperData.AtsCtrlBlckAddr->AtpState == SC_Status_EXECUTING) &&
@@ -27,7 +27,7 @@
 #define SC_LOADS_H
 
 #include "cfe.h"
-#include "sc_index_types.h"
+#include "sc_app.h"
 
 /**
  * \brief Parses an RTS to see if it is valid
@@ -65,20 +65,55 @@ bool SC_ParseRts(uint32 Buffer32[]);
 void SC_BuildTimeIndexTable(SC_AtsIndex_t AtsIndex);
 
 /**
- * \brief Inserts an item in a sorted list
+ * \brief Sorts a list of ATS commands by execution time
  *
  *  \par Description
- *        This function will insert a new element into the list of
- *        ATS commands sorted by execution time.
+ *        This function will sort a list of ATS commands so that they
+ *        are in the order they execute.  Commands with the same
+ *        execution time are ordered by command number.
  *
  *  \par Assumptions, External Events, and Notes:
- *        None
+ *        The list must not be the ATS time index scratch list, which is
+ *        used as a work area.  Every command in the list must be loaded.
+ *
+ *  \param [in]    AtsIndex        ATS array index selection
+ *  \param [in]    List            List of ATS command numbers to sort
+ *  \param [in]    ListLength      Number of elements in the list
+ */
+void SC_SortTimeIndex(SC_AtsIndex_t AtsIndex, SC_AtsCmdNumRecord_t *List, uint32 ListLength);
+
+/**
+ * \brief Merges two sorted lists of ATS commands
+ *
+ *  \par Description
+ *        This function will merge two lists of ATS commands that are
+ *        each sorted by execution time into a single sorted list.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The destination list must not overlap either input list.
  *
  *  \param [in]    AtsIndex        ATS array index selection
- *  \param [in]    NewCmdIndex     ATS command index for new list element
- *  \param [in]    ListLength      Number of elements currently in list
+ *  \param [out]   Dest            Merged list, LeftLength + RightLength elements
+ *  \param [in]    Left            First sorted list
+ *  \param [in]    LeftLength      Number of elements in the first list
+ *  \param [in]    Right           Second sorted list
+ *  \param [in]    RightLength     Number of elements in the second list
+ */
+void SC_MergeTimeIndex(SC_AtsIndex_t AtsIndex, SC_AtsCmdNumRecord_t *Dest, const SC_AtsCmdNumRecord_t *Left,
+                       uint32 LeftLength, const SC_AtsCmdNumRecord_t *Right, uint32 RightLength);
+
+/**
+ * \brief Gets the execution time of an ATS command
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The command must be loaded
+ *
+ *  \param [in]    AtsIndex        ATS array index selection
+ *  \param [in]    CmdNum          ATS command number
+ *
+ *  \return The absolute execution time of the command
  */
-void SC_Insert(SC_AtsIndex_t AtsIndex, SC_CommandIndex_t NewCmdIndex, uint32 ListLength);
+SC_AbsTimeTag_t SC_GetAtsCommandTime(SC_AtsIndex_t AtsIndex, SC_CommandNum_t CmdNum);
 
 /**
  * \brief Initializes ATS tables before a load starts
@@ -41,9 +41,6 @@
 
 #define UT_SC_NOMINAL_CMD_SIZE (SC_PACKET_MAX_SIZE / 2)
 
-static const SC_SeqIndex_t UT_SEQ_INDEX_0 = SC_IDX_FROM_UINT(0);
-static const SC_SeqIndex_t UT_SEQ_INDEX_1 = SC_IDX_FROM_UINT(1);
-
 /*
  * Function Definitions
  */
@@ -74,6 +71,58 @@ void UT_SC_SetMsgId(CFE_SB_MsgId_t MsgId)
     UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetMsgId), UT_SC_CmdTableMidHandler, &TestCaseMsgId);
 }
 
+void UT_SC_AtsEntryTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    SC_AtsEntryHeader_t *Entry = UT_Hook_GetArgValueByName(Context, "Entry", SC_AtsEntryHeader_t *);
+    SC_AbsTimeTag_t      Time  = Entry->TimeTag_LS;
+
+    UT_Stub_SetReturnValue(FuncKey, Time);
+}
+
+void UT_SC_CompareAbsTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    SC_AbsTimeTag_t AbsTime1 = UT_Hook_GetArgValueByName(Context, "AbsTime1", SC_AbsTimeTag_t);
+    SC_AbsTimeTag_t AbsTime2 = UT_Hook_GetArgValueByName(Context, "AbsTime2", SC_AbsTimeTag_t);
+    bool            Status   = (AbsTime1 > AbsTime2);
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+/* Makes the time index helpers see real command times, taken from the low word of the time tag */
+void UT_SC_SetupAtsTimeHandlers(void)
+{
+    UT_SetHandlerFunction(UT_KEY(SC_GetAtsEntryTime), UT_SC_AtsEntryTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(SC_CompareAbsTime), UT_SC_CompareAbsTimeHandler, NULL);
+}
+
+/* Places a loaded command directly into an ATS table */
+void UT_SC_SetupLoadedAtsCmd(SC_AtsIndex_t AtsIndex, uint16 CmdNumber, uint16 EntryOffset, uint16 TimeTag)
+{
+    SC_AtsEntry_t *   EntryPtr = SC_GetAtsEntryAtOffset(AtsIndex, SC_ENTRY_OFFSET_C(EntryOffset));
+    SC_CommandIndex_t CmdIndex = SC_CommandNumToIndex(SC_COMMAND_NUM_C(CmdNumber));
+
+    EntryPtr->Header.CmdNumber  = SC_COMMAND_NUM_C(CmdNumber);
+    EntryPtr->Header.TimeTag_LS = TimeTag;
+
+    SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex)->Offset    = SC_ENTRY_OFFSET_C(EntryOffset);
+    SC_GetAtsStatusEntryForCommand(AtsIndex, CmdIndex)->Status = SC_Status_LOADED;
+}
+
+void UT_SC_CheckTimeIndex(SC_AtsIndex_t AtsIndex, const uint16 *ExpectedCmdNums, uint32 NumExpected)
+{
+    uint32 i;
+
+    for (i = 0; i < NumExpected; i++)
+    {
+        UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i))->CmdNum),
+                           ExpectedCmdNums[i]);
+    }
+    if (NumExpected < SC_MAX_ATS_CMDS)
+    {
+        UtAssert_BOOL_TRUE(SC_IDNUM_IS_NULL(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i))->CmdNum));
+    }
+}
+
 void UT_SC_Loads_Test_Setup(void)
 {
     SC_Test_Setup();
@@ -550,96 +599,120 @@ void SC_BuildTimeIndexTable_Test_InvalidIndex(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void SC_Insert_Test(void)
+void SC_BuildTimeIndexTable_Test_Sorted(void)
 {
-    SC_AtsIndex_t         AtsIndex    = SC_ATS_IDX_C(0);
-    uint8                 ListLength  = 1;
-    SC_CommandIndex_t     NewCmdIndex = SC_COMMAND_IDX_C(0);
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec0;
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec1;
+    SC_AtsIndex_t AtsIndex   = SC_ATS_IDX_C(0);
+    const uint16  Expected[] = {4, 2, 5, 1, 3};
 
-    AtsCmdNumRec0 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_0);
-    AtsCmdNumRec1 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_1);
+    SC_InitAtsTables(AtsIndex);
+    UT_SC_SetupAtsTimeHandlers();
+
+    /* an odd number of merge passes, commands 2 and 5 have the same time */
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 1, 0, 30);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 2, 8, 20);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 3, 16, 50);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 4, 24, 10);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 5, 32, 20);
 
-    AtsCmdNumRec0->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
+    /* a stale entry past the end of the list must be cleared */
+    SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(5))->CmdNum = SC_COMMAND_NUM_C(6);
 
     /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    SC_BuildTimeIndexTable(AtsIndex);
 
     /* Verify results */
+    UT_SC_CheckTimeIndex(AtsIndex, Expected, 5);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, AtsCmdNumRec0->CmdNum);
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, SC_CommandIndexToNum(NewCmdIndex));
 }
 
-void SC_Insert_Test_MiddleOfList(void)
+void SC_SortTimeIndex_Test(void)
 {
-    SC_AtsIndex_t         AtsIndex    = SC_ATS_IDX_C(0);
-    uint8                 ListLength  = 1;
-    SC_CommandIndex_t     NewCmdIndex = SC_COMMAND_IDX_C(0);
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec0;
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec1;
-
-    AtsCmdNumRec0 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_0);
-    AtsCmdNumRec1 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_1);
-
-    /* Set to cause SC_CompareAbsTime to return false, in order to reach block starting with
-      "new cmd will execute at same time or after this list entry" */
-    UT_SetDeferredRetcode(UT_KEY(SC_CompareAbsTime), 1, false);
-
-    AtsCmdNumRec0->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
-
-    /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    SC_AtsIndex_t        AtsIndex   = SC_ATS_IDX_C(0);
+    const uint16         Expected[] = {3, 4, 1, 2};
+    SC_AtsCmdNumRecord_t List[4];
+    uint32               i;
 
-    /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, AtsCmdNumRec0->CmdNum);
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, SC_CommandIndexToNum(NewCmdIndex));
+    SC_InitAtsTables(AtsIndex);
+    UT_SC_SetupAtsTimeHandlers();
+
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 1, 0, 30);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 2, 8, 40);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 3, 16, 10);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 4, 24, 20);
+
+    /* empty and single entry lists are already sorted */
+    List[0].CmdNum = SC_COMMAND_NUM_C(2);
+    UtAssert_VOIDCALL(SC_SortTimeIndex(AtsIndex, List, 0));
+    UtAssert_VOIDCALL(SC_SortTimeIndex(AtsIndex, List, 1));
+    UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(List[0].CmdNum), 2);
+    UtAssert_STUB_COUNT(SC_CompareAbsTime, 0);
+
+    /* an even number of merge passes, in reverse time order */
+    List[0].CmdNum = SC_COMMAND_NUM_C(2);
+    List[1].CmdNum = SC_COMMAND_NUM_C(1);
+    List[2].CmdNum = SC_COMMAND_NUM_C(4);
+    List[3].CmdNum = SC_COMMAND_NUM_C(3);
+    UtAssert_VOIDCALL(SC_SortTimeIndex(AtsIndex, List, 4));
+
+    for (i = 0; i < 4; i++)
+    {
+        UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(List[i].CmdNum), Expected[i]);
+    }
 }
 
-void SC_Insert_Test_MiddleOfListCompareAbsTimeTrue(void)
+void SC_MergeTimeIndex_Test(void)
 {
-    SC_AtsIndex_t         AtsIndex    = SC_ATS_IDX_C(0);
-    uint8                 ListLength  = 1;
-    SC_CommandIndex_t     NewCmdIndex = SC_COMMAND_IDX_C(0);
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec0;
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec1;
+    SC_AtsIndex_t        AtsIndex   = SC_ATS_IDX_C(0);
+    const uint16         Expected[] = {1, 2, 3, 4, 5};
+    SC_AtsCmdNumRecord_t Left[3];
+    SC_AtsCmdNumRecord_t Right[2];
+    SC_AtsCmdNumRecord_t Dest[5];
+    uint32               i;
 
-    AtsCmdNumRec0 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_0);
-    AtsCmdNumRec1 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_1);
+    SC_InitAtsTables(AtsIndex);
+    UT_SC_SetupAtsTimeHandlers();
 
-    /* Set to cause SC_CompareAbsTime to return false, in order to reach block starting with
-      "new cmd will execute at same time or after this list entry" */
-    UT_SetDeferredRetcode(UT_KEY(SC_CompareAbsTime), 1, true);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 1, 0, 10);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 2, 8, 20);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 3, 16, 20);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 4, 24, 20);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 5, 32, 30);
 
-    AtsCmdNumRec0->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
+    /* commands with the same time end up in command number order whichever list they are in */
+    Left[0].CmdNum  = SC_COMMAND_NUM_C(1);
+    Left[1].CmdNum  = SC_COMMAND_NUM_C(4);
+    Left[2].CmdNum  = SC_COMMAND_NUM_C(5);
+    Right[0].CmdNum = SC_COMMAND_NUM_C(2);
+    Right[1].CmdNum = SC_COMMAND_NUM_C(3);
 
     /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    UtAssert_VOIDCALL(SC_MergeTimeIndex(AtsIndex, Dest, Left, 3, Right, 2));
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    for (i = 0; i < 5; i++)
+    {
+        UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(Dest[i].CmdNum), Expected[i]);
+    }
 
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, AtsCmdNumRec0->CmdNum);
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, SC_CommandIndexToNum(NewCmdIndex));
+    /* either list may be empty */
+    UtAssert_VOIDCALL(SC_MergeTimeIndex(AtsIndex, Dest, Left, 0, Right, 2));
+    UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(Dest[0].CmdNum), 2);
+    UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(Dest[1].CmdNum), 3);
+    UtAssert_VOIDCALL(SC_MergeTimeIndex(AtsIndex, Dest, Left, 3, Right, 0));
+    UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(Dest[0].CmdNum), 1);
+    UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(Dest[1].CmdNum), 4);
+    UtAssert_UINT32_EQ(SC_IDNUM_AS_UINT(Dest[2].CmdNum), 5);
 }
 
-void SC_Insert_Test_InvalidIndex(void)
+void SC_GetAtsCommandTime_Test(void)
 {
-    SC_AtsIndex_t     AtsIndex    = SC_ATS_IDX_C(SC_NUMBER_OF_ATS);
-    uint8             ListLength  = 1;
-    SC_CommandIndex_t NewCmdIndex = SC_COMMAND_IDX_C(0);
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(1);
 
-    /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    UT_SC_SetupAtsTimeHandlers();
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 7, 12, 1234);
 
-    /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_INSERTATS_INV_INDEX_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(SC_GetAtsCommandTime(AtsIndex, SC_COMMAND_NUM_C(7)), 1234);
 }
 
 void SC_InitAtsTables_Test_InvalidIndex(void)
@@ -1078,6 +1151,51 @@ void SC_ProcessAppend_Test(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void SC_ProcessAppend_Test_MergeTimeIndex(void)
+{
+    SC_AtsIndex_t        AtsIndex   = SC_ATS_IDX_C(0);
+    const uint16         Expected[] = {2, 4, 1, 3, 5};
+    void *               TailPtr;
+    SC_AtsEntryHeader_t *Entry;
+    SC_AtsInfoTable_t *  AtsInfoPtr;
+
+    AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
+
+    SC_InitAtsTables(AtsIndex);
+    UT_SC_SetupAtsTimeHandlers();
+
+    /* existing ATS, time ordered as 2, 3, 1 */
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 1, 0, 30);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 2, 8, 10);
+    UT_SC_SetupLoadedAtsCmd(AtsIndex, 3, 16, 20);
+    AtsInfoPtr->AtsSize          = 24;
+    AtsInfoPtr->NumberOfCommands = 3;
+    SC_BuildTimeIndexTable(AtsIndex);
+
+    /* replace command 3, add commands 5 and 4, then replace command 5 again */
+    TailPtr           = UT_SC_GetAppendTable();
+    Entry             = UT_SC_AppendSingleAtsEntry(&TailPtr, 3, UT_SC_NOMINAL_CMD_SIZE);
+    Entry->TimeTag_LS = 40;
+    Entry             = UT_SC_AppendSingleAtsEntry(&TailPtr, 5, UT_SC_NOMINAL_CMD_SIZE);
+    Entry->TimeTag_LS = 15;
+    Entry             = UT_SC_AppendSingleAtsEntry(&TailPtr, 4, UT_SC_NOMINAL_CMD_SIZE);
+    Entry->TimeTag_LS = 10;
+    Entry             = UT_SC_AppendSingleAtsEntry(&TailPtr, 5, UT_SC_NOMINAL_CMD_SIZE);
+    Entry->TimeTag_LS = 50;
+
+    SC_AppData.AppendWordCount                    = (uint32 *)TailPtr - (uint32 *)UT_SC_GetAppendTable();
+    SC_OperData.HkPacket.Payload.AppendEntryCount = 4;
+
+    /* Execute the function being tested */
+    SC_ProcessAppend(AtsIndex);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(AtsInfoPtr->NumberOfCommands, 5);
+    UT_SC_CheckTimeIndex(AtsIndex, Expected, 5);
+    UtAssert_STUB_COUNT(SC_BeginAts, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void SC_ProcessAppend_Test_CmdLoaded(void)
 {
     SC_AtsIndex_t                 AtsIndex = SC_ATS_IDX_C(0);
@@ -1470,11 +1588,11 @@ void UtTest_Setup(void)
 
     UtTest_Add(SC_BuildTimeIndexTable_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_BuildTimeIndexTable_Test_InvalidIndex");
-    UtTest_Add(SC_Insert_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_Insert_Test");
-    UtTest_Add(SC_Insert_Test_MiddleOfList, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_Insert_Test_MiddleOfList");
-    UtTest_Add(SC_Insert_Test_MiddleOfListCompareAbsTimeTrue, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
-               "SC_Insert_Test_MiddleOfListCompareAbsTimeTrue");
-    UtTest_Add(SC_Insert_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_Insert_Test_InvalidIndex");
+    UtTest_Add(SC_BuildTimeIndexTable_Test_Sorted, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_BuildTimeIndexTable_Test_Sorted");
+    UtTest_Add(SC_SortTimeIndex_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_SortTimeIndex_Test");
+    UtTest_Add(SC_MergeTimeIndex_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_MergeTimeIndex_Test");
+    UtTest_Add(SC_GetAtsCommandTime_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_GetAtsCommandTime_Test");
     UtTest_Add(SC_InitAtsTables_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_InitAtsTables_Test_InvalidIndex");
     UtTest_Add(SC_ValidateAts_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_ValidateAts_Test");
@@ -1512,6 +1630,8 @@ void UtTest_Setup(void)
     UtTest_Add(SC_UpdateAppend_Test_CmdNumberTooHigh, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_UpdateAppend_Test_CmdNumberTooHigh");
     UtTest_Add(SC_ProcessAppend_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_ProcessAppend_Test");
+    UtTest_Add(SC_ProcessAppend_Test_MergeTimeIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAppend_Test_MergeTimeIndex");
     UtTest_Add(SC_ProcessAppend_Test_CmdLoaded, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_ProcessAppend_Test_CmdLoaded");
     UtTest_Add(SC_ProcessAppend_Test_NotExecuting, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
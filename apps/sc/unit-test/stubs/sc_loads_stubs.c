@@ -40,28 +40,31 @@ void SC_BuildTimeIndexTable(SC_AtsIndex_t AtsIndex)
 
 /*
  * ----------------------------------------------------
- * Generated stub function for SC_InitAtsTables()
+ * Generated stub function for SC_GetAtsCommandTime()
  * ----------------------------------------------------
  */
-void SC_InitAtsTables(SC_AtsIndex_t AtsIndex)
+SC_AbsTimeTag_t SC_GetAtsCommandTime(SC_AtsIndex_t AtsIndex, SC_CommandNum_t CmdNum)
 {
-    UT_GenStub_AddParam(SC_InitAtsTables, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_SetupReturnBuffer(SC_GetAtsCommandTime, SC_AbsTimeTag_t);
 
-    UT_GenStub_Execute(SC_InitAtsTables, Basic, NULL);
+    UT_GenStub_AddParam(SC_GetAtsCommandTime, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_AddParam(SC_GetAtsCommandTime, SC_CommandNum_t, CmdNum);
+
+    UT_GenStub_Execute(SC_GetAtsCommandTime, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_GetAtsCommandTime, SC_AbsTimeTag_t);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for SC_Insert()
+ * Generated stub function for SC_InitAtsTables()
  * ----------------------------------------------------
  */
-void SC_Insert(SC_AtsIndex_t AtsIndex, SC_CommandIndex_t NewCmdIndex, uint32 ListLength)
+void SC_InitAtsTables(SC_AtsIndex_t AtsIndex)
 {
-    UT_GenStub_AddParam(SC_Insert, SC_AtsIndex_t, AtsIndex);
-    UT_GenStub_AddParam(SC_Insert, SC_CommandIndex_t, NewCmdIndex);
-    UT_GenStub_AddParam(SC_Insert, uint32, ListLength);
+    UT_GenStub_AddParam(SC_InitAtsTables, SC_AtsIndex_t, AtsIndex);
 
-    UT_GenStub_Execute(SC_Insert, Basic, NULL);
+    UT_GenStub_Execute(SC_InitAtsTables, Basic, NULL);
 }
 
 /*
@@ -88,6 +91,24 @@ void SC_LoadRts(SC_RtsIndex_t RtsIndex)
     UT_GenStub_Execute(SC_LoadRts, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_MergeTimeIndex()
+ * ----------------------------------------------------
+ */
+void SC_MergeTimeIndex(SC_AtsIndex_t AtsIndex, SC_AtsCmdNumRecord_t *Dest, const SC_AtsCmdNumRecord_t *Left,
+                       uint32 LeftLength, const SC_AtsCmdNumRecord_t *Right, uint32 RightLength)
+{
+    UT_GenStub_AddParam(SC_MergeTimeIndex, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_AddParam(SC_MergeTimeIndex, SC_AtsCmdNumRecord_t *, Dest);
+    UT_GenStub_AddParam(SC_MergeTimeIndex, const SC_AtsCmdNumRecord_t *, Left);
+    UT_GenStub_AddParam(SC_MergeTimeIndex, uint32, LeftLength);
+    UT_GenStub_AddParam(SC_MergeTimeIndex, const SC_AtsCmdNumRecord_t *, Right);
+    UT_GenStub_AddParam(SC_MergeTimeIndex, uint32, RightLength);
+
+    UT_GenStub_Execute(SC_MergeTimeIndex, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ParseRts()
@@ -114,6 +135,20 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
     UT_GenStub_Execute(SC_ProcessAppend, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SortTimeIndex()
+ * ----------------------------------------------------
+ */
+void SC_SortTimeIndex(SC_AtsIndex_t AtsIndex, SC_AtsCmdNumRecord_t *List, uint32 ListLength)
+{
+    UT_GenStub_AddParam(SC_SortTimeIndex, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_AddParam(SC_SortTimeIndex, SC_AtsCmdNumRecord_t *, List);
+    UT_GenStub_AddParam(SC_SortTimeIndex, uint32, ListLength);
+
+    UT_GenStub_Execute(SC_SortTimeIndex, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_UpdateAppend()
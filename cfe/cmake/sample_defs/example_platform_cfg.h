@@ -900,6 +900,46 @@
 */
 #define CFE_PLATFORM_EVS_START_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
 
+/**
+**  \cfeevscfg Define Deferred Event Queue Depth
+**
+**  \par Description:
+**       Number of events that may be waiting in the deferred event queue.
+**       Applications that select deferred mode with #CFE_EVS_SetDeferredMode
+**       queue their events here, and the EVS deferred event task logs and
+**       sends them.  Events sent while the queue is full are discarded.
+**
+**  \par Limits
+**       Must be a power of two, such as 64, to enable deferred mode.  The
+**       default of 0 disables deferred mode and the deferred event task
+**       is not created.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH 0
+
+/**
+**  \cfeevscfg Define EVS Deferred Event Task Priority
+**
+**  \par Description:
+**       Defines the priority of the EVS child task that sends deferred events.
+**       This should be lower (numerically higher) than the priority of the
+**       applications that use deferred mode.
+**
+**  \par Limits
+**       Not Applicable
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_TASK_PRIORITY 200
+
+/**
+**  \cfeevscfg Define EVS Deferred Event Task Stack Size
+**
+**  \par Description:
+**       Defines the stack size of the EVS child task that sends deferred events.
+**
+**  \par Limits
+**       There is a lower limit of 2048 on this configuration parameter.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
+
 /**
 **  \cfeevscfg Define Maximum Number of Event Filters per Application
 **
@@ -1119,8 +1159,8 @@
 **       sends, the SB dynamically allocates from this memory pool, the memory needed
 **       to process the message. The memory needed to process each message is msg
 **       size + msg descriptor(CFE_SB_BufferD_t). This memory pool is also used
-**       to allocate destination descriptors (CFE_SB_DestinationD_t) during the
-**       subscription process.
+**       to allocate the per-route destination lists (CFE_SB_DestinationList_t)
+**       during the subscription process.
 **       To see the run-time, high-water mark and the current utilization figures
 **       regarding this parameter, send an SB command to 'Send Statistics Pkt'.
 **       Some memory statistics have been added to the SB housekeeping packet.
@@ -1373,6 +1413,20 @@
 */
 #define CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE 16384
 
+/**
+**  \cfetblcfg Size of the Chunks Used to Stream a Table Image From a File
+**
+**  \par Description:
+**       Table file loads read the table image into the working buffer in chunks
+**       of at most this many bytes, and fold each chunk into the table CRC while
+**       it is still in the data cache.  Larger values mean fewer file system calls,
+**       smaller values keep each chunk within the cache of the processor.
+**
+**  \par Limits
+**       This parameter must be greater than zero and a multiple of 4.
+*/
+#define CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE 16384
+
 /**
 **  \cfetblcfg Maximum Number of Tables Allowed to be Registered
 **
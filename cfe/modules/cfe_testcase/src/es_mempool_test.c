@@ -36,6 +36,25 @@ typedef struct
 
 static CFE_FT_PoolMemBlock_t CFE_FT_PoolMemBlock[CFE_PLATFORM_ES_MAX_MEMORY_POOLS + 1];
 
+/*
+ * Pool stress test parameters.  The buffers are held in a ring, like
+ * messages sitting in pipes, and each one is put back then replaced
+ * by a buffer of the next size in the list.
+ */
+#define CFE_FT_POOL_STRESS_DEPTH      32
+#define CFE_FT_POOL_STRESS_ITERATIONS 1000000
+
+/*
+ * Request sizes loosely following software bus traffic: mostly
+ * small commands and housekeeping packets, some larger telemetry,
+ * and the occasional bulk data transfer.  The count is deliberately
+ * not a factor of the ring depth, so each slot cycles through sizes.
+ */
+static const size_t CFE_FT_PoolStressSizes[] = {12, 16, 64,  24, 180, 8,  32,  300, 20,
+                                                40, 96, 1024, 16, 140, 48, 256, 4000};
+
+static uint32 CFE_FT_PoolStressMem[16384];
+
 void TestMemPoolCreate(void)
 {
     CFE_ES_MemHandle_t PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
@@ -199,6 +218,74 @@ void TestMemPoolDelete(void)
     UtAssert_INT32_EQ(CFE_ES_PoolDelete(CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 }
 
+void RunMemPoolStress(bool UseMutex)
+{
+    CFE_ES_MemHandle_t  PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_ES_MemPoolBuf_t BufList[CFE_FT_POOL_STRESS_DEPTH];
+    OS_time_t           StartTime;
+    OS_time_t           ElapsedTime;
+    int64               AvgRate;
+    uint32              Count;
+    uint32              Slot;
+    size_t              ReqSize;
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateEx(&PoolID, CFE_FT_PoolStressMem, sizeof(CFE_FT_PoolStressMem), 0, NULL,
+                                          UseMutex),
+                      CFE_SUCCESS);
+
+    for (Slot = 0; Slot < CFE_FT_POOL_STRESS_DEPTH; ++Slot)
+    {
+        ReqSize = CFE_FT_PoolStressSizes[Slot % (sizeof(CFE_FT_PoolStressSizes) / sizeof(size_t))];
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&BufList[Slot], PoolID, ReqSize), ReqSize);
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+
+    for (Count = CFE_FT_POOL_STRESS_DEPTH; Count < CFE_FT_POOL_STRESS_ITERATIONS; ++Count)
+    {
+        Slot    = Count % CFE_FT_POOL_STRESS_DEPTH;
+        ReqSize = CFE_FT_PoolStressSizes[Count % (sizeof(CFE_FT_PoolStressSizes) / sizeof(size_t))];
+
+        /* In order to not "flood" with test results, only report a failure */
+        if (CFE_ES_PutPoolBuf(PoolID, BufList[Slot]) < 0 || CFE_ES_GetPoolBuf(&BufList[Slot], PoolID, ReqSize) < 0)
+        {
+            break;
+        }
+    }
+
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+    UtAssert_UINT32_EQ(Count, CFE_FT_POOL_STRESS_ITERATIONS);
+
+    UtAssert_MIR("Elapsed time for %lu pool put/get pairs: %lu usec",
+                 (unsigned long)(CFE_FT_POOL_STRESS_ITERATIONS - CFE_FT_POOL_STRESS_DEPTH),
+                 (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+    AvgRate = OS_TimeGetTotalMilliseconds(ElapsedTime);
+    if (AvgRate > 0)
+    {
+        AvgRate = ((int64)(Count - CFE_FT_POOL_STRESS_DEPTH) * 10000) / AvgRate;
+        UtAssert_MIR("Pool Rate: %ld.%01ld put/get pairs/sec", (long)(AvgRate / 10), (long)(AvgRate % 10));
+    }
+    else
+    {
+        /* If the entire test took less than a millisecond, then there is a config error */
+        UtAssert_Failed("Test configuration error: Executed too fast, needs more cycles!");
+    }
+
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
+}
+
+void TestMemPoolStress(void)
+{
+    UtPrintf("Testing: CFE_ES_GetPoolBuf, CFE_ES_PutPoolBuf throughput without mutex");
+    RunMemPoolStress(CFE_ES_NO_MUTEX);
+
+    UtPrintf("Testing: CFE_ES_GetPoolBuf, CFE_ES_PutPoolBuf throughput with mutex");
+    RunMemPoolStress(CFE_ES_USE_MUTEX);
+}
+
 void ESMemPoolTestSetup(void)
 {
     UtTest_Add(TestMemPoolCreate, NULL, NULL, "Test Mem Pool Create");
@@ -207,4 +294,5 @@ void ESMemPoolTestSetup(void)
     UtTest_Add(TestMemPoolBufInfo, NULL, NULL, "Test Mem Pool Buf Info");
     UtTest_Add(TestMemPoolPutBuf, NULL, NULL, "Test Mem Pool Put Buf");
     UtTest_Add(TestMemPoolDelete, NULL, NULL, "Test Mem Pool Delete");
+    UtTest_Add(TestMemPoolStress, NULL, NULL, "Test Mem Pool Stress");
 }
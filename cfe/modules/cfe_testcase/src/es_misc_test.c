@@ -35,6 +35,7 @@ void TestCalculateCRC(void)
     static const char CRC_OTHER_INPUT[] = "Random Stuff";
 
     uint32 inputCrc = 345353;
+    uint32 DefaultCheckValue;
 
     UtPrintf("Testing: CFE_ES_CalculateCRC");
 
@@ -48,13 +49,36 @@ void TestCalculateCRC(void)
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_16_ARC),
                        0xBB3D);
 
+    /* The CFE_ES_CrcType_32_C algorithm check value result is 0xe3069283 */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_32_C),
+                       0xE3069283);
+
+    /* The CFE_ES_CrcType_32_ISO_HDLC algorithm check value result is 0xcbf43926 */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_ES_CrcType_32_ISO_HDLC),
+                       0xCBF43926);
+
     /*
-     * In this version of CFE, only CRC-16/ARC is defined, so the default must be the same.  In a future version of CFE,
-     * if more than one option is available, this can go back to an "MIR" case, and the user must compare the result
-     * to the check value for what they have actully configured as the default CRC.
+     * The default must be one of the implemented algorithms, so the result must be the
+     * check value for whichever algorithm has been configured as the default CRC.
      */
+    switch (CFE_MISSION_ES_DEFAULT_CRC)
+    {
+        case CFE_ES_CrcType_16_ARC:
+            DefaultCheckValue = 0xBB3D;
+            break;
+        case CFE_ES_CrcType_32_C:
+            DefaultCheckValue = 0xE3069283;
+            break;
+        case CFE_ES_CrcType_32_ISO_HDLC:
+            DefaultCheckValue = 0xCBF43926;
+            break;
+        default:
+            UtAssert_Failed("Default CRC type %d is not implemented", (int)CFE_MISSION_ES_DEFAULT_CRC);
+            DefaultCheckValue = 0;
+            break;
+    }
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_CHECK_INPUT, sizeof(CRC_CHECK_INPUT) - 1, 0, CFE_MISSION_ES_DEFAULT_CRC),
-                       0xBB3D);
+                       DefaultCheckValue);
 
     /* Compute a secondary string - the reference value obtained using 3rd party tool implementing same algorithm */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, sizeof(CRC_OTHER_INPUT) - 1, 0, CFE_ES_CrcType_16_ARC),
@@ -70,6 +94,77 @@ void TestCalculateCRC(void)
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CRC_OTHER_INPUT, 0, inputCrc, CFE_ES_CrcType_16_ARC), inputCrc);
 }
 
+/* Size of the buffer used to measure CRC throughput, similar to a large table or memory region */
+#define CFE_FT_CRC_BUFFER_SIZE 65536
+
+/* Number of times the buffer is checksummed for each algorithm */
+#define CFE_FT_CRC_ITERATIONS 256
+
+/*
+ * Throughput of each CRC algorithm over a large buffer
+ *
+ * This characterizes the cost of checksumming large memory regions, as done by table
+ * loads and background checksum apps.  Compare the rates before and after changes to
+ * the CRC implementation, or between targets with and without hardware CRC support.
+ */
+void TestCalculateCRCThroughput(void)
+{
+    static uint8 CrcBuffer[CFE_FT_CRC_BUFFER_SIZE];
+
+    static const struct
+    {
+        CFE_ES_CrcType_Enum_t CrcType;
+        const char *          Name;
+    } CRC_TYPE_LIST[] = {
+        {CFE_ES_CrcType_16_ARC, "CRC-16/ARC"},
+        {CFE_ES_CrcType_32_C, "CRC-32C"},
+        {CFE_ES_CrcType_32_ISO_HDLC, "CRC-32"},
+    };
+
+    uint32    i;
+    uint32    j;
+    uint32    Crc;
+    OS_time_t StartTime;
+    OS_time_t ElapsedTime;
+    int64     AvgRate;
+
+    UtPrintf("Testing: CFE_ES_CalculateCRC throughput");
+
+    for (i = 0; i < sizeof(CrcBuffer); ++i)
+    {
+        CrcBuffer[i] = (uint8)(i * 7);
+    }
+
+    for (j = 0; j < sizeof(CRC_TYPE_LIST) / sizeof(CRC_TYPE_LIST[0]); ++j)
+    {
+        Crc = 0;
+        CFE_PSP_GetTime(&StartTime);
+        for (i = 0; i < CFE_FT_CRC_ITERATIONS; ++i)
+        {
+            Crc = CFE_ES_CalculateCRC(CrcBuffer, sizeof(CrcBuffer), Crc, CRC_TYPE_LIST[j].CrcType);
+        }
+        CFE_PSP_GetTime(&ElapsedTime);
+        ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+        UtAssert_MIR("Elapsed time for %s over %lu bytes: %lu usec (result 0x%08lx)", CRC_TYPE_LIST[j].Name,
+                     (unsigned long)sizeof(CrcBuffer) * CFE_FT_CRC_ITERATIONS,
+                     (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime), (unsigned long)Crc);
+
+        AvgRate = OS_TimeGetTotalMicroseconds(ElapsedTime);
+        if (AvgRate > 0)
+        {
+            /* bytes per usec is the same as MB per second */
+            AvgRate = ((int64)sizeof(CrcBuffer) * CFE_FT_CRC_ITERATIONS * 10) / AvgRate;
+            UtAssert_MIR("%s Rate: %ld.%01ld MB/sec", CRC_TYPE_LIST[j].Name, (long)(AvgRate / 10),
+                         (long)(AvgRate % 10));
+        }
+        else
+        {
+            UtAssert_Failed("Test configuration error: Executed too fast, needs more cycles!");
+        }
+    }
+}
+
 void TestWriteToSysLog(void)
 {
     const char *TestString = "Test String for CFE_ES_WriteToSysLog Functional Test";
@@ -122,6 +217,7 @@ void TestBackgroundWakeup(void)
 void ESMiscTestSetup(void)
 {
     UtTest_Add(TestCalculateCRC, NULL, NULL, "Test Calculate CRC");
+    UtTest_Add(TestCalculateCRCThroughput, NULL, NULL, "Test Calculate CRC Throughput");
     UtTest_Add(TestWriteToSysLog, NULL, NULL, "Test Write To Sys Log");
     UtTest_Add(TestProcessAsyncEvent, NULL, NULL, "Test Process Async Event");
     UtTest_Add(TestBackgroundWakeup, NULL, NULL, "Test Background Wakeup");
@@ -26,6 +26,8 @@
  */
 
 #include "cfe_test.h"
+#include "cfe_msgids.h"
+#include "cfe_es_msg.h"
 
 void TestPerfLogEntry(void)
 {
@@ -61,10 +63,131 @@ void TestPerfLogTrigger(void)
     UtAssert_VOIDCALL(CFE_ES_PerfLogExit(126));
 }
 
+/* Number of tasks recording markers at the same time in the marker contention test */
+#define CFE_FT_PERF_NUM_TASKS 4
+
+/* Number of entry/exit pairs recorded by each task in the marker contention test */
+#define CFE_FT_PERF_MARKER_PAIRS 250000
+
+/* Marker ID used by the contention test, not expected to be in the trigger mask */
+#define CFE_FT_PERF_MARKER_ID (CFE_MISSION_ES_PERF_MAX_IDS - 2)
+
+/* State structure for the marker contention test - shared between threads */
+typedef struct CFE_FT_PerfMarkerState
+{
+    volatile uint32 TasksFinished;
+
+    CFE_ES_TaskId_t TaskId[CFE_FT_PERF_NUM_TASKS];
+} CFE_FT_PerfMarkerState_t;
+
+CFE_FT_PerfMarkerState_t CFE_FT_PerfMarker;
+
+void CFE_FT_PerfMarkerTask(void)
+{
+    uint32 i;
+
+    for (i = 0; i < CFE_FT_PERF_MARKER_PAIRS; ++i)
+    {
+        CFE_ES_PerfLogEntry(CFE_FT_PERF_MARKER_ID);
+        CFE_ES_PerfLogExit(CFE_FT_PERF_MARKER_ID);
+    }
+
+    ++CFE_FT_PerfMarker.TasksFinished;
+}
+
+static void CFE_FT_SendPerfCommand(CFE_MSG_FcnCode_t FcnCode)
+{
+    union
+    {
+        CFE_ES_StartPerfDataCmd_t StartCmd;
+        CFE_ES_StopPerfDataCmd_t  StopCmd;
+    } CmdBuf;
+    size_t CmdSize;
+
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    if (FcnCode == CFE_ES_START_PERF_DATA_CC)
+    {
+        CmdSize                             = sizeof(CmdBuf.StartCmd);
+        CmdBuf.StartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_START;
+    }
+    else
+    {
+        /* An empty file name selects the default dump file */
+        CmdSize = sizeof(CmdBuf.StopCmd);
+    }
+
+    UtAssert_INT32_EQ(CFE_MSG_Init(CFE_MSG_PTR(CmdBuf.StartCmd.CommandHeader), CFE_SB_ValueToMsgId(CFE_ES_CMD_MID),
+                                   CmdSize),
+                      CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_MSG_SetFcnCode(CFE_MSG_PTR(CmdBuf.StartCmd.CommandHeader), FcnCode), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsg(CFE_MSG_PTR(CmdBuf.StartCmd.CommandHeader), true), CFE_SUCCESS);
+
+    /* Give ES a moment to process the command */
+    OS_TaskDelay(100);
+}
+
+/*
+ * Several tasks recording performance markers at the same time
+ *
+ * This characterizes the cost of a marker while the perf log is active,
+ * including contention between tasks for the shared log.  Compare the
+ * time per marker before and after changes to the marker path.
+ */
+void TestPerfLogMarkerContention(void)
+{
+    uint32    i;
+    char      TaskName[OS_MAX_API_NAME];
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    OS_time_t ElapsedTime;
+    int64     TotalMarkers;
+    int64     AvgTime;
+
+    UtPrintf("Testing: %u tasks recording perf markers", (unsigned int)CFE_FT_PERF_NUM_TASKS);
+    memset(&CFE_FT_PerfMarker, 0, sizeof(CFE_FT_PerfMarker));
+
+    CFE_FT_SendPerfCommand(CFE_ES_START_PERF_DATA_CC);
+
+    CFE_PSP_GetTime(&StartTime);
+
+    for (i = 0; i < CFE_FT_PERF_NUM_TASKS; ++i)
+    {
+        snprintf(TaskName, sizeof(TaskName), "PerfMarker%u", (unsigned int)i);
+        UtAssert_INT32_EQ(
+            CFE_ES_CreateChildTask(&CFE_FT_PerfMarker.TaskId[i], TaskName, CFE_FT_PerfMarkerTask, NULL, 16384, 150, 0),
+            CFE_SUCCESS);
+    }
+
+    while (CFE_FT_PerfMarker.TasksFinished < CFE_FT_PERF_NUM_TASKS)
+    {
+        OS_TaskDelay(10);
+    }
+
+    CFE_PSP_GetTime(&EndTime);
+
+    CFE_FT_SendPerfCommand(CFE_ES_STOP_PERF_DATA_CC);
+
+    ElapsedTime = OS_TimeSubtract(EndTime, StartTime);
+    UtAssert_MIR("Elapsed time for perf marker test: %lu usec", (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+    TotalMarkers = (int64)CFE_FT_PERF_NUM_TASKS * CFE_FT_PERF_MARKER_PAIRS * 2;
+    AvgTime      = OS_TimeGetTotalNanoseconds(ElapsedTime);
+    if (AvgTime > 0)
+    {
+        AvgTime = (AvgTime * 10) / TotalMarkers;
+        UtAssert_MIR("Marker Time: %ld.%01ld nsec/marker", (long)(AvgTime / 10), (long)(AvgTime % 10));
+    }
+    else
+    {
+        UtAssert_Failed("Test configuration error: Executed too fast, needs more cycles!");
+    }
+}
+
 void ESPerfTestSetup(void)
 {
     UtTest_Add(TestPerfLogEntry, NULL, NULL, "Test PerfLogEntry");
     UtTest_Add(TestPerfLogExit, NULL, NULL, "Test PerfLogExit");
     UtTest_Add(TestPerfLogAdd, NULL, NULL, "Test PerfLogAdd");
     UtTest_Add(TestPerfLogTrigger, NULL, NULL, "Test Perf Trigger");
+    UtTest_Add(TestPerfLogMarkerContention, NULL, NULL, "Test Perf Marker Contention");
 }
@@ -28,6 +28,7 @@
  */
 
 #include "cfe_test.h"
+#include "cfe_evs_msg.h"
 
 void TestSendEvent(void)
 {
@@ -123,9 +124,141 @@ void TestSendTimedEvent(void)
     UtAssert_INT32_EQ(CFE_EVS_SendTimedEvent(Time, 0, CFE_EVS_EventType_CRITICAL, NULL), CFE_EVS_INVALID_PARAMETER);
 }
 
+/* Number of events sent by the filtered event rate test */
+#define CFE_FT_EVS_FILTERED_EVENTS 200000
+
+/*
+ * Rate of sending events which are filtered out
+ *
+ * Apps commonly leave debug event calls in place, relying on debug events being disabled.
+ * This characterizes what such calls cost.  Compare the rates before and after changes
+ * to the event filtering path.
+ */
+void TestSendFilteredEventRate(void)
+{
+    uint32    i;
+    OS_time_t StartTime;
+    OS_time_t ElapsedTime;
+    int64     AvgRate;
+
+    UtPrintf("Testing: CFE_EVS_SendEvent filtered event rate");
+
+    if ((CFE_PLATFORM_EVS_DEFAULT_TYPE_FLAG & CFE_EVS_EventType_DEBUG_BIT) != 0)
+    {
+        UtAssert_NA("Debug events are enabled by default, filtered event rate not tested");
+        return;
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+    for (i = 0; i < CFE_FT_EVS_FILTERED_EVENTS; ++i)
+    {
+        CFE_Assert_STATUS_STORE(
+            CFE_EVS_SendEvent(0, CFE_EVS_EventType_DEBUG, "Filtered debug event %u", (unsigned int)i));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+            break;
+        }
+    }
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+    UtAssert_MIR("Elapsed time for %lu filtered events: %lu usec", (unsigned long)i,
+                 (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+    AvgRate = OS_TimeGetTotalMilliseconds(ElapsedTime);
+    if (AvgRate > 0)
+    {
+        AvgRate = ((int64)i * 10000) / AvgRate;
+        UtAssert_MIR("Filtered Event Rate: %ld.%01ld events/sec", (long)(AvgRate / 10), (long)(AvgRate % 10));
+    }
+    else
+    {
+        UtAssert_Failed("Test configuration error: Executed too fast, needs more cycles!");
+    }
+}
+
+/* Number of events timed in each mode by the deferred event test, must fit in the squelch burst */
+#define CFE_FT_EVS_DEFERRED_EVENTS 24
+
+/*
+ * Time spent by the sending task per event, sent immediately or deferred
+ */
+static int64 TestSendEventTime(void)
+{
+    uint32    i;
+    OS_time_t StartTime;
+    OS_time_t ElapsedTime;
+
+    if (CFE_PLATFORM_EVS_MAX_APP_EVENT_BURST)
+    {
+        /* Allow squelch credits to accumulate */
+        OS_TaskDelay((CFE_PLATFORM_EVS_MAX_APP_EVENT_BURST / CFE_PLATFORM_EVS_APP_EVENTS_PER_SEC) * 1000);
+    }
+
+    /* The first event warms up the path and wakes the deferred event task, do not time it */
+    UtAssert_INT32_EQ(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Untimed event"), CFE_SUCCESS);
+
+    CFE_PSP_GetTime(&StartTime);
+    for (i = 0; i < CFE_FT_EVS_DEFERRED_EVENTS; ++i)
+    {
+        CFE_Assert_STATUS_STORE(
+            CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Timed event %u", (unsigned int)i));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            break;
+        }
+    }
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+    CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+
+    return OS_TimeGetTotalNanoseconds(ElapsedTime) / CFE_FT_EVS_DEFERRED_EVENTS;
+}
+
+/*
+ * Cost of an event to the sending task, with and without deferred mode
+ *
+ * In deferred mode the EVS deferred event task logs and sends the event,
+ * so the sender only pays for formatting the text and queuing it.
+ */
+void TestSendDeferredEvent(void)
+{
+    int64 ImmediateTime;
+    int64 DeferredTime;
+
+    UtPrintf("Testing: CFE_EVS_SetDeferredMode");
+
+    if (CFE_EVS_SetDeferredMode(true) == CFE_EVS_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("Deferred event mode is disabled");
+        return;
+    }
+
+    UtAssert_INT32_EQ(CFE_EVS_SetDeferredMode(false), CFE_SUCCESS);
+    ImmediateTime = TestSendEventTime();
+
+    UtAssert_INT32_EQ(CFE_EVS_SetDeferredMode(true), CFE_SUCCESS);
+    DeferredTime = TestSendEventTime();
+
+    UtAssert_INT32_EQ(CFE_EVS_SetDeferredMode(false), CFE_SUCCESS);
+
+    UtAssert_MIR("Immediate event: %ld nsec per event to the sender", (long)ImmediateTime);
+    UtAssert_MIR("Deferred event: %ld nsec per event to the sender", (long)DeferredTime);
+
+    if (CFE_PLATFORM_EVS_MAX_APP_EVENT_BURST)
+    {
+        /* Allow squelch credits to accumulate */
+        OS_TaskDelay((CFE_PLATFORM_EVS_MAX_APP_EVENT_BURST / CFE_PLATFORM_EVS_APP_EVENTS_PER_SEC) * 1000);
+    }
+}
+
 void EVSSendTestSetup(void)
 {
     UtTest_Add(TestSendEvent, NULL, NULL, "Test Send Event");
     UtTest_Add(TestSendEventAppID, NULL, NULL, "Test Send Event with App ID");
     UtTest_Add(TestSendTimedEvent, NULL, NULL, "Test Send Timed Event");
+    UtTest_Add(TestSendFilteredEventRate, NULL, NULL, "Test Send Filtered Event Rate");
+    UtTest_Add(TestSendDeferredEvent, NULL, NULL, "Test Send Deferred Event");
 }
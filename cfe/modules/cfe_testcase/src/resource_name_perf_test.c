@@ -0,0 +1,193 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Functional test of the performance of registering and looking up
+ * named resources (tables, pipes and apps)
+ *
+ * This mimics the startup of a system with many apps, each registering
+ * several named resources and looking up those of other apps by name.
+ * The registries are filled as far as the platform configuration allows,
+ * so each lookup searches a full registry.
+ */
+
+#include "cfe_test.h"
+
+/* Number of times every registered name is looked up during a test */
+#define CFE_FT_NAME_LOOKUP_PASSES 16
+
+/*
+ * Reports the average time per operation, in nanoseconds as lookups
+ * may be well under a microsecond each
+ */
+static void NamePerfTest_Report(const char *What, OS_time_t StartTime, uint32 Count)
+{
+    OS_time_t ElapsedTime;
+
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+    if (Count > 0)
+    {
+        UtAssert_MIR("%s: %lu operations, %ld nsec per operation", What, (unsigned long)Count,
+                     (long)(OS_TimeGetTotalNanoseconds(ElapsedTime) / Count));
+    }
+}
+
+void TestTableNameLookupPerf(void)
+{
+    CFE_TBL_Handle_t TblHandles[CFE_PLATFORM_TBL_MAX_NUM_TABLES];
+    char             TblName[CFE_MISSION_TBL_MAX_NAME_LENGTH];
+    char             FullTblName[CFE_MISSION_TBL_MAX_FULL_NAME_LEN];
+    CFE_TBL_Info_t   TblInfo;
+    OS_time_t        StartTime;
+    uint32           NumTables;
+    uint32           Pass;
+    uint32           i;
+
+    UtPrintf("Testing: CFE_TBL_Register, CFE_TBL_GetInfo name lookup performance");
+
+    /* Register until the registry is full, which also checks each name is not a duplicate */
+    CFE_PSP_GetTime(&StartTime);
+    for (NumTables = 0; NumTables < CFE_PLATFORM_TBL_MAX_NUM_TABLES; ++NumTables)
+    {
+        snprintf(TblName, sizeof(TblName), "NamePerf%03u", (unsigned int)NumTables);
+        if (CFE_TBL_Register(&TblHandles[NumTables], TblName, sizeof(uint32), CFE_TBL_OPT_DEFAULT, NULL) !=
+            CFE_SUCCESS)
+        {
+            break;
+        }
+    }
+    NamePerfTest_Report("Table registration", StartTime, NumTables);
+
+    UtAssert_NONZERO(NumTables);
+
+    CFE_PSP_GetTime(&StartTime);
+    for (Pass = 0; Pass < CFE_FT_NAME_LOOKUP_PASSES; ++Pass)
+    {
+        for (i = 0; i < NumTables; ++i)
+        {
+            snprintf(FullTblName, sizeof(FullTblName), "CFE_TEST_APP.NamePerf%03u", (unsigned int)i);
+
+            /* In order to not "flood" with test results, only report a failure */
+            if (CFE_TBL_GetInfo(&TblInfo, FullTblName) != CFE_SUCCESS)
+            {
+                UtAssert_Failed("CFE_TBL_GetInfo(%s) failed", FullTblName);
+                break;
+            }
+        }
+    }
+    NamePerfTest_Report("Table lookup by name", StartTime, CFE_FT_NAME_LOOKUP_PASSES * NumTables);
+
+    for (i = 0; i < NumTables; ++i)
+    {
+        if (CFE_TBL_Unregister(TblHandles[i]) != CFE_SUCCESS)
+        {
+            UtAssert_Failed("CFE_TBL_Unregister() failed for entry %lu", (unsigned long)i);
+        }
+    }
+}
+
+void TestPipeNameLookupPerf(void)
+{
+    CFE_SB_PipeId_t PipeIds[CFE_PLATFORM_SB_MAX_PIPES];
+    CFE_SB_PipeId_t PipeIdBuff;
+    char            PipeName[OS_MAX_API_NAME];
+    OS_time_t       StartTime;
+    uint32          NumPipes;
+    uint32          Pass;
+    uint32          i;
+
+    UtPrintf("Testing: CFE_SB_CreatePipe, CFE_SB_GetPipeIdByName name lookup performance");
+
+    CFE_PSP_GetTime(&StartTime);
+    for (NumPipes = 0; NumPipes < CFE_PLATFORM_SB_MAX_PIPES; ++NumPipes)
+    {
+        snprintf(PipeName, sizeof(PipeName), "NamePerfPipe%03u", (unsigned int)NumPipes);
+        if (CFE_SB_CreatePipe(&PipeIds[NumPipes], 1, PipeName) != CFE_SUCCESS)
+        {
+            break;
+        }
+    }
+    NamePerfTest_Report("Pipe creation", StartTime, NumPipes);
+
+    UtAssert_NONZERO(NumPipes);
+
+    CFE_PSP_GetTime(&StartTime);
+    for (Pass = 0; Pass < CFE_FT_NAME_LOOKUP_PASSES; ++Pass)
+    {
+        for (i = 0; i < NumPipes; ++i)
+        {
+            snprintf(PipeName, sizeof(PipeName), "NamePerfPipe%03u", (unsigned int)i);
+
+            /* In order to not "flood" with test results, only report a failure */
+            if (CFE_SB_GetPipeIdByName(&PipeIdBuff, PipeName) != CFE_SUCCESS ||
+                !CFE_RESOURCEID_TEST_EQUAL(PipeIdBuff, PipeIds[i]))
+            {
+                UtAssert_Failed("CFE_SB_GetPipeIdByName(%s) failed", PipeName);
+                break;
+            }
+        }
+    }
+    NamePerfTest_Report("Pipe lookup by name", StartTime, CFE_FT_NAME_LOOKUP_PASSES * NumPipes);
+
+    for (i = 0; i < NumPipes; ++i)
+    {
+        if (CFE_SB_DeletePipe(PipeIds[i]) != CFE_SUCCESS)
+        {
+            UtAssert_Failed("CFE_SB_DeletePipe() failed for entry %lu", (unsigned long)i);
+        }
+    }
+}
+
+void TestAppNameLookupPerf(void)
+{
+    static const char *const AppNames[] = {"CFE_ES", "CFE_EVS", "CFE_SB", "CFE_TBL", "CFE_TIME", "CFE_TEST_APP"};
+    CFE_ES_AppId_t           AppId;
+    OS_time_t                StartTime;
+    uint32                   Pass;
+    uint32                   i;
+
+    UtPrintf("Testing: CFE_ES_GetAppIDByName name lookup performance");
+
+    CFE_PSP_GetTime(&StartTime);
+    for (Pass = 0; Pass < CFE_FT_NAME_LOOKUP_PASSES * CFE_PLATFORM_ES_MAX_APPLICATIONS; ++Pass)
+    {
+        for (i = 0; i < sizeof(AppNames) / sizeof(AppNames[0]); ++i)
+        {
+            /* In order to not "flood" with test results, only report a failure */
+            if (CFE_ES_GetAppIDByName(&AppId, AppNames[i]) != CFE_SUCCESS)
+            {
+                UtAssert_Failed("CFE_ES_GetAppIDByName(%s) failed", AppNames[i]);
+                break;
+            }
+        }
+    }
+    NamePerfTest_Report("App lookup by name", StartTime,
+                        CFE_FT_NAME_LOOKUP_PASSES * CFE_PLATFORM_ES_MAX_APPLICATIONS *
+                            (sizeof(AppNames) / sizeof(AppNames[0])));
+}
+
+void ResourceNamePerfTestSetup(void)
+{
+    UtTest_Add(TestTableNameLookupPerf, NULL, NULL, "Test Table Name Lookup Performance");
+    UtTest_Add(TestPipeNameLookupPerf, NULL, NULL, "Test Pipe Name Lookup Performance");
+    UtTest_Add(TestAppNameLookupPerf, NULL, NULL, "Test App Name Lookup Performance");
+}
@@ -578,6 +578,410 @@ void TestBulkTransferMulti4(void)
     UtAssert_INT32_EQ(OS_CountSemDelete(BulkTlm.SyncSem), OS_SUCCESS);
 }
 
+/* Number of concurrent publishers in the multi-publisher test */
+#define UT_MULTIPUB_NUM_PUBLISHERS 4
+
+/* Number of messages allowed in flight between publishers and the receiver, must be less than pipe depth */
+#define UT_MULTIPUB_PIPELINE_DEPTH 16
+
+/* State structure for multi-publisher test - shared between threads */
+typedef struct UT_BulkMultiPubSharedState
+{
+    volatile uint32 PubFinished;
+    volatile bool   RecvFinished;
+
+    bool UseBatchRecv;
+
+    CFE_ES_TaskId_t TaskIdXmit[UT_MULTIPUB_NUM_PUBLISHERS];
+    CFE_ES_TaskId_t TaskIdRecv;
+    CFE_SB_PipeId_t PipeId;
+    osal_id_t       SyncSem;
+    uint32          RecvCount;
+    OS_time_t       StartTime;
+    OS_time_t       EndTime;
+} UT_BulkMultiPubSharedState_t;
+
+UT_BulkMultiPubSharedState_t BulkMultiPub;
+
+void UT_MultiPubTransmitterTask(void)
+{
+    CFE_TEST_TestTlmMessage32_t TlmMsg;
+    uint32                      SendCount;
+
+    memset(&TlmMsg, 0, sizeof(TlmMsg));
+    CFE_MSG_Init(CFE_MSG_PTR(TlmMsg.TelemetryHeader), CFE_FT_TLM_MSGID, sizeof(TlmMsg));
+
+    for (SendCount = 0; SendCount < UT_BulkTestDuration; ++SendCount)
+    {
+        CFE_Assert_STATUS_STORE(OS_CountSemTake(BulkMultiPub.SyncSem));
+        if (!CFE_Assert_STATUS_SILENTCHECK(OS_SUCCESS))
+        {
+            CFE_Assert_STATUS_MUST_BE(OS_SUCCESS);
+            break;
+        }
+
+        TlmMsg.Payload.Value = SendCount;
+
+        /* All publishers share the same MsgId, so every transmit goes through the same route */
+        CFE_Assert_STATUS_STORE(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmMsg.TelemetryHeader), true));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+            break;
+        }
+    }
+
+    ++BulkMultiPub.PubFinished;
+}
+
+void UT_MultiPubReceiverTask(void)
+{
+    CFE_SB_Buffer_t *MsgBufs[UT_MULTIPUB_PIPELINE_DEPTH];
+    uint32           ExpectCount;
+    uint32           BatchCount;
+    uint32           i;
+
+    ExpectCount = UT_BulkTestDuration * UT_MULTIPUB_NUM_PUBLISHERS;
+    BatchCount  = 1;
+
+    for (BulkMultiPub.RecvCount = 0; BulkMultiPub.RecvCount < ExpectCount; BulkMultiPub.RecvCount += BatchCount)
+    {
+        if (BulkMultiPub.UseBatchRecv)
+        {
+            CFE_Assert_STATUS_STORE(CFE_SB_ReceiveBufferBatch(MsgBufs, UT_MULTIPUB_PIPELINE_DEPTH, &BatchCount,
+                                                              BulkMultiPub.PipeId, 5000));
+        }
+        else
+        {
+            CFE_Assert_STATUS_STORE(CFE_SB_ReceiveBuffer(&MsgBufs[0], BulkMultiPub.PipeId, 5000));
+        }
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+            break;
+        }
+
+        for (i = 0; i < BatchCount; ++i)
+        {
+            CFE_Assert_STATUS_STORE(OS_CountSemGive(BulkMultiPub.SyncSem));
+            if (!CFE_Assert_STATUS_SILENTCHECK(OS_SUCCESS))
+            {
+                CFE_Assert_STATUS_MUST_BE(OS_SUCCESS);
+                break;
+            }
+        }
+    }
+
+    CFE_PSP_GetTime(&BulkMultiPub.EndTime);
+    BulkMultiPub.RecvFinished = true;
+}
+
+/*
+ * Multiple publishers transmitting on the same route at the same time
+ *
+ * This characterizes contention on the SB shared data lock in the transmit path,
+ * which is the dominant cost when many apps publish concurrently on a multicore target.
+ * Run this before and after changes to the transmit path to compare message rates.
+ */
+static void UT_RunMultiPublisher(bool UseBatchRecv)
+{
+    uint32    i;
+    char      TaskName[OS_MAX_API_NAME];
+    OS_time_t ElapsedTime;
+    int64     AvgRate;
+
+    UtPrintf("Testing: %u Publisher Bulk SB Transmit to a single %s Receiver",
+             (unsigned int)UT_MULTIPUB_NUM_PUBLISHERS, UseBatchRecv ? "Batched" : "Single");
+    memset(&BulkMultiPub, 0, sizeof(BulkMultiPub));
+    BulkMultiPub.UseBatchRecv = UseBatchRecv;
+
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&BulkMultiPub.PipeId, UT_MULTIPUB_PIPELINE_DEPTH * 2, "MultiPubPipe"),
+                      CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_SubscribeEx(CFE_FT_TLM_MSGID, BulkMultiPub.PipeId, CFE_SB_DEFAULT_QOS,
+                                         UT_MULTIPUB_PIPELINE_DEPTH * 2),
+                      CFE_SUCCESS);
+    UtAssert_INT32_EQ(OS_CountSemCreate(&BulkMultiPub.SyncSem, "MultiPubSem", UT_MULTIPUB_PIPELINE_DEPTH, 0),
+                      OS_SUCCESS);
+
+    UtAssert_INT32_EQ(
+        CFE_ES_CreateChildTask(&BulkMultiPub.TaskIdRecv, "MultiPubRecv", UT_MultiPubReceiverTask, NULL, 32768, 100, 0),
+        CFE_SUCCESS);
+
+    CFE_PSP_GetTime(&BulkMultiPub.StartTime);
+
+    for (i = 0; i < UT_MULTIPUB_NUM_PUBLISHERS; ++i)
+    {
+        snprintf(TaskName, sizeof(TaskName), "MultiPubXmit%u", (unsigned int)i);
+        UtAssert_INT32_EQ(CFE_ES_CreateChildTask(&BulkMultiPub.TaskIdXmit[i], TaskName, UT_MultiPubTransmitterTask,
+                                                 NULL, 32768, 150, 0),
+                          CFE_SUCCESS);
+    }
+
+    do
+    {
+        OS_TaskDelay(1000);
+        UtPrintf("Counts => %lu/%lu RECV, %lu/%lu publishers finished", (unsigned long)BulkMultiPub.RecvCount,
+                 (unsigned long)(UT_BulkTestDuration * UT_MULTIPUB_NUM_PUBLISHERS),
+                 (unsigned long)BulkMultiPub.PubFinished, (unsigned long)UT_MULTIPUB_NUM_PUBLISHERS);
+    } while (!BulkMultiPub.RecvFinished);
+
+    ElapsedTime = OS_TimeSubtract(BulkMultiPub.EndTime, BulkMultiPub.StartTime);
+    UtAssert_MIR("Elapsed time for SB multi-publisher test: %lu usec",
+                 (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+    AvgRate = OS_TimeGetTotalMilliseconds(ElapsedTime);
+    if (AvgRate > 0)
+    {
+        AvgRate = ((int64)BulkMultiPub.RecvCount * 10000) / AvgRate;
+        UtAssert_MIR("Message Rate: %ld.%01ld messages/sec", (long)(AvgRate / 10), (long)(AvgRate % 10));
+    }
+    else
+    {
+        /* If the entire test took less than a millisecond, then there is a config error */
+        UtAssert_Failed("Test configuration error: Executed too fast, needs more cycles!");
+    }
+
+    /* Give the publishers a moment to self-exit after their final transmit */
+    OS_TaskDelay(100);
+
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(BulkMultiPub.PipeId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(OS_CountSemDelete(BulkMultiPub.SyncSem), OS_SUCCESS);
+}
+
+void TestBulkTransferMultiPublisher(void)
+{
+    UT_RunMultiPublisher(false);
+}
+
+/*
+ * Same as TestBulkTransferMultiPublisher, but the receiver drains the pipe
+ * with CFE_SB_ReceiveBufferBatch() rather than one CFE_SB_ReceiveBuffer() per message.
+ */
+void TestBulkTransferMultiPublisherBatchRecv(void)
+{
+    UT_RunMultiPublisher(true);
+}
+
+/* Number of routes kept subscribed at any one time in the route churn test */
+#define UT_ROUTE_CHURN_WINDOW 16
+
+/* Number of distinct MsgIds cycled through in the route churn test, more than the routing table can hold */
+#define UT_ROUTE_CHURN_SPAN (2 * CFE_PLATFORM_SB_MAX_MSG_IDS)
+
+/*
+ * Long-running subscribe/unsubscribe churn
+ *
+ * A small window of subscriptions slides across more MsgIds than the routing table
+ * can hold, as happens over time when apps are restarted.  This only keeps working
+ * if routes are released on unsubscribe, and the rate should not degrade as the
+ * total number of MsgIds ever routed grows.
+ */
+void TestRouteChurn(void)
+{
+    CFE_SB_PipeId_t             PipeId = CFE_SB_INVALID_PIPE;
+    CFE_TEST_TestTlmMessage32_t TlmMsg;
+    CFE_SB_Buffer_t *           MsgBuf;
+    CFE_SB_MsgId_Atom_t         BaseMsgIdValue;
+    CFE_SB_MsgId_t              MsgId;
+    uint32                      CycleCount;
+    uint32                      NumCycles;
+    uint32                      i;
+    OS_time_t                   StartTime;
+    OS_time_t                   ElapsedTime;
+    int64                       AvgRate;
+
+    UtPrintf("Testing: SB route churn across %u MsgIds, %u subscribed at a time", (unsigned int)UT_ROUTE_CHURN_SPAN,
+             (unsigned int)UT_ROUTE_CHURN_WINDOW);
+
+    memset(&TlmMsg, 0, sizeof(TlmMsg));
+
+    /* Use the top of the valid range, away from the MIDs used by the other tests */
+    BaseMsgIdValue = CFE_PLATFORM_SB_HIGHEST_VALID_MSGID - UT_ROUTE_CHURN_SPAN + 1;
+    NumCycles      = UT_BulkTestDuration / 64;
+
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&PipeId, UT_ROUTE_CHURN_WINDOW, "ChurnPipe"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_MSG_Init(CFE_MSG_PTR(TlmMsg.TelemetryHeader), CFE_SB_ValueToMsgId(BaseMsgIdValue),
+                                   sizeof(TlmMsg)),
+                      CFE_SUCCESS);
+
+    /* Fill the initial window */
+    for (i = 0; i < UT_ROUTE_CHURN_WINDOW; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(BaseMsgIdValue + i), PipeId), CFE_SUCCESS);
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+
+    for (CycleCount = 0; CycleCount < NumCycles; ++CycleCount)
+    {
+        /* Drop the oldest route in the window and add the next one */
+        MsgId = CFE_SB_ValueToMsgId(BaseMsgIdValue + (CycleCount % UT_ROUTE_CHURN_SPAN));
+        CFE_Assert_STATUS_STORE(CFE_SB_Unsubscribe(MsgId, PipeId));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+            break;
+        }
+
+        MsgId = CFE_SB_ValueToMsgId(BaseMsgIdValue + ((CycleCount + UT_ROUTE_CHURN_WINDOW) % UT_ROUTE_CHURN_SPAN));
+        CFE_Assert_STATUS_STORE(CFE_SB_Subscribe(MsgId, PipeId));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+            break;
+        }
+
+        /* Send one message on the new route to make sure it is live */
+        TlmMsg.Payload.Value = CycleCount;
+        CFE_MSG_SetMsgId(CFE_MSG_PTR(TlmMsg.TelemetryHeader), MsgId);
+        CFE_Assert_STATUS_STORE(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmMsg.TelemetryHeader), true));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+            break;
+        }
+
+        CFE_Assert_STATUS_STORE(CFE_SB_ReceiveBuffer(&MsgBuf, PipeId, CFE_SB_POLL));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+            break;
+        }
+    }
+
+    CFE_PSP_GetTime(&ElapsedTime);
+    ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+    UtAssert_UINT32_EQ(CycleCount, NumCycles);
+    UtAssert_MIR("Elapsed time for SB route churn test: %lu usec",
+                 (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+    AvgRate = OS_TimeGetTotalMilliseconds(ElapsedTime);
+    if (AvgRate > 0)
+    {
+        AvgRate = ((int64)CycleCount * 10000) / AvgRate;
+        UtAssert_MIR("Churn Rate: %ld.%01ld routes/sec", (long)(AvgRate / 10), (long)(AvgRate % 10));
+    }
+    else
+    {
+        /* If the entire test took less than a millisecond, then there is a config error */
+        UtAssert_Failed("Test configuration error: Executed too fast, needs more cycles!");
+    }
+
+    /* Also removes the routes still in the window */
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId), CFE_SUCCESS);
+}
+
+/* Number of pipes subscribed to the same MsgId in the fan-out test, as many as a route allows */
+#define UT_FANOUT_NUM_PIPES CFE_PLATFORM_SB_MAX_DEST_PER_PKT
+
+/* Number of messages sent back to back before the pipes are drained in the fan-out test */
+#define UT_FANOUT_BURST 8
+
+/*
+ * Transmit of one MsgId to many subscribers
+ *
+ * This is the pattern of widely subscribed messages such as the HK wakeup or the
+ * time tone.  Only the transmit calls are timed, so the rate reflects the cost of
+ * walking the destinations of the route and queuing the message to each pipe.
+ */
+void TestFanOut(void)
+{
+    CFE_SB_PipeId_t             PipeId[UT_FANOUT_NUM_PIPES];
+    char                        PipeName[OS_MAX_API_NAME];
+    CFE_TEST_TestTlmMessage32_t TlmMsg;
+    CFE_SB_Buffer_t *           MsgBuf;
+    uint32                      SendCount;
+    uint32                      RecvCount;
+    uint32                      NumBursts;
+    uint32                      BurstCount;
+    uint32                      i;
+    OS_time_t                   StartTime;
+    OS_time_t                   EndTime;
+    OS_time_t                   ElapsedTime;
+    int64                       AvgRate;
+
+    UtPrintf("Testing: SB fan-out to %u pipes", (unsigned int)UT_FANOUT_NUM_PIPES);
+
+    memset(&TlmMsg, 0, sizeof(TlmMsg));
+    UtAssert_INT32_EQ(CFE_MSG_Init(CFE_MSG_PTR(TlmMsg.TelemetryHeader), CFE_FT_TLM_MSGID, sizeof(TlmMsg)), CFE_SUCCESS);
+
+    for (i = 0; i < UT_FANOUT_NUM_PIPES; ++i)
+    {
+        snprintf(PipeName, sizeof(PipeName), "FanOutPipe%u", (unsigned int)i);
+        UtAssert_INT32_EQ(CFE_SB_CreatePipe(&PipeId[i], UT_FANOUT_BURST, PipeName), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_SB_SubscribeEx(CFE_FT_TLM_MSGID, PipeId[i], CFE_SB_DEFAULT_QOS, UT_FANOUT_BURST),
+                          CFE_SUCCESS);
+    }
+
+    NumBursts   = UT_BulkTestDuration / UT_FANOUT_BURST;
+    ElapsedTime = OS_TimeFromTotalMicroseconds(0);
+    SendCount   = 0;
+    RecvCount   = 0;
+
+    for (BurstCount = 0; BurstCount < NumBursts; ++BurstCount)
+    {
+        CFE_PSP_GetTime(&StartTime);
+
+        for (i = 0; i < UT_FANOUT_BURST; ++i)
+        {
+            TlmMsg.Payload.Value = SendCount;
+
+            /* In order to not "flood" with test results, this should be silent unless a failure occurs */
+            CFE_Assert_STATUS_STORE(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmMsg.TelemetryHeader), true));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                break;
+            }
+
+            ++SendCount;
+        }
+
+        CFE_PSP_GetTime(&EndTime);
+        ElapsedTime = OS_TimeAdd(ElapsedTime, OS_TimeSubtract(EndTime, StartTime));
+
+        if (i < UT_FANOUT_BURST)
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+            break;
+        }
+
+        /* Drain every pipe so the next burst fits, this part is not timed */
+        for (i = 0; i < UT_FANOUT_NUM_PIPES; ++i)
+        {
+            while (CFE_SB_ReceiveBuffer(&MsgBuf, PipeId[i], CFE_SB_POLL) == CFE_SUCCESS)
+            {
+                ++RecvCount;
+            }
+        }
+    }
+
+    /* Every message must have been delivered to every pipe */
+    UtAssert_UINT32_EQ(SendCount, NumBursts * UT_FANOUT_BURST);
+    UtAssert_UINT32_EQ(RecvCount, SendCount * UT_FANOUT_NUM_PIPES);
+
+    UtAssert_MIR("Elapsed time transmitting in SB fan-out test: %lu usec",
+                 (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+    AvgRate = OS_TimeGetTotalMicroseconds(ElapsedTime);
+    if (AvgRate > 0)
+    {
+        AvgRate = ((int64)SendCount * 10000000) / AvgRate;
+        UtAssert_MIR("Message Rate: %ld.%01ld messages/sec to %u pipes", (long)(AvgRate / 10), (long)(AvgRate % 10),
+                     (unsigned int)UT_FANOUT_NUM_PIPES);
+    }
+    else
+    {
+        /* If the entire test took less than a microsecond, then there is a config error */
+        UtAssert_Failed("Test configuration error: Executed too fast, needs more cycles!");
+    }
+
+    for (i = 0; i < UT_FANOUT_NUM_PIPES; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId[i]), CFE_SUCCESS);
+    }
+}
+
 void SBPerformanceTestSetup(void)
 {
     long      i;
@@ -612,4 +1016,8 @@ void SBPerformanceTestSetup(void)
     UtTest_Add(TestBulkTransferSingle, NULL, NULL, "Single Thread Bulk Transfer");
     UtTest_Add(TestBulkTransferMulti2, NULL, NULL, "2 Thread Bulk Transfer");
     UtTest_Add(TestBulkTransferMulti4, NULL, NULL, "4 Thread Bulk Transfer");
+    UtTest_Add(TestBulkTransferMultiPublisher, NULL, NULL, "Multi Publisher Bulk Transfer");
+    UtTest_Add(TestBulkTransferMultiPublisherBatchRecv, NULL, NULL, "Multi Publisher Batch Receive");
+    UtTest_Add(TestRouteChurn, NULL, NULL, "Route Churn");
+    UtTest_Add(TestFanOut, NULL, NULL, "Fan-out Transmit");
 }
@@ -199,8 +199,7 @@ void TestSBMaxSubscriptions(void)
      * exactly how many iterations of this loop will succeed, but it should be fewer than
      * CFE_PLATFORM_SB_MAX_MSG_IDS.
      *
-     * NOTE: after this loop, it may not be possible to add any more routes at all, until
-     * a processor reset is done, because routes are never actually deleted for sequence number persistence.
+     * Routes left without subscriptions are reclaimed when a new route is needed.
      */
     NumSubs = 0;
     while (NumSubs <= CFE_PLATFORM_SB_MAX_MSG_IDS)
@@ -228,6 +227,11 @@ void TestSBMaxSubscriptions(void)
 
     /* Note this should also remove any subscriptions from the above loop */
     UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId), CFE_SUCCESS);
+
+    /* The routes from the above loop can be reclaimed */
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&PipeId, 2, "TestPipe"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(1 + NumSubs), PipeId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId), CFE_SUCCESS);
 }
 
 /* This is a different flavor of the subscription limit - a single msgid can only
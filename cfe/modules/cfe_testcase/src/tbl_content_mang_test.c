@@ -52,6 +52,11 @@ static const char TESTTBL_SHORT_FILE[] =
     "/ram/testtbl_short.tbl"; /**< short version (header info matches file but smaller than tbl) */
 static const char TESTTBL_PARTIAL_FILE[] =
     "/ram/testtbl_part.tbl"; /**< partial (offset nonzero, remainder of data from short file) */
+static const char TESTTBL_PERF_FILE[] =
+    "/ram/testtbl_perf.tbl"; /**< generated image for the load performance test, size varies */
+
+/* Number of timed loads of each table size in the load performance test */
+#define CFE_FT_TBL_LOAD_PERF_ITERATIONS 256
 
 void TestLoad(void)
 {
@@ -478,6 +483,114 @@ void TblTest_GenerateTblFiles(void)
     UtAssert_INT32_EQ(OS_close(fh1), OS_SUCCESS);
 }
 
+/*
+ * Writes a table image file of the given size for the load performance test,
+ * with content that varies through the whole image.
+ */
+void TblTest_GeneratePerfFile(const char *RegisteredTblName, size_t TblSize)
+{
+    osal_id_t          fh;
+    CFE_FS_Header_t    FsHdr;
+    CFE_TBL_File_Hdr_t TblHdr;
+    uint8              Block[1024];
+    size_t             Pos;
+    size_t             i;
+
+    UtAssert_INT32_EQ(
+        OS_OpenCreate(&fh, TESTTBL_PERF_FILE, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY),
+        OS_SUCCESS);
+
+    CFE_FS_InitHeader(&FsHdr, "Table load performance", CFE_FS_SubType_TBL_IMG);
+    UtAssert_INT32_EQ(CFE_FS_WriteHeader(fh, &FsHdr), sizeof(FsHdr));
+
+    /* NOTE: headers must be in big-endian/network byte order! */
+    memset(&TblHdr, 0, sizeof(TblHdr));
+    TblTest_UpdateOffset(&TblHdr.Offset, 0);
+    TblTest_UpdateOffset(&TblHdr.NumBytes, TblSize);
+    strncpy(TblHdr.TableName, RegisteredTblName, sizeof(TblHdr.TableName) - 1);
+    UtAssert_INT32_EQ(OS_write(fh, &TblHdr, sizeof(TblHdr)), sizeof(TblHdr));
+
+    for (Pos = 0; Pos < TblSize; Pos += sizeof(Block))
+    {
+        for (i = 0; i < sizeof(Block); ++i)
+        {
+            Block[i] = (uint8)((Pos + i) * 7 + (Pos >> 10));
+        }
+
+        if (OS_write(fh, Block, sizeof(Block)) != sizeof(Block))
+        {
+            break;
+        }
+    }
+
+    UtAssert_UINT32_EQ(Pos, TblSize);
+    UtAssert_INT32_EQ(OS_close(fh), OS_SUCCESS);
+}
+
+/*
+ * Times file loads of a table set growing in size by factors of 4 from 1 KiB,
+ * up to 64 MiB or the largest table this platform allows, whichever is smaller.
+ */
+void TestLoadFromFilePerf(void)
+{
+    static const char TblName[]           = "PerfTable";
+    static const char RegisteredTblName[] = "CFE_TEST_APP.PerfTable";
+    CFE_TBL_Handle_t  TblHandle;
+    CFE_TBL_Info_t    TblInfo;
+    OS_time_t         StartTime;
+    OS_time_t         ElapsedTime;
+    int64             AvgTime;
+    uint32            Count;
+    size_t            TblSize;
+    void *            TblPtr;
+
+    UtPrintf("Testing: CFE_TBL_Load from file performance");
+
+    for (TblSize = 1024; TblSize <= CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE && TblSize <= (64 * 1024 * 1024);
+         TblSize *= 4)
+    {
+        TblTest_GeneratePerfFile(RegisteredTblName, TblSize);
+
+        UtAssert_INT32_EQ(CFE_TBL_Register(&TblHandle, TblName, TblSize, CFE_TBL_OPT_DEFAULT, NULL), CFE_SUCCESS);
+
+        /* The first load is untimed, it brings the file into the cache */
+        UtAssert_INT32_EQ(CFE_TBL_Load(TblHandle, CFE_TBL_SRC_FILE, TESTTBL_PERF_FILE), CFE_SUCCESS);
+
+        CFE_PSP_GetTime(&StartTime);
+
+        for (Count = 0; Count < CFE_FT_TBL_LOAD_PERF_ITERATIONS; ++Count)
+        {
+            /* In order to not "flood" with test results, only report a failure */
+            if (CFE_TBL_Load(TblHandle, CFE_TBL_SRC_FILE, TESTTBL_PERF_FILE) != CFE_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        CFE_PSP_GetTime(&ElapsedTime);
+        ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+        UtAssert_UINT32_EQ(Count, CFE_FT_TBL_LOAD_PERF_ITERATIONS);
+
+        /* The CRC accumulated while loading must match one computed over the loaded table */
+        UtAssert_INT32_EQ(CFE_TBL_GetInfo(&TblInfo, RegisteredTblName), CFE_SUCCESS);
+        CFE_Assert_STATUS_STORE(CFE_TBL_GetAddress(&TblPtr, TblHandle));
+        if (!CFE_Assert_STATUS_SILENTCHECK(CFE_TBL_INFO_UPDATED))
+        {
+            CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+        }
+        UtAssert_UINT32_EQ(TblInfo.Crc, CFE_ES_CalculateCRC(TblPtr, TblSize, 0, CFE_MISSION_ES_DEFAULT_CRC));
+        UtAssert_INT32_EQ(CFE_TBL_ReleaseAddress(TblHandle), CFE_SUCCESS);
+
+        UtAssert_INT32_EQ(CFE_TBL_Unregister(TblHandle), CFE_SUCCESS);
+
+        AvgTime = OS_TimeGetTotalMicroseconds(ElapsedTime) / CFE_FT_TBL_LOAD_PERF_ITERATIONS;
+        UtAssert_MIR("Table load of %lu bytes from file: %ld usec per load", (unsigned long)TblSize, (long)AvgTime);
+    }
+
+    UtAssert_INT32_EQ(OS_remove(TESTTBL_PERF_FILE), OS_SUCCESS);
+}
+
 void TBLContentMangTestSetup(void)
 {
     TblTest_GenerateTblFiles();
@@ -488,4 +601,5 @@ void TBLContentMangTestSetup(void)
     UtTest_Add(TestManage, RegisterTestTable, UnregisterTestTable, "Test Table Manage");
     UtTest_Add(TestDumpToBuffer, RegisterTestTable, UnregisterTestTable, "Test Table Dump to Buffer");
     UtTest_Add(TestModified, RegisterTestTable, UnregisterTestTable, "Test Table Modified");
+    UtTest_Add(TestLoadFromFilePerf, NULL, NULL, "Test Table Load From File Performance");
 }
@@ -317,6 +317,14 @@ char *CFE_ES_StatusToString(CFE_Status_t status, CFE_StatusString_t *status_stri
  */
 #define CFE_EVS_APP_SQUELCHED ((CFE_Status_t)0xc2000009)
 
+/**
+ * @brief Deferred event queue full
+ *
+ *  Event discarded because the deferred event queue was full
+ *
+ */
+#define CFE_EVS_DEFERRED_QUEUE_FULL ((CFE_Status_t)0xc200000a)
+
 /**
  * @brief Not Implemented
  *
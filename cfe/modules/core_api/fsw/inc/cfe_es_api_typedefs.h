@@ -86,7 +86,7 @@ typedef void *CFE_ES_StackPointer_t; /* aka osal_stackptr_t in proposed OSAL cha
 /**
  * \brief Checksum/CRC algorithm identifiers
  *
- * Currently only CFE_ES_CrcType_16_ARC is supported.
+ * CRC-16/ARC, CRC-32C and CRC-32 are supported.
  *
  * All defined CRC algorithms should include a check value, which is the accepted
  * result of computing the CRC across the fixed string "123456789"
@@ -112,11 +112,41 @@ typedef enum CFE_ES_CrcType_Enum
      */
     CFE_ES_CrcType_16_ARC = 1,
 
+    /**
+     * \brief Implementation of CRC-32C (Castagnoli), also known as CRC-32/ISCSI
+     *
+     * \par
+     *   Polynomial: 0x1EDC6F41 <br>
+     *   Initialization: 0xFFFFFFFF <br>
+     *   Reflect Input/Output: true <br>
+     *   Check value: 0xe3069283 <br>
+     *   XorOut: 0xFFFFFFFF <br>
+     *
+     * The initialization and XorOut are applied internally, so an input
+     * CRC of 0 starts a new computation, and the result of a previous
+     * call can be passed in to continue it across non-contiguous data.
+     */
+    CFE_ES_CrcType_32_C = 2,
+
+    /**
+     * \brief Implementation of CRC-32, also known as CRC-32/ISO-HDLC
+     *
+     * \par
+     *   Polynomial: 0x04C11DB7 <br>
+     *   Initialization: 0xFFFFFFFF <br>
+     *   Reflect Input/Output: true <br>
+     *   Check value: 0xcbf43926 <br>
+     *   XorOut: 0xFFFFFFFF <br>
+     *
+     * The initialization and XorOut are applied internally, as for #CFE_ES_CrcType_32_C.
+     */
+    CFE_ES_CrcType_32_ISO_HDLC = 3,
+
     /**
      * Placeholder for end of normal enumeration list
      * This should reflect the number of algorithms defined.
      */
-    CFE_ES_CrcType_MAX = 2,
+    CFE_ES_CrcType_MAX = 4,
 
     /*
      * Backward compatibility values.
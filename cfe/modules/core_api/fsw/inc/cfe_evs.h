@@ -103,6 +103,34 @@
 ** \retval #CFE_ES_BAD_ARGUMENT         \copybrief CFE_ES_BAD_ARGUMENT
 **/
 CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint16 FilterScheme);
+
+/**
+** \brief Select deferred or immediate event generation for the calling application
+**
+** \par Description
+**          By default the calling application's task formats, logs and sends each event
+**          before #CFE_EVS_SendEvent returns.  In deferred mode the sending task only formats
+**          the event text and queues it with the event time; a low priority EVS task then
+**          writes it to the local event log, the output ports and the software bus.  This
+**          moves most of the cost of an event out of time-critical application loops.
+**
+** \par Assumptions, External Events, and Notes:
+**          Deferred events from one application are sent in the order they were generated.
+**          Events sent while the deferred event queue is full are discarded and the send
+**          function returns #CFE_EVS_DEFERRED_QUEUE_FULL.  The queue size is configured by
+**          #CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH.  Events still queued when an application
+**          returns to immediate mode may be sent after its later events.  Calling
+**          #CFE_EVS_Register again selects immediate mode.
+**
+** \param[in] Deferred           true to queue the application's events, false to send them immediately
+**
+** \return Execution status below or from #CFE_ES_GetAppID, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                \copybrief CFE_SUCCESS
+** \retval #CFE_EVS_APP_NOT_REGISTERED \copybrief CFE_EVS_APP_NOT_REGISTERED
+** \retval #CFE_EVS_APP_ILLEGAL_APP_ID \copybrief CFE_EVS_APP_ILLEGAL_APP_ID
+** \retval #CFE_EVS_NOT_IMPLEMENTED    \copybrief CFE_EVS_NOT_IMPLEMENTED
+**/
+CFE_Status_t CFE_EVS_SetDeferredMode(bool Deferred);
 /**@}*/
 
 /** @defgroup CFEAPIEVSSend cFE Send Event APIs
@@ -148,6 +176,7 @@ CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint1
 ** \retval #CFE_EVS_APP_NOT_REGISTERED \copybrief CFE_EVS_APP_NOT_REGISTERED
 ** \retval #CFE_EVS_APP_ILLEGAL_APP_ID \copybrief CFE_EVS_APP_ILLEGAL_APP_ID
 ** \retval #CFE_EVS_INVALID_PARAMETER  \copybrief CFE_EVS_INVALID_PARAMETER
+** \retval #CFE_EVS_DEFERRED_QUEUE_FULL \copybrief CFE_EVS_DEFERRED_QUEUE_FULL
 **
 ** \sa #CFE_EVS_SendEventWithAppID, #CFE_EVS_SendTimedEvent
 **
@@ -197,6 +226,7 @@ CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spe
 ** \retval #CFE_EVS_APP_NOT_REGISTERED \copybrief CFE_EVS_APP_NOT_REGISTERED
 ** \retval #CFE_EVS_APP_ILLEGAL_APP_ID \copybrief CFE_EVS_APP_ILLEGAL_APP_ID
 ** \retval #CFE_EVS_INVALID_PARAMETER  \copybrief CFE_EVS_INVALID_PARAMETER
+** \retval #CFE_EVS_DEFERRED_QUEUE_FULL \copybrief CFE_EVS_DEFERRED_QUEUE_FULL
 **
 ** \sa #CFE_EVS_SendEvent, #CFE_EVS_SendTimedEvent
 **
@@ -247,6 +277,7 @@ CFE_Status_t CFE_EVS_SendEventWithAppID(uint16 EventID, uint16 EventType, CFE_ES
 ** \retval #CFE_EVS_APP_NOT_REGISTERED \copybrief CFE_EVS_APP_NOT_REGISTERED
 ** \retval #CFE_EVS_APP_ILLEGAL_APP_ID \copybrief CFE_EVS_APP_ILLEGAL_APP_ID
 ** \retval #CFE_EVS_INVALID_PARAMETER  \copybrief CFE_EVS_INVALID_PARAMETER
+** \retval #CFE_EVS_DEFERRED_QUEUE_FULL \copybrief CFE_EVS_DEFERRED_QUEUE_FULL
 **
 ** \sa #CFE_EVS_SendEvent, #CFE_EVS_SendEventWithAppID
 **
@@ -218,4 +218,54 @@ CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableS
  */
 int32 CFE_ResourceId_ToIndex(CFE_ResourceId_t Id, uint32 BaseValue, uint32 TableSize, uint32 *Idx);
 
+/**
+ * @brief Add a table entry to a name index
+ *
+ * Makes the entry at the given slot findable by name via CFE_ResourceId_NameIndexFind().
+ * If the slot is already in the index it is first removed, so this may also be used
+ * when the name of an entry changes.
+ *
+ * The index does not keep a copy of the name, and must be updated under the same
+ * lock that protects the table it indexes.
+ *
+ * @param[in,out] Index     the name index, an array of TableSize entries
+ * @param[in]     TableSize the size of the indexed table
+ * @param[in]     Slot      the table slot (array index) of the entry
+ * @param[in]     Name      the name of the entry
+ */
+void CFE_ResourceId_NameIndexAdd(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 Slot,
+                                 const char *Name);
+
+/**
+ * @brief Remove a table entry from a name index
+ *
+ * This should be called when the entry at the given slot is freed or renamed.
+ * It has no effect if the slot is not in the index.
+ *
+ * @param[in,out] Index     the name index, an array of TableSize entries
+ * @param[in]     TableSize the size of the indexed table
+ * @param[in]     Slot      the table slot (array index) of the entry
+ */
+void CFE_ResourceId_NameIndexRemove(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 Slot);
+
+/**
+ * @brief Look up a table entry by name using a name index
+ *
+ * Hashes the name and checks only the slots in its bucket, confirming each
+ * candidate with the supplied match function.
+ *
+ * @param[in]   Index     the name index, an array of TableSize entries
+ * @param[in]   TableSize the size of the indexed table
+ * @param[in]   Name      the name to find
+ * @param[in]   MatchFunc a function to check if the entry at a slot has the name
+ * @param[out]  Slot      the table slot (array index) of the matching entry
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ * @retval #CFE_SUCCESS               @copybrief CFE_SUCCESS
+ * @retval #CFE_ES_BAD_ARGUMENT       @copybrief CFE_ES_BAD_ARGUMENT
+ * @retval #CFE_ES_ERR_NAME_NOT_FOUND @copybrief CFE_ES_ERR_NAME_NOT_FOUND
+ */
+int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, const char *Name,
+                                   CFE_ResourceId_NameMatchFunc_t MatchFunc, uint32 *Slot);
+
 #endif /* CFE_RESOURCEID_H */
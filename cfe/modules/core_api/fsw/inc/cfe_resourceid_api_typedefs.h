@@ -75,4 +75,34 @@
 
 /** \} */
 
+/**
+ * @brief Checks whether the table entry at a slot is in use and has the given name
+ *
+ * Supplied to CFE_ResourceId_NameIndexFind() to confirm a candidate slot,
+ * as different names may hash to the same value.
+ *
+ * @param[in]   Slot   table slot (array index) to check
+ * @param[in]   Name   name to compare against the entry at that slot
+ * @returns true if the entry is in use and matches the name, false otherwise
+ */
+typedef bool (*CFE_ResourceId_NameMatchFunc_t)(uint32 Slot, const char *Name);
+
+/**
+ * @brief Bookkeeping for one slot of a name index
+ *
+ * A name index over a table of N entries is an array of N of these, stored
+ * alongside the table by the module that owns it.  Each element is both the
+ * chain link for the table slot with the same number and the head of the hash
+ * bucket with the same number, so no other storage is needed.
+ *
+ * A zero-filled array is a valid, empty index.
+ */
+typedef struct CFE_ResourceId_NameIndexEntry
+{
+    uint32 Hash;       /**< Hash of the name of the table entry at this slot, while indexed */
+    uint32 NextSlot;   /**< Next slot + 1 in the same bucket as this slot, 0 at the end of the bucket */
+    uint32 BucketHead; /**< First slot + 1 in the bucket with this number, 0 if the bucket is empty */
+    bool   IsIndexed;  /**< Whether the table entry at this slot is currently in the index */
+} CFE_ResourceId_NameIndexEntry_t;
+
 #endif /* CFE_RESOURCEID_API_TYPEDEFS_H */
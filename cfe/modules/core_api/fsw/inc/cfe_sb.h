@@ -478,6 +478,55 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
 
+/*****************************************************************************/
+/**
+** \brief Receive all pending messages, up to a limit, from a software bus pipe
+**
+** \par Description
+**          This routine is the batched form of #CFE_SB_ReceiveBuffer.  It waits for
+**          the first message in the same way, then also retrieves any further messages
+**          already waiting on the pipe, without blocking, up to MaxCount messages.
+**          Draining a pipe this way amortizes the per-message bookkeeping of a receive
+**          over the whole batch.
+**
+** \par Assumptions, External Events, and Notes:
+**          - All buffers returned in BufPtrArray remain valid only until the next call to
+**            CFE_SB_ReceiveBuffer or CFE_SB_ReceiveBufferBatch for the same pipe, at which
+**            point they are all released together.
+**          - At most #CFE_PLATFORM_SB_MAX_RECEIVE_BATCH buffers are returned per call;
+**            a larger MaxCount is silently limited to this value.
+**          - Messages are returned in the same order they would have been returned by
+**            repeated calls to CFE_SB_ReceiveBuffer.
+**          - If an error occurs, *CountPtr is set to zero and the contents of BufPtrArray
+**            should not be used.
+**          - If reading the pipe fails after some messages were already received, those
+**            messages are returned with #CFE_SUCCESS, and the error is returned by the
+**            next receive on the same pipe.
+**
+** \param[out] BufPtrArray  Array of pointers to receive the software bus buffers @nonnull.
+**                          Must have room for at least MaxCount entries.
+**
+** \param[in]  MaxCount     The maximum number of buffers to receive @nonzero
+**
+** \param[out] CountPtr     Set to the number of buffers received @nonnull
+**
+** \param[in]  PipeId       The pipe ID of the pipe containing the messages to be obtained.
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if the
+**                          pipe is empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \covtest \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+**/
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
 /** @} */
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy APIs
@@ -146,3 +146,19 @@ CFE_Status_t CFE_EVS_SendTimedEvent(CFE_TIME_SysTime_t Time, uint16 EventID, uin
 
     return UT_GenStub_GetReturnValue(CFE_EVS_SendTimedEvent, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_EVS_SetDeferredMode()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_EVS_SetDeferredMode(bool Deferred)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_EVS_SetDeferredMode, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_EVS_SetDeferredMode, bool, Deferred);
+
+    UT_GenStub_Execute(CFE_EVS_SetDeferredMode, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_EVS_SetDeferredMode, CFE_Status_t);
+}
@@ -107,6 +107,45 @@ void UT_DefaultHandler_CFE_ResourceId_FindNext(void *UserObj, UT_EntryKey_t Func
     UT_Stub_SetReturnValue(FuncKey, NextId);
 }
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_ResourceId_NameIndexFind coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_ResourceId_NameIndexFind(void *UserObj, UT_EntryKey_t FuncKey,
+                                                    const UT_StubContext_t *Context)
+{
+    uint32                         TableSize = UT_Hook_GetArgValueByName(Context, "TableSize", uint32);
+    const char *                   Name      = UT_Hook_GetArgValueByName(Context, "Name", const char *);
+    CFE_ResourceId_NameMatchFunc_t MatchFunc =
+        UT_Hook_GetArgValueByName(Context, "MatchFunc", CFE_ResourceId_NameMatchFunc_t);
+    uint32 *Slot = UT_Hook_GetArgValueByName(Context, "Slot", uint32 *);
+    uint32  i;
+    int32   return_code;
+
+    /*
+     * Unless the test case sets a return code, search the whole table with the
+     * match function.  This finds entries that a test case sets up directly,
+     * without going through the stubbed CFE_ResourceId_NameIndexAdd().
+     */
+    if (!UT_Stub_GetInt32StatusCode(Context, &return_code))
+    {
+        return_code = CFE_ES_ERR_NAME_NOT_FOUND;
+
+        for (i = 0; i < TableSize; ++i)
+        {
+            if (MatchFunc(i, Name))
+            {
+                *Slot       = i;
+                return_code = CFE_SUCCESS;
+                break;
+            }
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, return_code);
+    }
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_ResourceId_ToIndex coverage stub function
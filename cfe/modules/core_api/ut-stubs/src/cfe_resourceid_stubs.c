@@ -28,6 +28,7 @@
 void UT_DefaultHandler_CFE_ResourceId_FindNext(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_GetBase(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_GetSerial(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CFE_ResourceId_NameIndexFind(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_ResourceId_ToIndex(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -80,6 +81,57 @@ uint32 CFE_ResourceId_GetSerial(CFE_ResourceId_t ResourceId)
     return UT_GenStub_GetReturnValue(CFE_ResourceId_GetSerial, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ResourceId_NameIndexAdd()
+ * ----------------------------------------------------
+ */
+void CFE_ResourceId_NameIndexAdd(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 Slot,
+                                 const char *Name)
+{
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexAdd, CFE_ResourceId_NameIndexEntry_t *, Index);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexAdd, uint32, TableSize);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexAdd, uint32, Slot);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexAdd, const char *, Name);
+
+    UT_GenStub_Execute(CFE_ResourceId_NameIndexAdd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ResourceId_NameIndexFind()
+ * ----------------------------------------------------
+ */
+int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, const char *Name,
+                                   CFE_ResourceId_NameMatchFunc_t MatchFunc, uint32 *Slot)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ResourceId_NameIndexFind, int32);
+
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexFind, const CFE_ResourceId_NameIndexEntry_t *, Index);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexFind, uint32, TableSize);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexFind, const char *, Name);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexFind, CFE_ResourceId_NameMatchFunc_t, MatchFunc);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexFind, uint32 *, Slot);
+
+    UT_GenStub_Execute(CFE_ResourceId_NameIndexFind, Basic, UT_DefaultHandler_CFE_ResourceId_NameIndexFind);
+
+    return UT_GenStub_GetReturnValue(CFE_ResourceId_NameIndexFind, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ResourceId_NameIndexRemove()
+ * ----------------------------------------------------
+ */
+void CFE_ResourceId_NameIndexRemove(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 Slot)
+{
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexRemove, CFE_ResourceId_NameIndexEntry_t *, Index);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexRemove, uint32, TableSize);
+    UT_GenStub_AddParam(CFE_ResourceId_NameIndexRemove, uint32, Slot);
+
+    UT_GenStub_Execute(CFE_ResourceId_NameIndexRemove, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ResourceId_ToIndex()
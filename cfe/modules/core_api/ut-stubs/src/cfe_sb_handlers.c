@@ -349,6 +349,36 @@ void UT_DefaultHandler_CFE_SB_ReceiveBuffer(void *UserObj, UT_EntryKey_t FuncKey
     }
 }
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_SB_ReceiveBufferBatch coverage stub function
+ *
+ * Buffer pointers are taken from the data buffer registered for this
+ * function, one pointer per entry, up to MaxCount.
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_SB_ReceiveBufferBatch(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtrArray = UT_Hook_GetArgValueByName(Context, "BufPtrArray", CFE_SB_Buffer_t **);
+    uint32            MaxCount    = UT_Hook_GetArgValueByName(Context, "MaxCount", uint32);
+    uint32 *          CountPtr    = UT_Hook_GetArgValueByName(Context, "CountPtr", uint32 *);
+
+    int32 status;
+
+    *CountPtr = 0;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status >= 0)
+    {
+        while (*CountPtr < MaxCount && UT_Stub_CopyToLocal(UT_KEY(CFE_SB_ReceiveBufferBatch), &BufPtrArray[*CountPtr],
+                                                           sizeof(BufPtrArray[0])) == sizeof(BufPtrArray[0]))
+        {
+            ++(*CountPtr);
+        }
+    }
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_SB_TransmitMsg coverage stub function
@@ -41,6 +41,7 @@ void UT_DefaultHandler_CFE_SB_LocalTlmTopicIdToMsgId(void *, UT_EntryKey_t, cons
 void UT_DefaultHandler_CFE_SB_MessageStringGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_MessageStringSet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_ReceiveBuffer(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CFE_SB_ReceiveBufferBatch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_SetUserDataLength(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_TimeStampMsg(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_SB_TlmTopicIdToMsgId(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -354,6 +355,27 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBufferBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBufferBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, CFE_SB_Buffer_t **, BufPtrArray);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, uint32, MaxCount);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, uint32 *, CountPtr);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, int32, TimeOut);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBufferBatch, Basic, UT_DefaultHandler_CFE_SB_ReceiveBufferBatch);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBufferBatch, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_ReleaseMessageBuffer()
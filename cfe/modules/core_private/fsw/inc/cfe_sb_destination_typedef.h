@@ -19,7 +19,7 @@
 /**
  * @file
  *
- * Definition of the CFE_SB_DestinationD_t structure type
+ * Definition of the CFE_SB_DestinationD_t and CFE_SB_DestinationList_t structure types
  * This was moved into its own header file since it is referenced by multiple CFE modules.
  */
 
@@ -33,20 +33,43 @@
  * This structure defines a DESTINATION DESCRIPTOR used to specify
  * each destination pipe for a message.
  *
+ * The descriptor of the destination pipe is cached alongside the PipeId so
+ * that the transmit path does not need to look it up; it is only trusted after
+ * confirming that the descriptor still holds the same PipeId.
+ *
  * Note: Changing the size of this structure may require the memory pool
  * block sizes to change.
  */
 typedef struct CFE_SB_DestinationD
 {
-    CFE_SB_PipeId_t             PipeId;
-    uint8                       Active;
-    uint16                      MsgId2PipeLim;
-    uint16                      BuffCount;
-    uint16                      DestCnt;
-    uint8                       Scope;
-    uint8                       Spare[3];
-    struct CFE_SB_DestinationD *Prev;
-    struct CFE_SB_DestinationD *Next;
+    CFE_SB_PipeId_t      PipeId;
+    uint8                Active;
+    uint8                Scope;
+    uint16               MsgId2PipeLim;
+    uint32               BuffCount; /**< Buffers queued to the pipe, updated atomically */
+    uint16               DestCnt;
+    uint16               Spare;
+    struct CFE_SB_PipeD *PipeDscPtr;
 } CFE_SB_DestinationD_t;
 
+/******************************************************************************
+ * This structure defines the DESTINATION LIST of a route.
+ *
+ * All destinations of a route are kept together in a single block from the
+ * SB memory pool, so that sending to every subscriber walks one contiguous
+ * array.  The block is replaced by a larger or smaller one as destinations
+ * are added and removed.
+ *
+ * Transmits read the list without taking the SB lock, so a published list is
+ * only changed in place to enable or disable a destination, or to append one
+ * into spare space before NumDests is (atomically) raised to include it.  Any
+ * other change publishes a new block in place of the old one.
+ */
+typedef struct CFE_SB_DestinationList
+{
+    uint32                NumDests; /**< Number of destinations in use */
+    uint32                MaxDests; /**< Number of destinations the block can hold */
+    CFE_SB_DestinationD_t Dests[];  /**< Variably sized destination array, Keep last */
+} CFE_SB_DestinationList_t;
+
 #endif /* CFE_SB_DESTINATION_TYPEDEF_H */
@@ -42,6 +42,13 @@
  * Function prototypes
  */
 
+/*
+ * All functions that change routing must be serialized by the caller.  Lookups
+ * (CFE_SBR_GetRouteId, CFE_SBR_GetDestListHeadPtr) and the sequence counter
+ * functions may run concurrently with CFE_SBR_SetDestListHeadPtr, but not with
+ * CFE_SBR_AddRoute, which may move other entries of the message ID map.
+ */
+
 /**
  *  \brief Initialize software bus routing module
  */
@@ -54,6 +61,10 @@ void CFE_SBR_Init(void);
  *  element in the routing table.  Assumes check for existing
  *  route was already performed or routes could leak
  *
+ *  Only routes with destinations hold on to their element.  Elements
+ *  of routes without destinations are reclaimed least recently used
+ *  first, at which point their message ID no longer maps to a route.
+ *
  *  \param[in]  MsgId         Message ID of the route to add
  *  \param[out] CollisionsPtr Number of collisions (if not null)
  *
@@ -80,29 +91,40 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId);
 CFE_SB_MsgId_t CFE_SBR_GetMsgId(CFE_SBR_RouteId_t RouteId);
 
 /**
- *  \brief Obtain the destination list head pointer given a route id
+ *  \brief Obtain the destination list pointer given a route id
  *
  *  \param[in] RouteId Route ID
  *
- *  \returns Destination list head pointer for the given route id.
+ *  \returns Destination list pointer for the given route id.
  *           Will be null if route doesn't exist or no subscribers.
  */
-CFE_SB_DestinationD_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId);
+CFE_SB_DestinationList_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId);
 
 /**
- * \brief Set the destination list head pointer for given route id
+ * \brief Set the destination list pointer for given route id
+ *
+ * Setting the first destination list makes the route active, setting
+ * NULL makes it idle and eligible to be reclaimed by CFE_SBR_AddRoute.
+ *
+ * The pointer is published atomically, so a concurrent lookup gets either the
+ * previous or the new list, complete.
  *
  * \param[in] RouteId Route Id
- * \param[in] DestPtr Destination list head pointer
+ * \param[in] DestPtr Destination list pointer
  */
-void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr);
+void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationList_t *DestPtr);
 
 /**
  * \brief Increment the sequence counter associated with the supplied route ID
  *
+ * The counter is updated atomically, so concurrent callers each get a
+ * different value.
+ *
  * \param[in] RouteId Route ID
+ *
+ * \returns the sequence counter after the increment
  */
-void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
+CFE_MSG_SequenceCount_t CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
 
 /**
  * \brief Get the sequence counter associated with the supplied route ID
@@ -120,6 +142,11 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId);
  * depends on the routing table implementation.  Possibilities include
  * in subscription order and in order if incrementing message ids.
  *
+ * Only routes with destinations are visited.  The callback may remove
+ * the last destination of the route it was passed, other routes are
+ * still visited.  Routes becoming idle between throttled calls may
+ * cause a route to be skipped for that pass.
+ *
  * \param[in]     CallbackPtr Function to invoke for each matching ID
  * \param[in]     ArgPtr      Opaque argument to pass to callback function
  * \param[in,out] ThrottlePtr Throttling structure, NULL for no throttle
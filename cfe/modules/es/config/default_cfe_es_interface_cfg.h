@@ -117,8 +117,9 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_ES_CrcType_16_ARC is supported (see brief in CFE_ES_CrcType_Enum
-**      definition in cfe_es_api_typedefs.h)
+**      Must be one of the algorithms implemented in this version of CFE, currently
+**      CFE_ES_CrcType_16_ARC, CFE_ES_CrcType_32_C or CFE_ES_CrcType_32_ISO_HDLC (see
+**      brief in CFE_ES_CrcType_Enum definition in cfe_es_api_typedefs.h)
 */
 #define CFE_MISSION_ES_DEFAULT_CRC CFE_ES_CrcType_16_ARC
 
@@ -742,6 +742,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
             AppRecPtr->ControlReq.AppTimerMsec      = 0;
 
             CFE_ES_AppRecordSetUsed(AppRecPtr, CFE_RESOURCEID_RESERVED);
+            CFE_ES_AppRecordAddToNameIndex(AppRecPtr);
             CFE_ES_Global.LastAppId = PendingResourceId;
             Status                  = CFE_SUCCESS;
         }
@@ -801,6 +802,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
         /*
          * Set the table entry back to free
          */
+        CFE_ES_AppRecordRemoveFromNameIndex(AppRecPtr);
         CFE_ES_AppRecordSetFree(AppRecPtr);
         PendingResourceId = CFE_RESOURCEID_UNDEFINED;
     }
@@ -1531,6 +1533,7 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
      */
     if (CFE_ES_AppRecordIsMatch(AppRecPtr, CFE_ES_APPID_C(CFE_RESOURCEID_RESERVED)))
     {
+        CFE_ES_AppRecordRemoveFromNameIndex(AppRecPtr);
         CFE_ES_AppRecordSetFree(AppRecPtr);
     }
 
@@ -175,6 +175,21 @@ bool CFE_ES_CheckCDSHandleSlotUsed(CFE_ResourceId_t CheckId)
     return (CDSRegRecPtr == NULL || CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr));
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_CheckCDSNameSlotMatch(uint32 Slot, const char *Name)
+{
+    CFE_ES_CDS_RegRec_t *CDSRegRecPtr;
+
+    /* Perform a case sensitive name comparison */
+    CDSRegRecPtr = &CFE_ES_Global.CDSVars.Registry[Slot];
+    return (CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr) && strcmp(Name, CDSRegRecPtr->Name) == 0);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -409,6 +424,8 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, size_t UserBlockSize,
             strncpy(RegRecPtr->Name, Name, sizeof(RegRecPtr->Name) - 1);
             RegRecPtr->Name[sizeof(RegRecPtr->Name) - 1] = 0;
             CFE_ES_CDSBlockRecordSetUsed(RegRecPtr, PendingBlockId);
+            CFE_ResourceId_NameIndexAdd(CDS->NameIndex, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+                                        RegRecPtr - CDS->Registry, RegRecPtr->Name);
         }
 
         if (Status == CFE_SUCCESS && IsNewOffset)
@@ -608,6 +625,7 @@ int32 CFE_ES_InitCDSRegistry(void)
     if (Status == CFE_SUCCESS)
     {
         memset(CDS->Registry, 0, sizeof(CDS->Registry));
+        memset(CDS->NameIndex, 0, sizeof(CDS->NameIndex));
 
         Status = CFE_ES_UpdateCDSRegistry();
     }
@@ -726,30 +744,16 @@ CFE_ES_CDS_RegRec_t *CFE_ES_LocateCDSBlockRecordByName(const char *CDSName)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
-    uint32                 NumReg;
+    uint32                 Slot;
 
-    CDSRegRecPtr = CDS->Registry;
-    NumReg       = CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES;
-    while (true)
+    if (CFE_ResourceId_NameIndexFind(CDS->NameIndex, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, CDSName,
+                                     CFE_ES_CheckCDSNameSlotMatch, &Slot) == CFE_SUCCESS)
     {
-        if (NumReg == 0)
-        {
-            CDSRegRecPtr = NULL; /* not found */
-            break;
-        }
-
-        if (CFE_ES_CDSBlockRecordIsUsed(CDSRegRecPtr))
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(CDSName, CDSRegRecPtr->Name) == 0)
-            {
-                /* If the names match, then stop */
-                break;
-            }
-        }
-
-        ++CDSRegRecPtr;
-        --NumReg;
+        CDSRegRecPtr = &CDS->Registry[Slot];
+    }
+    else
+    {
+        CDSRegRecPtr = NULL; /* not found */
     }
 
     return CDSRegRecPtr;
@@ -766,6 +770,7 @@ int32 CFE_ES_RebuildCDS(void)
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     int32                  Status;
     int32                  PspStatus;
+    uint32                 i;
 
     /* First, determine if the CDS registry stored in the CDS is smaller or equal */
     /* in size to the CDS registry we are currently configured for                */
@@ -790,6 +795,17 @@ int32 CFE_ES_RebuildCDS(void)
 
     if (PspStatus == CFE_PSP_SUCCESS)
     {
+        /* Rebuild the name index from the recovered registry */
+        memset(CDS->NameIndex, 0, sizeof(CDS->NameIndex));
+        for (i = 0; i < CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES; ++i)
+        {
+            if (CFE_ES_CDSBlockRecordIsUsed(&CDS->Registry[i]))
+            {
+                CFE_ResourceId_NameIndexAdd(CDS->NameIndex, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES, i,
+                                            CDS->Registry[i].Name);
+            }
+        }
+
         /* Scan the memory pool and identify the created but currently unused memory blocks */
         Status = CFE_ES_RebuildCDSPool(CDS->DataSize, CDS_POOL_OFFSET);
     }
@@ -871,6 +887,8 @@ int32 CFE_ES_DeleteCDS(const char *CDSName, bool CalledByTblServices)
                 else
                 {
                     /* Remove entry from the CDS Registry */
+                    CFE_ResourceId_NameIndexRemove(CDS->NameIndex, CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES,
+                                                   RegRecPtr - CDS->Registry);
                     CFE_ES_CDSBlockRecordSetFree(RegRecPtr);
 
                     Status = CFE_ES_UpdateCDSRegistry();
@@ -163,6 +163,12 @@ typedef struct
     size_t              DataSize;       /**< \brief Size of actual user data pool */
     CFE_ResourceId_t    LastCDSBlockId; /**< \brief Last issued CDS block ID */
     CFE_ES_CDS_RegRec_t Registry[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES]; /**< \brief CDS Registry (Local Copy) */
+
+    /*
+     * Name index over the registry.  This is not stored in the
+     * CDS itself, it is rebuilt from the registry when needed.
+     */
+    CFE_ResourceId_NameIndexEntry_t NameIndex[CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES];
 } CFE_ES_CDS_Instance_t;
 
 /*
@@ -435,6 +441,22 @@ static inline size_t CFE_ES_CDSBlockRecordGetUserSize(const CFE_ES_CDS_RegRec_t
  */
 bool CFE_ES_CheckCDSHandleSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if a CDS registry table slot is used by a block with the given name
+ *
+ * This is a helper function intended to be used with
+ * CFE_ResourceId_NameIndexFind() for finding blocks by name
+ *
+ * As this dereferences fields within the record, global data must be
+ * locked prior to invoking this function.
+ *
+ * @param[in]   Slot       registry table slot to check
+ * @param[in]   Name       complete CDS name to compare against
+ * @returns true if the table slot is occupied by a block with that name, false otherwise
+ */
+bool CFE_ES_CheckCDSNameSlotMatch(uint32 Slot, const char *Name);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Initializes CDS data constructs
@@ -33,57 +33,100 @@
 
 #include <string.h>
 
+/*
+ * Hardware CRC instructions, used when the target compiler flags say they are available.
+ * SSE4.2 only implements CRC-32C, the ARMv8 CRC extension implements both CRC-32C and CRC-32.
+ * Both consume the data in little-endian byte order, which is also the order of the words
+ * loaded here on these targets.  Everything else uses the portable slice-by-8 tables.
+ */
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define CFE_ES_CRC_HW_32_C_BYTE(Crc, Byte) _mm_crc32_u8(Crc, Byte)
+#if defined(__x86_64__)
+#define CFE_ES_CRC_HW_32_C_WORD(Crc, Word) ((uint32)_mm_crc32_u64(Crc, Word))
+#else
+#define CFE_ES_CRC_HW_32_C_WORD(Crc, Word) _mm_crc32_u32(_mm_crc32_u32(Crc, (uint32)(Word)), (uint32)((Word) >> 32))
+#endif
+#elif defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_acle.h>
+#define CFE_ES_CRC_HW_32_C_BYTE(Crc, Byte)        __crc32cb(Crc, Byte)
+#define CFE_ES_CRC_HW_32_C_WORD(Crc, Word)        __crc32cd(Crc, Word)
+#define CFE_ES_CRC_HW_32_ISO_HDLC_BYTE(Crc, Byte) __crc32b(Crc, Byte)
+#define CFE_ES_CRC_HW_32_ISO_HDLC_WORD(Crc, Word) __crc32d(Crc, Word)
+#endif
+
 uint32 CFE_ES_ComputeCRC_Algo_NONE(const void *DataPtr, size_t DataLength, uint32 InputCRC)
 {
     /* This is a placeholder algorithm that always returns 0, no matter what the input was */
     return 0;
 }
 
+/*
+ * Common slice-by-8 loop for the reflected 32 bit algorithms
+ *
+ * The CRC value is passed in and returned without any conditioning,
+ * the caller takes care of the initial value and final XOR.
+ */
+static uint32 CFE_ES_ComputeCRC_Slice8_32(const uint32 Table[8][256], const uint8 *BufPtr, size_t DataLength,
+                                          uint32 Crc)
+{
+    size_t i;
+
+    i = DataLength;
+
+    /* Fold in 8 bytes per iteration, with the lookups being independent of each other */
+    while (i >= 8)
+    {
+        Crc ^= (uint32)BufPtr[0] | ((uint32)BufPtr[1] << 8) | ((uint32)BufPtr[2] << 16) | ((uint32)BufPtr[3] << 24);
+        Crc = Table[7][Crc & 0xFF] ^ Table[6][(Crc >> 8) & 0xFF] ^ Table[5][(Crc >> 16) & 0xFF] ^ Table[4][Crc >> 24] ^
+              Table[3][BufPtr[4]] ^ Table[2][BufPtr[5]] ^ Table[1][BufPtr[6]] ^ Table[0][BufPtr[7]];
+
+        i -= 8;
+        BufPtr += 8;
+    }
+
+    /* Any remaining bytes are done one at a time */
+    while (i > 0)
+    {
+        Crc = (Crc >> 8) ^ Table[0][(Crc ^ *BufPtr) & 0xFF];
+
+        --i;
+        ++BufPtr;
+    }
+
+    return Crc;
+}
+
 uint32 CFE_ES_ComputeCRC_Algo_16_ARC(const void *DataPtr, size_t DataLength, uint32 InputCRC)
 {
     size_t       i;
-    uint16       Index;
     uint16       Crc;
     const uint8 *BufPtr;
 
-    static const uint16 CrcTable[256] = {
-
-        0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1,
-        0xC481, 0x0440, 0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40,
-        0xC901, 0x09C0, 0x0880, 0xC841, 0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1,
-        0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41, 0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
-        0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040, 0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1,
-        0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441, 0x3C00, 0xFCC1, 0xFD81, 0x3D40,
-        0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840, 0x2800, 0xE8C1,
-        0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-        0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0,
-        0x2080, 0xE041, 0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740,
-        0xA501, 0x65C0, 0x6480, 0xA441, 0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0,
-        0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840, 0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
-        0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40, 0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1,
-        0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041, 0x5000, 0x90C1, 0x9181, 0x5140,
-        0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440, 0x9C01, 0x5CC0,
-        0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-        0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0,
-        0x4C80, 0x8C41, 0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341,
-        0x4100, 0x81C1, 0x8081, 0x4040
-
-    };
-
     i      = DataLength;
     BufPtr = (const uint8 *)DataPtr;
     Crc    = InputCRC;
 
+    /*
+     * It is assumed that the supplied buffer is in a
+     * directly-accessible memory space that does not
+     * require special logic to access
+     */
+    while (i >= 8)
+    {
+        Crc ^= (uint16)(BufPtr[0] | (BufPtr[1] << 8));
+        Crc = CFE_ES_CRC_TABLE_16_ARC[7][Crc & 0xFF] ^ CFE_ES_CRC_TABLE_16_ARC[6][Crc >> 8] ^
+              CFE_ES_CRC_TABLE_16_ARC[5][BufPtr[2]] ^ CFE_ES_CRC_TABLE_16_ARC[4][BufPtr[3]] ^
+              CFE_ES_CRC_TABLE_16_ARC[3][BufPtr[4]] ^ CFE_ES_CRC_TABLE_16_ARC[2][BufPtr[5]] ^
+              CFE_ES_CRC_TABLE_16_ARC[1][BufPtr[6]] ^ CFE_ES_CRC_TABLE_16_ARC[0][BufPtr[7]];
+
+        i -= 8;
+        BufPtr += 8;
+    }
+
     while (i > 0)
     {
-        /*
-         * It is assumed that the supplied buffer is in a
-         * directly-accessible memory space that does not
-         * require special logic to access
-         */
-        Index = *BufPtr;
-        Index = ((Crc ^ Index) & 0x00FF);
-        Crc   = ((Crc >> 8) & 0x00FF) ^ CrcTable[Index];
+        Crc = (Crc >> 8) ^ CFE_ES_CRC_TABLE_16_ARC[0][(Crc ^ *BufPtr) & 0xFF];
 
         --i;
         ++BufPtr;
@@ -92,6 +135,81 @@ uint32 CFE_ES_ComputeCRC_Algo_16_ARC(const void *DataPtr, size_t DataLength, uin
     return Crc;
 }
 
+/*
+ * For the 32 bit algorithms, the initial value and final XOR are both all ones,
+ * and are applied here so that an InputCRC of 0 starts a new CRC, and passing
+ * the result of a previous call as InputCRC continues it.
+ */
+uint32 CFE_ES_ComputeCRC_Algo_32_C(const void *DataPtr, size_t DataLength, uint32 InputCRC)
+{
+    const uint8 *BufPtr;
+    uint32       Crc;
+#ifdef CFE_ES_CRC_HW_32_C_WORD
+    uint64 Word;
+#endif
+
+    BufPtr = (const uint8 *)DataPtr;
+    Crc    = ~InputCRC;
+
+#ifdef CFE_ES_CRC_HW_32_C_WORD
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc = CFE_ES_CRC_HW_32_C_WORD(Crc, Word);
+
+        DataLength -= sizeof(Word);
+        BufPtr += sizeof(Word);
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = CFE_ES_CRC_HW_32_C_BYTE(Crc, *BufPtr);
+
+        --DataLength;
+        ++BufPtr;
+    }
+#else
+    Crc = CFE_ES_ComputeCRC_Slice8_32(CFE_ES_CRC_TABLE_32_C, BufPtr, DataLength, Crc);
+#endif
+
+    return ~Crc;
+}
+
+uint32 CFE_ES_ComputeCRC_Algo_32_ISO_HDLC(const void *DataPtr, size_t DataLength, uint32 InputCRC)
+{
+    const uint8 *BufPtr;
+    uint32       Crc;
+#ifdef CFE_ES_CRC_HW_32_ISO_HDLC_WORD
+    uint64 Word;
+#endif
+
+    BufPtr = (const uint8 *)DataPtr;
+    Crc    = ~InputCRC;
+
+#ifdef CFE_ES_CRC_HW_32_ISO_HDLC_WORD
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc = CFE_ES_CRC_HW_32_ISO_HDLC_WORD(Crc, Word);
+
+        DataLength -= sizeof(Word);
+        BufPtr += sizeof(Word);
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = CFE_ES_CRC_HW_32_ISO_HDLC_BYTE(Crc, *BufPtr);
+
+        --DataLength;
+        ++BufPtr;
+    }
+#else
+    Crc = CFE_ES_ComputeCRC_Slice8_32(CFE_ES_CRC_TABLE_32_ISO_HDLC, BufPtr, DataLength, Crc);
+#endif
+
+    return ~Crc;
+}
+
 CFE_ES_ComputeCRC_Params_t *CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_Enum_t CrcType)
 {
     CFE_ES_ComputeCRC_Params_t *ParamPtr;
@@ -102,7 +220,9 @@ CFE_ES_ComputeCRC_Params_t *CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_Enum_t Cr
 
     /* Lookup table for types that are implemented in this version of CFE */
     static CFE_ES_ComputeCRC_Params_t CRC_PARAM_TABLE[CFE_ES_CrcType_MAX] = {
-        [CFE_ES_CrcType_16_ARC] = {0, 0, CFE_ES_ComputeCRC_Algo_16_ARC},
+        [CFE_ES_CrcType_16_ARC]      = {0, 0, CFE_ES_ComputeCRC_Algo_16_ARC},
+        [CFE_ES_CrcType_32_C]        = {0xFFFFFFFF, 0xFFFFFFFF, CFE_ES_ComputeCRC_Algo_32_C},
+        [CFE_ES_CrcType_32_ISO_HDLC] = {0xFFFFFFFF, 0xFFFFFFFF, CFE_ES_ComputeCRC_Algo_32_ISO_HDLC},
     };
 
     if (CrcType < CFE_ES_CrcType_MAX)
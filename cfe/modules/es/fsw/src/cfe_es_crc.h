@@ -21,7 +21,9 @@
  *  Implemention of the CRC algorithm(s) for CFE ES
  *
  *  Notes:
- *    Historically only CRC-16/ARC is defined, but this can be expanded.
+ *    Historically only CRC-16/ARC was defined.  CRC-32C and CRC-32 are
+ *    also available, and further algorithms can be added to the table
+ *    in CFE_ES_ComputeCRC_GetParams().
  *
  */
 
@@ -48,6 +50,13 @@ typedef const struct CFE_ES_ComputeCRC_Params
 
 } CFE_ES_ComputeCRC_Params_t;
 
+/*
+ * Lookup tables for the slice-by-8 algorithms, see cfe_es_crc_tables.c
+ */
+extern const uint16 CFE_ES_CRC_TABLE_16_ARC[8][256];
+extern const uint32 CFE_ES_CRC_TABLE_32_C[8][256];
+extern const uint32 CFE_ES_CRC_TABLE_32_ISO_HDLC[8][256];
+
 CFE_ES_ComputeCRC_Params_t *CFE_ES_ComputeCRC_GetParams(CFE_ES_CrcType_Enum_t CrcType);
 
 #endif /* CFE_ES_CRC_H */
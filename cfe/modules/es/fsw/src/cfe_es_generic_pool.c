@@ -43,6 +43,45 @@
 ** Functions
 */
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the power-of-two size class of a requested block size,
+ * which is the bit length of (ReqSize - 1).
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_GenPoolSizeClass(size_t ReqSize)
+{
+    size_t Value;
+    uint16 Shift;
+    uint16 SizeClass;
+
+    SizeClass = 0;
+
+    if (ReqSize > 1)
+    {
+        /*
+         * Halve the search width each step, so this takes the
+         * same number of steps regardless of the request size.
+         */
+        Value = ReqSize - 1;
+        for (Shift = 4 * sizeof(size_t); Shift > 0; Shift >>= 1)
+        {
+            if ((Value >> Shift) != 0)
+            {
+                SizeClass += Shift;
+                Value >>= Shift;
+            }
+        }
+
+        /* Value is now exactly 1, the top bit */
+        SizeClass += Value;
+    }
+
+    return SizeClass;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -54,7 +93,13 @@ uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSi
 {
     uint16 Index;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /*
+     * Start from the first bucket that could fit this size class.  As the
+     * buckets are sorted, only those within the same class can be too small,
+     * so the number of steps does not depend on the total number of buckets.
+     */
+    for (Index = PoolRecPtr->SizeClassBucket[CFE_ES_GenPoolSizeClass(ReqSize)]; Index < PoolRecPtr->NumBuckets;
+         ++Index)
     {
         if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
         {
@@ -238,6 +283,7 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
     cpuaddr                 AlignMask;
     uint32                  i;
     uint32                  j;
+    size_t                  MinSize;
     CFE_ES_GenPoolBucket_t *BucketPtr;
 
     /*
@@ -316,6 +362,30 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Build the size class lookup table, recording the first bucket
+     * which fits the smallest request in each class.
+     */
+    j = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_SIZE_CLASSES; ++i)
+    {
+        if (i == 0)
+        {
+            MinSize = 0;
+        }
+        else
+        {
+            MinSize = ((size_t)1 << (i - 1)) + 1;
+        }
+
+        while (j < NumBlockSizes && PoolRecPtr->Buckets[j].BlockSize < MinSize)
+        {
+            ++j;
+        }
+
+        PoolRecPtr->SizeClassBucket[i] = j;
+    }
+
     return CFE_SUCCESS;
 }
 
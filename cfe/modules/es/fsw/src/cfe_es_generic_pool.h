@@ -50,6 +50,13 @@
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Number of power-of-two size classes in the bucket lookup table.
+ * Class 0 holds requests of 0 or 1 bytes, class N holds requests
+ * in the range (2^(N-1), 2^N], up to the full width of size_t.
+ */
+#define CFE_ES_GENERIC_POOL_SIZE_CLASSES ((8 * sizeof(size_t)) + 1)
+
 /*
 ** Type Definitions
 */
@@ -115,6 +122,13 @@ struct CFE_ES_GenPoolRecord
 
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    /**
+     * Index of the first bucket large enough for the smallest request in each
+     * size class, or NumBuckets if there is none.  Computed once by
+     * CFE_ES_GenPoolInitialize() so lookups need not scan the smaller buckets.
+     */
+    uint16 SizeClassBucket[CFE_ES_GENERIC_POOL_SIZE_CLASSES];
 };
 
 /*****************************************************************************/
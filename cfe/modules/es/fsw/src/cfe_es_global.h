@@ -145,6 +145,12 @@ typedef struct
     */
     osal_id_t PerfDataMutex;
 
+    /*
+    ** Number of performance markers currently adding to the log,
+    ** see CFE_ES_PerfLogQuiesce()
+    */
+    uint32 PerfMarkersActive;
+
     /*
     ** Startup Sync
     */
@@ -161,8 +167,9 @@ typedef struct
     */
     uint32             RegisteredCoreApps;
     uint32             RegisteredExternalApps;
-    CFE_ResourceId_t   LastAppId;
-    CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    CFE_ResourceId_t                LastAppId;
+    CFE_ES_AppRecord_t              AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+    CFE_ResourceId_NameIndexEntry_t AppNameIndex[CFE_PLATFORM_ES_MAX_APPLICATIONS];
 
     /*
     ** ES Shared Library Table
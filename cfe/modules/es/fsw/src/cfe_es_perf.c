@@ -160,15 +160,17 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             CFE_ES_Global.TaskData.CommandCounter++;
 
             /* Taking lock here as this might be changing states from one active mode to another.
-             * In that case, need to make sure that the log is not written to while resetting the counters. */
+             * Markers do not take the lock, so the log is also quiesced while resetting the counters,
+             * which stops new entries and waits out any marker that already passed its state check. */
             OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+            CFE_ES_PerfLogQuiesce();
             Perf->MetaData.Mode                  = CmdPtr->TriggerMode;
             Perf->MetaData.TriggerCount          = 0;
             Perf->MetaData.DataStart             = 0;
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+            OS_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER); /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
@@ -340,6 +342,17 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 
                 case CFE_ES_PerfDumpState_LOCK_DATA:
                     OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+
+                    /*
+                     * Markers may have completed out of order, so settle the
+                     * start position and put the entries in time order before
+                     * anything is written out.
+                     */
+                    if (Perf->MetaData.DataCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+                    {
+                        Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+                    }
+                    CFE_ES_PerfLogSortEntries();
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
@@ -565,6 +578,8 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
     CFE_ES_PerfDataEntry_t EntryData;
     uint32                 DataEnd;
+    uint32                 TriggerCount;
+    uint32                 State;
     CFE_ES_PerfData_t *    Perf;
 
     /*
@@ -608,46 +623,44 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     }
 
     /*
-     * prepare the entry data (timestamp) before locking,
-     * just in case the locking operation incurs a delay
+     * prepare the entry data (timestamp) before reserving a slot,
+     * so the slot is filled in as soon as possible after reserving it
      */
     EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
     CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
 
     /*
-     * Acquire the perflog mutex before writing into the shared area.
-     * Note this lock is held for long periods while a background dump
-     * is taking place, but the dump should never be active at the
-     * same time that a capture/record is taking place.
+     * The log counters are advanced atomically rather than under the perf
+     * log mutex, so markers from different tasks never wait on each other
+     * and the profiler does not perturb the scheduling it is measuring.
+     *
+     * Note the mutex is still held for long periods while a background dump
+     * is taking place, but the log is set idle before the dump starts, and
+     * the dump waits for any already-started markers to finish.
      */
-    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
 
     /*
-     * Confirm that the global is still non-idle after lock
-     * (state could become idle while getting lock)
+     * Confirm that the global is still non-idle
+     * (state could become idle while getting the timestamp).
+     *
+     * The marker counts itself active before checking, and
+     * CFE_ES_PerfLogQuiesce() sets the log idle before checking the count,
+     * so either this sees the idle state or the quiesce waits for this.
      */
-    if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
+    OS_AtomicAdd32(&CFE_ES_Global.PerfMarkersActive, 1);
+    if (OS_AtomicLoad32(&Perf->MetaData.State) != CFE_ES_PERF_IDLE)
     {
-        /* copy data to next perflog slot */
-        DataEnd                   = Perf->MetaData.DataEnd;
+        /* reserve the next perflog slot and copy data to it */
+        DataEnd = CFE_ES_PerfLogAdvance(&Perf->MetaData.DataEnd, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE, true);
         Perf->DataBuffer[DataEnd] = EntryData;
 
-        ++DataEnd;
-        if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            DataEnd = 0;
-        }
-        Perf->MetaData.DataEnd = DataEnd;
-
-        /* we have filled up the buffer */
-        if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            Perf->MetaData.DataCount++;
-        }
-        else
+        /* we have filled up the buffer (the count before this entry was at least SIZE - 1) */
+        if (CFE_ES_PerfLogAdvance(&Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE, false) >=
+            CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1)
         {
             /* after the buffer fills up start and end point to the same entry since we
-               are now overwriting old data */
+               are now overwriting old data.  Concurrent markers may leave this slightly
+               behind, so it is settled again before the log is dumped. */
             Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
         }
 
@@ -656,24 +669,29 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
         {
             if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
             {
-                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+                /*
+                 * Only move from waiting to triggered.  A plain store could
+                 * race with a stop command and restart an idle log.
+                 */
+                State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+                OS_AtomicCompareAndSwap32(&Perf->MetaData.State, &State, CFE_ES_PERF_TRIGGERED);
             }
         }
 
         /* triggered */
         if (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
         {
-            Perf->MetaData.TriggerCount++;
+            TriggerCount = 1 + CFE_ES_PerfLogAdvance(&Perf->MetaData.TriggerCount, UINT32_MAX, false);
             if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_START)
             {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+                if (TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
                 {
                     Perf->MetaData.State = CFE_ES_PERF_IDLE;
                 }
             }
             else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_CENTER)
             {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
+                if (TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
                 {
                     Perf->MetaData.State = CFE_ES_PERF_IDLE;
                 }
@@ -684,6 +702,129 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
             }
         }
     }
+    OS_AtomicSub32(&CFE_ES_Global.PerfMarkersActive, 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogQuiesce(void)
+{
+    OS_AtomicStore32(&CFE_ES_Global.ResetDataPtr->Perf.MetaData.State, CFE_ES_PERF_IDLE);
+
+    /*
+     * Markers never block while active, so this only waits for ones that
+     * were preempted partway through to be scheduled again.
+     */
+    while (OS_AtomicLoad32(&CFE_ES_Global.PerfMarkersActive) != 0)
+    {
+        OS_TaskDelay(1);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfLogAdvance(uint32 *Counter, uint32 Limit, bool Wrap)
+{
+    uint32 Value;
+    uint32 NextValue;
 
-    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+    Value = *Counter;
+    do
+    {
+        if (Wrap)
+        {
+            /* an index, so the values run from 0 to Limit - 1 */
+            if (Value < Limit - 1)
+            {
+                NextValue = Value + 1;
+            }
+            else
+            {
+                NextValue = 0;
+            }
+        }
+        else if (Value < Limit)
+        {
+            NextValue = Value + 1;
+        }
+        else
+        {
+            /* already at the limit, nothing to update */
+            break;
+        }
+
+        /* On failure this reloads Value with the current counter, so just retry */
+    } while (!OS_AtomicCompareAndSwap32(Counter, &Value, NextValue));
+
+    return Value;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogSortEntries(void)
+{
+    CFE_ES_PerfData_t *    Perf;
+    CFE_ES_PerfDataEntry_t EntryData;
+    uint32                 DataCount;
+    uint32                 Idx;
+    uint32                 Pos;
+    uint32                 PrevPos;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    DataCount = Perf->MetaData.DataCount;
+    if (DataCount > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    }
+
+    /*
+     * Positions are relative to DataStart, wrapping around the end of the buffer.
+     * Each entry is moved back past any later-stamped entries in front of it.
+     */
+    for (Idx = 1; Idx < DataCount; ++Idx)
+    {
+        Pos       = (Perf->MetaData.DataStart + Idx) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+        EntryData = Perf->DataBuffer[Pos];
+
+        while (Pos != Perf->MetaData.DataStart)
+        {
+            if (Pos == 0)
+            {
+                PrevPos = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+            }
+            else
+            {
+                PrevPos = Pos - 1;
+            }
+
+            if (Perf->DataBuffer[PrevPos].TimerUpper32 < EntryData.TimerUpper32 ||
+                (Perf->DataBuffer[PrevPos].TimerUpper32 == EntryData.TimerUpper32 &&
+                 Perf->DataBuffer[PrevPos].TimerLower32 <= EntryData.TimerLower32))
+            {
+                /* in order - stop here */
+                break;
+            }
+
+            Perf->DataBuffer[Pos] = Perf->DataBuffer[PrevPos];
+            Pos                   = PrevPos;
+        }
+
+        Perf->DataBuffer[Pos] = EntryData;
+    }
 }
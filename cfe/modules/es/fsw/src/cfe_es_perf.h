@@ -137,6 +137,48 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Stop adding entries to the performance log
+ *
+ * Sets the log idle and waits for any markers that were already adding an
+ * entry to finish, so that the caller may then change the log counters
+ * without racing a marker.  Markers do not take the perf log mutex, so this
+ * is the only way to be sure none are still advancing the counters.
+ */
+void CFE_ES_PerfLogQuiesce(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically advance a performance log counter
+ *
+ * Adds one to the counter without taking the perf log mutex, so that
+ * markers logged concurrently by different tasks never block each other.
+ * When the counter reaches Limit it either wraps back to zero (if Wrap is
+ * set) or stays at Limit.
+ *
+ * @param[inout] Counter  Counter to advance
+ * @param[in]    Limit    Upper bound of the counter
+ * @param[in]    Wrap     Whether to wrap back to zero at Limit, rather than stop
+ *
+ * @return The value of the counter before it was advanced
+ */
+uint32 CFE_ES_PerfLogAdvance(uint32 *Counter, uint32 Limit, bool Wrap);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Put the captured performance log entries into time order
+ *
+ * Markers reserve log slots in the order they reach the log, which may differ
+ * slightly from the order of their timestamps when tasks are preempted in
+ * between.  This sorts the captured entries by timebase value before they are
+ * written out.  The log is nearly sorted already, so an insertion sort is used,
+ * which runs in close to linear time in that case.
+ *
+ * Must only be called while the log is idle and the perf log mutex is held.
+ */
+void CFE_ES_PerfLogSortEntries(void);
+
 /** @} */
 
 #endif /* CFE_ES_PERF_H */
@@ -80,27 +80,19 @@ CFE_ES_TaskId_t CFE_ES_TaskId_FromOSAL(osal_id_t id)
 CFE_ES_AppRecord_t *CFE_ES_LocateAppRecordByName(const char *Name)
 {
     CFE_ES_AppRecord_t *AppRecPtr;
-    uint32              Count;
+    uint32              Slot;
 
     /*
-    ** Search the Application table for an app with a matching name.
+    ** Look up the app with a matching name in the Application name index.
     */
-    AppRecPtr = CFE_ES_Global.AppTable;
-    Count     = CFE_PLATFORM_ES_MAX_APPLICATIONS;
-    while (true)
+    if (CFE_ResourceId_NameIndexFind(CFE_ES_Global.AppNameIndex, CFE_PLATFORM_ES_MAX_APPLICATIONS, Name,
+                                     CFE_ES_CheckAppNameSlotMatch, &Slot) == CFE_SUCCESS)
     {
-        if (Count == 0)
-        {
-            AppRecPtr = NULL;
-            break;
-        }
-        if (CFE_ES_AppRecordIsUsed(AppRecPtr) && strcmp(Name, CFE_ES_AppRecordGetName(AppRecPtr)) == 0)
-        {
-            break;
-        }
-
-        ++AppRecPtr;
-        --Count;
+        AppRecPtr = &CFE_ES_Global.AppTable[Slot];
+    }
+    else
+    {
+        AppRecPtr = NULL;
     }
 
     return AppRecPtr;
@@ -393,3 +385,17 @@ bool CFE_ES_CheckLibIdSlotUsed(CFE_ResourceId_t CheckId)
     LibRecPtr = CFE_ES_LocateLibRecordByID(CFE_ES_LIBID_C(CheckId));
     return (LibRecPtr == NULL || CFE_ES_LibRecordIsUsed(LibRecPtr));
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_CheckAppNameSlotMatch(uint32 Slot, const char *Name)
+{
+    CFE_ES_AppRecord_t *AppRecPtr;
+
+    AppRecPtr = &CFE_ES_Global.AppTable[Slot];
+    return (CFE_ES_AppRecordIsUsed(AppRecPtr) && strcmp(Name, CFE_ES_AppRecordGetName(AppRecPtr)) == 0);
+}
@@ -226,6 +226,37 @@ static inline void CFE_ES_AppRecordSetFree(CFE_ES_AppRecord_t *AppRecPtr)
     AppRecPtr->AppId = CFE_ES_APPID_UNDEFINED;
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Add an app record table entry to the app name index
+ *
+ * This makes the entry findable via CFE_ES_LocateAppRecordByName() once it
+ * is also marked as used.  It must be called after the name is stored in
+ * the record, and while global data is locked.
+ *
+ * @param[in]   AppRecPtr   pointer to app table entry
+ */
+static inline void CFE_ES_AppRecordAddToNameIndex(CFE_ES_AppRecord_t *AppRecPtr)
+{
+    CFE_ResourceId_NameIndexAdd(CFE_ES_Global.AppNameIndex, CFE_PLATFORM_ES_MAX_APPLICATIONS,
+                                AppRecPtr - CFE_ES_Global.AppTable, AppRecPtr->AppName);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Remove an app record table entry from the app name index
+ *
+ * This should be called whenever the entry is freed, while global
+ * data is locked.
+ *
+ * @param[in]   AppRecPtr   pointer to app table entry
+ */
+static inline void CFE_ES_AppRecordRemoveFromNameIndex(CFE_ES_AppRecord_t *AppRecPtr)
+{
+    CFE_ResourceId_NameIndexRemove(CFE_ES_Global.AppNameIndex, CFE_PLATFORM_ES_MAX_APPLICATIONS,
+                                   AppRecPtr - CFE_ES_Global.AppTable);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if an app record is a match for the given AppID
@@ -814,4 +845,19 @@ bool CFE_ES_CheckLibIdSlotUsed(CFE_ResourceId_t CheckId);
  */
 bool CFE_ES_CheckCounterIdSlotUsed(CFE_ResourceId_t CheckId);
 
+/*
+ * Name check functions used in conjunction with CFE_ResourceId_NameIndexFind()
+ */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Checks if Application slot is used by an app with the given name
+ *
+ * Helper function, confirms a candidate found via the app name index.
+ * Must be called while locked.
+ *
+ * @returns true if slot is used and the app name matches, false otherwise
+ */
+bool CFE_ES_CheckAppNameSlotMatch(uint32 Slot, const char *Name);
+
 #endif /* CFE_ES_RESOURCE_H */
@@ -751,6 +751,7 @@ void CFE_ES_CreateObjects(void)
                     AppRecPtr->ControlReq.AppTimerMsec      = 0;
 
                     CFE_ES_AppRecordSetUsed(AppRecPtr, CFE_RESOURCEID_RESERVED);
+                    CFE_ES_AppRecordAddToNameIndex(AppRecPtr);
                     CFE_ES_Global.LastAppId = PendingAppId;
                 }
 
@@ -790,6 +791,7 @@ void CFE_ES_CreateObjects(void)
                         /* failure mode - just clear the whole app table entry.
                          * This will set the AppType back to CFE_ES_ResourceType_INVALID (0),
                          * as well as clearing any other data that had been written */
+                        CFE_ES_AppRecordRemoveFromNameIndex(AppRecPtr);
                         memset(AppRecPtr, 0, sizeof(*AppRecPtr));
                     }
 
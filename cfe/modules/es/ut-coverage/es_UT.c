@@ -597,6 +597,20 @@ typedef struct
     uint32 AppState;
 } ES_UT_SetAppStateHook_t;
 
+/* A performance marker that was preempted finishes while the caller waits */
+static int32 ES_UT_PerfMarkerDoneHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                      const UT_StubContext_t *Context)
+{
+    CFE_ES_PerfData_t *Perf = UserObj;
+
+    /* the marker advanced the counters before it noticed the log was quiesced */
+    Perf->MetaData.DataEnd   = 5;
+    Perf->MetaData.DataCount = 5;
+    --CFE_ES_Global.PerfMarkersActive;
+
+    return StubRetcode;
+}
+
 static int32 ES_UT_SetAppStateHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
 {
     ES_UT_SetAppStateHook_t *StateHook = UserObj;
@@ -1107,6 +1121,14 @@ static void ES_UT_SetPerfIdle(void *UserObj, UT_EntryKey_t FuncKey, const UT_Stu
     CFE_ES_Global.ResetDataPtr->Perf.MetaData.State = CFE_ES_PERF_IDLE;
 }
 
+static void ES_UT_SetPerfEntry(CFE_ES_PerfDataEntry_t *EntryPtr, uint32 Data, uint32 TimerUpper32,
+                               uint32 TimerLower32)
+{
+    EntryPtr->Data         = Data;
+    EntryPtr->TimerUpper32 = TimerUpper32;
+    EntryPtr->TimerLower32 = TimerLower32;
+}
+
 static void ES_UT_ForEachObjectIncrease(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     OS_ArgCallback_t callback_ptr = UT_Hook_GetArgValueByName(Context, "callback_ptr", OS_ArgCallback_t);
@@ -2198,6 +2220,17 @@ void TestGenericPool(void)
                                                   UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve,
                                                   ES_UT_PoolDirectCommit));
 
+    /*
+     * Check the size class lookup table against the sorted block sizes:
+     * 4, 8, 12 ... 64 in steps of 4, then 128.
+     */
+    UtAssert_UINT32_EQ(Pool1.SizeClassBucket[0], 0);  /* 0-1 bytes starts at 4 */
+    UtAssert_UINT32_EQ(Pool1.SizeClassBucket[3], 1);  /* 5-8 bytes starts at 8 */
+    UtAssert_UINT32_EQ(Pool1.SizeClassBucket[6], 8);  /* 33-64 bytes starts at 36 */
+    UtAssert_UINT32_EQ(Pool1.SizeClassBucket[7], 16); /* 65-128 bytes starts at 128 */
+    UtAssert_UINT32_EQ(Pool1.SizeClassBucket[8], Pool1.NumBuckets);
+    UtAssert_UINT32_EQ(Pool1.SizeClassBucket[CFE_ES_GENERIC_POOL_SIZE_CLASSES - 1], Pool1.NumBuckets);
+
     /* Allocate buffers until no space left */
     CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 44));
     UtAssert_NONZERO(Offset1);
@@ -2231,6 +2264,7 @@ void TestGenericPool(void)
 
     /* Attempt Bigger than the largest bucket */
     UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 1000), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, SIZE_MAX), CFE_ES_ERR_MEM_BLOCK_SIZE);
 
     /* Call stats functions for coverage (no return code) */
     UtAssert_VOIDCALL(CFE_ES_GenPoolGetUsage(&Pool1, &FreeSize, &TotalSize));
@@ -3681,6 +3715,36 @@ void TestPerf(void)
                     UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_EID);
 
+    /* Test that a start command waits for markers already adding an entry
+     * before it resets the log counters
+     */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    Perf->MetaData.State                    = CFE_ES_PERF_TRIGGERED;
+    CFE_ES_Global.PerfMarkersActive         = 1;
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PerfTrigger_START;
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), ES_UT_PerfMarkerDoneHook, Perf);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STARTCMD_EID);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfMarkersActive, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
+
+    /* Test that a marker is no longer counted active once it has added its entry */
+    ES_ResetUnitTest();
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0]  = 0xffff;
+    Perf->MetaData.TriggerMask[0] = 0x0;
+    Perf->MetaData.DataCount      = 0;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfMarkersActive, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+
     /* Test successful performance data collection stop */
     ES_ResetUnitTest();
     memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
@@ -3814,9 +3878,21 @@ void TestPerf(void)
 
     /* Test addition where state goes to idle after first check */
     ES_ResetUnitTest();
-    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-    UT_SetHandlerFunction(UT_KEY(OS_MutSemTake), ES_UT_SetPerfIdle, NULL);
+    Perf->MetaData.State     = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.DataCount = 0;
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_SetPerfIdle, NULL);
     CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 0);
+
+    /* Test that the marker does not take the perf log mutex */
+    ES_ResetUnitTest();
+    Perf->MetaData.State     = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.DataEnd   = 0;
+    Perf->MetaData.DataCount = 0;
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
 
     /* Test addition of a new entry to the performance log with an invalid
      * marker after an invalid marker has already been reported
@@ -3887,6 +3963,64 @@ void TestPerf(void)
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
+    /* Test advancing the log counters, with wrap and without */
+    ES_ResetUnitTest();
+    Perf->MetaData.DataEnd = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 2;
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogAdvance(&Perf->MetaData.DataEnd, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE, true),
+                       CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 2);
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogAdvance(&Perf->MetaData.DataEnd, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE, true),
+                       CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
+    Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogAdvance(&Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE, false),
+                       CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(CFE_ES_PerfLogAdvance(&Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE, false),
+                       CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+
+    /* Test that once the log is full the start follows the end around the ring */
+    ES_ResetUnitTest();
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0]  = 0xffff;
+    Perf->MetaData.TriggerMask[0] = 0x0;
+    Perf->MetaData.DataStart      = 0;
+    Perf->MetaData.DataEnd        = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+    Perf->MetaData.DataCount      = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 0);
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 1);
+    Perf->MetaData.State     = CFE_ES_PERF_IDLE;
+    Perf->MetaData.DataCount = 0;
+
+    /* Test putting entries in time order, including across the end of the buffer */
+    ES_ResetUnitTest();
+    Perf->MetaData.DataStart = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 2;
+    Perf->MetaData.DataCount = 4;
+    ES_UT_SetPerfEntry(&Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 2], 1, 1, 5);
+    ES_UT_SetPerfEntry(&Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1], 2, 2, 0);
+    ES_UT_SetPerfEntry(&Perf->DataBuffer[0], 3, 1, 7);
+    ES_UT_SetPerfEntry(&Perf->DataBuffer[1], 4, 2, 0);
+    UtAssert_VOIDCALL(CFE_ES_PerfLogSortEntries());
+    UtAssert_UINT32_EQ(Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 2].Data, 1);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1].Data, 3);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[0].Data, 2);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[1].Data, 4);
+
+    /* An overfull count is limited to the buffer size */
+    memset(Perf->DataBuffer, 0, sizeof(Perf->DataBuffer));
+    Perf->MetaData.DataStart = 0;
+    Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
+    ES_UT_SetPerfEntry(&Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1], 5, 0, 0);
+    UtAssert_VOIDCALL(CFE_ES_PerfLogSortEntries());
+    UtAssert_UINT32_EQ(Perf->DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1].Data, 5);
+    Perf->MetaData.DataCount = 0;
+
     /* Test performance data collection start with an invalid message length */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), 0, UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
@@ -3919,6 +4053,17 @@ void TestPerf(void)
     CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_IDLE);
 
+    /* With a full log, the dump should settle the start position to the oldest entry */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    memset(Perf->DataBuffer, 0, sizeof(Perf->DataBuffer));
+    Perf->MetaData.DataStart                           = 0;
+    Perf->MetaData.DataEnd                             = 3;
+    Perf->MetaData.DataCount                           = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_LOCK_DATA;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 3);
+
     /* Test a failure to open the output file */
     /* This should go immediately back to idle, and generate CFE_ES_PERF_LOG_ERR_EID */
     ES_ResetUnitTest();
@@ -3999,6 +4144,9 @@ void TestAPI(void)
     size_t               SysLogBufSize;
     uint32               StackBuf[8];
     uint8                Data[12];
+    uint8                CrcData[37];
+    uint32               CrcValue;
+    uint32               i;
     uint32               ResetType;
     CFE_ES_AppId_t       AppId;
     CFE_ES_TaskId_t      TaskId;
@@ -4462,6 +4610,28 @@ void TestAPI(void)
     ES_ResetUnitTest();
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CrcType_CRC_32), 0);
 
+    /* Test the check values of the 32 bit algorithms */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_ES_CrcType_32_C), 0xE3069283);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_ES_CrcType_32_ISO_HDLC), 0xCBF43926);
+
+    /* Test a length that is not a multiple of 8, reference values obtained using a 3rd party tool */
+    for (i = 0; i < sizeof(CrcData); ++i)
+    {
+        CrcData[i] = i + 1;
+    }
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CrcData, sizeof(CrcData), 0, CFE_ES_CrcType_16_ARC), 0x15D7);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CrcData, sizeof(CrcData), 0, CFE_ES_CrcType_32_C), 0x3207FE27);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(CrcData, sizeof(CrcData), 0, CFE_ES_CrcType_32_ISO_HDLC), 0xFC7AA72E);
+
+    /* Test continuing a 32 bit CRC across non-contiguous chunks, starting at an odd offset */
+    CrcValue = CFE_ES_CalculateCRC(CrcData, 13, 0, CFE_ES_CrcType_32_C);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CrcData[13], sizeof(CrcData) - 13, CrcValue, CFE_ES_CrcType_32_C),
+                       0x3207FE27);
+    CrcValue = CFE_ES_CalculateCRC(CrcData, 13, 0, CFE_ES_CrcType_32_ISO_HDLC);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&CrcData[13], sizeof(CrcData) - 13, CrcValue, CFE_ES_CrcType_32_ISO_HDLC),
+                       0xFC7AA72E);
+
     /* Test calculating a CRC on a range of memory using an invalid CRC type
      */
     ES_ResetUnitTest();
@@ -4909,6 +5079,16 @@ void TestCDS()
     ES_ResetUnitTest();
     CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
 
+    /* Test that rebuilding the CDS also rebuilds the name index from the stored registry */
+    CFE_ES_CDSBlockRecordSetUsed(&CFE_ES_Global.CDSVars.Registry[1], CFE_RESOURCEID_RESERVED);
+    strcpy(CFE_ES_Global.CDSVars.Registry[1].Name, "UT.CDS");
+    CFE_UtAssert_SETUP(CFE_ES_UpdateCDSRegistry());
+    memset(CFE_ES_Global.CDSVars.Registry, 0, sizeof(CFE_ES_Global.CDSVars.Registry));
+    CFE_ES_RebuildCDS();
+    UtAssert_STUB_COUNT(CFE_ResourceId_NameIndexAdd, 1);
+    UtAssert_STRINGBUF_EQ(CFE_ES_Global.CDSVars.Registry[1].Name, sizeof(CFE_ES_Global.CDSVars.Registry[1].Name),
+                          "UT.CDS", -1);
+
     /* Test CDS initialization with a read error */
     ES_ResetUnitTest();
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_ReadFromCDS), 1, -1);
@@ -58,6 +58,46 @@
 */
 #define CFE_PLATFORM_EVS_START_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
 
+/**
+**  \cfeevscfg Define Deferred Event Queue Depth
+**
+**  \par Description:
+**       Number of events that may be waiting in the deferred event queue.
+**       Applications that select deferred mode with #CFE_EVS_SetDeferredMode
+**       queue their events here, and the EVS deferred event task logs and
+**       sends them.  Events sent while the queue is full are discarded.
+**
+**  \par Limits
+**       Must be a power of two, such as 64, to enable deferred mode.  The
+**       default of 0 disables deferred mode and the deferred event task
+**       is not created.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH 0
+
+/**
+**  \cfeevscfg Define EVS Deferred Event Task Priority
+**
+**  \par Description:
+**       Defines the priority of the EVS child task that sends deferred events.
+**       This should be lower (numerically higher) than the priority of the
+**       applications that use deferred mode.
+**
+**  \par Limits
+**       Not Applicable
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_TASK_PRIORITY 200
+
+/**
+**  \cfeevscfg Define EVS Deferred Event Task Stack Size
+**
+**  \par Description:
+**       Defines the stack size of the EVS child task that sends deferred events.
+**
+**  \par Limits
+**       There is a lower limit of 2048 on this configuration parameter.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_TASK_STACK_SIZE CFE_PLATFORM_ES_DEFAULT_STACK_SIZE
+
 /**
 **  \cfeevscfg Define Maximum Number of Event Filters per Application
 **
@@ -103,6 +103,8 @@ CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint1
                 AppDataPtr->BinFilters[i].Count   = 0;
             }
 
+            EVS_UpdateFilterMap(AppDataPtr);
+
             EVS_AppDataSetUsed(AppDataPtr, AppID);
         }
     }
@@ -110,6 +112,40 @@ CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint1
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_EVS_SetDeferredMode(bool Deferred)
+{
+    int32          Status;
+    CFE_ES_AppId_t AppID;
+    EVS_AppData_t *AppDataPtr;
+
+    /* Query and verify the caller's AppID */
+    Status = EVS_GetCurrentContext(&AppDataPtr, &AppID);
+    if (Status == CFE_SUCCESS)
+    {
+        if (!EVS_AppDataIsMatch(AppDataPtr, AppID))
+        {
+            Status = CFE_EVS_APP_NOT_REGISTERED;
+        }
+        else if (Deferred && !OS_ObjectIdDefined(CFE_EVS_Global.DeferredSemID))
+        {
+            /* Deferred mode is disabled, or the deferred event task is not running */
+            Status = CFE_EVS_NOT_IMPLEMENTED;
+        }
+        else
+        {
+            AppDataPtr->DeferredFlag = Deferred;
+        }
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -145,9 +181,16 @@ CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spe
                 /* Get current spacecraft time */
                 Time = CFE_TIME_GetTime();
 
-                /* Send the event packets */
+                /* Send the event packets, or queue them for the deferred event task */
                 va_start(Ptr, Spec);
-                EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+                if (AppDataPtr->DeferredFlag)
+                {
+                    Status = EVS_DeferEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+                }
+                else
+                {
+                    EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+                }
                 va_end(Ptr);
             }
             else
@@ -195,9 +238,16 @@ CFE_Status_t CFE_EVS_SendEventWithAppID(uint16 EventID, uint16 EventType, CFE_ES
             /* Get current spacecraft time */
             Time = CFE_TIME_GetTime();
 
-            /* Send the event packets */
+            /* Send the event packets, or queue them for the deferred event task */
             va_start(Ptr, Spec);
-            EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            if (AppDataPtr->DeferredFlag)
+            {
+                Status = EVS_DeferEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            }
+            else
+            {
+                EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            }
             va_end(Ptr);
         }
         else
@@ -240,9 +290,16 @@ CFE_Status_t CFE_EVS_SendTimedEvent(CFE_TIME_SysTime_t Time, uint16 EventID, uin
         {
             if (EVS_CheckAndIncrementSquelchTokens(AppDataPtr) == true)
             {
-                /* Send the event packets */
+                /* Send the event packets, or queue them for the deferred event task */
                 va_start(Ptr, Spec);
-                EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+                if (AppDataPtr->DeferredFlag)
+                {
+                    Status = EVS_DeferEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+                }
+                else
+                {
+                    EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+                }
                 va_end(Ptr);
             }
             else
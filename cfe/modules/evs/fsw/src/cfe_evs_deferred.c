@@ -0,0 +1,245 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+**  File: cfe_evs_deferred.c
+**
+**  Title: Event Services API - Deferred Event Interfaces
+**
+**  Purpose: This module defines the deferred event queue and the
+**           child task that sends deferred events
+**
+*/
+
+/* Include Files */
+#include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
+
+#include <string.h>
+
+/*
+ * The deferred event queue is a bounded multi-producer, single-consumer
+ * ring.  Each slot carries a sequence number giving the queue position it
+ * is ready for: a slot at position P may be claimed by a sender when its
+ * sequence is P, and holds a complete event once the sender sets it to P+1.
+ * After sending the event the deferred task sets it to P+SLOTS, freeing the
+ * slot for the next pass around the ring.  Senders claim positions with a
+ * compare-and-swap on WriteCount, so no lock is taken on the send path
+ * where OSAL atomic operations are lock-free.
+ * Only the first sender after the task last checked the queue gives the
+ * wakeup semaphore; during a burst the others skip that system call.
+ */
+
+#define EVS_DEFERRED_SLOT(Position) \
+    (&CFE_EVS_Global.DeferredQueue.Events[(Position) & (CFE_EVS_DEFERRED_QUEUE_SLOTS - 1)])
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 EVS_DeferredInit(void)
+{
+    int32  Status = CFE_SUCCESS;
+    int32  OsStatus;
+    uint32 i;
+
+    if (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH > 0)
+    {
+        CFE_EVS_Global.DeferredQueue.WriteCount = 0;
+        CFE_EVS_Global.DeferredQueue.ReadCount  = 0;
+        CFE_EVS_Global.DeferredQueue.WakeupFlag = 0;
+        for (i = 0; i < CFE_EVS_DEFERRED_QUEUE_SLOTS; i++)
+        {
+            CFE_EVS_Global.DeferredQueue.Events[i].Sequence = i;
+        }
+
+        OsStatus = OS_CountSemCreate(&CFE_EVS_Global.DeferredSemID, CFE_EVS_DEFERRED_SEM_NAME, 0, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Error creating deferred event semaphore:RC=%ld\n", __func__, (long)OsStatus);
+            Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+        else
+        {
+            Status = CFE_ES_CreateChildTask(&CFE_EVS_Global.DeferredTaskID, CFE_EVS_DEFERRED_TASK_NAME,
+                                            CFE_EVS_DeferredTask, CFE_ES_TASK_STACK_ALLOCATE,
+                                            CFE_PLATFORM_EVS_DEFERRED_TASK_STACK_SIZE,
+                                            CFE_PLATFORM_EVS_DEFERRED_TASK_PRIORITY, 0);
+            if (Status != CFE_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("%s: Error creating deferred event child task:RC=0x%08X\n", __func__,
+                                     (unsigned int)Status);
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 EVS_DeferEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                              const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
+{
+    EVS_DeferredEvent_t *EventPtr;
+    int32                Status     = CFE_SUCCESS;
+    uint32               WakeupFlag = 1;
+    uint32               Position;
+    int32                Distance;
+
+    /* Claim the next queue position, unless the slot for it has not been sent yet */
+    Position = OS_AtomicLoad32(&CFE_EVS_Global.DeferredQueue.WriteCount);
+    while (true)
+    {
+        EventPtr = EVS_DEFERRED_SLOT(Position);
+        Distance = (int32)(OS_AtomicLoad32(&EventPtr->Sequence) - Position);
+        if (Distance < 0)
+        {
+            /* Queue is full */
+            EventPtr = NULL;
+            break;
+        }
+
+        if (Distance == 0)
+        {
+            /* On failure another sender claimed this position, and Position is updated */
+            if (OS_AtomicCompareAndSwap32(&CFE_EVS_Global.DeferredQueue.WriteCount, &Position, Position + 1))
+            {
+                break;
+            }
+        }
+        else
+        {
+            Position = OS_AtomicLoad32(&CFE_EVS_Global.DeferredQueue.WriteCount);
+        }
+    }
+
+    if (EventPtr == NULL)
+    {
+        Status = CFE_EVS_DEFERRED_QUEUE_FULL;
+    }
+    else
+    {
+        EventPtr->AppID     = EVS_AppDataGetID(AppDataPtr);
+        EventPtr->EventID   = EventID;
+        EventPtr->EventType = EventType;
+        EventPtr->Time      = *TimeStamp;
+        EVS_FormatEventMessage(EventPtr->Message, sizeof(EventPtr->Message), MsgSpec, ArgPtr);
+
+        /* Hand the slot to the deferred event task */
+        OS_AtomicStore32(&EventPtr->Sequence, Position + 1);
+
+        WakeupFlag = OS_AtomicExchange32(&CFE_EVS_Global.DeferredQueue.WakeupFlag, 1);
+    }
+
+    if (WakeupFlag == 0)
+    {
+        OS_CountSemGive(CFE_EVS_Global.DeferredSemID);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 EVS_ProcessDeferredEvents(void)
+{
+    EVS_DeferredEvent_t *  EventPtr;
+    EVS_AppData_t *        AppDataPtr;
+    CFE_EVS_LongEventTlm_t LongEventTlm;
+    uint32                 Position;
+    uint32                 Sequence;
+    uint32                 Count = 0;
+
+    /* Senders after this point wake the task again, so none of their events are missed */
+    (void)OS_AtomicExchange32(&CFE_EVS_Global.DeferredQueue.WakeupFlag, 0);
+
+    while (true)
+    {
+        Position = CFE_EVS_Global.DeferredQueue.ReadCount;
+        EventPtr = EVS_DEFERRED_SLOT(Position);
+
+        Sequence = OS_AtomicLoad32(&EventPtr->Sequence);
+
+        if (Sequence != Position + 1)
+        {
+            /* Empty, or the sender has not finished filling in the slot */
+            break;
+        }
+
+        memset(&LongEventTlm, 0, sizeof(LongEventTlm));
+        CFE_MSG_Init(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
+                     sizeof(LongEventTlm));
+        LongEventTlm.Payload.PacketID.EventID   = EventPtr->EventID;
+        LongEventTlm.Payload.PacketID.EventType = EventPtr->EventType;
+        memcpy(LongEventTlm.Payload.Message, EventPtr->Message, sizeof(LongEventTlm.Payload.Message));
+
+        /* The sender may have been deleted since queuing the event, but the event is still sent */
+        AppDataPtr = EVS_GetAppDataByID(EventPtr->AppID);
+        if (AppDataPtr != NULL && !EVS_AppDataIsMatch(AppDataPtr, EventPtr->AppID))
+        {
+            AppDataPtr = NULL;
+        }
+
+        EVS_SendEventTelemetry(AppDataPtr, EventPtr->AppID, &LongEventTlm, &EventPtr->Time);
+
+        /* Free the slot for the next pass around the queue */
+        OS_AtomicStore32(&EventPtr->Sequence, Position + CFE_EVS_DEFERRED_QUEUE_SLOTS);
+
+        CFE_EVS_Global.DeferredQueue.ReadCount = Position + 1;
+        ++Count;
+    }
+
+    return Count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_EVS_DeferredTask(void)
+{
+    int32 OsStatus;
+
+    while (true)
+    {
+        /* Increment the child task Execution Counter */
+        CFE_ES_IncrementTaskCounter();
+
+        /* Pend until an event is queued */
+        OsStatus = OS_CountSemTake(CFE_EVS_Global.DeferredSemID);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("%s: Error waiting for deferred events:RC=%ld\n", __func__, (long)OsStatus);
+            break;
+        }
+
+        EVS_ProcessDeferredEvents();
+    }
+}
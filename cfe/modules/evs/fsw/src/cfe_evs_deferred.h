@@ -0,0 +1,101 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  Title:    Event Services Deferred Event Interfaces.
+ *
+ *  Purpose:
+ *            Unit specification for the event services deferred event queue
+ *            and the child task that sends deferred events.
+ *
+ *  Contents:
+ *       I.  macro and constant type definitions
+ *      II.  EVM internal structures
+ *     III.  function prototypes
+ *
+ *  Design Notes:
+ *            Applications in deferred mode format the event text and place it
+ *            in a bounded queue shared by all applications.  The deferred event
+ *            task takes events from the queue in order, so events from any one
+ *            application are sent in the order they were generated.
+ *
+ *  References:
+ *     Flight Software Branch C Coding Standard Version 1.0a
+ *
+ *  Notes:
+ */
+
+#ifndef CFE_EVS_DEFERRED_H
+#define CFE_EVS_DEFERRED_H
+
+/********************* Include Files  ************************/
+
+#include <stdarg.h>
+
+#include "cfe_evs_task.h" /* EVS internal definitions */
+
+/* ==============   Section I: Macro and Constant Type Definitions   =========== */
+
+/* ==============   Section II: Internal Structures ============ */
+
+/* ==============   Section III: Function Prototypes =========== */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Create the deferred event queue and task
+ *
+ * This routine prepares the deferred event queue and starts the deferred
+ * event task.  It does nothing if deferred mode is disabled by setting
+ * #CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH to 0.
+ */
+int32 EVS_DeferredInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Queue an event for the deferred event task
+ *
+ * This routine formats the event text into the next free queue slot and
+ * wakes the deferred event task.  The event is discarded if the queue is full.
+ *
+ * @returns CFE_SUCCESS if the event was queued, CFE_EVS_DEFERRED_QUEUE_FULL otherwise
+ */
+int32 EVS_DeferEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                              const CFE_TIME_SysTime_t *Time, const char *MsgSpec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send all events waiting in the deferred event queue
+ *
+ * Events are sent in queue order.  This stops at the first slot that a
+ * sending application has claimed but not yet filled in.
+ *
+ * @returns the number of events sent
+ */
+uint32 EVS_ProcessDeferredEvents(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Deferred event task entry point
+ *
+ * This child task waits for events to be queued and sends them.
+ */
+void CFE_EVS_DeferredTask(void);
+
+#endif /* CFE_EVS_DEFERRED_H */
@@ -43,6 +43,7 @@
 #include "cfe_evs_task.h"     /* EVS internal definitions */
 #include "cfe_evs_log.h"      /* EVS log file definitions */
 #include "cfe_evs_utils.h"    /* EVS utility function definitions */
+#include "cfe_evs_deferred.h" /* EVS deferred event definitions */
 #include "cfe_evs_dispatch.h"
 
 #endif /* CFE_EVS_MODULE_ALL_H */
@@ -296,6 +296,12 @@ int32 CFE_EVS_TaskInit(void)
         return Status;
     }
 
+    Status = EVS_DeferredInit();
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
     /* Write the AppID to the global location, now that the rest of initialization is done */
     CFE_EVS_Global.EVS_AppID = AppID;
     CFE_Config_GetVersionString(VersionString, CFE_CFG_MAX_VERSION_STR_LEN, "cFE", CFE_SRC_VERSION, CFE_BUILD_CODENAME,
@@ -1079,6 +1085,8 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
                 FilterPtr->Mask    = CmdPtr->Mask;
                 FilterPtr->Count   = 0;
 
+                EVS_UpdateFilterMap(AppDataPtr);
+
                 EVS_SendEvent(CFE_EVS_ADDFILTER_EID, CFE_EVS_EventType_DEBUG,
                               "Add Filter Command Received with AppName = %s, EventID = 0x%08x, Mask = 0x%04x",
                               LocalName, (unsigned int)CmdPtr->EventID, (unsigned int)CmdPtr->Mask);
@@ -1146,6 +1154,8 @@ int32 CFE_EVS_DeleteEventFilterCmd(const CFE_EVS_DeleteEventFilterCmd_t *data)
             FilterPtr->Mask    = CFE_EVS_NO_MASK;
             FilterPtr->Count   = 0;
 
+            EVS_UpdateFilterMap(AppDataPtr);
+
             EVS_SendEvent(CFE_EVS_DELFILTER_EID, CFE_EVS_EventType_DEBUG,
                           "Delete Filter Command Received with AppName = %s, EventID = 0x%08x", LocalName,
                           (unsigned int)CmdPtr->EventID);
@@ -61,6 +61,16 @@
 #define CFE_EVS_MAX_SQUELCH_COUNT    255
 #define CFE_EVS_PIPE_NAME            "EVS_CMD_PIPE"
 #define CFE_EVS_MAX_PORT_MSG_LENGTH  (CFE_MISSION_EVS_MAX_MESSAGE_LENGTH + OS_MAX_API_NAME + 19)
+#define CFE_EVS_FILTER_MAP_WORDS     8 /* Size of the per-app event ID filter map, 32 IDs per word */
+#define CFE_EVS_DEFERRED_TASK_NAME   "EVS_DEFERRED_TASK"
+#define CFE_EVS_DEFERRED_SEM_NAME    "EVS_DEFERRED_SEM"
+
+/* The deferred event queue keeps one slot when deferred mode is disabled, so the array stays valid C */
+#if CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH > 0
+#define CFE_EVS_DEFERRED_QUEUE_SLOTS CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH
+#else
+#define CFE_EVS_DEFERRED_QUEUE_SLOTS 1
+#endif
 
 /* Since CFE_EVS_MAX_PORT_MSG_LENGTH is the size of the buffer that is sent to
  * print out (using OS_printf), we need to check to make sure that the buffer
@@ -89,6 +99,7 @@ typedef struct
     CFE_ES_AppId_t UnregAppID;
 
     EVS_BinFilter_t BinFilters[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS]; /* Array of binary filters */
+    uint32          FilterMap[CFE_EVS_FILTER_MAP_WORDS];            /* Event IDs which may have a filter */
 
     uint8     ActiveFlag;                /* Application event service active flag */
     uint8     EventTypesActiveFlag;      /* Application event types active flag */
@@ -96,6 +107,7 @@ typedef struct
     OS_time_t LastSquelchCreditableTime; /* Time of last squelch token return */
     int32     SquelchTokens;             /* Application event squelch token counter */
     uint8     SquelchedCount;            /* Application events squelched counter */
+    bool      DeferredFlag;              /* Events are queued for the deferred event task */
 } EVS_AppData_t;
 
 typedef struct
@@ -109,6 +121,24 @@ typedef struct
     EVS_BinFilter_t Filters[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS]; /* Application event filters */
 } CFE_EVS_AppDataFile_t;
 
+typedef struct
+{
+    uint32             Sequence;                                    /* Queue position the slot is ready for */
+    CFE_ES_AppId_t     AppID;                                       /* Application that sent the event */
+    uint16             EventID;                                     /* Numerical event identifier */
+    uint16             EventType;                                   /* Event type */
+    CFE_TIME_SysTime_t Time;                                        /* Event time */
+    char               Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH]; /* Formatted event text */
+} EVS_DeferredEvent_t;
+
+typedef struct
+{
+    uint32              WriteCount; /* Queue positions claimed by sending applications */
+    uint32              ReadCount;  /* Queue positions sent by the deferred event task */
+    uint32              WakeupFlag; /* Deferred event task has been woken and not yet checked the queue */
+    EVS_DeferredEvent_t Events[CFE_EVS_DEFERRED_QUEUE_SLOTS];
+} EVS_DeferredQueue_t;
+
 /* Global data structure */
 typedef struct
 {
@@ -125,6 +155,13 @@ typedef struct
     osal_id_t                 EVS_SharedDataMutexID;
     CFE_ES_AppId_t            EVS_AppID;
     uint32                    EVS_EventBurstMax;
+
+    /*
+    ** Deferred event task data
+    */
+    EVS_DeferredQueue_t DeferredQueue;
+    osal_id_t           DeferredSemID;
+    CFE_ES_TaskId_t     DeferredTaskID;
 } CFE_EVS_Global_t;
 
 /*
@@ -241,8 +241,8 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
                 break;
         }
 
-    /* Is this type of event enabled for this application? */
-    if (Filtered == false)
+    /* Is this type of event enabled for this application, and might it have a filter? */
+    if (Filtered == false && EVS_FilterMapIsSet(AppDataPtr, EventID))
     {
         FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
 
@@ -415,6 +415,33 @@ EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_BinFilter_t *FilterArray)
     return (EVS_BinFilter_t *)NULL;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_UpdateFilterMap(EVS_AppData_t *AppDataPtr)
+{
+    uint32 FilterMap[CFE_EVS_FILTER_MAP_WORDS];
+    uint32 Bit;
+    uint32 i;
+
+    memset(FilterMap, 0, sizeof(FilterMap));
+
+    for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
+    {
+        if (AppDataPtr->BinFilters[i].EventID != (uint16)CFE_EVS_FREE_SLOT)
+        {
+            Bit = AppDataPtr->BinFilters[i].EventID % (CFE_EVS_FILTER_MAP_WORDS * 32);
+            FilterMap[Bit / 32] |= (uint32)1 << (Bit % 32);
+        }
+    }
+
+    /* Built locally so a concurrent event never sees a partially cleared map */
+    memcpy(AppDataPtr->FilterMap, FilterMap, sizeof(FilterMap));
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -452,12 +479,9 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask)
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
 {
-    CFE_EVS_LongEventTlm_t  LongEventTlm;  /* The "long" flavor is always generated, as this is what is logged */
-    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
-    int                     ExpandedLength;
+    CFE_EVS_LongEventTlm_t LongEventTlm; /* The "long" flavor is always generated, as this is what is logged */
 
     memset(&LongEventTlm, 0, sizeof(LongEventTlm));
-    memset(&ShortEventTlm, 0, sizeof(ShortEventTlm));
 
     /* Initialize EVS event packets */
     CFE_MSG_Init(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
@@ -465,41 +489,68 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
     LongEventTlm.Payload.PacketID.EventID   = EventID;
     LongEventTlm.Payload.PacketID.EventType = EventType;
 
+    EVS_FormatEventMessage((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), MsgSpec,
+                           ArgPtr);
+
+    EVS_SendEventTelemetry(AppDataPtr, EVS_AppDataGetID(AppDataPtr), &LongEventTlm, TimeStamp);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_FormatEventMessage(char *MessagePtr, size_t MessageSize, const char *MsgSpec, va_list ArgPtr)
+{
+    int ExpandedLength;
+
     /* vsnprintf() returns the total expanded length of the formatted string */
     /* vsnprintf() copies and zero terminates portion that fits in the buffer */
-    ExpandedLength =
-        vsnprintf((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), MsgSpec, ArgPtr);
+    ExpandedLength = vsnprintf(MessagePtr, MessageSize, MsgSpec, ArgPtr);
 
     /*
      * If vsnprintf is bigger than message size, mark with truncation character
      * Note negative returns (error from vsnprintf) will just leave the message as-is
      */
-    if (ExpandedLength >= (int)sizeof(LongEventTlm.Payload.Message))
+    if (ExpandedLength >= (int)MessageSize)
     {
         /* Mark character before zero terminator to indicate truncation */
-        LongEventTlm.Payload.Message[sizeof(LongEventTlm.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
+        MessagePtr[MessageSize - 2] = CFE_EVS_MSG_TRUNCATED;
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter++;
     }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_SendEventTelemetry(EVS_AppData_t *AppDataPtr, CFE_ES_AppId_t AppID, CFE_EVS_LongEventTlm_t *LongEventTlmPtr,
+                            const CFE_TIME_SysTime_t *TimeStamp)
+{
+    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
 
     /* Obtain task and system information */
-    CFE_ES_GetAppName((char *)LongEventTlm.Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
-                      sizeof(LongEventTlm.Payload.PacketID.AppName));
-    LongEventTlm.Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
-    LongEventTlm.Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
+    CFE_ES_GetAppName((char *)LongEventTlmPtr->Payload.PacketID.AppName, AppID,
+                      sizeof(LongEventTlmPtr->Payload.PacketID.AppName));
+    LongEventTlmPtr->Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
+    LongEventTlmPtr->Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
 
     /* Set the packet timestamp */
-    CFE_MSG_SetMsgTime(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), *TimeStamp);
+    CFE_MSG_SetMsgTime(CFE_MSG_PTR(LongEventTlmPtr->TelemetryHeader), *TimeStamp);
 
     /* Write event to the event log */
-    EVS_AddLog(&LongEventTlm);
+    EVS_AddLog(LongEventTlmPtr);
 
     /* Send event via selected ports */
-    EVS_SendViaPorts(&LongEventTlm);
+    EVS_SendViaPorts(LongEventTlmPtr);
 
     if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_LONG)
     {
         /* Send long event via SoftwareBus */
-        CFE_SB_TransmitMsg(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), true);
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(LongEventTlmPtr->TelemetryHeader), true);
     }
     else if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_SHORT)
     {
@@ -509,10 +560,11 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
          *
          * This goes out on a separate message ID.
          */
+        memset(&ShortEventTlm, 0, sizeof(ShortEventTlm));
         CFE_MSG_Init(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID),
                      sizeof(ShortEventTlm));
         CFE_MSG_SetMsgTime(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), *TimeStamp);
-        ShortEventTlm.Payload.PacketID = LongEventTlm.Payload.PacketID;
+        ShortEventTlm.Payload.PacketID = LongEventTlmPtr->Payload.PacketID;
         CFE_SB_TransmitMsg(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), true);
     }
 
@@ -522,7 +574,7 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter++;
     }
 
-    if (AppDataPtr->EventCount < CFE_EVS_MAX_EVENT_SEND_COUNT)
+    if (AppDataPtr != NULL && AppDataPtr->EventCount < CFE_EVS_MAX_EVENT_SEND_COUNT)
     {
         AppDataPtr->EventCount++;
     }
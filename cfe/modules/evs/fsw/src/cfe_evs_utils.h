@@ -162,6 +162,27 @@ static inline bool EVS_AppDataIsMatch(EVS_AppData_t *AppDataPtr, CFE_ES_AppId_t
     return (AppDataPtr != NULL && CFE_RESOURCEID_TEST_EQUAL(AppDataPtr->AppID, AppID));
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if an event ID may have a filter entry for an app
+ *
+ * Each event ID maps to one bit in the app filter map, which is set for
+ * every event ID in the app filter array.  If the bit is clear, the event
+ * ID is certainly not in the filter array, so the search can be skipped.
+ * If set, the filter array must still be searched, since several event
+ * IDs share each bit.
+ *
+ * @param[in]   AppDataPtr   pointer to app table entry
+ * @param[in]   EventID      event ID to check
+ * @returns true if the event ID may be in the filter array, false if not
+ */
+static inline bool EVS_FilterMapIsSet(const EVS_AppData_t *AppDataPtr, uint16 EventID)
+{
+    uint32 Bit = EventID % (CFE_EVS_FILTER_MAP_WORDS * 32);
+
+    return ((AppDataPtr->FilterMap[Bit / 32] >> (Bit % 32)) & 1) != 0;
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Retrieve app details by app name
@@ -211,6 +232,16 @@ bool EVS_CheckAndIncrementSquelchTokens(EVS_AppData_t *AppDataPtr);
  */
 EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_BinFilter_t *FilterArray);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Update the filter map of an app
+ *
+ * This routine rebuilds the filter map from the event IDs in the
+ * app filter array.  It must be called whenever an event ID in the
+ * filter array is changed.
+ */
+void EVS_UpdateFilterMap(EVS_AppData_t *AppDataPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Enable event types
@@ -241,6 +272,28 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask);
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *Time, const char *MsgSpec, va_list ArgPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Format the text of an event
+ *
+ * This routine expands the event format string into the given buffer.  If the
+ * text does not fit it is marked with the truncation character and the
+ * truncated message counter is incremented.
+ */
+void EVS_FormatEventMessage(char *MessagePtr, size_t MessageSize, const char *MsgSpec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Log and send an event whose text has already been formatted
+ *
+ * This routine completes the long event message, writes it to the event log,
+ * sends it out the enabled output ports and on the software bus, and updates
+ * the message send counters.  AppDataPtr may be NULL if the application that
+ * sent the event is no longer registered; AppID always identifies the sender.
+ */
+void EVS_SendEventTelemetry(EVS_AppData_t *AppDataPtr, CFE_ES_AppId_t AppID, CFE_EVS_LongEventTlm_t *LongEventTlmPtr,
+                            const CFE_TIME_SysTime_t *Time);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Internal function to send an event
@@ -69,4 +69,21 @@
 #error CFE_PLATFORM_EVS_START_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+/*
+** Validate deferred event queue and task...
+*/
+#if (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH & (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH - 1)) != 0
+#error CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH must be a power of two or 0
+#endif
+
+#if CFE_PLATFORM_EVS_DEFERRED_TASK_PRIORITY < 0
+#error CFE_PLATFORM_EVS_DEFERRED_TASK_PRIORITY must be greater than or equal to zero
+#elif CFE_PLATFORM_EVS_DEFERRED_TASK_PRIORITY > 255
+#error CFE_PLATFORM_EVS_DEFERRED_TASK_PRIORITY must be less than or equal to 255
+#endif
+
+#if CFE_PLATFORM_EVS_DEFERRED_TASK_STACK_SIZE < 2048
+#error CFE_PLATFORM_EVS_DEFERRED_TASK_STACK_SIZE must be greater than or equal to 2048
+#endif
+
 #endif /* CFE_EVS_VERIFY_H */
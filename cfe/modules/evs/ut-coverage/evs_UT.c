@@ -55,7 +55,10 @@ static const char *EVS_SYSLOG_MSGS[] = {
     "%s: Call to CFE_EVS_Register Failed:RC=0x%08X\n",
     "%s: Call to CFE_SB_CreatePipe Failed:RC=0x%08X\n",
     "%s: Subscribing to Cmds Failed:RC=0x%08X\n",
-    "%s: Subscribing to HK Request Failed:RC=0x%08X\n"};
+    "%s: Subscribing to HK Request Failed:RC=0x%08X\n",
+    "%s: Error creating deferred event semaphore:RC=%ld\n",
+    "%s: Error creating deferred event child task:RC=0x%08X\n",
+    "%s: Error waiting for deferred events:RC=%ld\n"};
 
 /* Normal dispatching registers the MsgID+CC in order to follow a
  * certain path through a series of switch statements */
@@ -281,6 +284,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_FilterCmd);
     UT_ADD_TEST(Test_InvalidCmd);
     UT_ADD_TEST(Test_Squelching);
+    UT_ADD_TEST(Test_Deferred);
     UT_ADD_TEST(Test_Misc);
 }
 
@@ -418,6 +422,14 @@ void Test_Init(void)
     CFE_EVS_TaskInit();
     CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[10]);
 
+#if (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH > 0)
+    /* Test task initialization where the deferred event semaphore creation fails */
+    UT_InitData_EVS();
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_EVS_TaskInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[15]);
+#endif
+
     /* Test successful task initialization */
     UT_InitData_EVS();
     CFE_EVS_TaskInit();
@@ -644,6 +656,17 @@ void Test_FilterRegistration(void)
     UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)), 0);
     UtAssert_UINT32_EQ(FilterPtr->Count, CFE_EVS_MAX_FILTER_COUNT);
 
+    /* Test that event IDs are only looked up if they may have a filter */
+    UtAssert_BOOL_TRUE(EVS_FilterMapIsSet(AppDataPtr, CFE_PLATFORM_EVS_MAX_EVENT_FILTERS - 1));
+    UtAssert_BOOL_FALSE(EVS_FilterMapIsSet(AppDataPtr, CFE_PLATFORM_EVS_MAX_EVENT_FILTERS));
+
+    /* Test that an event ID sharing a filter map bit with a filtered event ID gets through */
+    UT_InitData_EVS();
+    UtAssert_BOOL_TRUE(EVS_FilterMapIsSet(AppDataPtr, CFE_EVS_FILTER_MAP_WORDS * 32));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(CFE_EVS_FILTER_MAP_WORDS * 32, CFE_EVS_EventType_INFORMATION, "OK"));
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter, 4);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)), 1);
+
     /* Return application to original state: re-register application */
     UT_InitData_EVS();
     CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
@@ -1622,9 +1645,13 @@ void Test_FilterCmd(void)
     CFE_EVS_AddEventFilterCmd_t     appmaskcmd;
     CFE_EVS_ResetFilterCmd_t        appcmdcmd;
     CFE_EVS_EnableAppEventTypeCmd_t appbitcmd;
+    EVS_AppData_t *                 AppDataPtr;
 
     UtPrintf("Begin Test Filter Command");
 
+    /* Get a local ref to the "current" AppData table entry */
+    EVS_GetCurrentContext(&AppDataPtr, NULL);
+
     CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
 
     UT_InitData_EVS();
@@ -1681,6 +1708,7 @@ void Test_FilterCmd(void)
     UT_EVS_DoDispatchCheckEvents(&appmaskcmd, sizeof(appmaskcmd), UT_TPID_CFE_EVS_CMD_ADD_EVENT_FILTER_CC,
                                  &UT_EVS_EventBuf);
     UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_ADDFILTER_EID);
+    UtAssert_BOOL_TRUE(EVS_FilterMapIsSet(AppDataPtr, 0));
 
     /* Test adding an event filter to an event already registered
      * for filtering
@@ -1711,6 +1739,7 @@ void Test_FilterCmd(void)
     UT_EVS_DoDispatchCheckEvents(&appcmdcmd, sizeof(appcmdcmd), UT_TPID_CFE_EVS_CMD_DELETE_EVENT_FILTER_CC,
                                  &UT_EVS_EventBuf);
     UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_DELFILTER_EID);
+    UtAssert_BOOL_FALSE(EVS_FilterMapIsSet(AppDataPtr, 0));
 
     /* Test filling the event filters */
     UT_InitData_EVS();
@@ -2019,6 +2048,143 @@ void Test_Squelching(void)
     UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), NULL, NULL);
 }
 
+/*
+** Test deferred event mode
+*/
+#if (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH > 0)
+void Test_Deferred(void)
+{
+    CFE_EVS_LongEventTlm_t         CapturedTlm;
+    UT_SoftwareBusSnapshot_Entry_t SnapshotData = {.MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_LONG_EVENT_MSG_MID),
+                                                   .SnapshotBuffer = &CapturedTlm,
+                                                   .SnapshotOffset = 0,
+                                                   .SnapshotSize   = sizeof(CapturedTlm)};
+    CFE_TIME_SysTime_t             Time         = {0, 0};
+    CFE_ES_AppId_t                 AppID;
+    EVS_AppData_t *                AppDataPtr;
+    EVS_DeferredEvent_t *          EventPtr;
+    uint16                         EventCount;
+    uint32                         Position;
+    uint32                         i;
+
+    UtPrintf("Begin Test Deferred");
+
+    UT_InitData_EVS();
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+    CFE_ES_GetAppID(&AppID);
+    EVS_GetCurrentContext(&AppDataPtr, NULL);
+
+    /* Test deferred event task initialization failures */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(EVS_DeferredInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[15]);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_INT32_EQ(EVS_DeferredInit(), CFE_ES_ERR_CHILD_TASK_CREATE);
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[16]);
+
+    /* Test selecting deferred mode when the deferred event task is not running */
+    CFE_EVS_Global.DeferredSemID = OS_OBJECT_ID_UNDEFINED;
+    UtAssert_INT32_EQ(CFE_EVS_SetDeferredMode(true), CFE_EVS_NOT_IMPLEMENTED);
+    UtAssert_BOOL_FALSE(AppDataPtr->DeferredFlag);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SetDeferredMode(false));
+
+    /* Test selecting deferred mode with an illegal application ID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_AppID_ToIndex), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_EVS_SetDeferredMode(true), CFE_EVS_APP_ILLEGAL_APP_ID);
+
+    /* Test successful initialization and selection of deferred mode */
+    UT_InitData_EVS();
+    CFE_UtAssert_SUCCESS(EVS_DeferredInit());
+    CFE_UtAssert_SUCCESS(CFE_EVS_SetDeferredMode(true));
+    UtAssert_BOOL_TRUE(AppDataPtr->DeferredFlag);
+
+    /* Test that deferred events are only sent by the deferred event task, in order, with one wakeup */
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &SnapshotData);
+    EventCount = AppDataPtr->EventCount;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(1, CFE_EVS_EventType_INFORMATION, "Deferred %d", 1));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEventWithAppID(2, CFE_EVS_EventType_INFORMATION, AppID, "Deferred %d", 2));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendTimedEvent(Time, 3, CFE_EVS_EventType_INFORMATION, "Deferred %d", 3));
+    UtAssert_UINT32_EQ(SnapshotData.Count, 0);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 3);
+    UtAssert_UINT32_EQ(SnapshotData.Count, 3);
+    UtAssert_UINT32_EQ(CapturedTlm.Payload.PacketID.EventID, 3);
+    UtAssert_STRINGBUF_EQ(CapturedTlm.Payload.Message, sizeof(CapturedTlm.Payload.Message), "Deferred 3", -1);
+    UtAssert_UINT32_EQ(AppDataPtr->EventCount, EventCount + 3);
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 0);
+
+    /* Test that events are discarded when the queue is full */
+    for (i = 0; i < CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH; i++)
+    {
+        CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(4, CFE_EVS_EventType_INFORMATION, "Deferred"));
+    }
+    UtAssert_INT32_EQ(CFE_EVS_SendEvent(5, CFE_EVS_EventType_INFORMATION, "Discarded"),
+                      CFE_EVS_DEFERRED_QUEUE_FULL);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 2);
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH);
+    UtAssert_UINT32_EQ(CapturedTlm.Payload.PacketID.EventID, 4);
+
+    /* Test that the deferred event task waits for a slot which is claimed but not yet filled in */
+    SnapshotData.Count = 0;
+    Position           = CFE_EVS_Global.DeferredQueue.WriteCount++;
+    EventPtr           = &CFE_EVS_Global.DeferredQueue.Events[Position & (CFE_EVS_DEFERRED_QUEUE_SLOTS - 1)];
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(7, CFE_EVS_EventType_INFORMATION, "Deferred"));
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 0);
+    EventPtr->AppID     = AppID;
+    EventPtr->EventID   = 6;
+    EventPtr->EventType = CFE_EVS_EventType_INFORMATION;
+    EventPtr->Sequence  = Position + 1;
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 2);
+    UtAssert_UINT32_EQ(SnapshotData.Count, 2);
+    UtAssert_UINT32_EQ(CapturedTlm.Payload.PacketID.EventID, 7);
+
+    /* Test that events queued by an application are still sent after it is deleted */
+    EventCount = AppDataPtr->EventCount;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(8, CFE_EVS_EventType_INFORMATION, "Deferred"));
+    CFE_UtAssert_SUCCESS(CFE_EVS_CleanUpApp(AppID));
+    UtAssert_INT32_EQ(CFE_EVS_SetDeferredMode(false), CFE_EVS_APP_NOT_REGISTERED);
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 1);
+    UtAssert_UINT32_EQ(CapturedTlm.Payload.PacketID.EventID, 8);
+    UtAssert_UINT32_EQ(AppDataPtr->EventCount, EventCount);
+
+    /* Test that registering again selects immediate mode */
+    CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+    UtAssert_BOOL_FALSE(AppDataPtr->DeferredFlag);
+
+    /* Test the deferred event task, which exits when waiting for events fails */
+    UT_InitData_EVS();
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &SnapshotData);
+    SnapshotData.Count = 0;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SetDeferredMode(true));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(9, CFE_EVS_EventType_INFORMATION, "Deferred"));
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    UtAssert_VOIDCALL(CFE_EVS_DeferredTask());
+    UtAssert_UINT32_EQ(SnapshotData.Count, 1);
+    CFE_UtAssert_SYSLOG(EVS_SYSLOG_MSGS[17]);
+
+    CFE_UtAssert_SUCCESS(CFE_EVS_SetDeferredMode(false));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), NULL, NULL);
+}
+#else
+void Test_Deferred(void)
+{
+    EVS_AppData_t *AppDataPtr;
+
+    UtPrintf("Begin Test Deferred");
+
+    UT_InitData_EVS();
+    EVS_GetCurrentContext(&AppDataPtr, NULL);
+
+    /* Test that no deferred event task is created and deferred mode cannot be selected when it is disabled */
+    CFE_UtAssert_SUCCESS(EVS_DeferredInit());
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_INT32_EQ(CFE_EVS_SetDeferredMode(true), CFE_EVS_NOT_IMPLEMENTED);
+    UtAssert_BOOL_FALSE(AppDataPtr->DeferredFlag);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SetDeferredMode(false));
+}
+#endif
+
 /*
 ** Test miscellaneous functionality
 */
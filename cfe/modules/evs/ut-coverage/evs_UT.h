@@ -264,6 +264,22 @@ void Test_InvalidCmd(void);
 ******************************************************************************/
 void Test_Squelching(void);
 
+/*****************************************************************************/
+/**
+** \brief Test deferred event mode
+**
+** \par Description
+**        This function tests queuing events for the deferred event task
+**        and sending them from that task.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Deferred(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test miscellaneous functionality
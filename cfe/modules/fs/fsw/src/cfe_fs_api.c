@@ -667,55 +667,69 @@ CFE_Status_t CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *File
 
 /*----------------------------------------------------------------
  *
- * Implemented per public API
+ * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+bool CFE_FS_BackgroundFileDumpFlush(CFE_FS_FileWriteMetaData_t *Meta, CFE_FS_CurrentFileState_t *State)
 {
-    CFE_FS_CurrentFileState_t *       State;
-    CFE_FS_BackgroundFileDumpEntry_t *Curr;
-    CFE_FS_FileWriteMetaData_t *      Meta;
-    int32                             OsStatus;
-    int32                             Status;
-    CFE_FS_Header_t                   FileHdr;
-    void *                            RecordPtr;
-    size_t                            RecordSize;
-    bool                              IsEOF;
+    int32 OsStatus;
+    bool  IsOK;
 
-    State      = &CFE_FS_Global.FileDump.Current;
-    Curr       = NULL;
-    IsEOF      = false;
-    RecordPtr  = NULL;
-    RecordSize = 0;
+    IsOK = true;
 
-    State->Credit += (ElapsedTime * CFE_FS_BACKGROUND_CREDIT_PER_SECOND) / 1000;
-    if (State->Credit > CFE_FS_BACKGROUND_MAX_CREDIT)
+    if (State->StagedSize > 0)
     {
-        State->Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
-    }
+        OsStatus = OS_write(State->Fd, State->Staging, State->StagedSize);
 
-    /*
-     * Lock shared data.
-     * Not strictly necessary as the "CompleteCount" is only updated
-     * by this task but this helps in case the access isn't atomic.
-     */
-    CFE_FS_LockSharedData(__func__);
+        if (OsStatus != State->StagedSize)
+        {
+            /* end the file early */
+            OS_close(State->Fd);
+            State->Fd = OS_OBJECT_ID_UNDEFINED;
 
-    if (CFE_FS_Global.FileDump.CompleteCount != CFE_FS_Global.FileDump.RequestCount)
-    {
-        Curr = &CFE_FS_Global.FileDump
-                    .Entries[CFE_FS_Global.FileDump.CompleteCount & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)];
-    }
+            /* generate write error event */
+            /* NOTE: This converts the OSAL status directly into a CFE status for logging */
+            Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum,
+                          State->StagedSize, State->FileSize);
 
-    CFE_FS_UnlockSharedData(__func__);
+            IsOK = false;
+        }
+        else
+        {
+            State->FileSize += State->StagedSize;
+        }
 
-    if (Curr == NULL)
-    {
-        return false;
+        State->StagedSize = 0;
     }
 
-    Meta = Curr->Meta;
+    return IsOK;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_FS_BackgroundFileDumpRunEntry(CFE_FS_BackgroundFileDumpEntry_t *Curr, int32 Quota)
+{
+    CFE_FS_CurrentFileState_t * State;
+    CFE_FS_FileWriteMetaData_t *Meta;
+    int32                       OsStatus;
+    int32                       Status;
+    int32                       Used;
+    CFE_FS_Header_t             FileHdr;
+    void *                      RecordPtr;
+    size_t                      RecordSize;
+    bool                        IsEOF;
+
+    State      = &Curr->Current;
+    Meta       = Curr->Meta;
+    Used       = 0;
+    IsEOF      = false;
+    RecordPtr  = NULL;
+    RecordSize = 0;
 
     if (!OS_ObjectIdDefined(State->Fd) && Meta->IsPending)
     {
@@ -743,14 +757,15 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
             }
             else
             {
-                State->FileSize = sizeof(CFE_FS_Header_t);
-                State->Credit -= sizeof(CFE_FS_Header_t);
-                State->RecordNum = 0;
+                State->FileSize   = sizeof(CFE_FS_Header_t);
+                State->StagedSize = 0;
+                State->RecordNum  = 0;
+                Used += CFE_FS_BACKGROUND_WRITE_COST(sizeof(CFE_FS_Header_t));
             }
         }
     }
 
-    while (OS_ObjectIdDefined(State->Fd) && State->Credit > 0 && !IsEOF)
+    while (OS_ObjectIdDefined(State->Fd) && Used < Quota && !IsEOF)
     {
         /*
          * Getter should return false on EOF (last record), true if more data is still waiting
@@ -764,63 +779,187 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
          */
         if (RecordSize > 0)
         {
-            State->Credit -= RecordSize;
-
             /*
-             * Now write to file
+             * Make room in the staging buffer if this record does not fit
              */
-            OsStatus = OS_write(State->Fd, RecordPtr, RecordSize);
+            if (State->StagedSize + RecordSize > sizeof(State->Staging))
+            {
+                Used += CFE_FS_BACKGROUND_WRITE_COST(State->StagedSize);
+
+                if (!CFE_FS_BackgroundFileDumpFlush(Meta, State))
+                {
+                    break;
+                }
+            }
 
-            if (OsStatus != RecordSize)
+            if (RecordSize > sizeof(State->Staging))
             {
-                /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
-                OS_close(State->Fd);
-                State->Fd = OS_OBJECT_ID_UNDEFINED;
+                /*
+                 * Record will never fit, so write it directly
+                 */
+                Used += CFE_FS_BACKGROUND_WRITE_COST(RecordSize);
 
-                /* generate write error event */
-                /* NOTE: This converts the OSAL status directly into a CFE status for logging */
-                Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum,
-                              RecordSize, State->FileSize);
-                break;
+                OsStatus = OS_write(State->Fd, RecordPtr, RecordSize);
+
+                if (OsStatus != RecordSize)
+                {
+                    /* end the file early */
+                    OS_close(State->Fd);
+                    State->Fd = OS_OBJECT_ID_UNDEFINED;
+
+                    /* generate write error event */
+                    /* NOTE: This converts the OSAL status directly into a CFE status for logging */
+                    Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum,
+                                  RecordSize, State->FileSize);
+                    break;
+                }
+
+                State->FileSize += RecordSize;
             }
             else
             {
-                State->FileSize += RecordSize;
+                memcpy(&State->Staging[State->StagedSize], RecordPtr, RecordSize);
+                State->StagedSize += RecordSize;
             }
         }
 
         ++State->RecordNum;
     }
 
-    /* On normal EOF close the file and generate the complete event */
-    if (IsEOF)
+    /*
+     * On normal EOF write out whatever is still staged, then close the file and generate the complete event
+     * (cannot be done if the file was closed early due to an error, as that already generated an event)
+     */
+    if (IsEOF && OS_ObjectIdDefined(State->Fd))
     {
-        OS_close(State->Fd);
-        State->Fd = OS_OBJECT_ID_UNDEFINED;
+        Used += CFE_FS_BACKGROUND_WRITE_COST(State->StagedSize);
+
+        if (CFE_FS_BackgroundFileDumpFlush(Meta, State))
+        {
+            OS_close(State->Fd);
+            State->Fd = OS_OBJECT_ID_UNDEFINED;
 
-        /* generate complete event */
-        Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, State->RecordNum, 0, State->FileSize);
+            /* generate complete event */
+            Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, State->RecordNum, 0, State->FileSize);
+        }
+    }
+
+    return Used;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+{
+    CFE_FS_BackgroundFileDumpState_t *DumpState;
+    CFE_FS_BackgroundFileDumpEntry_t *Curr;
+    CFE_FS_FileWriteMetaData_t *      Meta;
+    uint32                            FirstPending;
+    uint32                            EndPending;
+    uint32                            NumPending;
+    uint32                            i;
+    int32                             Quota;
+    bool                              IsPending;
+
+    DumpState = &CFE_FS_Global.FileDump;
+
+    DumpState->Credit += (ElapsedTime * CFE_FS_BACKGROUND_CREDIT_PER_SECOND) / 1000;
+    if (DumpState->Credit > CFE_FS_BACKGROUND_MAX_CREDIT)
+    {
+        DumpState->Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
     }
 
     /*
-     * if the file is not open, consider this file complete, and advance the head position.
-     * (done this way so it also catches the case where the file failed to create, not just EOF)
+     * Lock shared data to get the range of pending entries.
+     * Entries in this range are only changed by this task, so
+     * they can be worked on after unlocking.
      */
-    if (!OS_ObjectIdDefined(State->Fd))
+    CFE_FS_LockSharedData(__func__);
+
+    FirstPending = DumpState->CompleteCount;
+    EndPending   = DumpState->RequestCount;
+
+    CFE_FS_UnlockSharedData(__func__);
+
+    /*
+     * All pending entries are written at the same time, with the credit shared
+     * equally between them.  This is repeated while credit remains, so that any
+     * credit not used by an entry which finished early goes to the others.
+     */
+    NumPending = EndPending - FirstPending;
+    while (NumPending > 0 && DumpState->Credit > 0)
     {
-        CFE_FS_LockSharedData(__func__);
+        Quota      = (DumpState->Credit + (int32)NumPending - 1) / (int32)NumPending;
+        NumPending = 0;
 
-        /* Wipe the entry structure, as it will be reused */
-        memset(Curr, 0, sizeof(*Curr));
-        ++CFE_FS_Global.FileDump.CompleteCount;
+        for (i = FirstPending; i != EndPending; ++i)
+        {
+            Curr = &DumpState->Entries[i & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)];
+            Meta = Curr->Meta;
 
-        /* Set the "IsPending" flag to false - this indicates that the originator may re-post now */
-        Meta->IsPending = false;
+            if (Meta == NULL)
+            {
+                /* already finished */
+            }
+            else if (DumpState->Credit <= 0)
+            {
+                /* no credit left for this entry, continue it next time */
+                ++NumPending;
+            }
+            else
+            {
+                DumpState->Credit -= CFE_FS_BackgroundFileDumpRunEntry(Curr, Quota);
 
-        CFE_FS_UnlockSharedData(__func__);
+                /*
+                 * if the file is not open, consider this entry finished.
+                 * (done this way so it also catches the case where the file failed to create, not just EOF)
+                 */
+                if (OS_ObjectIdDefined(Curr->Current.Fd))
+                {
+                    ++NumPending;
+                }
+                else
+                {
+                    CFE_FS_LockSharedData(__func__);
+
+                    Curr->Meta = NULL;
+
+                    /* Set the "IsPending" flag to false - this indicates that the originator may re-post now */
+                    Meta->IsPending = false;
+
+                    CFE_FS_UnlockSharedData(__func__);
+                }
+            }
+        }
     }
 
-    return !IsEOF;
+    CFE_FS_LockSharedData(__func__);
+
+    /*
+     * Advance the head position past all finished entries.  Entries are
+     * wiped as they will be reused.
+     */
+    while (DumpState->CompleteCount != DumpState->RequestCount)
+    {
+        Curr = &DumpState->Entries[DumpState->CompleteCount & (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1)];
+        if (Curr->Meta != NULL)
+        {
+            break;
+        }
+
+        memset(Curr, 0, sizeof(*Curr));
+        ++DumpState->CompleteCount;
+    }
+
+    IsPending = (DumpState->CompleteCount != DumpState->RequestCount);
+
+    CFE_FS_UnlockSharedData(__func__);
+
+    return IsPending;
 }
 
 /*----------------------------------------------------------------
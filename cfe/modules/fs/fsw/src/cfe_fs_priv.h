@@ -51,11 +51,11 @@
 /*
  * Background file credit accumulation rate
  *
- * The background file writer will limit the total bytes written over time.  This
- * controls the amount of "credit" (bytes that can be written) per second
- * of elapsed time.
+ * The background file writer will limit the total writes over time.  This
+ * controls the amount of "credit" (see CFE_FS_BACKGROUND_WRITE_CREDIT) that
+ * is gained per second of elapsed time.
  *
- * This permits a file writing rate of up to 10kbytes/sec.
+ * This permits up to 20 writes, or 40kbytes of staged records, per second.
  */
 #define CFE_FS_BACKGROUND_CREDIT_PER_SECOND 10000
 
@@ -72,30 +72,62 @@
  */
 #define CFE_FS_BACKGROUND_MAX_CREDIT 10000
 
+/*
+ * Size of the staging buffer for each background file write
+ *
+ * Records from the getter are copied into this buffer and written to the
+ * file in one call once it fills up, rather than one write per record.
+ * Records larger than this are written directly.
+ */
+#define CFE_FS_BACKGROUND_STAGING_SIZE 2048
+
+/*
+ * Credit used by each write to a background dump file
+ *
+ * It is the number of writes, more than their size, that loads the file
+ * system, so credit is used per write rather than per byte: each write of up
+ * to CFE_FS_BACKGROUND_STAGING_SIZE bytes uses this much, and a larger record
+ * written directly uses this much for each staging buffer's worth of data.
+ * Staging a record uses no credit.
+ */
+#define CFE_FS_BACKGROUND_WRITE_CREDIT 500
+
+/*
+ * Credit used by a write of "Size" bytes
+ */
+#define CFE_FS_BACKGROUND_WRITE_COST(Size) \
+    (CFE_FS_BACKGROUND_WRITE_CREDIT * (((Size) + CFE_FS_BACKGROUND_STAGING_SIZE - 1) / CFE_FS_BACKGROUND_STAGING_SIZE))
+
 /*
 ** Type Definitions
 */
 
+typedef struct
+{
+    osal_id_t Fd;
+    uint32    RecordNum;
+    size_t    FileSize;   /**< Bytes written to the file so far */
+    size_t    StagedSize; /**< Bytes held in the staging buffer, not yet written */
+    uint8     Staging[CFE_FS_BACKGROUND_STAGING_SIZE];
+} CFE_FS_CurrentFileState_t;
+
 /*
  * Background file dump entry structure
  *
  * This structure is stored in global memory and keeps the state
  * of the file dump from one iteration to the next.
+ *
+ * All pending entries are written at the same time, so each one keeps
+ * its own file state.  The Meta pointer is set to NULL once the entry
+ * is finished, which may be before earlier entries in the queue.
  */
 typedef struct
 {
     CFE_ES_AppId_t              RequestorAppId;
     CFE_FS_FileWriteMetaData_t *Meta;
+    CFE_FS_CurrentFileState_t   Current;
 } CFE_FS_BackgroundFileDumpEntry_t;
 
-typedef struct
-{
-    osal_id_t Fd;
-    int32     Credit;
-    uint32    RecordNum;
-    size_t    FileSize;
-} CFE_FS_CurrentFileState_t;
-
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Background file dump queue structure
@@ -107,6 +139,9 @@ typedef struct
  * same value.  When an application requests a background file dump,
  * the "RequestCount" is incremented accordingly, and when the background
  * job finishes, the "CompleteCount" is incremented accordingly.
+ *
+ * Entries may finish out of order, but "CompleteCount" only advances past
+ * an entry once it and all entries before it have finished.
  */
 typedef struct
 {
@@ -114,15 +149,14 @@ typedef struct
     uint32 CompleteCount; /**< Total Number of background file writes completed */
 
     /**
-     * Data related to each background file write request
+     * Credit left for writing, shared by all pending entries
      */
-    CFE_FS_BackgroundFileDumpEntry_t Entries[CFE_FS_MAX_BACKGROUND_FILE_WRITES];
+    int32 Credit;
 
     /**
-     * Persistent storage for the current file write
-     * (reused for each file)
+     * Data related to each background file write request
      */
-    CFE_FS_CurrentFileState_t Current;
+    CFE_FS_BackgroundFileDumpEntry_t Entries[CFE_FS_MAX_BACKGROUND_FILE_WRITES];
 } CFE_FS_BackgroundFileDumpState_t;
 
 /******************************************************************************
@@ -176,4 +210,34 @@ void CFE_FS_ByteSwapCFEHeader(CFE_FS_Header_t *Hdr);
  */
 void CFE_FS_ByteSwapUint32(uint32 *Uint32ToSwapPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes the staged records of a background file dump to the file
+ *
+ * If the write fails, the file is closed and the record write error
+ * event is sent to the requester.
+ *
+ * @param Meta  The metadata object of the request
+ * @param State The file state of the request
+ *
+ * @returns true if successful (or nothing was staged), false if the write failed
+ */
+bool CFE_FS_BackgroundFileDumpFlush(CFE_FS_FileWriteMetaData_t *Meta, CFE_FS_CurrentFileState_t *State);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Does some of the work of one background file dump request
+ *
+ * Opens the file if needed, then gets records and stages or writes them
+ * until at least "Quota" credit has been used or the end of the file is
+ * reached.
+ *
+ * @param Curr  The request entry
+ * @param Quota The credit this entry may use during this call
+ *
+ * @returns The credit used.  The entry is finished once the file is no
+ *          longer open.
+ */
+int32 CFE_FS_BackgroundFileDumpRunEntry(CFE_FS_BackgroundFileDumpEntry_t *Curr, int32 Quota);
+
 #endif /* CFE_FS_PRIV_H */
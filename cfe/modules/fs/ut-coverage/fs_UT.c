@@ -83,6 +83,8 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_FS_Private);
 
     UT_ADD_TEST(Test_CFE_FS_BackgroundFileDump);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileDumpConcurrent);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileDumpLarge);
 }
 
 /*
@@ -531,11 +533,11 @@ void Test_CFE_FS_BackgroundFileDump(void)
 
     /* Nominal with nothing pending - should accumulate credit */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(1, NULL));
-    UtAssert_INT32_GTEQ(CFE_FS_Global.FileDump.Current.Credit, 1);
-    UtAssert_INT32_LTEQ(CFE_FS_Global.FileDump.Current.Credit, CFE_FS_BACKGROUND_MAX_CREDIT);
+    UtAssert_INT32_GTEQ(CFE_FS_Global.FileDump.Credit, 1);
+    UtAssert_INT32_LTEQ(CFE_FS_Global.FileDump.Credit, CFE_FS_BACKGROUND_MAX_CREDIT);
 
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100000, NULL));
-    UtAssert_INT32_EQ(CFE_FS_Global.FileDump.Current.Credit, CFE_FS_BACKGROUND_MAX_CREDIT);
+    UtAssert_INT32_EQ(CFE_FS_Global.FileDump.Credit, CFE_FS_BACKGROUND_MAX_CREDIT);
 
     UtAssert_INT32_EQ(CFE_FS_BackgroundFileDumpRequest(NULL), CFE_FS_BAD_ARGUMENT);
 
@@ -576,8 +578,10 @@ void Test_CFE_FS_BackgroundFileDump(void)
     UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
     UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(1, NULL));
     UtAssert_STUB_COUNT(OS_OpenCreate, 1); /* confirm OS_open() was invoked */
-    UtAssert_INT32_LTEQ(CFE_FS_Global.FileDump.Current.Credit, 0);
+    UtAssert_INT32_LTEQ(CFE_FS_Global.FileDump.Credit, 0);
     UtAssert_STUB_COUNT(OS_close, 0); /* confirm OS_close() was not invoked */
+    /* records are written in batches, not one at a time */
+    UtAssert_UINT32_LT(UT_GetStubCount(UT_KEY(OS_write)), CFE_FS_Global.FileDump.Entries[0].Current.RecordNum);
 
     UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true); /* return EOF */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
@@ -595,7 +599,7 @@ void Test_CFE_FS_BackgroundFileDump(void)
     CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
     UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
 
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
     UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_CREATE_ERROR],
                        1); /* create error event was sent */
     UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
@@ -606,20 +610,22 @@ void Test_CFE_FS_BackgroundFileDump(void)
     CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
     UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
 
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
     UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR],
                        1); /* header error event was sent */
     UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
     /* No more pending requests */
     UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.CompleteCount, CFE_FS_Global.FileDump.RequestCount);
 
-    /* Error writing data */
+    /* Error writing data (when the staged records are written at EOF) */
     CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
     UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true);
     UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
-    /* record error event was sent */
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    /* record error event was sent, but not the complete event */
     UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
     UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
     /* No more pending requests */
     UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.CompleteCount, CFE_FS_Global.FileDump.RequestCount);
@@ -644,13 +650,143 @@ void Test_CFE_FS_BackgroundFileDump(void)
     /* Confirm null arg handling in CFE_FS_BackgroundFileDumpIsPending() */
     UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(NULL));
 
-    /* this catches the branch where Meta->IsPending is false */
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    /* this catches the branch where Meta->IsPending is false, all entries are finished at once */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.CompleteCount, CFE_FS_Global.FileDump.RequestCount);
 
     CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
     UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true); /* avoid infinite loop */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
 }
+
+void Test_CFE_FS_BackgroundFileDumpConcurrent(void)
+{
+    /*
+     * Test routine for:
+     * bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+     * with several requests pending and records which do not fit the staging buffer
+     */
+    CFE_FS_FileWriteMetaData_t        State[2];
+    CFE_FS_BackgroundFileDumpEntry_t *Entry[2];
+    uint32                            MyBuffer[2];
+    static uint8                      BigBuffer[CFE_FS_BACKGROUND_STAGING_SIZE + 1];
+    uint32                            i;
+
+    UT_InitData();
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(State, 0, sizeof(State));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+
+    for (i = 0; i < 2; ++i)
+    {
+        State[i].GetData = UT_FS_DataGetter;
+        State[i].OnEvent = UT_FS_OnEvent;
+        strncpy(State[i].FileName, "/ram/UT.bin", sizeof(State[i].FileName));
+        CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State[i]));
+        Entry[i] = &CFE_FS_Global.FileDump.Entries[i];
+    }
+
+    /* Both requests are started at once and get an equal share of the credit */
+    MyBuffer[0] = 10;
+    MyBuffer[1] = 20;
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(200, NULL));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_INT32_LTEQ(CFE_FS_Global.FileDump.Credit, 0);
+    UtAssert_UINT32_EQ(Entry[0]->Current.StagedSize, Entry[1]->Current.StagedSize);
+    UtAssert_NONZERO(Entry[0]->Current.StagedSize);
+
+    /*
+     * The second request finishes first, the queue head stays on the first one.
+     * The first request stages records until it has to write them out, then
+     * the second one gets the end of file.
+     */
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), (CFE_FS_BACKGROUND_STAGING_SIZE / sizeof(MyBuffer)) + 1, true);
+    CFE_FS_Global.FileDump.Credit = 0;
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_BOOL_TRUE(CFE_FS_BackgroundFileDumpIsPending(&State[0]));
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State[1]));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.CompleteCount, 0);
+    UtAssert_NULL(Entry[1]->Meta);
+
+    /* The first request finishes, and the head moves past both */
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State[0]));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.CompleteCount, 2);
+    UtAssert_STUB_COUNT(OS_close, 2);
+
+    /* Error when writing a full staging buffer */
+    CFE_FS_Global.FileDump.Credit = 0;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State[0]));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+
+    /* Records larger than the staging buffer are written directly */
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_ResetState(UT_KEY(OS_write));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), BigBuffer, sizeof(BigBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true);
+    CFE_FS_Global.FileDump.Credit = 0;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State[0]));
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_STUB_COUNT(OS_write, 3); /* header and two records */
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 3);
+
+    /* Error when writing a large record directly, which is also the last record */
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    CFE_FS_Global.FileDump.Credit = 0;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State[0]));
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 2);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 3);
+
+    /* The first request uses up all of the credit, so the second one does not start yet */
+    UT_ResetState(UT_KEY(OS_OpenCreate));
+    CFE_FS_Global.FileDump.Credit = 0;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State[0]));
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State[1]));
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(1, NULL));
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_BOOL_TRUE(CFE_FS_BackgroundFileDumpIsPending(&State[1]));
+}
+
+void Test_CFE_FS_BackgroundFileDumpLarge(void)
+{
+    /*
+     * Test routine for:
+     * bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+     * with a single request for a 30 kbyte file of 100 byte records
+     */
+    CFE_FS_FileWriteMetaData_t State;
+    uint8                      MyBuffer[100];
+
+    UT_InitData();
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&State, 0, sizeof(State));
+    memset(MyBuffer, 0, sizeof(MyBuffer));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+
+    State.GetData = UT_FS_DataGetter;
+    State.OnEvent = UT_FS_OnEvent;
+    strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 300, true);
+
+    /*
+     * Charged per byte, this would take three seconds worth of credit.  Charged
+     * per write, the header and 15 full staging buffers fit in the first second.
+     */
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(1000, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_STUB_COUNT(OS_write, 16);
+    UtAssert_INT32_EQ(CFE_FS_Global.FileDump.Credit,
+                      CFE_FS_BACKGROUND_MAX_CREDIT - (16 * CFE_FS_BACKGROUND_WRITE_CREDIT));
+}
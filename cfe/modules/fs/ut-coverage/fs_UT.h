@@ -312,4 +312,30 @@ void Test_CFE_FS_GetUncompressedFile(void);
 ******************************************************************************/
 void Test_CFE_FS_BackgroundFileDump(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests for FS background file dump with several requests pending
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileDumpConcurrent(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests for FS background file dump of a single large file
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileDumpLarge(void);
+
 #endif /* FS_UT_H */
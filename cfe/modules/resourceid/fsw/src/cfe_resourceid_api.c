@@ -143,3 +143,126 @@ CFE_ResourceId_t CFE_ResourceId_FindNext(CFE_ResourceId_t StartId, uint32 TableS
 
     return CheckId;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Computes the 32-bit FNV-1a hash of a name string
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ResourceId_NameHash(const char *Name)
+{
+    uint32 Hash;
+
+    Hash = 2166136261U;
+    while (*Name != 0)
+    {
+        Hash ^= (uint8)*Name;
+        Hash *= 16777619U;
+        ++Name;
+    }
+
+    return Hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ResourceId_NameIndexAdd(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 Slot,
+                                 const char *Name)
+{
+    CFE_ResourceId_NameIndexEntry_t *Entry;
+    CFE_ResourceId_NameIndexEntry_t *Bucket;
+
+    if (Index == NULL || Name == NULL || Slot >= TableSize)
+    {
+        return;
+    }
+
+    CFE_ResourceId_NameIndexRemove(Index, TableSize, Slot);
+
+    Entry       = &Index[Slot];
+    Entry->Hash = CFE_ResourceId_NameHash(Name);
+    Bucket      = &Index[Entry->Hash % TableSize];
+
+    Entry->NextSlot    = Bucket->BucketHead;
+    Entry->IsIndexed   = true;
+    Bucket->BucketHead = Slot + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ResourceId_NameIndexRemove(CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, uint32 Slot)
+{
+    uint32 *LinkPtr;
+
+    if (Index == NULL || Slot >= TableSize || !Index[Slot].IsIndexed)
+    {
+        return;
+    }
+
+    /*
+     * Unlink the slot from its bucket.  Its own NextSlot is left as is, so a
+     * lookup that is already positioned at this slot still reaches the rest
+     * of the bucket.
+     */
+    LinkPtr = &Index[Index[Slot].Hash % TableSize].BucketHead;
+    while (*LinkPtr != 0)
+    {
+        if (*LinkPtr == (Slot + 1))
+        {
+            *LinkPtr = Index[Slot].NextSlot;
+            break;
+        }
+
+        LinkPtr = &Index[*LinkPtr - 1].NextSlot;
+    }
+
+    Index[Slot].IsIndexed = false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ResourceId_NameIndexFind(const CFE_ResourceId_NameIndexEntry_t *Index, uint32 TableSize, const char *Name,
+                                   CFE_ResourceId_NameMatchFunc_t MatchFunc, uint32 *Slot)
+{
+    uint32 Hash;
+    uint32 Link;
+    uint32 Count;
+
+    if (Index == NULL || Name == NULL || MatchFunc == NULL || Slot == NULL || TableSize == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    Hash = CFE_ResourceId_NameHash(Name);
+    Link = Index[Hash % TableSize].BucketHead;
+
+    /* A bucket never holds more than every slot, this bounds the search even if the index is being updated */
+    Count = TableSize;
+    while (Link != 0 && Count > 0)
+    {
+        if (Index[Link - 1].Hash == Hash && MatchFunc(Link - 1, Name))
+        {
+            *Slot = Link - 1;
+            return CFE_SUCCESS;
+        }
+
+        Link = Index[Link - 1].NextSlot;
+        --Count;
+    }
+
+    return CFE_ES_ERR_NAME_NOT_FOUND;
+}
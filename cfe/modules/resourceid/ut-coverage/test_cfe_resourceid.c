@@ -34,6 +34,14 @@ static bool UT_ResourceId_CheckIdSlotUsed(CFE_ResourceId_t Id)
     return UT_DEFAULT_IMPL(UT_ResourceId_CheckIdSlotUsed) != 0;
 }
 
+/* Names of the entries in the table being indexed, an empty string marks a free entry */
+static char UT_ResourceId_Names[UT_RESOURCEID_TEST_SLOTS][16];
+
+static bool UT_ResourceId_NameMatch(uint32 Slot, const char *Name)
+{
+    return (UT_ResourceId_Names[Slot][0] != 0 && strcmp(UT_ResourceId_Names[Slot], Name) == 0);
+}
+
 void TestResourceID(void)
 {
     /*
@@ -176,7 +184,113 @@ void TestResourceID(void)
                   CFE_ResourceId_ToInteger(Id));
 }
 
+void TestNameIndex(void)
+{
+    /*
+     * Test cases for the name index, which is stubbed out in the
+     * tests of the modules that use it.
+     */
+    CFE_ResourceId_NameIndexEntry_t Index[UT_RESOURCEID_TEST_SLOTS];
+    uint32                          Slot;
+    uint32                          i;
+
+    memset(Index, 0, sizeof(Index));
+    memset(UT_ResourceId_Names, 0, sizeof(UT_ResourceId_Names));
+
+    /* Invalid inputs */
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(NULL, UT_RESOURCEID_TEST_SLOTS, "a", UT_ResourceId_NameMatch, &Slot),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, 0, "a", UT_ResourceId_NameMatch, &Slot), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, NULL, UT_ResourceId_NameMatch, &Slot),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, "a", NULL, &Slot),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, "a", UT_ResourceId_NameMatch, NULL),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_VOIDCALL(CFE_ResourceId_NameIndexAdd(NULL, UT_RESOURCEID_TEST_SLOTS, 0, "a"));
+    UtAssert_VOIDCALL(CFE_ResourceId_NameIndexAdd(Index, UT_RESOURCEID_TEST_SLOTS, 0, NULL));
+    UtAssert_VOIDCALL(CFE_ResourceId_NameIndexAdd(Index, UT_RESOURCEID_TEST_SLOTS, UT_RESOURCEID_TEST_SLOTS, "a"));
+    UtAssert_VOIDCALL(CFE_ResourceId_NameIndexRemove(NULL, UT_RESOURCEID_TEST_SLOTS, 0));
+    UtAssert_VOIDCALL(CFE_ResourceId_NameIndexRemove(Index, UT_RESOURCEID_TEST_SLOTS, UT_RESOURCEID_TEST_SLOTS));
+
+    /* Nothing is found in an empty (zeroed) index, and removing an unindexed slot has no effect */
+    UtAssert_VOIDCALL(CFE_ResourceId_NameIndexRemove(Index, UT_RESOURCEID_TEST_SLOTS, 1));
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, "a", UT_ResourceId_NameMatch, &Slot),
+                      CFE_ES_ERR_NAME_NOT_FOUND);
+
+    /*
+     * Index every slot.  With as many buckets as slots, some buckets hold
+     * several names, so lookups and removals also walk bucket chains.
+     * Note in these loops only _failures_ are asserted, to de-clutter the log.
+     */
+    for (i = 0; i < UT_RESOURCEID_TEST_SLOTS; ++i)
+    {
+        snprintf(UT_ResourceId_Names[i], sizeof(UT_ResourceId_Names[i]), "UT_NAME_%lu", (unsigned long)i);
+        CFE_ResourceId_NameIndexAdd(Index, UT_RESOURCEID_TEST_SLOTS, i, UT_ResourceId_Names[i]);
+    }
+
+    for (i = 0; i < UT_RESOURCEID_TEST_SLOTS; ++i)
+    {
+        if (CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, UT_ResourceId_Names[i],
+                                         UT_ResourceId_NameMatch, &Slot) != CFE_SUCCESS ||
+            Slot != i)
+        {
+            UtAssert_Failed("Name index lookup of %s failed", UT_ResourceId_Names[i]);
+        }
+    }
+
+    /* Remove every other slot, in reverse so removals happen at all positions in the chains */
+    i = UT_RESOURCEID_TEST_SLOTS;
+    while (i > 0)
+    {
+        --i;
+        if ((i & 1) == 0)
+        {
+            CFE_ResourceId_NameIndexRemove(Index, UT_RESOURCEID_TEST_SLOTS, i);
+        }
+    }
+
+    for (i = 0; i < UT_RESOURCEID_TEST_SLOTS; ++i)
+    {
+        if (CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, UT_ResourceId_Names[i],
+                                         UT_ResourceId_NameMatch, &Slot) != (((i & 1) == 0) ? CFE_ES_ERR_NAME_NOT_FOUND
+                                                                                            : CFE_SUCCESS))
+        {
+            UtAssert_Failed("Name index lookup of %s after removal failed", UT_ResourceId_Names[i]);
+        }
+    }
+
+    /* Renaming a slot makes the old name unfindable */
+    CFE_ResourceId_NameIndexAdd(Index, UT_RESOURCEID_TEST_SLOTS, 1, "UT_RENAMED");
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, "UT_NAME_1",
+                                                   UT_ResourceId_NameMatch, &Slot),
+                      CFE_ES_ERR_NAME_NOT_FOUND);
+    strcpy(UT_ResourceId_Names[1], "UT_RENAMED");
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, "UT_RENAMED",
+                                                   UT_ResourceId_NameMatch, &Slot),
+                      CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Slot, 1);
+
+    /* The match function has the final say, e.g. for an entry freed without updating the index */
+    UT_ResourceId_Names[3][0] = 0;
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, "UT_NAME_3",
+                                                   UT_ResourceId_NameMatch, &Slot),
+                      CFE_ES_ERR_NAME_NOT_FOUND);
+
+    /* A damaged (cyclic) bucket chain does not make the search run forever */
+    memset(Index, 0, sizeof(Index));
+    for (i = 0; i < UT_RESOURCEID_TEST_SLOTS; ++i)
+    {
+        Index[i].BucketHead = 1;
+        Index[i].NextSlot   = 1;
+    }
+    UtAssert_INT32_EQ(CFE_ResourceId_NameIndexFind(Index, UT_RESOURCEID_TEST_SLOTS, "UT_NAME_5",
+                                                   UT_ResourceId_NameMatch, &Slot),
+                      CFE_ES_ERR_NAME_NOT_FOUND);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(TestResourceID, NULL, NULL, "Resource ID");
+    UtTest_Add(TestNameIndex, NULL, NULL, "Name Index");
 }
@@ -0,0 +1,516 @@
+/**
+ * @file
+ *
+ * Compares the SB transmit path used before the lock-free rework, where each
+ * transmit took the SB lock three times (buffer allocation, routing and
+ * accounting, undo and buffer release), with the current one, where the
+ * routing and accounting use the atomic operations of osapi-atomic.h and a
+ * transmit only takes the lock to allocate its buffer:
+ *
+ * - 1 to 8 publisher threads each send messages to one route with several
+ *   subscribed pipes, each pipe drained by its own receiver thread;
+ * - a route change thread adds and removes a subscriber every few ms, which
+ *   in the current path publishes a new destination list and waits for the
+ *   active transmits, as CFE_SB_RemoveDestNode() does.
+ *
+ * Only the SB locking and accounting are modeled, with pthread mutexes in
+ * place of the SB shared data lock and the OS queues, and a free list in
+ * place of the SB buffer pool.  The result is the total publisher rate, plus
+ * the messages that found a pipe full (the same in both paths, so only the
+ * rate should differ).  Build with the CFE_SB_BENCH cmake option, or by hand:
+ *
+ *   cc -O2 -pthread -I<osal>/src/os/inc -I<dir with osconfig.h> \
+ *      cfe_sb_bench.c -o cfe_sb_bench
+ *
+ * and run as "cfe_sb_bench [messages per publisher]".
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "osapi-atomic.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define BENCH_NUM_PIPES   4
+#define BENCH_MAX_DESTS   (BENCH_NUM_PIPES + 1)
+#define BENCH_PIPE_DEPTH  64
+#define BENCH_MSG_LIM     64
+#define BENCH_NUM_BUFS    1024
+#define BENCH_MSG_SIZE    128
+#define BENCH_MAX_PUBS    8
+#define BENCH_ROUTE_DELAY 5000 /* us between route changes */
+
+typedef struct
+{
+    uint32 UseCount;
+    uint32 Next;
+    uint8  Content[BENCH_MSG_SIZE];
+} Bench_Buf_t;
+
+typedef struct
+{
+    pthread_mutex_t Lock;
+    pthread_cond_t  NotEmpty;
+    Bench_Buf_t *   Slots[BENCH_PIPE_DEPTH];
+    uint32          Head;
+    uint32          Count;
+    bool            Stop;
+    uint32          CurrentQueueDepth;
+    uint32          PeakQueueDepth;
+} Bench_Pipe_t;
+
+typedef struct
+{
+    uint32        BuffCount;
+    uint32        MsgLim;
+    Bench_Pipe_t *Pipe;
+} Bench_Dest_t;
+
+typedef struct
+{
+    uint32       NumDests;
+    Bench_Dest_t Dests[BENCH_MAX_DESTS];
+} Bench_DestList_t;
+
+static struct
+{
+    bool              LockFree;
+    pthread_mutex_t   SbLock;
+    Bench_Buf_t       Bufs[BENCH_NUM_BUFS];
+    uint32            FreeHead;
+    Bench_Pipe_t      Pipes[BENCH_MAX_DESTS];
+    Bench_DestList_t *DestList;
+    uint32            SeqCnt;
+    uint32            Epoch;
+    uint32            Active[2];
+    uint32            PipeFull;
+    uint32            Stop;
+    long              MsgsPerPub;
+} Bench;
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+/* the buffer pool has no lock of its own, both paths allocate under the SB lock */
+static Bench_Buf_t *PoolGet(void)
+{
+    Bench_Buf_t *Buf;
+
+    pthread_mutex_lock(&Bench.SbLock);
+    Buf = NULL;
+    if (Bench.FreeHead < BENCH_NUM_BUFS)
+    {
+        Buf            = &Bench.Bufs[Bench.FreeHead];
+        Bench.FreeHead = Buf->Next;
+    }
+    pthread_mutex_unlock(&Bench.SbLock);
+
+    return Buf;
+}
+
+/* call with the SB lock held */
+static void DecrUseCount(Bench_Buf_t *Buf)
+{
+    if (OS_AtomicSub32(&Buf->UseCount, 1) == 0)
+    {
+        Buf->Next      = Bench.FreeHead;
+        Bench.FreeHead = Buf - Bench.Bufs;
+    }
+}
+
+static uint32 IncrementBelow(uint32 *Counter, uint32 Limit)
+{
+    uint32 Value = OS_AtomicLoad32(Counter);
+
+    while (Value < Limit && !OS_AtomicCompareAndSwap32(Counter, &Value, Value + 1))
+    {
+    }
+
+    return Value;
+}
+
+static uint32 DecrementAbove(uint32 *Counter, uint32 Limit)
+{
+    uint32 Value = OS_AtomicLoad32(Counter);
+
+    while (Value > Limit && !OS_AtomicCompareAndSwap32(Counter, &Value, Value - 1))
+    {
+    }
+
+    return Value;
+}
+
+static void Raise(uint32 *Counter, uint32 Value)
+{
+    uint32 Current = OS_AtomicLoad32(Counter);
+
+    while (Current < Value && !OS_AtomicCompareAndSwap32(Counter, &Current, Value))
+    {
+    }
+}
+
+/* OS_QueuePut() with OS_CHECK, as a transmit never blocks on a full pipe */
+static bool QueuePut(Bench_Pipe_t *Pipe, Bench_Buf_t *Buf)
+{
+    bool Ok;
+
+    pthread_mutex_lock(&Pipe->Lock);
+    Ok = (Pipe->Count < BENCH_PIPE_DEPTH);
+    if (Ok)
+    {
+        Pipe->Slots[(Pipe->Head + Pipe->Count) % BENCH_PIPE_DEPTH] = Buf;
+        ++Pipe->Count;
+        pthread_cond_signal(&Pipe->NotEmpty);
+    }
+    pthread_mutex_unlock(&Pipe->Lock);
+
+    return Ok;
+}
+
+static Bench_Buf_t *QueueGet(Bench_Pipe_t *Pipe)
+{
+    Bench_Buf_t *Buf = NULL;
+
+    pthread_mutex_lock(&Pipe->Lock);
+    while (Pipe->Count == 0 && !Pipe->Stop)
+    {
+        pthread_cond_wait(&Pipe->NotEmpty, &Pipe->Lock);
+    }
+    if (Pipe->Count != 0)
+    {
+        Buf        = Pipe->Slots[Pipe->Head];
+        Pipe->Head = (Pipe->Head + 1) % BENCH_PIPE_DEPTH;
+        --Pipe->Count;
+    }
+    pthread_mutex_unlock(&Pipe->Lock);
+
+    return Buf;
+}
+
+/* the previous path: routing, accounting and release all under the SB lock */
+static void TransmitLocked(Bench_Buf_t *Buf)
+{
+    Bench_Dest_t *    Sent[BENCH_MAX_DESTS];
+    bool              Full[BENCH_MAX_DESTS];
+    Bench_DestList_t *DestList;
+    Bench_Dest_t *    DestPtr;
+    uint32            NumSent;
+    uint32            i;
+
+    NumSent = 0;
+
+    pthread_mutex_lock(&Bench.SbLock);
+    Buf->Content[0] = (uint8)(++Bench.SeqCnt);
+    DestList        = Bench.DestList;
+    for (i = 0; i < DestList->NumDests; i++)
+    {
+        DestPtr = &DestList->Dests[i];
+        if (DestPtr->BuffCount < DestPtr->MsgLim)
+        {
+            ++DestPtr->BuffCount;
+            ++Buf->UseCount;
+            if (++DestPtr->Pipe->CurrentQueueDepth > DestPtr->Pipe->PeakQueueDepth)
+            {
+                DestPtr->Pipe->PeakQueueDepth = DestPtr->Pipe->CurrentQueueDepth;
+            }
+            Sent[NumSent++] = DestPtr;
+        }
+    }
+    pthread_mutex_unlock(&Bench.SbLock);
+
+    for (i = 0; i < NumSent; i++)
+    {
+        Full[i] = !QueuePut(Sent[i]->Pipe, Buf);
+    }
+
+    pthread_mutex_lock(&Bench.SbLock);
+    for (i = 0; i < NumSent; i++)
+    {
+        if (Full[i])
+        {
+            ++Bench.PipeFull;
+            --Sent[i]->BuffCount;
+            --Sent[i]->Pipe->CurrentQueueDepth;
+            --Buf->UseCount;
+        }
+    }
+    DecrUseCount(Buf);
+    pthread_mutex_unlock(&Bench.SbLock);
+}
+
+/* the current path, as CFE_SB_TransmitTxn_Execute() */
+static void TransmitLockFree(Bench_Buf_t *Buf)
+{
+    Bench_Dest_t *    Sent[BENCH_MAX_DESTS];
+    Bench_DestList_t *DestList;
+    Bench_Dest_t *    DestPtr;
+    uint32            NumSent;
+    uint32            NumDests;
+    uint32            Epoch;
+    uint32            i;
+
+    NumSent = 0;
+
+    /* CFE_SB_TransmitEnter(), no routing change holds off transmits here */
+    Epoch = OS_AtomicLoad32(&Bench.Epoch);
+    OS_AtomicAdd32(&Bench.Active[Epoch & 1], 1);
+    while (OS_AtomicLoad32(&Bench.Epoch) != Epoch)
+    {
+        OS_AtomicSub32(&Bench.Active[Epoch & 1], 1);
+        Epoch = OS_AtomicLoad32(&Bench.Epoch);
+        OS_AtomicAdd32(&Bench.Active[Epoch & 1], 1);
+    }
+
+    Buf->Content[0] = (uint8)OS_AtomicAdd32(&Bench.SeqCnt, 1);
+    DestList        = OS_AtomicLoadPtr((void *const volatile *)&Bench.DestList);
+    NumDests        = OS_AtomicLoad32(&DestList->NumDests);
+    for (i = 0; i < NumDests; i++)
+    {
+        DestPtr = &DestList->Dests[i];
+        if (IncrementBelow(&DestPtr->BuffCount, DestPtr->MsgLim) < DestPtr->MsgLim)
+        {
+            OS_AtomicAdd32(&Buf->UseCount, 1);
+            Raise(&DestPtr->Pipe->PeakQueueDepth, OS_AtomicAdd32(&DestPtr->Pipe->CurrentQueueDepth, 1));
+            Sent[NumSent++] = DestPtr;
+        }
+    }
+
+    for (i = 0; i < NumSent; i++)
+    {
+        if (!QueuePut(Sent[i]->Pipe, Buf))
+        {
+            OS_AtomicAdd32(&Bench.PipeFull, 1);
+            DecrementAbove(&Sent[i]->BuffCount, 0);
+            DecrementAbove(&Sent[i]->Pipe->CurrentQueueDepth, 0);
+            DecrementAbove(&Buf->UseCount, 1);
+        }
+    }
+
+    OS_AtomicSub32(&Bench.Active[Epoch & 1], 1);
+
+    /* CFE_SB_ReleaseBufferRef(), only the last reference takes the lock */
+    if (DecrementAbove(&Buf->UseCount, 1) <= 1)
+    {
+        pthread_mutex_lock(&Bench.SbLock);
+        DecrUseCount(Buf);
+        pthread_mutex_unlock(&Bench.SbLock);
+    }
+}
+
+static void *Publisher(void *Arg)
+{
+    Bench_Buf_t *Buf;
+    long         i;
+
+    (void)Arg;
+
+    for (i = 0; i < Bench.MsgsPerPub; i++)
+    {
+        while ((Buf = PoolGet()) == NULL)
+        {
+            sched_yield();
+        }
+
+        Buf->UseCount = 1;
+        memset(Buf->Content, (int)i, sizeof(Buf->Content));
+
+        if (Bench.LockFree)
+        {
+            TransmitLockFree(Buf);
+        }
+        else
+        {
+            TransmitLocked(Buf);
+        }
+    }
+
+    return NULL;
+}
+
+/* the receive path takes the SB lock in both, as CFE_SB_ReceiveTxn_Execute() */
+static void *Receiver(void *Arg)
+{
+    Bench_Pipe_t *Pipe = Arg;
+    Bench_Buf_t * Buf;
+    uint32        i;
+
+    while ((Buf = QueueGet(Pipe)) != NULL)
+    {
+        pthread_mutex_lock(&Bench.SbLock);
+        for (i = 0; i < Bench.DestList->NumDests; i++)
+        {
+            if (Bench.DestList->Dests[i].Pipe == Pipe)
+            {
+                DecrementAbove(&Bench.DestList->Dests[i].BuffCount, 0);
+            }
+        }
+        DecrementAbove(&Pipe->CurrentQueueDepth, 0);
+        DecrUseCount(Buf);
+        pthread_mutex_unlock(&Bench.SbLock);
+    }
+
+    return NULL;
+}
+
+/* CFE_SB_WaitForTransmits() */
+static void WaitForTransmits(void)
+{
+    uint32 Epoch = OS_AtomicAdd32(&Bench.Epoch, 1) - 1;
+
+    while (OS_AtomicLoad32(&Bench.Active[Epoch & 1]) != 0)
+    {
+        usleep(1000);
+    }
+}
+
+/* alternately subscribes and unsubscribes the last pipe */
+static void *RouteChanger(void *Arg)
+{
+    Bench_DestList_t *OldList;
+    Bench_DestList_t *NewList;
+    uint32            Copied[BENCH_MAX_DESTS];
+    uint32            i;
+
+    (void)Arg;
+
+    while (!OS_AtomicLoad32(&Bench.Stop))
+    {
+        usleep(BENCH_ROUTE_DELAY);
+
+        pthread_mutex_lock(&Bench.SbLock);
+        OldList = Bench.DestList;
+        if (OldList->NumDests < BENCH_MAX_DESTS)
+        {
+            /* append in place, then publish the new count */
+            OldList->Dests[OldList->NumDests].BuffCount = 0;
+            OldList->Dests[OldList->NumDests].MsgLim    = BENCH_MSG_LIM;
+            OldList->Dests[OldList->NumDests].Pipe      = &Bench.Pipes[BENCH_NUM_PIPES];
+            OS_AtomicStore32(&OldList->NumDests, OldList->NumDests + 1);
+        }
+        else if (!Bench.LockFree)
+        {
+            --OldList->NumDests;
+        }
+        else
+        {
+            /* publish a copy without the last entry, then reconcile counts after the grace period */
+            NewList = malloc(sizeof(*NewList));
+            memcpy(NewList, OldList, sizeof(*NewList));
+            NewList->NumDests = OldList->NumDests - 1;
+            for (i = 0; i < NewList->NumDests; i++)
+            {
+                Copied[i] = NewList->Dests[i].BuffCount;
+            }
+            OS_AtomicStorePtr((void *volatile *)&Bench.DestList, NewList);
+            WaitForTransmits();
+            for (i = 0; i < NewList->NumDests; i++)
+            {
+                OS_AtomicAdd32(&NewList->Dests[i].BuffCount, OldList->Dests[i].BuffCount - Copied[i]);
+            }
+            free(OldList);
+        }
+        pthread_mutex_unlock(&Bench.SbLock);
+    }
+
+    return NULL;
+}
+
+static double RunBench(bool LockFree, uint32 NumPubs, uint32 *PipeFullPtr)
+{
+    pthread_t Pubs[BENCH_MAX_PUBS];
+    pthread_t Rcvs[BENCH_MAX_DESTS];
+    pthread_t Changer;
+    double    Start;
+    double    Elapsed;
+    uint32    i;
+
+    memset(&Bench.Pipes, 0, sizeof(Bench.Pipes));
+    Bench.LockFree = LockFree;
+    Bench.SeqCnt   = 0;
+    Bench.PipeFull = 0;
+    Bench.Stop     = 0;
+    Bench.FreeHead = 0;
+    for (i = 0; i < BENCH_NUM_BUFS; i++)
+    {
+        Bench.Bufs[i].Next = i + 1;
+    }
+
+    Bench.DestList = calloc(1, sizeof(*Bench.DestList));
+    for (i = 0; i < BENCH_MAX_DESTS; i++)
+    {
+        pthread_mutex_init(&Bench.Pipes[i].Lock, NULL);
+        pthread_cond_init(&Bench.Pipes[i].NotEmpty, NULL);
+        pthread_create(&Rcvs[i], NULL, Receiver, &Bench.Pipes[i]);
+    }
+    for (i = 0; i < BENCH_NUM_PIPES; i++)
+    {
+        Bench.DestList->Dests[i].MsgLim = BENCH_MSG_LIM;
+        Bench.DestList->Dests[i].Pipe   = &Bench.Pipes[i];
+    }
+    Bench.DestList->NumDests = BENCH_NUM_PIPES;
+
+    pthread_create(&Changer, NULL, RouteChanger, NULL);
+
+    Start = Now();
+    for (i = 0; i < NumPubs; i++)
+    {
+        pthread_create(&Pubs[i], NULL, Publisher, NULL);
+    }
+    for (i = 0; i < NumPubs; i++)
+    {
+        pthread_join(Pubs[i], NULL);
+    }
+    Elapsed = Now() - Start;
+
+    OS_AtomicStore32(&Bench.Stop, 1);
+    pthread_join(Changer, NULL);
+
+    for (i = 0; i < BENCH_MAX_DESTS; i++)
+    {
+        pthread_mutex_lock(&Bench.Pipes[i].Lock);
+        Bench.Pipes[i].Stop = true;
+        pthread_cond_signal(&Bench.Pipes[i].NotEmpty);
+        pthread_mutex_unlock(&Bench.Pipes[i].Lock);
+        pthread_join(Rcvs[i], NULL);
+        pthread_mutex_destroy(&Bench.Pipes[i].Lock);
+        pthread_cond_destroy(&Bench.Pipes[i].NotEmpty);
+    }
+
+    free(Bench.DestList);
+
+    *PipeFullPtr = Bench.PipeFull;
+    return (NumPubs * Bench.MsgsPerPub) / Elapsed;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32 NumPubs;
+    uint32 LockedFull, LockFreeFull;
+    double LockedRate, LockFreeRate;
+
+    Bench.MsgsPerPub = argc > 1 ? atol(argv[1]) : 200000;
+    pthread_mutex_init(&Bench.SbLock, NULL);
+
+    printf("%4s %16s %16s %12s %12s\n", "pubs", "locked (msg/s)", "current (msg/s)", "locked full", "current full");
+
+    for (NumPubs = 1; NumPubs <= BENCH_MAX_PUBS; NumPubs *= 2)
+    {
+        LockedRate   = RunBench(false, NumPubs, &LockedFull);
+        LockFreeRate = RunBench(true, NumPubs, &LockFreeFull);
+
+        printf("%4u %16.0f %16.0f %12u %12u\n", (unsigned int)NumPubs, LockedRate, LockFreeRate,
+               (unsigned int)LockedFull, (unsigned int)LockFreeFull);
+    }
+
+    return 0;
+}
@@ -85,6 +85,22 @@
 */
 #define CFE_PLATFORM_SB_MAX_DEST_PER_PKT 16
 
+/**
+**  \cfesbcfg Maximum Number of messages returned by a single batched receive
+**
+**  \par Description:
+**       Dictates the maximum number of buffers that a single call to
+**       #CFE_SB_ReceiveBufferBatch can return.  Each pipe holds a reference to
+**       every buffer in its most recent batch until the next receive on that pipe.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.
+**       This constant has a direct effect on the size of the SB pipe table, as
+**       each pipe descriptor contains this many buffer references.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_RECEIVE_BATCH 16
+
 /**
 **  \cfesbcfg Default Subscription Message Limit
 **
@@ -108,8 +124,8 @@
 **       sends, the SB dynamically allocates from this memory pool, the memory needed
 **       to process the message. The memory needed to process each message is msg
 **       size + msg descriptor(CFE_SB_BufferD_t). This memory pool is also used
-**       to allocate destination descriptors (CFE_SB_DestinationD_t) during the
-**       subscription process.
+**       to allocate the per-route destination lists (CFE_SB_DestinationList_t)
+**       during the subscription process.
 **       To see the run-time, high-water mark and the current utilization figures
 **       regarding this parameter, send an SB command to 'Send Statistics Pkt'.
 **       Some memory statistics have been added to the SB housekeeping packet.
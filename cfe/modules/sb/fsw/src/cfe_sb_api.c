@@ -190,8 +190,11 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
         PipeDscPtr->SysQueueId    = SysQueueId;
         PipeDscPtr->MaxQueueDepth = Depth;
         PipeDscPtr->AppId         = AppId;
+        strncpy(PipeDscPtr->PipeName, PipeName, sizeof(PipeDscPtr->PipeName) - 1);
 
         CFE_SB_PipeDescSetUsed(PipeDscPtr, PendingPipeId);
+        CFE_ResourceId_NameIndexAdd(CFE_SB_Global.PipeNameIndex, CFE_PLATFORM_SB_MAX_PIPES,
+                                    PipeDscPtr - CFE_SB_Global.PipeTbl, PipeDscPtr->PipeName);
 
         /* Increment the Pipes in use ctr and if it's > the high water mark,*/
         /* adjust the high water mark */
@@ -379,7 +382,10 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
          * However we must first save certain state data for later deletion.
          */
         SysQueueId = PipeDscPtr->SysQueueId;
-        BufDscPtr  = PipeDscPtr->LastBuffer;
+        BufDscPtr  = NULL;
+
+        /* Release any buffer(s) still held from the last receive on this pipe */
+        CFE_SB_ReleasePipeBuffers(PipeDscPtr);
 
         /*
          * Mark entry as "reserved" so other resources can be deleted
@@ -388,6 +394,8 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
          * any task from re-subscribing to this pipe.
          */
         CFE_SB_PipeDescSetUsed(PipeDscPtr, CFE_RESOURCEID_RESERVED);
+        CFE_ResourceId_NameIndexRemove(CFE_SB_Global.PipeNameIndex, CFE_PLATFORM_SB_MAX_PIPES,
+                                       PipeDscPtr - CFE_SB_Global.PipeTbl);
     }
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -769,17 +777,13 @@ CFE_Status_t CFE_SB_GetPipeName(char *PipeNameBuf, size_t PipeNameSize, CFE_SB_P
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName)
 {
-    int32           OsStatus;
     int32           Status;
     CFE_ES_TaskId_t TskId;
     uint32          Idx;
     char            FullName[(OS_MAX_API_NAME * 2)];
     uint16          PendingEventID;
-    CFE_SB_PipeD_t *PipeDscPtr;
-    osal_id_t       SysQueueId;
 
     PendingEventID = 0;
-    SysQueueId     = OS_OBJECT_ID_UNDEFINED;
 
     if (PipeName == NULL || PipeIdPtr == NULL)
     {
@@ -788,43 +792,24 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
     }
     else
     {
-        /* Get QueueID from OSAL */
-        OsStatus = OS_QueueGetIdByName(&SysQueueId, PipeName);
-        if (OsStatus == OS_SUCCESS)
-        {
-            Status = CFE_SUCCESS;
-        }
-        else
-        {
-            PendingEventID = CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID;
-            Status         = CFE_SB_BAD_ARGUMENT;
-        }
+        Status = CFE_SUCCESS;
     }
 
     CFE_SB_LockSharedData(__func__, __LINE__);
 
     if (Status == CFE_SUCCESS)
     {
-        Idx        = CFE_PLATFORM_SB_MAX_PIPES;
-        PipeDscPtr = CFE_SB_Global.PipeTbl;
-        while (true)
+        /* Pipe names are the same as their OSAL queue names, so are unique */
+        if (CFE_ResourceId_NameIndexFind(CFE_SB_Global.PipeNameIndex, CFE_PLATFORM_SB_MAX_PIPES, PipeName,
+                                         CFE_SB_CheckPipeNameSlotMatch, &Idx) == CFE_SUCCESS)
         {
-            if (Idx == 0)
-            {
-                PendingEventID = CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID;
-                Status         = CFE_SB_BAD_ARGUMENT;
-                break;
-            }
-
-            if (OS_ObjectIdEqual(PipeDscPtr->SysQueueId, SysQueueId))
-            {
-                /* grab the ID before we release the lock */
-                *PipeIdPtr = CFE_SB_PipeDescGetID(PipeDscPtr);
-                break;
-            }
-
-            --Idx;
-            ++PipeDscPtr;
+            /* grab the ID before we release the lock */
+            *PipeIdPtr = CFE_SB_PipeDescGetID(&CFE_SB_Global.PipeTbl[Idx]);
+        }
+        else
+        {
+            PendingEventID = CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
         }
     }
 
@@ -916,21 +901,21 @@ CFE_Status_t CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
 int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_Qos_t Quality, uint16 MsgLim,
                            uint8 Scope)
 {
-    CFE_SBR_RouteId_t      RouteId;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    int32                  Status;
-    CFE_ES_TaskId_t        TskId;
-    CFE_ES_AppId_t         AppId;
-    CFE_SB_DestinationD_t *DestPtr;
-    uint32                 DestCount;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
-    uint32                 Collisions;
-    uint16                 PendingEventID;
+    CFE_SBR_RouteId_t         RouteId;
+    CFE_SB_PipeD_t *          PipeDscPtr;
+    int32                     Status;
+    CFE_ES_TaskId_t           TskId;
+    CFE_ES_AppId_t            AppId;
+    CFE_SB_DestinationList_t *DestList;
+    CFE_SB_DestinationD_t     NewDest;
+    uint32                    DestCount;
+    char                      FullName[(OS_MAX_API_NAME * 2)];
+    char                      PipeName[OS_MAX_API_NAME];
+    uint32                    Collisions;
+    uint16                    PendingEventID;
 
     PendingEventID = 0;
     Status         = CFE_SUCCESS;
-    DestPtr        = NULL;
     Collisions     = 0;
 
     /* get the callers Application Id */
@@ -967,8 +952,14 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
 
         if (!CFE_SBR_IsValidRouteId(RouteId))
         {
-            /* Add the route */
+            /*
+             * Add the route.  This may reclaim an idle route and move entries of the
+             * message ID map, which transmits look up without the SB lock, so they
+             * are held off until it is done.
+             */
+            CFE_SB_HoldTransmits();
             RouteId = CFE_SBR_AddRoute(MsgId, &Collisions);
+            CFE_SB_ReleaseTransmits();
 
             /* if all routing table elements are used, send event */
             if (!CFE_SBR_IsValidRouteId(RouteId))
@@ -976,66 +967,63 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
                 PendingEventID = CFE_SB_MAX_MSGS_MET_EID;
                 Status         = CFE_SB_MAX_MSGS_MET;
             }
-            else
-            {
-                /* Increment the MsgIds in use ctr and if it's > the high water mark,*/
-                /* adjust the high water mark */
-                CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse++;
-                if (CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse)
-                {
-                    CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse = CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse;
-                }
-            }
         }
     }
 
     /* If successful up to this point, check if new dest should be added to this route */
     if (Status == CFE_SUCCESS)
     {
+        DestList  = CFE_SBR_GetDestListHeadPtr(RouteId);
         DestCount = 0;
-        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
+        if (DestList != NULL)
         {
-            ++DestCount;
-
-            /* Check if duplicate (status stays as CFE_SUCCESS) */
-            if (CFE_RESOURCEID_TEST_EQUAL(DestPtr->PipeId, PipeId))
-            {
-                PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
-                break;
-            }
-
-            /* Check if limit reached */
-            if (DestCount >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
-            {
-                PendingEventID = CFE_SB_MAX_DESTS_MET_EID;
-                Status         = CFE_SB_MAX_DESTS_MET;
-                break;
-            }
+            DestCount = DestList->NumDests;
         }
 
+        /* Check if duplicate (status stays as CFE_SUCCESS) */
+        if (CFE_SB_GetDestPtr(RouteId, PipeId) != NULL)
+        {
+            PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
+        }
+        /* Check if limit reached */
+        else if (DestCount >= CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+        {
+            PendingEventID = CFE_SB_MAX_DESTS_MET_EID;
+            Status         = CFE_SB_MAX_DESTS_MET;
+        }
         /* If no existing dest found, add one now */
-        if (DestPtr == NULL)
+        else
         {
-            DestPtr = CFE_SB_GetDestinationBlk();
-            if (DestPtr == NULL)
+            /* initialize destination */
+            memset(&NewDest, 0, sizeof(NewDest));
+            NewDest.PipeId        = PipeId;
+            NewDest.MsgId2PipeLim = MsgLim;
+            NewDest.Active        = CFE_SB_ACTIVE;
+            NewDest.BuffCount     = 0;
+            NewDest.DestCnt       = 0;
+            NewDest.Scope         = Scope;
+            NewDest.PipeDscPtr    = PipeDscPtr;
+
+            /* add destination node */
+            Status = CFE_SB_AddDestNode(RouteId, &NewDest);
+            if (Status != CFE_SUCCESS)
             {
                 PendingEventID = CFE_SB_DEST_BLK_ERR_EID;
-                Status         = CFE_SB_BUF_ALOC_ERR;
             }
             else
             {
-                /* initialize destination block */
-                DestPtr->PipeId        = PipeId;
-                DestPtr->MsgId2PipeLim = MsgLim;
-                DestPtr->Active        = CFE_SB_ACTIVE;
-                DestPtr->BuffCount     = 0;
-                DestPtr->DestCnt       = 0;
-                DestPtr->Scope         = Scope;
-                DestPtr->Prev          = NULL;
-                DestPtr->Next          = NULL;
-
-                /* add destination node */
-                CFE_SB_AddDestNode(RouteId, DestPtr);
+                /* Increment the MsgIds in use ctr on the first destination and if it's > the high water mark,*/
+                /* adjust the high water mark */
+                if (DestCount == 0)
+                {
+                    CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse++;
+                    if (CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse >
+                        CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse)
+                    {
+                        CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse =
+                            CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse;
+                    }
+                }
 
                 CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse++;
                 if (CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse >
@@ -1375,6 +1363,55 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return CFE_SB_MessageTxn_GetStatus(Txn);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                       CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    CFE_SB_ReceiveTxn_State_t  TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    uint32                     Count;
+
+    Count = 0;
+    Txn   = CFE_SB_ReceiveTxn_Init(&TxnBuf, BufPtrArray);
+
+    if (CFE_SB_MessageTxn_IsOK(Txn) && (CountPtr == NULL || MaxCount == 0))
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_ReceiveTxn_SetPipeId(Txn, PipeId);
+
+        /* Verify by default, same as CFE_SB_ReceiveBuffer() */
+        CFE_SB_MessageTxn_SetEndpoint(Txn, true);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        Count = CFE_SB_ReceiveTxn_ExecuteBatch(Txn, BufPtrArray, MaxCount);
+    }
+
+    if (CountPtr != NULL)
+    {
+        *CountPtr = Count;
+    }
+
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    return CFE_SB_MessageTxn_GetStatus(Txn);
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1516,10 +1553,11 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 {
     CFE_SB_TransmitTxn_State_t TxnBuf;
     CFE_SB_MessageTxn_State_t *Txn;
-    CFE_SB_Buffer_t *          BufPtr;
+    CFE_SB_BufferD_t *         BufDscPtr;
+    CFE_ES_AppId_t             AppId;
 
-    BufPtr = NULL;
-    Txn    = CFE_SB_TransmitTxn_Init(&TxnBuf, MsgPtr);
+    BufDscPtr = NULL;
+    Txn       = CFE_SB_TransmitTxn_Init(&TxnBuf, MsgPtr);
 
     /* In this context, the user should have set the the size and MsgId in the content */
     if (CFE_SB_MessageTxn_IsOK(Txn))
@@ -1530,12 +1568,27 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
     if (CFE_SB_MessageTxn_IsOK(Txn))
     {
         /* Get buffer - note this pre-initializes the returned buffer with
-         * a use count of 1, which refers to this task as it fills the buffer. */
-        BufPtr = CFE_SB_AllocateMessageBuffer(CFE_SB_MessageTxn_GetContentSize(Txn));
-        if (BufPtr == NULL)
+         * a use count of 1, which refers to this task as it fills the buffer.
+         *
+         * Unlike CFE_SB_AllocateMessageBuffer(), the app never gets this buffer,
+         * so it is not tracked in the ZeroCopyList, and the transmit does not
+         * need to take the SB lock again to remove it from there. */
+        if (CFE_ES_GetAppID(&AppId) == CFE_SUCCESS)
+        {
+            CFE_SB_LockSharedData(__func__, __LINE__);
+            BufDscPtr = CFE_SB_GetBufferFromPool(CFE_SB_MessageTxn_GetContentSize(Txn));
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+        }
+
+        if (BufDscPtr == NULL)
         {
             CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_GET_BUF_ERR_EID, CFE_SB_BUF_ALOC_ERR);
         }
+        else
+        {
+            /* Owned by the sending app until it is transmitted */
+            BufDscPtr->AppId = AppId;
+        }
     }
 
     /*
@@ -1553,18 +1606,18 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
     if (CFE_SB_MessageTxn_IsOK(Txn))
     {
         /* Copy actual message content into buffer */
-        memcpy(&BufPtr->Msg, MsgPtr, CFE_SB_MessageTxn_GetContentSize(Txn));
+        memcpy(&BufDscPtr->Content.Msg, MsgPtr, CFE_SB_MessageTxn_GetContentSize(Txn));
 
         /* Save passed-in parameters */
         CFE_SB_MessageTxn_SetEndpoint(Txn, IsOrigination);
 
-        CFE_SB_TransmitTxn_Execute(Txn, BufPtr);
+        CFE_SB_TransmitTxn_Execute(Txn, &BufDscPtr->Content);
 
         /*
          * The broadcast function consumes the buffer, so it should not be
          * accessed in this function anymore
          */
-        BufPtr = NULL;
+        BufDscPtr = NULL;
     }
 
     /* send an event for each pipe write error that may have occurred */
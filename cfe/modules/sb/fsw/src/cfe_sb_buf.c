@@ -163,9 +163,21 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
 void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd)
 {
     /* range check the UseCount variable */
-    if (bd->UseCount < 0x7FFF)
+    CFE_SB_CounterIncrementBelow(&bd->UseCount, 0x7FFF);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
+{
+    /* range check the UseCount variable, and free the buffer once the last reference is gone */
+    if (CFE_SB_CounterDecrementAbove(&bd->UseCount, 0) == 1)
     {
-        ++bd->UseCount;
+        CFE_SB_ReturnBufferToPool(bd);
     }
 }
 
@@ -175,18 +187,43 @@ void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
+void CFE_SB_ReleaseBufferRef(CFE_SB_BufferD_t *bd)
 {
-    /* range check the UseCount variable */
-    if (bd->UseCount > 0)
+    /*
+     * Other references may be dropped at the same time, so this may only decrement
+     * without the lock while it is certain not to be the last one
+     */
+    if (CFE_SB_CounterDecrementAbove(&bd->UseCount, 1) <= 1)
     {
-        --bd->UseCount;
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_DecrBufUseCnt(bd);
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+}
 
-        if (bd->UseCount == 0)
-        {
-            CFE_SB_ReturnBufferToPool(bd);
-        }
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleasePipeBuffers(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    uint16 i;
+
+    if (PipeDscPtr->LastBuffer != NULL)
+    {
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
+        PipeDscPtr->LastBuffer = NULL;
+    }
+
+    for (i = 0; i < PipeDscPtr->LastBatchCount; ++i)
+    {
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBatch[i]);
+        PipeDscPtr->LastBatch[i] = NULL;
     }
+
+    PipeDscPtr->LastBatchCount = 0;
 }
 
 /*----------------------------------------------------------------
@@ -195,19 +232,25 @@ void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
+CFE_SB_DestinationList_t *CFE_SB_GetDestinationBlk(uint16 MaxDests)
 {
-    int32               Stat;
-    CFE_ES_MemPoolBuf_t addr = NULL;
+    int32                     Stat;
+    CFE_ES_MemPoolBuf_t       addr = NULL;
+    CFE_SB_DestinationList_t *DestList;
 
-    /* Allocate a new destination descriptor from the SB memory pool.*/
-    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, sizeof(CFE_SB_DestinationD_t));
+    /* Allocate a new destination list from the SB memory pool.*/
+    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl,
+                             sizeof(CFE_SB_DestinationList_t) + (MaxDests * sizeof(CFE_SB_DestinationD_t)));
     if (Stat < 0)
     {
         return NULL;
     }
 
-    /* Add the size of a destination descriptor to the memory-in-use ctr and */
+    DestList           = (CFE_SB_DestinationList_t *)addr;
+    DestList->NumDests = 0;
+    DestList->MaxDests = MaxDests;
+
+    /* Add the size of a destination list to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
     if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
@@ -215,7 +258,7 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
         CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
     }
 
-    return (CFE_SB_DestinationD_t *)addr;
+    return DestList;
 }
 
 /*----------------------------------------------------------------
@@ -224,7 +267,7 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
+int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationList_t *Dest)
 {
     int32 Stat;
 
@@ -233,11 +276,11 @@ int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
         return CFE_SB_BAD_ARGUMENT;
     }
 
-    /* give the destination block back to the SB memory pool */
+    /* give the destination list back to the SB memory pool */
     Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, Dest);
     if (Stat > 0)
     {
-        /* Subtract the size of the destination block from the Memory in use ctr */
+        /* Subtract the size of the destination list from the Memory in use ctr */
         CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= Stat;
     }
 
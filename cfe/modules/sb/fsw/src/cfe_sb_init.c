@@ -114,9 +114,8 @@ int32 CFE_SB_InitBuffers(void)
     }
 
     /*
-     * Initialize the buffer tracking lists to be empty
+     * Initialize the buffer tracking list to be empty
      */
-    CFE_SB_TrackingListReset(&CFE_SB_Global.InTransitList);
     CFE_SB_TrackingListReset(&CFE_SB_Global.ZeroCopyList);
 
     return CFE_SUCCESS;
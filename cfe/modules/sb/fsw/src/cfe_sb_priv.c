@@ -168,18 +168,47 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber)
  *-----------------------------------------------------------------*/
 CFE_SB_DestinationD_t *CFE_SB_GetDestPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId)
 {
-    CFE_SB_DestinationD_t *destptr;
+    CFE_SB_DestinationList_t *destlist;
+    CFE_SB_DestinationD_t *   destptr;
+    uint16                    i;
 
-    destptr = CFE_SBR_GetDestListHeadPtr(RouteId);
+    destlist = CFE_SBR_GetDestListHeadPtr(RouteId);
+    destptr  = NULL;
 
     /* Check all destinations */
-    while (destptr != NULL)
+    if (destlist != NULL)
     {
-        if (CFE_RESOURCEID_TEST_EQUAL(destptr->PipeId, PipeId))
+        for (i = 0; i < destlist->NumDests; ++i)
         {
-            break;
+            if (CFE_RESOURCEID_TEST_EQUAL(destlist->Dests[i].PipeId, PipeId))
+            {
+                destptr = &destlist->Dests[i];
+                break;
+            }
         }
-        destptr = destptr->Next;
+    }
+
+    return destptr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_DestinationD_t *CFE_SB_GetBufferDestPtr(const CFE_SB_BufferD_t *BufDscPtr, CFE_SB_PipeId_t PipeId)
+{
+    CFE_SB_DestinationD_t *destptr = NULL;
+
+    /*
+     * The route may have been released and reclaimed for another MsgId while
+     * the buffer was on the pipe, in which case the destination now belongs to
+     * the other MsgId and the buffer no longer counts against it.
+     */
+    if (CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(BufDscPtr->DestRouteId), BufDscPtr->MsgId))
+    {
+        destptr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, PipeId);
     }
 
     return destptr;
@@ -246,6 +275,20 @@ bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId)
     return (PipeDscPtr == NULL || CFE_SB_PipeDescIsUsed(PipeDscPtr));
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_CheckPipeNameSlotMatch(uint32 Slot, const char *Name)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+
+    PipeDscPtr = &CFE_SB_Global.PipeTbl[Slot];
+    return (CFE_SB_PipeDescIsUsed(PipeDscPtr) && strcmp(Name, PipeDscPtr->PipeName) == 0);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -347,34 +390,276 @@ void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNode)
+uint32 CFE_SB_CounterIncrementBelow(uint32 *Counter, uint32 Limit)
 {
-    CFE_SB_DestinationD_t *WBS; /* Will Be Second (WBS) node */
-    CFE_SB_DestinationD_t *listheadptr;
+    uint32 Value;
 
-    listheadptr = CFE_SBR_GetDestListHeadPtr(RouteId);
+    Value = OS_AtomicLoad32(Counter);
 
-    /* if first node in list */
-    if (listheadptr == NULL)
+    /* On failure this reloads Value with the current counter, so just retry */
+    while (Value < Limit && !OS_AtomicCompareAndSwap32(Counter, &Value, Value + 1))
     {
-        /* initialize the new node */
-        NewNode->Next = NULL;
-        NewNode->Prev = NULL;
     }
-    else
+
+    return Value;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_CounterDecrementAbove(uint32 *Counter, uint32 Limit)
+{
+    uint32 Value;
+
+    Value = OS_AtomicLoad32(Counter);
+
+    /* On failure this reloads Value with the current counter, so just retry */
+    while (Value > Limit && !OS_AtomicCompareAndSwap32(Counter, &Value, Value - 1))
+    {
+    }
+
+    return Value;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_CounterRaise(uint32 *Counter, uint32 Value)
+{
+    uint32 Current;
+
+    Current = OS_AtomicLoad32(Counter);
+
+    /* On failure this reloads Current with the current counter, so just retry */
+    while (Current < Value && !OS_AtomicCompareAndSwap32(Counter, &Current, Value))
+    {
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_TransmitEnter(void)
+{
+    uint32 Epoch;
+
+    /*
+     * Count this transmit in the slot of the current epoch.  If the epoch moved on
+     * in the meantime, a routing change may already have checked that slot, so
+     * count it again in the slot of the new epoch instead.
+     */
+    Epoch = OS_AtomicLoad32(&CFE_SB_Global.Transmit.Epoch);
+    OS_AtomicAdd32(&CFE_SB_Global.Transmit.Active[Epoch & 1], 1);
+    while (OS_AtomicLoad32(&CFE_SB_Global.Transmit.Epoch) != Epoch)
+    {
+        OS_AtomicSub32(&CFE_SB_Global.Transmit.Active[Epoch & 1], 1);
+        Epoch = OS_AtomicLoad32(&CFE_SB_Global.Transmit.Epoch);
+        OS_AtomicAdd32(&CFE_SB_Global.Transmit.Active[Epoch & 1], 1);
+    }
+
+    /*
+     * A routing change that needs all transmits to stop sets Exclusive before it
+     * waits, so either this sees it set, or the change waits for this transmit.
+     * In the former case wait for the change to finish by taking the SB lock,
+     * which it holds throughout.  Exclusive is never set while the lock is free.
+     */
+    if (OS_AtomicLoad32(&CFE_SB_Global.Transmit.Exclusive) != 0)
+    {
+        CFE_SB_TransmitLeave(Epoch);
+
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        Epoch = OS_AtomicLoad32(&CFE_SB_Global.Transmit.Epoch);
+        OS_AtomicAdd32(&CFE_SB_Global.Transmit.Active[Epoch & 1], 1);
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return Epoch;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitLeave(uint32 Epoch)
+{
+    OS_AtomicSub32(&CFE_SB_Global.Transmit.Active[Epoch & 1], 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_WaitForTransmits(void)
+{
+    uint32 Epoch;
+
+    /* Transmits that start from here on count in the other slot */
+    Epoch = OS_AtomicAdd32(&CFE_SB_Global.Transmit.Epoch, 1) - 1;
+
+    /*
+     * Transmits never block while active, so this only waits for ones that
+     * were preempted partway through to be scheduled again.
+     */
+    while (OS_AtomicLoad32(&CFE_SB_Global.Transmit.Active[Epoch & 1]) != 0)
+    {
+        OS_TaskDelay(1);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_HoldTransmits(void)
+{
+    OS_AtomicStore32(&CFE_SB_Global.Transmit.Exclusive, 1);
+    CFE_SB_WaitForTransmits();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleaseTransmits(void)
+{
+    OS_AtomicStore32(&CFE_SB_Global.Transmit.Exclusive, 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_CollectTransmitCounters(void)
+{
+    CFE_SB_TransmitSync_t *           SyncPtr = &CFE_SB_Global.Transmit;
+    CFE_SB_HousekeepingTlm_Payload_t *HkPtr   = &CFE_SB_Global.HKTlmMsg.Payload;
+
+    HkPtr->NoSubscribersCounter += OS_AtomicExchange32(&SyncPtr->NoSubscribersCounter, 0);
+    HkPtr->MsgSendErrorCounter += OS_AtomicExchange32(&SyncPtr->MsgSendErrorCounter, 0);
+    HkPtr->MsgLimitErrorCounter += OS_AtomicExchange32(&SyncPtr->MsgLimitErrorCounter, 0);
+    HkPtr->PipeOverflowErrorCounter += OS_AtomicExchange32(&SyncPtr->PipeOverflowErrorCounter, 0);
+    HkPtr->InternalErrorCounter += OS_AtomicExchange32(&SyncPtr->InternalErrorCounter, 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_DestinationList_t *CFE_SB_ResizeDestList(CFE_SBR_RouteId_t RouteId, uint16 MaxDests,
+                                                 const CFE_SB_DestinationD_t *OmitPtr)
+{
+    CFE_SB_DestinationList_t *OldList;
+    CFE_SB_DestinationList_t *NewList;
+    uint32                    Copied[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+    uint32                    OldIdx;
+    uint32                    NewIdx;
+
+    OldList = CFE_SBR_GetDestListHeadPtr(RouteId);
+    NewList = CFE_SB_GetDestinationBlk(MaxDests);
+
+    if (NewList != NULL)
+    {
+        NewIdx = 0;
+        for (OldIdx = 0; OldList != NULL && OldIdx < OldList->NumDests; ++OldIdx)
+        {
+            if (&OldList->Dests[OldIdx] != OmitPtr)
+            {
+                NewList->Dests[NewIdx]           = OldList->Dests[OldIdx];
+                Copied[NewIdx]                   = OS_AtomicLoad32(&OldList->Dests[OldIdx].BuffCount);
+                NewList->Dests[NewIdx].BuffCount = Copied[NewIdx];
+                ++NewIdx;
+            }
+        }
+        NewList->NumDests = NewIdx;
+
+        CFE_SBR_SetDestListHeadPtr(RouteId, NewList);
+
+        if (OldList != NULL)
+        {
+            /*
+             * Transmits that found the old list may still be counting buffers in it.
+             * Once they are finished, carry over what they changed since the copy.
+             * Receives take the SB lock, so none of these buffers is received until
+             * this is done.
+             */
+            CFE_SB_WaitForTransmits();
+
+            NewIdx = 0;
+            for (OldIdx = 0; OldIdx < OldList->NumDests; ++OldIdx)
+            {
+                if (&OldList->Dests[OldIdx] != OmitPtr)
+                {
+                    OS_AtomicAdd32(&NewList->Dests[NewIdx].BuffCount,
+                                   OS_AtomicLoad32(&OldList->Dests[OldIdx].BuffCount) - Copied[NewIdx]);
+                    ++NewIdx;
+                }
+            }
+
+            CFE_SB_PutDestinationBlk(OldList);
+        }
+    }
+
+    return NewList;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, const CFE_SB_DestinationD_t *NewNode)
+{
+    CFE_SB_DestinationList_t *DestList;
+    uint16                    MaxDests;
+
+    DestList = CFE_SBR_GetDestListHeadPtr(RouteId);
+
+    /* Make room for the new node, doubling the list each time it fills up */
+    if (DestList == NULL || DestList->NumDests >= DestList->MaxDests)
     {
-        WBS = listheadptr;
+        MaxDests = 1;
+        if (DestList != NULL)
+        {
+            MaxDests = DestList->MaxDests * 2;
+        }
 
-        /* initialize the new node */
-        NewNode->Next = WBS;
-        NewNode->Prev = NULL;
+        if (MaxDests > CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+        {
+            MaxDests = CFE_PLATFORM_SB_MAX_DEST_PER_PKT;
+        }
 
-        /* insert the new node */
-        WBS->Prev = NewNode;
+        DestList = CFE_SB_ResizeDestList(RouteId, MaxDests, NULL);
+        if (DestList == NULL)
+        {
+            return CFE_SB_BUF_ALOC_ERR;
+        }
     }
 
-    /* Update Head */
-    CFE_SBR_SetDestListHeadPtr(RouteId, NewNode);
+    /* Transmits may be reading the list, so the node must be complete before it is counted */
+    DestList->Dests[DestList->NumDests] = *NewNode;
+    OS_AtomicStore32(&DestList->NumDests, DestList->NumDests + 1);
 
     return CFE_SUCCESS;
 }
@@ -388,8 +673,13 @@ int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNo
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
 {
     CFE_SB_RemoveDestNode(RouteId, DestPtr);
-    CFE_SB_PutDestinationBlk(DestPtr);
     CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse--;
+
+    /* Route is no longer in use once nothing subscribes to it */
+    if (CFE_SBR_GetDestListHeadPtr(RouteId) == NULL)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse--;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -400,39 +690,40 @@ void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr
  *-----------------------------------------------------------------*/
 void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove)
 {
-    CFE_SB_DestinationD_t *PrevNode;
-    CFE_SB_DestinationD_t *NextNode;
+    CFE_SB_DestinationList_t *DestList;
+    uint16                    MaxDests;
+    uint32                    NumAfter;
 
-    if ((NodeToRemove->Prev == NULL) && (NodeToRemove->Next == NULL))
+    DestList = CFE_SBR_GetDestListHeadPtr(RouteId);
+
+    if (DestList->NumDests == 1)
     {
-        /* Clear destinations if this is the only node in the list */
+        /* Clear destinations if this was the only node in the list */
         CFE_SBR_SetDestListHeadPtr(RouteId, NULL);
+        CFE_SB_WaitForTransmits();
+        CFE_SB_PutDestinationBlk(DestList);
+        return;
     }
-    else if (NodeToRemove->Prev == NULL)
-    {
-        /* First in the list, set the next node to list head */
-        NextNode       = NodeToRemove->Next;
-        NextNode->Prev = NULL;
-        CFE_SBR_SetDestListHeadPtr(RouteId, NextNode);
-    }
-    else if (NodeToRemove->Next == NULL)
+
+    /* Give back the unused space once the list is no more than a quarter full */
+    MaxDests = DestList->MaxDests;
+    if ((DestList->NumDests - 1) <= (MaxDests / 4))
     {
-        /* Last in the list, remove previous pointer */
-        PrevNode       = NodeToRemove->Prev;
-        PrevNode->Next = NULL;
+        MaxDests /= 2;
     }
-    else
+
+    /* Publish a copy without the node, keeping the remaining destinations in order */
+    if (CFE_SB_ResizeDestList(RouteId, MaxDests, NodeToRemove) == NULL)
     {
-        /* Middle of list, remove */
-        PrevNode       = NodeToRemove->Prev;
-        NextNode       = NodeToRemove->Next;
-        PrevNode->Next = NextNode;
-        NextNode->Prev = PrevNode;
-    }
+        /* Without memory for the copy, close the gap in place while no transmits are active */
+        CFE_SB_HoldTransmits();
+
+        --DestList->NumDests;
+        NumAfter = DestList->NumDests - (NodeToRemove - DestList->Dests);
+        memmove(NodeToRemove, NodeToRemove + 1, NumAfter * sizeof(CFE_SB_DestinationD_t));
 
-    /* initialize the node before returning it to the heap */
-    NodeToRemove->Next = NULL;
-    NodeToRemove->Prev = NULL;
+        CFE_SB_ReleaseTransmits();
+    }
 }
 
 /*----------------------------------------------------------------
@@ -775,24 +1066,29 @@ void CFE_SB_MessageTxn_ReportEvents(const CFE_SB_MessageTxn_State_t *TxnPtr)
          * Note that transmit side just has one error counter, whereas
          * receive side has two - these differeniate between a bad passed-in
          * arg vs some other internal error such as queue access.
+         *
+         * Transmits do not take the SB lock, see CFE_SB_CollectTransmitCounters().
          */
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
         if (TxnPtr->IsTransmit)
         {
-            CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
-        }
-        else if (TxnPtr->Status == CFE_SB_BAD_ARGUMENT)
-        {
-            ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+            OS_AtomicAdd32(&CFE_SB_Global.Transmit.MsgSendErrorCounter, 1);
         }
         else
         {
-            /* For any other unexpected error (e.g. CFE_SB_Q_RD_ERR_EID) */
-            ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
-        }
+            CFE_SB_LockSharedData(__func__, __LINE__);
 
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
+            if (TxnPtr->Status == CFE_SB_BAD_ARGUMENT)
+            {
+                ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+            }
+            else
+            {
+                /* For any other unexpected error (e.g. CFE_SB_Q_RD_ERR_EID) */
+                ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
+            }
+
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+        }
     }
 }
 
@@ -925,23 +1221,28 @@ CFE_SB_MessageTxn_State_t *CFE_SB_TransmitTxn_Init(CFE_SB_TransmitTxn_State_t *T
  *-----------------------------------------------------------------*/
 void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
 {
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeSetEntry_t *ContextPtr;
-    CFE_ES_AppId_t         AppId;
-    bool                   IsAcceptable;
-    CFE_Status_t           Status;
+    CFE_SB_PipeD_t *          PipeDscPtr;
+    CFE_SB_DestinationList_t *DestList;
+    CFE_SB_DestinationD_t *   DestPtr;
+    CFE_SB_PipeSetEntry_t *   ContextPtr;
+    CFE_ES_AppId_t            AppId;
+    bool                      IsAcceptable;
+    CFE_Status_t              Status;
+    uint32                    NumDests;
+    uint32                    DestIdx;
 
     /*
      * get app id for loopback testing  -
      * This is only used if one or more of the destinations has its "IGNOREMINE" option set,
-     * but it should NOT be gotten while locked.  So since we do not know (yet) if we need it,
-     * it is better to get it and not need it than need it and not have it.
+     * but since we do not know (yet) if we need it, it is better to get it and not need it
+     * than need it and not have it.
      */
     CFE_ES_GetAppID(&AppId);
 
-    /* take semaphore to prevent a task switch during processing */
-    CFE_SB_LockSharedData(__func__, __LINE__);
+    /*
+     * The routing is read without taking the SB lock.  The caller counts this as an active
+     * transmit, so the destination list and pipes found here stay valid until it leaves.
+     */
 
     /* Get the routing id */
     BufDscPtr->DestRouteId = CFE_SBR_GetRouteId(TxnPtr->RoutingMsgId);
@@ -949,24 +1250,31 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
     /* For an invalid route / no subscribers this whole logic can be skipped */
     if (CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId))
     {
-        /* If this is the origination, then update the message content (while locked) before actually sending */
+        /* If this is the origination, then update the message content before actually sending */
         if (TxnPtr->IsEndpoint)
         {
-            CFE_SBR_IncrementSequenceCounter(BufDscPtr->DestRouteId);
-
-            /* Set the sequence count from the route */
-            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(BufDscPtr->DestRouteId));
+            /* Set the sequence count from the route, concurrent senders each get their own count */
+            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg,
+                                     CFE_SBR_IncrementSequenceCounter(BufDscPtr->DestRouteId));
         }
 
         /* Send the packet to all destinations  */
-        DestPtr = CFE_SBR_GetDestListHeadPtr(BufDscPtr->DestRouteId);
-        while (DestPtr != NULL && TxnPtr->NumPipes < TxnPtr->MaxPipes)
+        DestList = CFE_SBR_GetDestListHeadPtr(BufDscPtr->DestRouteId);
+        NumDests = 0;
+        if (DestList != NULL)
+        {
+            NumDests = OS_AtomicLoad32(&DestList->NumDests);
+        }
+
+        for (DestIdx = 0; DestIdx < NumDests && TxnPtr->NumPipes < TxnPtr->MaxPipes; ++DestIdx)
         {
+            DestPtr    = &DestList->Dests[DestIdx];
             ContextPtr = NULL;
 
             if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
             {
-                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+                /* cached at subscription, confirmed below in case the pipe has since been deleted */
+                PipeDscPtr = DestPtr->PipeDscPtr;
             }
             else
             {
@@ -989,57 +1297,35 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
 
                 ContextPtr->PipeId     = DestPtr->PipeId;
                 ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
+                ContextPtr->DestPtr    = DestPtr;
 
                 /* if Msg limit exceeded, log event, increment counter */
                 /* and go to next destination */
-                if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
+                if (CFE_SB_CounterIncrementBelow(&DestPtr->BuffCount, DestPtr->MsgId2PipeLim) >=
+                    DestPtr->MsgId2PipeLim)
                 {
                     ContextPtr->PendingEventId = CFE_SB_MSGID_LIM_ERR_EID;
-                    ++CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter;
-                    ++PipeDscPtr->SendErrors;
+                    OS_AtomicAdd32(&CFE_SB_Global.Transmit.MsgLimitErrorCounter, 1);
+                    OS_AtomicAdd32(&PipeDscPtr->SendErrors, 1);
                     ++TxnPtr->NumPipeErrs;
                 }
                 else
                 {
                     CFE_SB_IncrBufUseCnt(BufDscPtr);
-                    ++DestPtr->BuffCount;
-
-                    ++PipeDscPtr->CurrentQueueDepth;
-                    if (PipeDscPtr->CurrentQueueDepth > PipeDscPtr->PeakQueueDepth)
-                    {
-                        PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
-                    }
+                    CFE_SB_CounterRaise(&PipeDscPtr->PeakQueueDepth,
+                                        OS_AtomicAdd32(&PipeDscPtr->CurrentQueueDepth, 1));
                 }
             }
-
-            DestPtr = DestPtr->Next;
         }
     }
     else
     {
         /* if there have been no subscriptions for this pkt, */
         /* increment the dropped pkt cnt, send event and return success */
-        CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
+        OS_AtomicAdd32(&CFE_SB_Global.Transmit.NoSubscribersCounter, 1);
         CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_NO_SUBS_EID, CFE_SUCCESS);
     }
 
-    /*
-     * Remove this from whatever list it was in
-     *
-     * If it was a singleton/new buffer this has no effect.
-     * If it was a zero-copy buffer this removes it from the ZeroCopyList.
-     */
-    CFE_SB_TrackingListRemove(&BufDscPtr->Link);
-
-    /* clear the AppID field in case it was a zero copy buffer,
-     * as it is no longer owned by that app after broadcasting */
-    BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
-
-    /* track the buffer as an in-transit message */
-    CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link);
-
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
-
     /*
      * Lastly, if this is the origination point, now that all headers should
      * have known values (including sequence) - invoke the mission-specific
@@ -1099,9 +1385,7 @@ int32 CFE_SB_MessageTxn_GetOsTimeout(const CFE_SB_MessageTxn_State_t *TxnPtr)
  *-----------------------------------------------------------------*/
 bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg)
 {
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_BufferD_t *     BufDscPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
 
     BufDscPtr = Arg;
 
@@ -1115,46 +1399,72 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
         OS_QueuePut(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
 
     /*
-     * If it succeeded, nothing else to do.  But if it fails then we must undo the
-     * optimistic depth accounting done earlier.
+     * If it succeeded, nothing else to do.  But if it fails then the optimistic
+     * depth accounting done earlier must be undone, which is deferred to
+     * CFE_SB_TransmitTxn_Finish() where all failed pipes are handled together.
      */
     if (ContextPtr->OsStatus != OS_SUCCESS)
     {
         ++TxnPtr->NumPipeErrs;
 
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
         if (ContextPtr->OsStatus == OS_QUEUE_FULL)
         {
             ContextPtr->PendingEventId = CFE_SB_Q_FULL_ERR_EID;
-            CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
         }
         else
         {
             /* Unexpected error while writing to queue. */
             ContextPtr->PendingEventId = CFE_SB_Q_WR_ERR_EID;
-            CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
         }
+    }
 
-        PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
-        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) && PipeDscPtr->CurrentQueueDepth > 0)
+    /* always keep going when sending (broadcast) */
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_Finish(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    uint32                 i;
+    CFE_SB_PipeSetEntry_t *ContextPtr;
+
+    /*
+     * Undo the accounting for any destination where the queue write failed.
+     * Entries that were skipped in FindDestinations (e.g. msg limit) never had
+     * a write attempted, so their OsStatus is still OS_SUCCESS and nothing is undone.
+     *
+     * The destination and pipe found by FindDestinations are still valid, as
+     * this transmit is still counted as active.
+     */
+    for (i = 0; TxnPtr->NumPipeErrs != 0 && i < TxnPtr->NumPipes; ++i)
+    {
+        ContextPtr = &TxnPtr->PipeSet[i];
+
+        if (ContextPtr->OsStatus == OS_SUCCESS)
         {
-            --PipeDscPtr->CurrentQueueDepth;
+            continue;
         }
 
-        DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
-        if (DestPtr != NULL && DestPtr->BuffCount > 0)
+        if (ContextPtr->OsStatus == OS_QUEUE_FULL)
+        {
+            OS_AtomicAdd32(&CFE_SB_Global.Transmit.PipeOverflowErrorCounter, 1);
+        }
+        else
         {
-            DestPtr->BuffCount--;
+            OS_AtomicAdd32(&CFE_SB_Global.Transmit.InternalErrorCounter, 1);
         }
 
-        CFE_SB_DecrBufUseCnt(BufDscPtr);
+        CFE_SB_CounterDecrementAbove(&ContextPtr->DestPtr->PipeDscPtr->CurrentQueueDepth, 0);
+        CFE_SB_CounterDecrementAbove(&ContextPtr->DestPtr->BuffCount, 0);
 
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
+        /* The sender still holds a reference, so this is never the last one */
+        CFE_SB_CounterDecrementAbove(&BufDscPtr->UseCount, 1);
     }
-
-    /* always keep going when sending (broadcast) */
-    return true;
 }
 
 /*----------------------------------------------------------------
@@ -1192,6 +1502,7 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
 {
     int32             Status;
     CFE_SB_BufferD_t *BufDscPtr;
+    uint32            Epoch;
 
     /* Sanity check on the input buffer - if this doesn't work, stop now */
     Status = CFE_SB_ZeroCopyBufferValidate(BufPtr, &BufDscPtr);
@@ -1206,20 +1517,43 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
     BufDscPtr->ContentSize = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
     BufDscPtr->MsgId       = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
 
+    /*
+     * If it was a zero-copy buffer, remove it from the ZeroCopyList, which needs the SB lock.
+     * A buffer allocated by CFE_SB_TransmitMsg() is not in any list.  Nothing else links to
+     * a node that is not in a list, so its links can be checked without the lock.
+     */
+    if (!CFE_SB_TrackingListIsEnd(&BufDscPtr->Link, CFE_SB_TrackingListGetNext(&BufDscPtr->Link)))
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_TrackingListRemove(&BufDscPtr->Link);
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    /* clear the AppID field in case it was a zero copy buffer,
+     * as it is no longer owned by that app after broadcasting */
+    BufDscPtr->AppId = CFE_ES_APPID_UNDEFINED;
+
+    /* The routing is used without the SB lock from here, until the transmit leaves */
+    Epoch = CFE_SB_TransmitEnter();
+
     /* Convert the route to a set of pipes/destinations */
     CFE_SB_TransmitTxn_FindDestinations(TxnPtr, BufDscPtr);
 
     /* Note the above function always succeeds - even if no pipes are subscribed,
-     * the transaction will simply have 0 pipes and this next call becomes a no-op */
+     * the transaction will simply have 0 pipes and this next call becomes a no-op.
+     * Queue writes never block for a transmit, so the transmit does not stay active for long. */
     CFE_SB_MessageTxn_ProcessPipes(CFE_SB_TransmitTxn_PipeHandler, TxnPtr, BufDscPtr);
 
+    CFE_SB_TransmitTxn_Finish(TxnPtr, BufDscPtr);
+
+    CFE_SB_TransmitLeave(Epoch);
+
     /*
      * Decrement the buffer UseCount - This means that the caller
-     * should not use the buffer anymore after this call.
+     * should not use the buffer anymore after this call.  This only takes
+     * the SB lock if no subscriber still holds the buffer.
      */
-    CFE_SB_LockSharedData(__func__, __LINE__);
-    CFE_SB_DecrBufUseCnt(BufDscPtr);
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
+    CFE_SB_ReleaseBufferRef(BufDscPtr);
 }
 
 /******************************************************************
@@ -1292,8 +1626,12 @@ void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeI
     {
         ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
 
+        /* Pick up any error deferred by the last batched receive, the pipe handler reports it */
+        ContextPtr->OsStatus         = PipeDscPtr->DeferredOsStatus;
+        PipeDscPtr->DeferredOsStatus = OS_SUCCESS;
+
         /*
-         * Un-reference any previous buffer from the last call.
+         * Un-reference any previous buffer(s) from the last call, single or batched.
          *
          * NOTE: This is historical behavior where apps call CFE_SB_ReceiveBuffer()
          * in the loop within the app's main task.  There is currently no separate
@@ -1307,12 +1645,7 @@ void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeI
          * in a future version of CFE to decouple these actions, to allow for
          * multiple workers to service the same pipe.
          */
-        if (PipeDscPtr->LastBuffer != NULL)
-        {
-            /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
-            CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
-            PipeDscPtr->LastBuffer = NULL;
-        }
+        CFE_SB_ReleasePipeBuffers(PipeDscPtr);
     }
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -1359,23 +1692,23 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
         *ParentBufDscPtrP = BufDscPtr;
 
         /* get pointer to destination to be used in decrementing msg limit cnt*/
-        DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
+        DestPtr = CFE_SB_GetBufferDestPtr(BufDscPtr, ContextPtr->PipeId);
 
         /*
         ** DestPtr would be NULL if the msg is unsubscribed to while it is on
         ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
         ** then resubscribed to while it is on the pipe. Both of these cases are
         ** considered nominal and are handled by the code below.
+        **
+        ** Transmits update these counters without the SB lock, so they are
+        ** only changed atomically.
         */
-        if (DestPtr != NULL && DestPtr->BuffCount > 0)
+        if (DestPtr != NULL)
         {
-            DestPtr->BuffCount--;
+            CFE_SB_CounterDecrementAbove(&DestPtr->BuffCount, 0);
         }
 
-        if (PipeDscPtr->CurrentQueueDepth > 0)
-        {
-            --PipeDscPtr->CurrentQueueDepth;
-        }
+        CFE_SB_CounterDecrementAbove(&PipeDscPtr->CurrentQueueDepth, 0);
     }
     else
     {
@@ -1404,10 +1737,15 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
     size_t             BufDscSize;
 
     ParentBufDscPtrP = Arg;
+    BufDscPtr        = NULL;
+    BufDscSize       = 0;
 
-    /* Read the buffer descriptor address from the queue.  */
-    ContextPtr->OsStatus = OS_QueueGet(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize,
-                                       CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    /* Read the buffer descriptor address from the queue, unless an error was deferred from the last batch */
+    if (ContextPtr->OsStatus == OS_SUCCESS)
+    {
+        ContextPtr->OsStatus = OS_QueueGet(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize,
+                                           CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    }
 
     /*
      * translate the return value -
@@ -1525,3 +1863,233 @@ const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnP
 
     return Result;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReceiveTxn_ExportBatch(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                   CFE_SB_ReceiveBatch_t *BatchPtr)
+{
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_BufferD_t *     BufDscPtr;
+    bool                   IsPipeValid;
+    uint32                 i;
+    uint32                 NumKept;
+
+    NumKept    = 0;
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* Same as the single receive - the pipe may have been deleted while reading the queue */
+    IsPipeValid = CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId);
+
+    for (i = 0; i < BatchPtr->Count; ++i)
+    {
+        BufDscPtr = BatchPtr->BufDscPtrs[i];
+
+        if (IsPipeValid)
+        {
+            /* see CFE_SB_ReceiveTxn_ExportReference() regarding these counters */
+            DestPtr = CFE_SB_GetBufferDestPtr(BufDscPtr, ContextPtr->PipeId);
+            if (DestPtr != NULL)
+            {
+                CFE_SB_CounterDecrementAbove(&DestPtr->BuffCount, 0);
+            }
+
+            CFE_SB_CounterDecrementAbove(&PipeDscPtr->CurrentQueueDepth, 0);
+
+            if (BatchPtr->IsAcceptable[i])
+            {
+                /*
+                 * The reference that was in the queue is transferred directly to the
+                 * pipe descriptor, rather than taking a new one and dropping the old one.
+                 */
+                PipeDscPtr->LastBatch[PipeDscPtr->LastBatchCount] = BufDscPtr;
+                ++PipeDscPtr->LastBatchCount;
+
+                BatchPtr->BufDscPtrs[NumKept] = BufDscPtr;
+                ++NumKept;
+                continue;
+            }
+
+            ++BatchPtr->Dropped;
+        }
+
+        /* Drop the reference that was in the queue */
+        CFE_SB_DecrBufUseCnt(BufDscPtr);
+    }
+
+    if (!IsPipeValid)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+        ContextPtr->PendingEventId = CFE_SB_BAD_PIPEID_EID;
+    }
+    else if (NumKept > 0 && ContextPtr->OsStatus != OS_SUCCESS)
+    {
+        /*
+         * The buffers kept here can only be returned if this receive succeeds,
+         * so hold the read error on the pipe for the next receive to report.
+         */
+        PipeDscPtr->DeferredOsStatus = ContextPtr->OsStatus;
+        ContextPtr->OsStatus         = OS_SUCCESS;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    BatchPtr->Count = NumKept;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_ReceiveTxn_BatchPipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                        void *Arg)
+{
+    CFE_SB_ReceiveBatch_t *BatchPtr;
+    CFE_Status_t           Status;
+    uint32                 i;
+    uint32                 NumValid;
+
+    BatchPtr = Arg;
+    NumValid = 0;
+
+    /* Read all the pending buffer descriptor addresses from the queue, up to the limit */
+    if (ContextPtr->OsStatus == OS_SUCCESS)
+    {
+        ContextPtr->OsStatus = OS_QueueGetBatch(ContextPtr->SysQueueId, BatchPtr->BufDscPtrs,
+                                                sizeof(BatchPtr->BufDscPtrs[0]), BatchPtr->MaxCount,
+                                                &BatchPtr->Count, CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+
+        /* A short item ends the batch and is counted, but it cannot be a buffer descriptor address */
+        if (ContextPtr->OsStatus == OS_QUEUE_INVALID_SIZE && BatchPtr->Count > 0)
+        {
+            --BatchPtr->Count;
+        }
+    }
+
+    /*
+     * Whatever was read must be accounted for, even if the OSAL call also reported
+     * an error partway through the batch.  A NULL entry cannot be exported and is
+     * treated as a read error, same as the single receive.
+     */
+    for (i = 0; i < BatchPtr->Count; ++i)
+    {
+        if (BatchPtr->BufDscPtrs[i] == NULL)
+        {
+            ContextPtr->OsStatus = OS_ERROR;
+            continue;
+        }
+
+        BatchPtr->BufDscPtrs[NumValid] = BatchPtr->BufDscPtrs[i];
+
+        if (TxnPtr->IsEndpoint)
+        {
+            Status = CFE_MSG_VerificationAction(&BatchPtr->BufDscPtrs[NumValid]->Content.Msg,
+                                                BatchPtr->BufDscPtrs[NumValid]->AllocatedSize,
+                                                &BatchPtr->IsAcceptable[NumValid]);
+            if (Status != CFE_SUCCESS)
+            {
+                /* This typically should not happen - only if VerificationAction got bad arguments */
+                BatchPtr->IsAcceptable[NumValid] = false;
+            }
+        }
+        else
+        {
+            /* If no verification being done at this stage - consider everything "good" */
+            BatchPtr->IsAcceptable[NumValid] = true;
+        }
+
+        ++NumValid;
+    }
+
+    BatchPtr->Count = NumValid;
+
+    if (BatchPtr->Count > 0)
+    {
+        CFE_SB_ReceiveTxn_ExportBatch(TxnPtr, ContextPtr, BatchPtr);
+    }
+
+    /* translate the return value, same as CFE_SB_ReceiveTxn_PipeHandler() */
+    if (ContextPtr->OsStatus == OS_QUEUE_EMPTY)
+    {
+        /* normal if using CFE_SB_POLL */
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_NO_MESSAGE);
+    }
+    else if (ContextPtr->OsStatus == OS_QUEUE_TIMEOUT)
+    {
+        /* normal if using a nonzero timeout */
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_TIME_OUT);
+    }
+    else if (ContextPtr->OsStatus != OS_SUCCESS)
+    {
+        /* off-nominal condition, report an error event */
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+        ContextPtr->PendingEventId = CFE_SB_Q_RD_ERR_EID;
+    }
+
+    /* Read ops only process one pipe */
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_ReceiveTxn_ExecuteBatch(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t **BufPtrArray,
+                                      uint32 MaxCount)
+{
+    CFE_SB_ReceiveBatch_t Batch;
+    uint32                i;
+
+    if (MaxCount > CFE_PLATFORM_SB_MAX_RECEIVE_BATCH)
+    {
+        MaxCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH;
+    }
+
+    Batch.MaxCount = MaxCount;
+    Batch.Count    = 0;
+
+    TxnPtr->RoutingMsgId = CFE_SB_INVALID_MSG_ID;
+    TxnPtr->ContentSize  = 0;
+
+    while (CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        Batch.Count   = 0;
+        Batch.Dropped = 0;
+
+        CFE_SB_MessageTxn_ProcessPipes(CFE_SB_ReceiveTxn_BatchPipeHandler, TxnPtr, &Batch);
+
+        /* Report an event for each buffer that was dropped */
+        for (i = 0; i < Batch.Dropped; ++i)
+        {
+            CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, TxnPtr->PipeSet, CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
+        }
+
+        /*
+         * Stop if anything was received, or if nothing was dropped (meaning the read
+         * itself came up empty).  If every buffer was dropped, read again, as the single
+         * receive does, so the caller does not see an empty batch.
+         */
+        if (Batch.Count > 0 || Batch.Dropped == 0)
+        {
+            break;
+        }
+    }
+
+    for (i = 0; i < Batch.Count; ++i)
+    {
+        BufPtrArray[i] = &Batch.BufDscPtrs[i]->Content;
+    }
+
+    return Batch.Count;
+}
@@ -153,7 +153,7 @@ typedef struct CFE_SB_BufferD
     size_t AllocatedSize; /**< Total size of this descriptor (including descriptor itself) */
     size_t ContentSize;   /**< Actual size of message content currently stored in the buffer */
 
-    uint16 UseCount; /**< Number of active references to this buffer in the system */
+    uint32 UseCount; /**< Number of active references to this buffer in the system, updated atomically */
 
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
 } CFE_SB_BufferD_t;
@@ -166,18 +166,22 @@ typedef struct CFE_SB_BufferD
 **     characteristics and status of a pipe.
 */
 
-typedef struct
+typedef struct CFE_SB_PipeD
 {
     CFE_SB_PipeId_t   PipeId;
     CFE_ES_AppId_t    AppId;
     osal_id_t         SysQueueId;
     uint8             Opts;
     uint8             Spare;
-    uint16            SendErrors;
     uint16            MaxQueueDepth;
-    uint16            CurrentQueueDepth;
-    uint16            PeakQueueDepth;
+    uint32            SendErrors;        /**< Updated atomically, transmits do not take the SB lock */
+    uint32            CurrentQueueDepth; /**< Updated atomically, transmits do not take the SB lock */
+    uint32            PeakQueueDepth;    /**< Updated atomically, transmits do not take the SB lock */
+    uint16            LastBatchCount;
+    int32             DeferredOsStatus;
     CFE_SB_BufferD_t *LastBuffer;
+    CFE_SB_BufferD_t *LastBatch[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
+    char              PipeName[OS_MAX_API_NAME];
 } CFE_SB_PipeD_t;
 
 /******************************************************************************
@@ -228,6 +232,32 @@ typedef struct
     CFE_SB_BackgroundFileBuffer_t Buffer;    /**< Temporary holding area for file record */
 } CFE_SB_BackgroundFileStateInfo_t;
 
+/**
+ * \brief State shared between transmits and changes to the routing
+ *
+ * Transmits do not take the SB lock.  Instead each one counts itself as active
+ * in one of two slots, chosen by the current epoch, until it is finished with
+ * the routing.  A routing change, made while holding the SB lock, waits for the
+ * transmits that might still be using the old routing by advancing the epoch and
+ * waiting for the slot of the previous epoch to empty.  Transmits that start in
+ * the meantime count in the other slot, so they cannot hold up the wait.
+ *
+ * The housekeeping counters that transmits update are accumulated here, and are
+ * only added into the housekeeping telemetry when it is sent.
+ */
+typedef struct
+{
+    uint32 Epoch;     /**< Advanced by each wait for transmits */
+    uint32 Active[2]; /**< Number of transmits in progress, by epoch */
+    uint32 Exclusive; /**< Set while a routing change does not allow any transmits */
+
+    uint32 NoSubscribersCounter;
+    uint32 MsgSendErrorCounter;
+    uint32 MsgLimitErrorCounter;
+    uint32 PipeOverflowErrorCounter;
+    uint32 InternalErrorCounter;
+} CFE_SB_TransmitSync_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_Global_t
 **
@@ -250,10 +280,13 @@ typedef struct
     CFE_SB_Qos_t                 Default_Qos;
     CFE_ResourceId_t             LastPipeId;
 
+    /* Name index over the pipe table, for CFE_SB_GetPipeIdByName() */
+    CFE_ResourceId_NameIndexEntry_t PipeNameIndex[CFE_PLATFORM_SB_MAX_PIPES];
+
     CFE_SB_BackgroundFileStateInfo_t BackgroundFile;
 
-    /* A list of buffers currently in-transit, owned by SB */
-    CFE_SB_BufferLink_t InTransitList;
+    /* Synchronization of transmits with routing changes, accessed atomically */
+    CFE_SB_TransmitSync_t Transmit;
 
     /* A list of buffers currently issued to apps for zero-copy */
     CFE_SB_BufferLink_t ZeroCopyList;
@@ -264,10 +297,11 @@ typedef struct
  */
 typedef struct
 {
-    CFE_SB_PipeId_t PipeId;
-    osal_id_t       SysQueueId;
-    uint16          PendingEventId;
-    int32           OsStatus;
+    CFE_SB_PipeId_t        PipeId;
+    osal_id_t              SysQueueId;
+    uint16                 PendingEventId;
+    int32                  OsStatus;
+    CFE_SB_DestinationD_t *DestPtr; /**< Destination counted by a transmit, to undo it if the write fails */
 } CFE_SB_PipeSetEntry_t;
 
 typedef enum
@@ -335,6 +369,21 @@ typedef struct
     CFE_SB_PipeSetEntry_t Source;
 } CFE_SB_ReceiveTxn_State_t;
 
+/**
+ * \brief Buffers read from a pipe by a batched receive transaction
+ *
+ * Holds the buffer descriptors read from the underlying queue in one operation,
+ * along with the outcome of verifying each one, until they are exported.
+ */
+typedef struct
+{
+    uint32            MaxCount; /**< Number of buffers the caller can accept, at most the array size */
+    uint32            Count;    /**< Number of valid entries in BufDscPtrs */
+    uint32            Dropped;  /**< Number of buffers dropped because they failed verification */
+    CFE_SB_BufferD_t *BufDscPtrs[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
+    bool              IsAcceptable[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH];
+} CFE_SB_ReceiveBatch_t;
+
 typedef bool (*CFE_SB_MessageTxn_PipeHandler_t)(CFE_SB_MessageTxn_State_t *, CFE_SB_PipeSetEntry_t *, void *);
 
 /*
@@ -485,7 +534,8 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId);
  * UseCount is a variable in the CFE_SB_BufferD_t and is used to
  * determine when a buffer may be returned to the memory pool.
  *
- * @note This must only be invoked while holding the SB global lock
+ * @note The count is updated atomically, so this may be invoked without holding
+ * the SB global lock, as long as the caller already holds a reference.
  *
  * @param bd  Pointer to the buffer descriptor.
  */
@@ -507,6 +557,34 @@ void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd);
  */
 void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Decrement the UseCount of a buffer, without holding the SB global lock
+ *
+ * As CFE_SB_DecrBufUseCnt(), but only takes the SB global lock if this drops
+ * the last reference, to return the buffer to the memory pool.
+ *
+ * @note This must not be invoked while counted as an active transmit, see
+ * CFE_SB_TransmitEnter().
+ *
+ * @param bd  Pointer to the buffer descriptor.
+ */
+void CFE_SB_ReleaseBufferRef(CFE_SB_BufferD_t *bd);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Release all buffers held by a pipe from its most recent receive
+ *
+ * A pipe keeps a reference to the buffer(s) it last returned to the application,
+ * either from a single receive or a batched receive, so they remain valid until the
+ * next receive.  This decrements the UseCount of all of them and clears the references.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param PipeDscPtr  Pointer to the pipe descriptor.
+ */
+void CFE_SB_ReleasePipeBuffers(CFE_SB_PipeD_t *PipeDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * SB internal function to validate a given MsgId.
@@ -565,23 +643,26 @@ void CFE_SB_FinishSendEvent(CFE_ES_TaskId_t TaskId, int32 Bit);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * This function gets a destination descriptor from the SB memory pool.
+ * This function gets an empty destination list from the SB memory pool.
  *
  * @note This must only be invoked while holding the SB global lock
- * @return Pointer to the destination descriptor
+ *
+ * @param MaxDests Number of destinations the list must be able to hold
+ *
+ * @return Pointer to the destination list, or NULL if it could not be allocated
  */
-CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
+CFE_SB_DestinationList_t *CFE_SB_GetDestinationBlk(uint16 MaxDests);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * This function returns a destination descriptor to the SB memory pool.
+ * This function returns a destination list to the SB memory pool.
  * @note This must only be invoked while holding the SB global lock
  *
- * @param Dest Pointer to the destination descriptor
+ * @param Dest Pointer to the destination list
  *
  * \return Execution status, see \ref CFEReturnCodes
  */
-int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
+int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationList_t *Dest);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -670,26 +751,161 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  */
 int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Atomically increment a counter, unless it has reached a limit
+ *
+ * \param[inout] Counter Counter to increment
+ * \param[in]    Limit   Value the counter is not incremented beyond
+ *
+ * \returns The value of the counter before the increment, which was only done if less than Limit
+ */
+uint32 CFE_SB_CounterIncrementBelow(uint32 *Counter, uint32 Limit);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Atomically decrement a counter, unless it has reached a limit
+ *
+ * \param[inout] Counter Counter to decrement
+ * \param[in]    Limit   Value the counter is not decremented beyond
+ *
+ * \returns The value of the counter before the decrement, which was only done if greater than Limit
+ */
+uint32 CFE_SB_CounterDecrementAbove(uint32 *Counter, uint32 Limit);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Atomically raise a high water mark to a value, if it is lower
+ *
+ * \param[inout] Counter High water mark to update
+ * \param[in]    Value   New value that the high water mark must be at least
+ */
+void CFE_SB_CounterRaise(uint32 *Counter, uint32 Value);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Count the calling task as an active transmit
+ *
+ * Transmits find their destinations without taking the SB lock.  While counted
+ * as active the routing found remains valid: destination lists and pipes are not
+ * freed or reused until the transmit leaves, see CFE_SB_WaitForTransmits().
+ *
+ * While active, the task must not block on anything that may wait for the SB
+ * lock to be released, including the SB lock itself.
+ *
+ * \returns The epoch the transmit is counted in, to pass to CFE_SB_TransmitLeave()
+ */
+uint32 CFE_SB_TransmitEnter(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Stop counting the calling task as an active transmit
+ *
+ * \param[in] Epoch The value returned by CFE_SB_TransmitEnter()
+ */
+void CFE_SB_TransmitLeave(uint32 Epoch);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Wait for transmits that started before now to finish
+ *
+ * Used after publishing a change to the routing, before freeing anything the
+ * old routing referred to.  Transmits that start during the wait already see
+ * the change, and are not waited for.
+ *
+ * \note This must only be invoked while holding the SB global lock
+ */
+void CFE_SB_WaitForTransmits(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Stop any transmits from using the routing
+ *
+ * Waits for all active transmits to finish, and makes any that start afterward
+ * wait for the SB lock, until CFE_SB_ReleaseTransmits().  This allows a change
+ * to the routing that cannot be published atomically, such as adding a route.
+ *
+ * \note This must only be invoked while holding the SB global lock, which must
+ * not be released before calling CFE_SB_ReleaseTransmits().
+ */
+void CFE_SB_HoldTransmits(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Allow transmits to use the routing again after CFE_SB_HoldTransmits()
+ *
+ * \note This must only be invoked while holding the SB global lock
+ */
+void CFE_SB_ReleaseTransmits(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Add the counters updated by transmits into the housekeeping telemetry
+ *
+ * Transmits do not take the SB lock, so they count errors and messages without
+ * subscribers separately, and these are added into the telemetry by this call.
+ */
+void CFE_SB_CollectTransmitCounters(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Replace the destination list of a route
+ *
+ * Private function that will copy the destinations of the route, except for
+ * OmitPtr, into a new list that can hold the given number of destinations,
+ * and publish it in place of the old list.  The old list is returned to the
+ * pool once no transmit can still be using it, after carrying over the buffer
+ * counts of the destinations that were changed by those transmits.  The route
+ * keeps its old list if the new one cannot be allocated.
+ *
+ * \note MaxDests must not be less than the number of destinations copied
+ *
+ * \param[in] RouteId  The route ID to resize the destination list of
+ * \param[in] MaxDests Number of destinations the new list must be able to hold
+ * \param[in] OmitPtr  Destination of the old list not to copy, or NULL to copy all
+ *
+ * \returns Pointer to the new destination list, NULL if it could not be allocated
+ */
+CFE_SB_DestinationList_t *CFE_SB_ResizeDestList(CFE_SBR_RouteId_t RouteId, uint16 MaxDests,
+                                                 const CFE_SB_DestinationD_t *OmitPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Add a destination node
  *
- * Private function that will add a destination node to the linked list
+ * Private function that will append a copy of the destination to the
+ * destination list of the route.  If the list is full it is replaced by
+ * one twice the size, up to #CFE_PLATFORM_SB_MAX_DEST_PER_PKT entries.
+ * Otherwise the destination is appended in place, and only counted in the
+ * list once it is complete, so concurrent transmits never see it partially
+ * written.
  *
- * \note Assumes destination pointer is valid
+ * \note Assumes the route has fewer than #CFE_PLATFORM_SB_MAX_DEST_PER_PKT
+ * destinations.  Any destination pointer into the list is invalidated by this call.
  *
  * \param[in] RouteId The route ID to add destination node to
  * \param[in] NewNode Pointer to the destination to add
+ *
+ * \returns CFE_SUCCESS, or CFE_SB_BUF_ALOC_ERR if the list could not be grown
  */
-int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNode);
+int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, const CFE_SB_DestinationD_t *NewNode);
 
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Remove a destination node
  *
- * Private function that will remove a destination node from the linked list
+ * Private function that will remove a destination node from the destination
+ * list of the route, keeping the remaining destinations in order.  The list
+ * is returned to the pool when it becomes empty, and replaced by one half the
+ * size when it is no more than a quarter full.
  *
- * \note Assumes destination pointer is valid and in route
+ * Concurrent transmits may be reading the list, so the remaining destinations
+ * are published as a new list, see CFE_SB_ResizeDestList().  If that cannot be
+ * allocated the node is removed in place instead, while transmits are held off
+ * with CFE_SB_HoldTransmits().
+ *
+ * \note Assumes destination pointer is valid and in route.  Any destination
+ * pointer into the list is invalidated by this call.
  *
  * \param[in] RouteId      The route ID to remove destination node from
  * \param[in] NodeToRemove Pointer to the destination to remove
@@ -700,8 +916,9 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
 /**
  * \brief Remove a destination
  *
- * Private function that will remove a destination by removing the node,
- * returning the block, and decrementing counters
+ * Private function that will remove a destination by removing the node
+ * and decrementing counters.  Removing the last destination leaves the
+ * route idle so its routing table element can be reclaimed.
  *
  * \note Assumes destination pointer is valid and in route
  *
@@ -724,6 +941,22 @@ void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr
  */
 CFE_SB_DestinationD_t *CFE_SB_GetDestPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the destination a buffer on a pipe was counted against
+ *
+ * Private function that will return the destination pointer for the route
+ * and PipeId the buffer was delivered through.  Returns NULL if the route has
+ * since been reclaimed for a different MsgId, as the destination found there
+ * would not be the one the buffer was counted against.
+ *
+ * \param[in] BufDscPtr The buffer descriptor
+ * \param[in] PipeId    The pipe ID the buffer was received from
+ *
+ * \returns The destination pointer for a match, NULL otherwise
+ */
+CFE_SB_DestinationD_t *CFE_SB_GetBufferDestPtr(const CFE_SB_BufferD_t *BufDscPtr, CFE_SB_PipeId_t PipeId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Get the size of a message header.
@@ -1084,6 +1317,69 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
  */
 const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Pipe handler function for batched receive transactions
+ *
+ * Helper function to implement reading of a pipe during a batched receive transaction.
+ * This is only used via CFE_SB_MessageTxn_ProcessPipes(), but declared here so it can be
+ * unit tested.
+ *
+ * Reads up to BatchPtr->MaxCount buffers from the pipe with a single OSAL call, verifies
+ * each one (if the transaction is an endpoint), and then exports all of them to the
+ * pipe descriptor under a single acquisition of the SB shared data lock.
+ *
+ * If an error deferred from the previous batch is pending on the pipe, the queue is not
+ * read, and that error is reported instead.
+ *
+ * \sa CFE_SB_MessageTxn_ProcessPipes
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[in]    ContextPtr Pointer to pipe entry within transaction
+ * \param[inout] Arg        Opaque argument for API, should be a CFE_SB_ReceiveBatch_t*
+ * \returns always false to stop the parent loop (receive transactions only read a single pipe)
+ */
+bool CFE_SB_ReceiveTxn_BatchPipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                        void *Arg);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Stores a batch of received buffers in the pipe descriptor
+ *
+ * Performs the same accounting as a single receive for every buffer in the batch, but
+ * with one acquisition of the SB shared data lock.  Buffers that passed verification are
+ * kept in the pipe descriptor until the next receive on the pipe; buffers that did not
+ * are released immediately and removed from the batch.
+ *
+ * If the read also failed partway through the batch, and some buffers were kept, the
+ * error is deferred in the pipe descriptor so that the buffers are returned now and the
+ * error is reported by the next receive on the pipe.
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[in]    ContextPtr Pointer to pipe entry within transaction
+ * \param[inout] BatchPtr   Batch of buffers read from the pipe, compacted to only the accepted buffers
+ */
+void CFE_SB_ReceiveTxn_ExportBatch(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                   CFE_SB_ReceiveBatch_t *BatchPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes a batched receive transaction
+ *
+ * Implements reading of up to MaxCount buffers from the pipe.  Only the first buffer is
+ * subject to the transaction timeout, any others must already be pending on the pipe.
+ * Buffers that were read before an error are still returned, and the transaction
+ * reports success; the error is reported by the next receive on the pipe.
+ *
+ * \param[inout] TxnPtr      Transaction object
+ * \param[out]   BufPtrArray Array to store the buffer pointers that were read
+ * \param[in]    MaxCount    Size of BufPtrArray, limited to #CFE_PLATFORM_SB_MAX_RECEIVE_BATCH
+ * \returns Number of buffers that were read
+ * \retval  0 if no message was read (e.g. if a timeout occurred or polling an empty queue)
+ */
+uint32 CFE_SB_ReceiveTxn_ExecuteBatch(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t **BufPtrArray,
+                                      uint32 MaxCount);
+
 /*
  * Transmit Transaction implementation/helper functions
  * These functions are specific to the transmit-side operation
@@ -1140,6 +1436,9 @@ void CFE_SB_TransmitTxn_SetupFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CF
  * actually successful, then the count must be decremented accordingly, to keep the reference
  * counts correct.
  *
+ * \note The routing is read without the SB lock, so this must be called while counted as an
+ * active transmit, see CFE_SB_TransmitEnter().
+ *
  * \param[inout] TxnPtr    Transaction object
  * \param[inout] BufDscPtr Buffer descriptor that is pending broadcast
  */
@@ -1162,6 +1461,23 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
  */
 bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Settle the buffer accounting at the end of a transmit transaction
+ *
+ * The pipe handler only records queue write failures in the transaction.  This undoes
+ * the optimistic depth, buffer count and use count accounting from
+ * CFE_SB_TransmitTxn_FindDestinations() for those pipes, and updates the corresponding
+ * error counters.  All counters are updated atomically, without the SB lock.
+ *
+ * \note This must be called before the transmit leaves, see CFE_SB_TransmitEnter().
+ * The reference held by the sender is not released here.
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[inout] BufDscPtr Buffer descriptor that was broadcast
+ */
+void CFE_SB_TransmitTxn_Finish(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Executes the transmit transaction
@@ -1178,6 +1494,10 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
  * However, if this returns a non-successful status code then the use count will _not_ be
  * decremented - but this can generally only fail if the passed-in buffer does not validate.
  *
+ * \note The routing is used without taking the SB lock.  The lock is only taken to remove a
+ * zero copy buffer from the ZeroCopyList, and to return the buffer to the pool if no
+ * subscriber still holds it.
+ *
  * \param[inout] TxnPtr    Transaction object
  * \param[inout] BufPtr    Buffer object that is pending to be broadcast
  */
@@ -1462,6 +1782,19 @@ static inline bool CFE_SB_PipeDescIsMatch(const CFE_SB_PipeD_t *PipeDscPtr, CFE_
  */
 bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Checks if a table slot is used by a pipe with the given name
+ *
+ * Helper for looking up pipes by name,
+ * Used in conjunction with CFE_ResourceId_NameIndexFind().
+ *
+ * @param Slot pipe table slot to test
+ * @param Name pipe name to compare against
+ * @returns true if slot is currently in use by a pipe with that name
+ */
+bool CFE_SB_CheckPipeNameSlotMatch(uint32 Slot, const char *Name);
+
 /*
  * Helper functions for background file write requests (callbacks)
  */
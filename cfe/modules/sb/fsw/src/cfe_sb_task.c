@@ -347,6 +347,8 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_SB_SendHkCmd_t *data)
 {
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
+    CFE_SB_CollectTransmitCounters();
+
     CFE_SB_Global.HKTlmMsg.Payload.MemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
     CFE_SB_Global.HKTlmMsg.Payload.UnmarkedMem =
         CFE_PLATFORM_SB_BUF_MEMORY_BYTES - CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse;
@@ -367,6 +369,9 @@ int32 CFE_SB_SendHKTlmCmd(const CFE_SB_SendHkCmd_t *data)
  *-----------------------------------------------------------------*/
 void CFE_SB_ResetCounters(void)
 {
+    /* Take the counts from transmits first, so they are reset as well */
+    CFE_SB_CollectTransmitCounters();
+
     CFE_SB_Global.HKTlmMsg.Payload.CommandCounter                = 0;
     CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter           = 0;
     CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter          = 0;
@@ -582,6 +587,7 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
  *-----------------------------------------------------------------*/
 void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 {
+    CFE_SB_DestinationList_t *          DestList;
     CFE_SB_DestinationD_t *             DestPtr;
     CFE_SB_PipeD_t *                    PipeDscPtr;
     CFE_SB_MsgId_t                      RouteMsgId;
@@ -599,16 +605,16 @@ void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 
     RouteMsgId                      = CFE_SBR_GetMsgId(RouteId);
     RouteBufferPtr->NumDestinations = 0;
+    DestList                        = CFE_SBR_GetDestListHeadPtr(RouteId);
 
     /* If this is a valid route, get the destinations */
-    if (CFE_SB_IsValidMsgId(RouteMsgId))
+    if (CFE_SB_IsValidMsgId(RouteMsgId) && DestList != NULL)
     {
-        DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId);
-
         /* copy relevant data from the destination list into the temp buffer */
-        while (DestPtr != NULL && RouteBufferPtr->NumDestinations < CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+        for (i = 0; i < DestList->NumDests && RouteBufferPtr->NumDestinations < CFE_PLATFORM_SB_MAX_DEST_PER_PKT; ++i)
         {
-            PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+            DestPtr    = &DestList->Dests[i];
+            PipeDscPtr = DestPtr->PipeDscPtr;
 
             /* If invalid id, continue on to next entry */
             if (CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
@@ -627,8 +633,6 @@ void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 
                 ++RouteBufferPtr->NumDestinations;
             }
-
-            DestPtr = DestPtr->Next;
         }
     }
 
@@ -1097,14 +1101,18 @@ int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data)
  *-----------------------------------------------------------------*/
 void CFE_SB_SendRouteSub(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 {
-    CFE_SB_DestinationD_t *destptr;
-    int32                  status;
+    CFE_SB_DestinationList_t *destlist;
+    CFE_SB_DestinationD_t *   destptr;
+    int32                     status;
+    uint16                    i;
 
-    destptr = CFE_SBR_GetDestListHeadPtr(RouteId);
+    destlist = CFE_SBR_GetDestListHeadPtr(RouteId);
 
     /* Loop through destinations */
-    while (destptr != NULL)
+    for (i = 0; destlist != NULL && i < destlist->NumDests; ++i)
     {
+        destptr = &destlist->Dests[i];
+
         if (destptr->Scope == CFE_SB_MSG_GLOBAL)
         {
             /* ...add entry into pkt */
@@ -1129,16 +1137,13 @@ void CFE_SB_SendRouteSub(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
             }
 
             /*
-             * break while loop through destinations, onto next route
+             * break loop through destinations, onto next route
              * This is done because we want only one network subscription per msgid
              * Later when Qos is used, we may want to take just the highest priority
              * subscription if there are more than one
              */
             break;
         }
-
-        /* Advance to next destination */
-        destptr = destptr->Next;
     }
 }
 
@@ -48,6 +48,12 @@
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH < 1
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be less than 1!
+#elif CFE_PLATFORM_SB_MAX_RECEIVE_BATCH > 65535
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be greater than 65535!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
 #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
@@ -75,6 +75,17 @@ const CFE_SB_MsgId_t SB_UT_TLM_MID4 = CFE_SB_MSGID_WRAP_VALUE(SB_UT_TLM_MID_VALU
 const CFE_SB_MsgId_t SB_UT_TLM_MID5 = CFE_SB_MSGID_WRAP_VALUE(SB_UT_TLM_MID_VALUE_BASE + 5);
 const CFE_SB_MsgId_t SB_UT_TLM_MID6 = CFE_SB_MSGID_WRAP_VALUE(SB_UT_TLM_MID_VALUE_BASE + 6);
 
+/*
+ * Storage for a destination list with more entries than SB allows, used to
+ * emulate a hypothetical bug in the destination bookkeeping
+ */
+typedef union
+{
+    CFE_SB_DestinationList_t List;
+    uint8                    Storage[sizeof(CFE_SB_DestinationList_t) +
+                  (sizeof(CFE_SB_DestinationD_t) * (CFE_PLATFORM_SB_MAX_DEST_PER_PKT + 1))];
+} SB_UT_LongDestList_t;
+
 /* Normal dispatching registers the MsgID+CC in order to follow a
  * certain path through a series of switch statements */
 #define SB_UT_MID_DISPATCH(intf) \
@@ -207,6 +218,7 @@ void UtTest_Setup(void)
     Test_Unsubscribe_API();
     Test_TransmitMsg_API();
     Test_ReceiveBuffer_API();
+    Test_ReceiveBufferBatch_API();
     SB_UT_ADD_SUBTEST(Test_CleanupApp_API);
     Test_SB_Utils();
 
@@ -537,10 +549,15 @@ void Test_SB_Cmds_RstCtrs(void)
 
     memset(&ResetCounters, 0, sizeof(ResetCounters));
 
+    /* Counters kept by transmits are reset too */
+    CFE_SB_Global.Transmit.PipeOverflowErrorCounter = 1;
+
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(ResetCounters.SBBuf), sizeof(ResetCounters.Cmd),
                     UT_TPID_CFE_SB_CMD_RESET_COUNTERS_CC);
 
     CFE_UtAssert_EVENTCOUNT(1);
+    UtAssert_ZERO(CFE_SB_Global.Transmit.PipeOverflowErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_CMD1_RCVD_EID);
 
@@ -681,8 +698,8 @@ void Test_SB_Cmds_RoutingInfoDataGetter(void)
     size_t                           LocalBufSize;
     CFE_SB_BackgroundFileStateInfo_t State;
     CFE_SB_PipeD_t *                 PipeDscPtr;
-    CFE_SB_DestinationD_t *          DestPtr;
-    CFE_SB_DestinationD_t *          DestPtrSave;
+    CFE_SB_DestinationList_t *       DestList;
+    SB_UT_LongDestList_t             LongList;
 
     /* Create some map info */
     CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1"));
@@ -717,12 +734,17 @@ void Test_SB_Cmds_RoutingInfoDataGetter(void)
         CFE_SB_WriteRouteInfoDataGetter(&State, CFE_PLATFORM_SB_MAX_MSG_IDS, &LocalBuffer, &LocalBufSize));
     UtAssert_ZERO(LocalBufSize);
 
-    /* Hit max destination limit by corrupting head pointer, point to self (bug avoidance code) */
-    DestPtr       = CFE_SBR_GetDestListHeadPtr(CFE_SBR_ValueToRouteId(1));
-    DestPtrSave   = DestPtr->Next;
-    DestPtr->Next = DestPtr;
+    /* Hit max destination limit by substituting an overlong list (bug avoidance code) */
+    DestList = CFE_SBR_GetDestListHeadPtr(CFE_SBR_ValueToRouteId(1));
+    for (i = 0; i <= CFE_PLATFORM_SB_MAX_DEST_PER_PKT; i++)
+    {
+        LongList.List.Dests[i] = DestList->Dests[0];
+    }
+    LongList.List.NumDests = CFE_PLATFORM_SB_MAX_DEST_PER_PKT + 1;
+    LongList.List.MaxDests = CFE_PLATFORM_SB_MAX_DEST_PER_PKT + 1;
+    CFE_SBR_SetDestListHeadPtr(CFE_SBR_ValueToRouteId(1), &LongList.List);
     UtAssert_VOIDCALL(CFE_SB_CollectRouteInfo(CFE_SBR_ValueToRouteId(1), &State));
-    DestPtr->Next = DestPtrSave;
+    CFE_SBR_SetDestListHeadPtr(CFE_SBR_ValueToRouteId(1), DestList);
 
     /* Hit invalid PipeId case by corrupting PipeId (bug avoidance code) */
     PipeDscPtr         = CFE_SB_LocatePipeDescByID(PipeId1);
@@ -1333,11 +1355,17 @@ void Test_SB_Cmds_SendHK(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgIdCmd, sizeof(MsgIdCmd), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
+    /* Counters kept by transmits since the last HK are folded into the packet */
+    CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter = 1;
+    CFE_SB_Global.Transmit.MsgLimitErrorCounter         = 2;
+
     CFE_SB_ProcessCmdPipePkt(&Housekeeping.SBBuf);
 
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter, 3);
+    UtAssert_ZERO(CFE_SB_Global.Transmit.MsgLimitErrorCounter);
 }
 
 /*
@@ -2073,16 +2101,14 @@ void Test_GetPipeIdByName_InvalidName(void)
     CFE_SB_PipeId_t PipeIdOut;
     osal_id_t       OtherQueueId;
 
-    UT_SetDeferredRetcode(UT_KEY(OS_QueueGetIdByName), 1, OS_ERR_NAME_NOT_FOUND);
     UtAssert_INT32_EQ(CFE_SB_GetPipeIdByName(&PipeIdOut, "invalid"), CFE_SB_BAD_ARGUMENT);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID);
     UT_ClearEventHistory();
 
-    /* Set up a test case where OS_QueueGetIdByName() succeeds but returns an ID that
-       is not an SB pipe (i.e. if it was a queue belonging to some app other than SB) */
+    /* Set up a test case where the name is of a queue that is not an
+       SB pipe (i.e. if it was a queue belonging to some app other than SB) */
     CFE_UtAssert_SETUP(OS_QueueCreate(&OtherQueueId, "nonsb", 4, 4, 0));
-    UT_SetDataBuffer(UT_KEY(OS_QueueGetIdByName), &OtherQueueId, sizeof(OtherQueueId), false);
 
     UtAssert_INT32_EQ(CFE_SB_GetPipeIdByName(&PipeIdOut, "nonsb"), CFE_SB_BAD_ARGUMENT);
     CFE_UtAssert_EVENTSENT(CFE_SB_GETPIPEIDBYNAME_NAME_ERR_EID);
@@ -2099,11 +2125,9 @@ void Test_GetPipeIdByName(void)
 
     CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
 
-    UT_SetDataBuffer(UT_KEY(OS_QueueGetIdByName), &(CFE_SB_Global.PipeTbl[0].SysQueueId),
-                     sizeof(CFE_SB_Global.PipeTbl[0].SysQueueId), false);
-
     CFE_UtAssert_SUCCESS(CFE_SB_GetPipeIdByName(&PipeIdOut, "TestPipe1"));
     CFE_UtAssert_EVENTSENT(CFE_SB_GETPIPEIDBYNAME_EID);
+    CFE_UtAssert_RESOURCEID_EQ(PipeIdOut, PipeId);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -2219,6 +2243,7 @@ void Test_Subscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Subscribe_DuplicateSubscription);
     SB_UT_ADD_SUBTEST(Test_Subscribe_LocalSubscription);
     SB_UT_ADD_SUBTEST(Test_Subscribe_MaxDestCount);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_DestListGrowth);
     SB_UT_ADD_SUBTEST(Test_Subscribe_MaxMsgIdCount);
     SB_UT_ADD_SUBTEST(Test_Subscribe_SendPrevSubs);
     SB_UT_ADD_SUBTEST(Test_Subscribe_PipeNonexistent);
@@ -2400,6 +2425,78 @@ void Test_Subscribe_MaxDestCount(void)
     }
 }
 
+/*
+** Test that the destination list of a route grows as pipes subscribe to it
+*/
+void Test_Subscribe_DestListGrowth(void)
+{
+    CFE_SB_PipeId_t           PipeId[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+    CFE_SB_MsgId_t            MsgId = SB_UT_TLM_MID;
+    CFE_SBR_RouteId_t         RouteId;
+    CFE_SB_DestinationList_t *DestList;
+    char                      PipeName[OS_MAX_API_NAME];
+    uint16                    PipeDepth = 10;
+    uint16                    ExpMax;
+    int32                     i;
+
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_DEST_PER_PKT; i++)
+    {
+        snprintf(PipeName, sizeof(PipeName), "TestPipe%ld", (long)i);
+        CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId[i], PipeDepth, PipeName));
+    }
+
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId[0]));
+    RouteId  = CFE_SBR_GetRouteId(MsgId);
+    DestList = CFE_SBR_GetDestListHeadPtr(RouteId);
+    UtAssert_UINT32_EQ(DestList->NumDests, 1);
+    UtAssert_UINT32_EQ(DestList->MaxDests, 1);
+
+    /* A failure to grow the list leaves the existing destinations alone */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    UtAssert_INT32_EQ(CFE_SB_Subscribe(MsgId, PipeId[1]), CFE_SB_BUF_ALOC_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_DEST_BLK_ERR_EID);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(RouteId), DestList);
+    UtAssert_UINT32_EQ(DestList->NumDests, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse, 1);
+
+    /* Start from a capacity that does not double evenly into the per-route limit */
+    ExpMax = (CFE_PLATFORM_SB_MAX_DEST_PER_PKT / 2) + 1;
+    UtAssert_NOT_NULL(CFE_SB_ResizeDestList(RouteId, ExpMax, NULL));
+
+    /* Capacity doubles each time the list fills, up to the per-route limit */
+    for (i = 1; i < CFE_PLATFORM_SB_MAX_DEST_PER_PKT; i++)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId[i]));
+
+        if (i >= ExpMax)
+        {
+            ExpMax *= 2;
+        }
+        if (ExpMax > CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+        {
+            ExpMax = CFE_PLATFORM_SB_MAX_DEST_PER_PKT;
+        }
+
+        DestList = CFE_SBR_GetDestListHeadPtr(RouteId);
+        UtAssert_UINT32_EQ(DestList->NumDests, i + 1);
+        UtAssert_UINT32_EQ(DestList->MaxDests, ExpMax);
+    }
+
+    /* Destinations stay in subscription order, with the pipe descriptor cached */
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_DEST_PER_PKT; i++)
+    {
+        CFE_UtAssert_RESOURCEID_EQ(DestList->Dests[i].PipeId, PipeId[i]);
+        UtAssert_ADDRESS_EQ(DestList->Dests[i].PipeDscPtr, CFE_SB_LocatePipeDescByID(PipeId[i]));
+    }
+
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_DEST_PER_PKT; i++)
+    {
+        CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId[i]));
+    }
+
+    UtAssert_NULL(CFE_SBR_GetDestListHeadPtr(RouteId));
+}
+
 /*
 ** Test message subscription response to reaching the maximum message ID count
 */
@@ -2592,6 +2689,8 @@ void Test_Unsubscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_FirstDestWithMany);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_MiddleDestWithMany);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_GetDestPtr);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_ReleasesRoute);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_DestListShrink);
 }
 
 /*
@@ -2883,6 +2982,100 @@ void Test_Unsubscribe_GetDestPtr(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(TestPipe2));
 }
 
+/*
+** Test that removing the last subscription to a message ID frees its
+** routing table element for a new message ID
+*/
+void Test_Unsubscribe_ReleasesRoute(void)
+{
+    CFE_SB_PipeId_t PipeId    = CFE_SB_INVALID_PIPE;
+    uint16          PipeDepth = 50;
+    int32           i;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_MSG_IDS; i++)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(1 + i), PipeId));
+    }
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, CFE_PLATFORM_SB_MAX_MSG_IDS);
+    UtAssert_INT32_EQ(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(1 + i), PipeId), CFE_SB_MAX_MSGS_MET);
+
+    /* Removing a subscription makes room for a different message ID */
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(CFE_SB_ValueToMsgId(1), PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, CFE_PLATFORM_SB_MAX_MSG_IDS - 1);
+    CFE_UtAssert_SUCCESS(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(1 + i), PipeId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, CFE_PLATFORM_SB_MAX_MSG_IDS);
+
+    /* The unsubscribed message ID no longer has a route */
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(1))));
+    UtAssert_INT32_EQ(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(1), PipeId), CFE_SB_MAX_MSGS_MET);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse);
+}
+
+/*
+** Test that the destination list of a route shrinks as pipes unsubscribe from it
+*/
+void Test_Unsubscribe_DestListShrink(void)
+{
+    CFE_SB_PipeId_t           PipeId[4];
+    CFE_SB_MsgId_t            MsgId = SB_UT_TLM_MID;
+    CFE_SBR_RouteId_t         RouteId;
+    CFE_SB_DestinationList_t *DestList;
+    char                      PipeName[OS_MAX_API_NAME];
+    uint16                    PipeDepth = 10;
+    int32                     i;
+
+    for (i = 0; i < 4; i++)
+    {
+        snprintf(PipeName, sizeof(PipeName), "TestPipe%ld", (long)i);
+        CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId[i], PipeDepth, PipeName));
+        CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId[i]));
+    }
+
+    RouteId  = CFE_SBR_GetRouteId(MsgId);
+    DestList = CFE_SBR_GetDestListHeadPtr(RouteId);
+    UtAssert_UINT32_EQ(DestList->MaxDests, 4);
+
+    /* Removing from the middle or the end publishes a copy that keeps the remaining order */
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId[1]));
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId[3]));
+    UtAssert_NOT_NULL(DestList = CFE_SBR_GetDestListHeadPtr(RouteId));
+    UtAssert_UINT32_EQ(DestList->NumDests, 2);
+    UtAssert_UINT32_EQ(DestList->MaxDests, 4);
+    CFE_UtAssert_RESOURCEID_EQ(DestList->Dests[0].PipeId, PipeId[0]);
+    CFE_UtAssert_RESOURCEID_EQ(DestList->Dests[1].PipeId, PipeId[2]);
+
+    /* A failure to allocate the copy removes the entry from the current list in place */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId[0]));
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(RouteId), DestList);
+    UtAssert_UINT32_EQ(DestList->NumDests, 1);
+    UtAssert_UINT32_EQ(DestList->MaxDests, 4);
+    CFE_UtAssert_RESOURCEID_EQ(DestList->Dests[0].PipeId, PipeId[2]);
+
+    /* Once no more than a quarter full, the list is replaced by one half the size */
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId[0]));
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId[0]));
+    DestList = CFE_SBR_GetDestListHeadPtr(RouteId);
+    UtAssert_UINT32_EQ(DestList->NumDests, 1);
+    UtAssert_UINT32_EQ(DestList->MaxDests, 2);
+    CFE_UtAssert_RESOURCEID_EQ(DestList->Dests[0].PipeId, PipeId[2]);
+
+    /* The last unsubscribe releases the list */
+    CFE_UtAssert_SUCCESS(CFE_SB_Unsubscribe(MsgId, PipeId[2]));
+    UtAssert_NULL(CFE_SBR_GetDestListHeadPtr(RouteId));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse);
+
+    for (i = 0; i < 4; i++)
+    {
+        CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId[i]));
+    }
+}
+
 void Test_TransmitTxn_Init(void)
 {
     /* Test case for:
@@ -3067,6 +3260,9 @@ void Test_TransmitTxn_FindDestinations(void)
     CFE_SB_MsgId_t             MsgId  = SB_UT_TLM_MID;
     CFE_SBR_RouteId_t          RouteId;
     CFE_SB_DestinationD_t *    DestPtr;
+    CFE_SB_DestinationList_t * DestList;
+    SB_UT_LongDestList_t       LongList;
+    uint16                     i;
 
     memset(&BufDsc, 0, sizeof(BufDsc));
     CFE_SB_TrackingListReset(&BufDsc.Link); /* so tracking list ops work */
@@ -3079,12 +3275,12 @@ void Test_TransmitTxn_FindDestinations(void)
     Txn                        = CFE_SB_TransmitTxn_Init(&TxnBuf, &BufDsc.Content);
     PipeDscPtr->PeakQueueDepth = 1;
 
-    CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter = 0;
+    CFE_SB_Global.Transmit.NoSubscribersCounter = 0;
 
     /* No subscriber case */
     Txn->RoutingMsgId = CFE_SB_INVALID_MSG_ID;
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_FindDestinations(Txn, &BufDsc));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.NoSubscribersCounter, 1);
     UtAssert_UINT32_EQ(Txn->TransactionEventId, CFE_SB_SEND_NO_SUBS_EID);
     UtAssert_UINT32_EQ(BufDsc.UseCount, 0);
 
@@ -3169,13 +3365,20 @@ void Test_TransmitTxn_FindDestinations(void)
     CFE_ES_GetAppID(&PipeDscPtr->AppId);
     PipeDscPtr->Opts &= ~CFE_SB_PIPEOPTS_IGNOREMINE;
 
-    /* DestPtr List too long - this emulates a hypothetical bug in SBR allowing list to grow too long */
-    /* Hack to make it infinite length */
-    DestPtr->Next     = DestPtr;
+    /* DestPtr List too long - this emulates a hypothetical bug in SB allowing list to grow too long */
+    DestList = CFE_SBR_GetDestListHeadPtr(RouteId);
+    for (i = 0; i <= CFE_PLATFORM_SB_MAX_DEST_PER_PKT; i++)
+    {
+        LongList.List.Dests[i] = *DestPtr;
+    }
+    LongList.List.NumDests = CFE_PLATFORM_SB_MAX_DEST_PER_PKT + 1;
+    LongList.List.MaxDests = CFE_PLATFORM_SB_MAX_DEST_PER_PKT + 1;
+    CFE_SBR_SetDestListHeadPtr(RouteId, &LongList.List);
     Txn               = CFE_SB_TransmitTxn_Init(&TxnBuf, &BufDsc.Content);
     Txn->RoutingMsgId = MsgId;
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_FindDestinations(Txn, &BufDsc));
     UtAssert_UINT32_EQ(Txn->NumPipes, CFE_PLATFORM_SB_MAX_DEST_PER_PKT);
+    CFE_SBR_SetDestListHeadPtr(RouteId, DestList);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -3234,6 +3437,71 @@ void Test_TransmitTxn_PipeHandler(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+void Test_TransmitTxn_Finish(void)
+{
+    /* Test function for:
+     * void CFE_SB_TransmitTxn_Finish(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
+     */
+
+    CFE_SB_TransmitTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_SB_PipeId_t            PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t             MsgId  = SB_UT_TLM_MID;
+    CFE_SB_BufferD_t           SBBufD;
+    CFE_SB_PipeD_t *           PipeDscPtr;
+    CFE_SB_DestinationD_t *    DestPtr;
+
+    memset(&SBBufD, 0, sizeof(SBBufD));
+    memset(&TxnBuf, 0, sizeof(TxnBuf));
+    CFE_SB_TrackingListReset(&SBBufD.Link); /* so tracking list ops work */
+    Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, &SBBufD.Content);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 3, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+
+    SBBufD.MsgId       = MsgId;
+    SBBufD.DestRouteId = CFE_SBR_GetRouteId(MsgId);
+    PipeDscPtr         = CFE_SB_LocatePipeDescByID(PipeId);
+    DestPtr            = CFE_SB_GetDestPtr(SBBufD.DestRouteId, PipeId);
+
+    CFE_SB_Global.Transmit.PipeOverflowErrorCounter = 0;
+    CFE_SB_Global.Transmit.InternalErrorCounter     = 0;
+
+    /* All writes successful - nothing to undo, the sender reference is released by the caller */
+    PipeDscPtr->CurrentQueueDepth = 1;
+    DestPtr->BuffCount            = 1;
+    SBBufD.UseCount               = 2;
+    Txn->NumPipes                 = 1;
+    Txn->PipeSet[0].PipeId        = PipeId;
+    Txn->PipeSet[0].DestPtr       = DestPtr;
+    UtAssert_VOIDCALL(CFE_SB_TransmitTxn_Finish(Txn, &SBBufD));
+    UtAssert_UINT32_EQ(SBBufD.UseCount, 2);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+
+    /* Mixed failures, including a msg limit entry which must not be undone */
+    PipeDscPtr->CurrentQueueDepth  = 2;
+    DestPtr->BuffCount             = 2;
+    SBBufD.UseCount                = 3;
+    Txn->NumPipes                  = 3;
+    Txn->NumPipeErrs               = 3;
+    Txn->PipeSet[0].OsStatus       = OS_QUEUE_FULL;
+    Txn->PipeSet[1].PipeId         = PipeId;
+    Txn->PipeSet[1].DestPtr        = DestPtr;
+    Txn->PipeSet[1].OsStatus       = OS_ERROR;
+    Txn->PipeSet[2].PipeId         = PipeId;
+    Txn->PipeSet[2].DestPtr        = DestPtr;
+    Txn->PipeSet[2].PendingEventId = CFE_SB_MSGID_LIM_ERR_EID;
+    UtAssert_VOIDCALL(CFE_SB_TransmitTxn_Finish(Txn, &SBBufD));
+    UtAssert_UINT32_EQ(SBBufD.UseCount, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.PipeOverflowErrorCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.InternalErrorCounter, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 void Test_TransmitTxn_Execute(void)
 {
     /* Test case for:
@@ -3443,29 +3711,29 @@ void Test_MessageTxn_ReportEvents(void)
 
     /* nominal */
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Transmit.MsgSendErrorCounter);
 
     /* with an event at the transaction level, known to be an error */
     Txn.TransactionEventId = CFE_SB_MSG_TOO_BIG_EID;
     Txn.IsTransmit         = true;
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.MsgSendErrorCounter, 1);
 
     /* with some undefined/unknown event at the transaction level, not an error */
     Txn.TransactionEventId = 0xFFFF;
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.MsgSendErrorCounter, 1);
 
     /* with an event at the pipe level, known to be an error */
     Txn.TransactionEventId        = 0;
     Txn.PipeSet[0].PendingEventId = CFE_SB_Q_FULL_ERR_EID;
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.MsgSendErrorCounter, 2);
 
     /* with some undefined/unknown event at the pipe level, not an error */
     Txn.PipeSet[0].PendingEventId = 0xFFFF;
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.MsgSendErrorCounter, 2);
 }
 
 /*
@@ -3497,6 +3765,7 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_Init);
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_FindDestinations);
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_PipeHandler);
+    SB_UT_ADD_SUBTEST(Test_TransmitTxn_Finish);
     SB_UT_ADD_SUBTEST(Test_TransmitTxn_Execute);
 
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
@@ -3549,14 +3818,14 @@ void Test_TransmitMsg_MaxMsgSizePlusOne(void)
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter = 0;
+    CFE_SB_Global.Transmit.MsgSendErrorCounter = 0;
 
     UtAssert_INT32_EQ(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true), CFE_SB_MSG_TOO_BIG);
 
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_MSG_TOO_BIG_EID);
-    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+    UtAssert_INT32_EQ(CFE_SB_Global.Transmit.MsgSendErrorCounter, 1);
 }
 
 /*
@@ -4421,6 +4690,389 @@ void Test_ReceiveBuffer_InvalidBufferPtr(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Function for calling SB batched receive API test functions
+*/
+void Test_ReceiveBufferBatch_API(void)
+{
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_Nominal);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_InvalidArgs);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_NoMessage);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_PipeReadError);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch_VerifyFail);
+    SB_UT_ADD_SUBTEST(Test_ReceiveTxn_ExportBatch);
+}
+
+/* Sends the given number of telemetry packets to a pipe subscribed to SB_UT_TLM_MID */
+static void SB_UT_SendTlmPackets(SB_UT_Test_Tlm_t *TlmPkt, uint32 NumPkts)
+{
+    CFE_SB_MsgId_t MsgId = SB_UT_TLM_MID;
+    CFE_MSG_Size_t Size  = sizeof(*TlmPkt);
+    CFE_MSG_Type_t Type  = CFE_MSG_Type_Tlm;
+    uint32         i;
+
+    for (i = 0; i < NumPkts; ++i)
+    {
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt->TelemetryHeader), true));
+    }
+}
+
+/*
+** Test receiving several messages from the software bus in one call
+*/
+void Test_ReceiveBufferBatch_Nominal(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    uint32           Count;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(SB_UT_TLM_MID, PipeId, CFE_SB_DEFAULT_QOS, 10));
+
+    /* Batch is limited by what is pending on the pipe */
+    SB_UT_SendTlmPackets(&TlmPkt, 3);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 3);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(Count, 3);
+    UtAssert_UINT32_EQ(PipeDscPtr->LastBatchCount, 3);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBatch[0]->Content, SBBufPtrs[0]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBatch[2]->Content, SBBufPtrs[2]);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 3);
+
+    /* Batch is limited by the caller, and the previous batch is released */
+    SB_UT_SendTlmPackets(&TlmPkt, 3);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 2, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_UINT32_EQ(PipeDscPtr->LastBatchCount, 2);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 3);
+
+    /* A single receive also releases the previous batch */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_ZERO(PipeDscPtr->LastBatchCount);
+    UtAssert_NOT_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    /* Caller asking for more than the configured limit is not an error */
+    SB_UT_SendTlmPackets(&TlmPkt, 1);
+    CFE_UtAssert_SUCCESS(
+        CFE_SB_ReceiveBufferBatch(SBBufPtrs, CFE_PLATFORM_SB_MAX_RECEIVE_BATCH + 1, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_NULL(PipeDscPtr->LastBuffer);
+
+    /* Empty pipe releases everything */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_ZERO(Count);
+    UtAssert_ZERO(PipeDscPtr->LastBatchCount);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    /* Deleting the pipe releases a batch still held by it */
+    SB_UT_SendTlmPackets(&TlmPkt, 2);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 2);
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+}
+
+/*
+** Test batched receive with invalid arguments
+*/
+void Test_ReceiveBufferBatch_InvalidArgs(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    uint32           Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+
+    Count = 1;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(NULL, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_ZERO(Count);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, NULL, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 0, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, -5), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, SB_UT_ALTERNATE_INVALID_PIPEID, CFE_SB_POLL),
+                      CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    UtAssert_STUB_COUNT(OS_QueueGetBatch, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test batched receive when no message arrives
+*/
+void Test_ReceiveBufferBatch_NoMessage(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    uint32           Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_ZERO(Count);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGetBatch), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, 200), CFE_SB_TIME_OUT);
+    UtAssert_ZERO(Count);
+
+    CFE_UtAssert_EVENTCOUNT(1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_PIPE_ADDED_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/* Returns a NULL buffer descriptor followed by the real content of the queue */
+static void SB_UT_QueueGetBatchNullHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_BufferD_t **data         = UT_Hook_GetArgValueByName(Context, "data", void *);
+    osal_id_t          queue_id     = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t);
+    uint32 *           items_copied = UT_Hook_GetArgValueByName(Context, "items_copied", uint32 *);
+    int32              status       = OS_SUCCESS;
+
+    data[0]       = NULL;
+    *items_copied = 1;
+    if (UT_Stub_CopyToLocal((UT_EntryKey_t)OS_ObjectIdToInteger(queue_id), &data[1], sizeof(data[1])) ==
+        sizeof(data[1]))
+    {
+        ++(*items_copied);
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/* Returns the real content of the queue followed by a short item, which OSAL counts as the last item */
+static void SB_UT_QueueGetBatchShortHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_BufferD_t **data         = UT_Hook_GetArgValueByName(Context, "data", void *);
+    osal_id_t          queue_id     = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t);
+    uint32 *           items_copied = UT_Hook_GetArgValueByName(Context, "items_copied", uint32 *);
+    int32              status       = OS_QUEUE_INVALID_SIZE;
+
+    *items_copied = 0;
+    if (UT_Stub_CopyToLocal((UT_EntryKey_t)OS_ObjectIdToInteger(queue_id), &data[0], sizeof(data[0])) ==
+        sizeof(data[0]))
+    {
+        ++(*items_copied);
+    }
+
+    data[*items_copied] = NULL;
+    ++(*items_copied);
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+** Test batched receive with errors reading the pipe
+*/
+void Test_ReceiveBufferBatch_PipeReadError(void)
+{
+    CFE_SB_Buffer_t *SBBufPtrs[4];
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    uint32           Count;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID, PipeId));
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGetBatch), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_PEND_FOREVER),
+                      CFE_SB_PIPE_RD_ERR);
+    UtAssert_ZERO(Count);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+
+    /* A NULL entry is an error, but the valid buffer is still returned, and the error is reported next time */
+    SB_UT_SendTlmPackets(&TlmPkt, 1);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGetBatch), SB_UT_QueueGetBatchNullHandler, NULL);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_PEND_FOREVER));
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGetBatch), NULL, NULL);
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->LastBatchCount, 1);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBatch[0]->Content, SBBufPtrs[0]);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+    UtAssert_INT32_EQ(PipeDscPtr->DeferredOsStatus, OS_ERROR);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_PIPE_RD_ERR);
+    UtAssert_ZERO(Count);
+    UtAssert_STUB_COUNT(OS_QueueGetBatch, 2);
+    UtAssert_ZERO(PipeDscPtr->LastBatchCount);
+    UtAssert_INT32_EQ(PipeDscPtr->DeferredOsStatus, OS_SUCCESS);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 2);
+
+    /* A short item ends the batch, it is not exported but the buffer before it is */
+    SB_UT_SendTlmPackets(&TlmPkt, 1);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGetBatch), SB_UT_QueueGetBatchShortHandler, NULL);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL));
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGetBatch), NULL, NULL);
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBatch[0]->Content, SBBufPtrs[0]);
+    UtAssert_INT32_EQ(PipeDscPtr->DeferredOsStatus, OS_QUEUE_INVALID_SIZE);
+
+    /* A deferred error is also reported by a single receive, without reading the queue */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_PIPE_RD_ERR);
+    UtAssert_STUB_COUNT(OS_QueueGet, 0);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 3);
+
+    /* A short item on its own is just an error */
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGetBatch), SB_UT_QueueGetBatchShortHandler, NULL);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_PIPE_RD_ERR);
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGetBatch), NULL, NULL);
+    UtAssert_ZERO(Count);
+    UtAssert_INT32_EQ(PipeDscPtr->DeferredOsStatus, OS_SUCCESS);
+    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 4);
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test batched receive where some buffers fail verification
+*/
+void Test_ReceiveBufferBatch_VerifyFail(void)
+{
+    CFE_SB_Buffer_t *          SBBufPtrs[4];
+    CFE_SB_PipeId_t            PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t           TlmPkt;
+    CFE_SB_PipeD_t *           PipeDscPtr;
+    uint32                     Count;
+    CFE_SB_ReceiveTxn_State_t  TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID, PipeId));
+
+    /* Alternating verification result - the 1st and 3rd buffers are dropped */
+    SB_UT_SendTlmPackets(&TlmPkt, 3);
+    UT_SetHandlerFunction(UT_KEY(CFE_MSG_VerificationAction), UT_CFE_MSG_Verify_CustomHandler, NULL);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->LastBatchCount, 1);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBatch[0]->Content, SBBufPtrs[0]);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, 1);
+
+    /* If all buffers fail verification, the pipe is read again */
+    SB_UT_SendTlmPackets(&TlmPkt, 1);
+    UT_ResetState(UT_KEY(CFE_MSG_VerificationAction));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_VerificationAction), CFE_MSG_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(SBBufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_ZERO(Count);
+    UtAssert_STUB_COUNT(OS_QueueGetBatch, 3);
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
+
+    /* Non-endpoint transactions are not verified */
+    UT_ResetState(UT_KEY(CFE_MSG_VerificationAction));
+    SB_UT_SendTlmPackets(&TlmPkt, 1);
+    Txn = CFE_SB_ReceiveTxn_Init(&TxnBuf, SBBufPtrs);
+    CFE_SB_ReceiveTxn_SetPipeId(Txn, PipeId);
+    CFE_SB_MessageTxn_SetEndpoint(Txn, false);
+    UtAssert_UINT32_EQ(CFE_SB_ReceiveTxn_ExecuteBatch(Txn, SBBufPtrs, 4), 1);
+    UtAssert_STUB_COUNT(CFE_MSG_VerificationAction, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test storing a batch of buffers in a pipe descriptor
+*/
+void Test_ReceiveTxn_ExportBatch(void)
+{
+    /* Test function for:
+     * void CFE_SB_ReceiveTxn_ExportBatch(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+     *                                    CFE_SB_ReceiveBatch_t *BatchPtr);
+     */
+    CFE_SB_ReceiveTxn_State_t  TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_SB_ReceiveBatch_t      Batch;
+    CFE_SB_BufferD_t           SBBufD[2];
+    CFE_SB_PipeId_t            PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t *           PipeDscPtr;
+    void *                     RefPtr;
+
+    memset(&TxnBuf, 0, sizeof(TxnBuf));
+    memset(&Batch, 0, sizeof(Batch));
+    memset(SBBufD, 0, sizeof(SBBufD));
+    CFE_SB_TrackingListReset(&SBBufD[0].Link);
+    CFE_SB_TrackingListReset(&SBBufD[1].Link);
+
+    RefPtr = &Batch;
+    Txn    = CFE_SB_ReceiveTxn_Init(&TxnBuf, &RefPtr);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 3, "TestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    /* Nominal, one accepted and one dropped - the dropped one is removed from the batch */
+    SBBufD[0].UseCount            = 2;
+    SBBufD[1].UseCount            = 2;
+    SBBufD[0].DestRouteId         = CFE_SBR_INVALID_ROUTE_ID;
+    SBBufD[1].DestRouteId         = CFE_SBR_INVALID_ROUTE_ID;
+    PipeDscPtr->CurrentQueueDepth = 2;
+    Txn->PipeSet->PipeId          = PipeId;
+    Batch.Count                   = 2;
+    Batch.BufDscPtrs[0]           = &SBBufD[0];
+    Batch.IsAcceptable[0]         = false;
+    Batch.BufDscPtrs[1]           = &SBBufD[1];
+    Batch.IsAcceptable[1]         = true;
+    UtAssert_VOIDCALL(CFE_SB_ReceiveTxn_ExportBatch(Txn, Txn->PipeSet, &Batch));
+    UtAssert_UINT32_EQ(Batch.Count, 1);
+    UtAssert_UINT32_EQ(Batch.Dropped, 1);
+    UtAssert_ADDRESS_EQ(Batch.BufDscPtrs[0], &SBBufD[1]);
+    UtAssert_UINT32_EQ(PipeDscPtr->LastBatchCount, 1);
+    UtAssert_ADDRESS_EQ(PipeDscPtr->LastBatch[0], &SBBufD[1]);
+    UtAssert_UINT32_EQ(SBBufD[0].UseCount, 1);
+    UtAssert_UINT32_EQ(SBBufD[1].UseCount, 2);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+    CFE_UtAssert_SUCCESS(CFE_SB_MessageTxn_GetStatus(Txn));
+
+    /* Pipe no longer matches (deleted while reading) - everything is released */
+    PipeDscPtr->LastBatchCount = 0;
+    SBBufD[0].UseCount         = 2;
+    Batch.Count                = 1;
+    Batch.Dropped              = 0;
+    Batch.BufDscPtrs[0]        = &SBBufD[0];
+    Batch.IsAcceptable[0]      = true;
+    Txn->PipeSet->PipeId       = SB_UT_ALTERNATE_INVALID_PIPEID;
+    UtAssert_VOIDCALL(CFE_SB_ReceiveTxn_ExportBatch(Txn, Txn->PipeSet, &Batch));
+    UtAssert_ZERO(Batch.Count);
+    UtAssert_ZERO(Batch.Dropped);
+    UtAssert_UINT32_EQ(SBBufD[0].UseCount, 1);
+    UtAssert_ZERO(PipeDscPtr->LastBatchCount);
+    UtAssert_INT32_EQ(CFE_SB_MessageTxn_GetStatus(Txn), CFE_SB_PIPE_RD_ERR);
+    UtAssert_UINT32_EQ(Txn->PipeSet->PendingEventId, CFE_SB_BAD_PIPEID_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test SB Utility APIs
 */
@@ -4720,7 +5372,9 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_CFE_SB_Buffers);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_BadPipeInfo);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_UnsubResubPath);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_RouteReclaimedPath);
     SB_UT_ADD_SUBTEST(Test_MessageString);
+    SB_UT_ADD_SUBTEST(Test_TransmitSync);
 }
 
 /*
@@ -4807,8 +5461,9 @@ void Test_CFE_SB_Buffers(void)
 {
     int32 ExpRtn;
 
-    CFE_SB_BufferD_t *     bd;
-    CFE_SB_DestinationD_t *destptr;
+    CFE_SB_BufferD_t *        bd;
+    CFE_SB_DestinationList_t *destlist;
+    size_t                    destsize;
 
     CFE_SB_Global.StatTlmMsg.Payload.MemInUse     = 0;
     CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = sizeof(CFE_SB_BufferD_t) * 4;
@@ -4836,21 +5491,24 @@ void Test_CFE_SB_Buffers(void)
 
     CFE_UtAssert_EVENTCOUNT(0);
 
-    destptr = CFE_SB_GetDestinationBlk();
-    UtAssert_NOT_NULL(destptr);
-    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, sizeof(*destptr));
+    destsize = sizeof(CFE_SB_DestinationList_t) + (2 * sizeof(CFE_SB_DestinationD_t));
+    destlist = CFE_SB_GetDestinationBlk(2);
+    UtAssert_NOT_NULL(destlist);
+    UtAssert_UINT32_EQ(destlist->NumDests, 0);
+    UtAssert_UINT32_EQ(destlist->MaxDests, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, destsize);
 
     /*
      * historical behavior has CFE_SB_PutDestinationBlk() return SUCCESS even if the underlying call fails,
      * but the MemInUse should remain the same
      */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
-    CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destptr));
-    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, sizeof(*destptr));
+    CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destlist));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, destsize);
 
     /* normal case should reduce MemInUse */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, sizeof(*destptr));
-    CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destptr));
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, destsize);
+    CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destlist));
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
 
     CFE_UtAssert_EVENTCOUNT(0);
@@ -4925,6 +5583,55 @@ void Test_ReceiveBuffer_UnsubResubPath(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test receiving a message whose route was reclaimed for a different
+** message ID while the message was on the pipe
+*/
+void Test_ReceiveBuffer_RouteReclaimedPath(void)
+{
+    CFE_SB_Buffer_t *      SBBufPtr;
+    CFE_SB_MsgId_t         MsgId  = SB_UT_TLM_MID;
+    CFE_SB_PipeId_t        PipeId = CFE_SB_INVALID_PIPE;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    uint32                 PipeDepth = 10;
+    CFE_MSG_Type_t         Type      = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t         Size      = sizeof(TlmPkt);
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_SB_DestinationD_t *DestPtr;
+    int32                  i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    /* Fill the routing table so the only idle route to reclaim is the one in flight */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    for (i = 1; i < CFE_PLATFORM_SB_MAX_MSG_IDS; i++)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(i), PipeId));
+    }
+    RouteId = CFE_SBR_GetRouteId(MsgId);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+
+    /* The route is handed to a new message ID, which has a message of its own on the pipe */
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(CFE_SB_ValueToMsgId(i), PipeId));
+    UtAssert_UINT32_EQ(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(i)).RouteId, RouteId.RouteId);
+    DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
+    UtAssert_NOT_NULL(DestPtr);
+    DestPtr->BuffCount = 1;
+
+    /* Receiving the old message must not count against the new message ID */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_NOT_NULL(SBBufPtr);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Test the paths through the MessageStringSet and MessageStringGet functions
 */
@@ -4996,3 +5703,66 @@ void Test_MessageString(void)
     CFE_SB_MessageStringGet(DestString, SrcString, DefString, 4, sizeof(SrcString));
     UtAssert_STRINGBUF_EQ(DestString, 4, SrcString, 3);
 }
+
+/*
+** Hook to finish the active transmits while a routing change waits for them
+*/
+static int32 UT_FinishTransmitsHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                    const UT_StubContext_t *Context)
+{
+    CFE_SB_Global.Transmit.Active[0] = 0;
+    CFE_SB_Global.Transmit.Active[1] = 0;
+
+    return StubRetcode;
+}
+
+/*
+** Test the synchronization between transmits and routing changes
+*/
+void Test_TransmitSync(void)
+{
+    uint32 Epoch;
+    uint32 Counter;
+
+    /* A transmit counts in the slot of the current epoch */
+    Epoch = CFE_SB_TransmitEnter();
+    UtAssert_UINT32_EQ(Epoch, CFE_SB_Global.Transmit.Epoch);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.Active[Epoch & 1], 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+
+    /* Waiting moves on the epoch and polls until the transmit leaves */
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_FinishTransmitsHook, NULL);
+    UtAssert_VOIDCALL(CFE_SB_WaitForTransmits());
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.Epoch, Epoch + 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_ZERO(CFE_SB_Global.Transmit.Active[Epoch & 1]);
+
+    /* Nothing active, so the next wait returns at once */
+    UtAssert_VOIDCALL(CFE_SB_WaitForTransmits());
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+
+    /* A transmit that starts while transmits are held waits on the SB lock */
+    UtAssert_VOIDCALL(CFE_SB_HoldTransmits());
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.Exclusive, 1);
+    Epoch = CFE_SB_TransmitEnter();
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Transmit.Active[Epoch & 1], 1);
+    UtAssert_ZERO(CFE_SB_Global.Transmit.Active[(Epoch + 1) & 1]);
+    UtAssert_VOIDCALL(CFE_SB_TransmitLeave(Epoch));
+    UtAssert_ZERO(CFE_SB_Global.Transmit.Active[Epoch & 1]);
+    UtAssert_VOIDCALL(CFE_SB_ReleaseTransmits());
+    UtAssert_ZERO(CFE_SB_Global.Transmit.Exclusive);
+
+    /* Bounded counters */
+    Counter = 1;
+    UtAssert_UINT32_EQ(CFE_SB_CounterIncrementBelow(&Counter, 2), 1);
+    UtAssert_UINT32_EQ(CFE_SB_CounterIncrementBelow(&Counter, 2), 2);
+    UtAssert_UINT32_EQ(Counter, 2);
+    UtAssert_UINT32_EQ(CFE_SB_CounterDecrementAbove(&Counter, 1), 2);
+    UtAssert_UINT32_EQ(CFE_SB_CounterDecrementAbove(&Counter, 1), 1);
+    UtAssert_UINT32_EQ(Counter, 1);
+    UtAssert_VOIDCALL(CFE_SB_CounterRaise(&Counter, 3));
+    UtAssert_UINT32_EQ(Counter, 3);
+    UtAssert_VOIDCALL(CFE_SB_CounterRaise(&Counter, 2));
+    UtAssert_UINT32_EQ(Counter, 3);
+}
@@ -1478,6 +1478,23 @@ void Test_Subscribe_LocalSubscription(void);
 ******************************************************************************/
 void Test_Subscribe_MaxDestCount(void);
 
+/*****************************************************************************/
+/**
+** \brief Test growth of the destination list of a route
+**
+** \par Description
+**        This function tests that the destination list of a route grows as
+**        pipes subscribe, keeps the destinations in order, and is left
+**        unchanged if it cannot be grown.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_DestListGrowth(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test message subscription response to reaching the maximum
@@ -1771,6 +1788,39 @@ void Test_Unsubscribe_MiddleDestWithMany(void);
 ******************************************************************************/
 void Test_Unsubscribe_GetDestPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief  Test that unsubscribing frees the routing table element
+**
+** \par Description
+**        This function tests that once the last subscription to a message ID
+**        is removed, its routing table element can be used by another message ID.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Unsubscribe_ReleasesRoute(void);
+
+/*****************************************************************************/
+/**
+** \brief Test shrinking of the destination list of a route
+**
+** \par Description
+**        This function tests that the destination list of a route keeps the
+**        remaining destinations in order as pipes unsubscribe, shrinks once
+**        mostly empty, and is released with the last subscription.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Unsubscribe_DestListShrink(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB send message API test functions
@@ -2060,6 +2110,22 @@ void Test_TransmitMsg_DisabledDestination(void);
 ******************************************************************************/
 void Test_TransmitTxn_PipeHandler(void);
 
+/*****************************************************************************/
+/**
+** \brief Test CFE_SB_TransmitTxn_Finish
+**
+** \par Description
+**        This function tests the deferred accounting for failed queue writes
+**        and the release of the sender reference.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitTxn_Finish(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test response to sending a message which has an invalid Msg ID
@@ -2221,6 +2287,117 @@ void Test_ReceiveBuffer_PendForever(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_InvalidBufferPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Function for calling SB batched receive API test functions
+**
+** \par Description
+**        Function for calling SB batched receive API test functions.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_API(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving several messages from the software bus in one call
+**
+** \par Description
+**        This function tests batched receive limits and the release of
+**        buffers held from a previous batch.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_Nominal(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batched receive with invalid arguments
+**
+** \par Description
+**        This function tests batched receive with NULL pointers, a zero
+**        count, an invalid timeout, and an invalid pipe ID.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_InvalidArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batched receive when no message arrives
+**
+** \par Description
+**        This function tests batched receive when polling an empty pipe and
+**        when the timeout expires.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_NoMessage(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batched receive with errors reading the pipe
+**
+** \par Description
+**        This function tests batched receive when the queue read fails or
+**        returns an invalid buffer descriptor.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_PipeReadError(void);
+
+/*****************************************************************************/
+/**
+** \brief Test batched receive where some buffers fail verification
+**
+** \par Description
+**        This function tests that buffers failing verification are dropped
+**        from the batch.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch_VerifyFail(void);
+
+/*****************************************************************************/
+/**
+** \brief Test storing a batch of buffers in a pipe descriptor
+**
+** \par Description
+**        This function tests CFE_SB_ReceiveTxn_ExportBatch, including when
+**        the pipe was deleted while reading.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveTxn_ExportBatch(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing zero copy buffers for all pipes owned by a
@@ -2457,6 +2634,22 @@ void Test_CFE_SB_BadPipeInfo(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_UnsubResubPath(void);
 
+/*****************************************************************************/
+/**
+** \brief Test ReceiveBuffer function reclaimed route path
+**
+** \par Description
+**        This function tests the branch path in the ReceiveBuffer function when
+**        the route of a message in the pipe is reclaimed for a different message ID.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_RouteReclaimedPath(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test MessageStringSet and MessageStringGet function paths
@@ -2473,6 +2666,22 @@ void Test_ReceiveBuffer_UnsubResubPath(void);
 ******************************************************************************/
 void Test_MessageString(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the synchronization between transmits and routing changes
+**
+** \par Description
+**        This function tests entering and leaving a transmit, waiting for
+**        and holding off transmits, and the bounded counters used by them.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitSync(void);
+
 void Test_SB_Macros(void);
 
 void Test_SB_CCSDSPriHdr_Macros(void);
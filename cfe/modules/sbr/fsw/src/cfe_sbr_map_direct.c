@@ -83,6 +83,20 @@ uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
     return 0;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId)
+{
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        CFE_SBR_MSGMAP[CFE_SB_MsgIdToValue(MsgId)] = CFE_SBR_INVALID_ROUTE_ID;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -143,6 +143,57 @@ uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
     return collisions;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hole;
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SB_MsgId_Atom_t home;
+    CFE_SBR_RouteId_t   routeid;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        /* Find the slot holding this message id, same probe as CFE_SBR_GetRouteId */
+        hole    = CFE_SBR_MsgIdHash(MsgId);
+        routeid = CFE_SBR_MSGMAP[hole];
+        while (CFE_SBR_IsValidRouteId(routeid) && !CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid), MsgId))
+        {
+            hole    = (hole + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            routeid = CFE_SBR_MSGMAP[hole];
+        }
+
+        if (CFE_SBR_IsValidRouteId(routeid))
+        {
+            /*
+             * Backward shift deletion, no tombstones are left behind so probe lengths
+             * only depend on the routes currently in the map.  Walk the rest of the
+             * cluster and move back any entry whose probe sequence passes through the
+             * hole, i.e. whose home slot is not between the hole and its current slot.
+             */
+            hash = (hole + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            while (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hash]))
+            {
+                home = CFE_SBR_MsgIdHash(CFE_SBR_GetMsgId(CFE_SBR_MSGMAP[hash]));
+
+                if (((hash - home) & (CFE_SBR_MSG_MAP_SIZE - 1)) >= ((hash - hole) & (CFE_SBR_MSG_MAP_SIZE - 1)))
+                {
+                    CFE_SBR_MSGMAP[hole] = CFE_SBR_MSGMAP[hash];
+                    hole                 = hash;
+                }
+
+                hash = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            }
+
+            CFE_SBR_MSGMAP[hole] = CFE_SBR_INVALID_ROUTE_ID;
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
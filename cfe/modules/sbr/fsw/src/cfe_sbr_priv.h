@@ -58,4 +58,16 @@ void CFE_SBR_Init_Map(void);
  */
 uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Removes the association between the given message ID and its route ID
+ *
+ * Used when a route is removed so later lookups of the message ID find no route.
+ * Must be called while the routing table still holds the message IDs of all routes,
+ * including the one being removed, since hash lookups depend on them.
+ *
+ * \param[in] MsgId Message id to disassociate
+ */
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId);
+
 #endif /* CFE_SBR_PRIV_H */
@@ -37,6 +37,7 @@
 
 #include "cfe_sb.h"
 #include "cfe_msg.h"
+#include "osapi.h"
 
 /******************************************************************************
  * Type Definitions
@@ -45,18 +46,45 @@
 /** \brief Routing table entry */
 typedef struct
 {
-    CFE_SB_DestinationD_t * ListHeadPtr; /**< \brief Destination list head */
-    CFE_SB_MsgId_t          MsgId;       /**< \brief Message ID associated with route */
-    CFE_MSG_SequenceCount_t SeqCnt;      /**< \brief Message sequence counter */
+    CFE_SB_DestinationList_t *ListHeadPtr; /**< \brief Destination list */
+    CFE_SB_MsgId_t            MsgId;       /**< \brief Message ID associated with route */
+    uint32                    SeqCnt;      /**< \brief Message sequence counter, updated atomically */
+    CFE_SB_RouteId_Atom_t     ActiveIdx;   /**< \brief Position in ActiveList while route has destinations */
 } CFE_SBR_RouteEntry_t;
 
-/** \brief Module data */
+/** \brief Links for the list of idle routing table entries */
 typedef struct
 {
-    CFE_SBR_RouteEntry_t  RoutingTbl[CFE_PLATFORM_SB_MAX_MSG_IDS]; /**< \brief Routing table */
-    CFE_SB_RouteId_Atom_t RouteIdxTop;                             /**< \brief First unused entry in RoutingTbl */
+    CFE_SB_RouteId_Atom_t Prev; /**< \brief Previous idle entry, or CFE_SBR_IDLE_LIST */
+    CFE_SB_RouteId_Atom_t Next; /**< \brief Next idle entry, or CFE_SBR_IDLE_LIST */
+} CFE_SBR_IdleLink_t;
+
+/**
+ * \brief Module data
+ *
+ * A route with at least one destination is active, and its entry index is kept in the
+ * densely packed ActiveList so iterating routes only touches live entries.
+ *
+ * All other entries are idle, kept in least recently used order.  An idle entry that
+ * was previously used keeps its message ID mapping and sequence counter, so the sequence
+ * count carries on if the message is sent or subscribed to again, until the entry is
+ * reclaimed for a new route.  New routes always take the least recently used idle entry.
+ */
+typedef struct
+{
+    CFE_SBR_RouteEntry_t  RoutingTbl[CFE_PLATFORM_SB_MAX_MSG_IDS];    /**< \brief Routing table */
+    CFE_SB_RouteId_Atom_t ActiveList[CFE_PLATFORM_SB_MAX_MSG_IDS];    /**< \brief Indices of active entries */
+    CFE_SBR_IdleLink_t    IdleLinks[CFE_PLATFORM_SB_MAX_MSG_IDS + 1]; /**< \brief Idle list, last is the head */
+    CFE_SB_RouteId_Atom_t ActiveCount;                                /**< \brief Number of active entries */
 } cfe_sbr_route_data_t;
 
+/******************************************************************************
+ * Macro Definitions
+ */
+
+/** \brief Index of the idle list head in IdleLinks */
+#define CFE_SBR_IDLE_LIST CFE_PLATFORM_SB_MAX_MSG_IDS
+
 /******************************************************************************
  * Shared data
  */
@@ -64,6 +92,39 @@ typedef struct
 /** \brief Routing module shared data */
 cfe_sbr_route_data_t CFE_SBR_RDATA;
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Removes an entry from the idle list
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SBR_IdleUnlink(CFE_SB_RouteId_Atom_t RouteIdx)
+{
+    CFE_SBR_IdleLink_t *link = &CFE_SBR_RDATA.IdleLinks[RouteIdx];
+
+    CFE_SBR_RDATA.IdleLinks[link->Prev].Next = link->Next;
+    CFE_SBR_RDATA.IdleLinks[link->Next].Prev = link->Prev;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds an entry to the idle list as the most recently used
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_SBR_IdleAppend(CFE_SB_RouteId_Atom_t RouteIdx)
+{
+    CFE_SBR_IdleLink_t *link = &CFE_SBR_RDATA.IdleLinks[RouteIdx];
+
+    link->Next = CFE_SBR_IDLE_LIST;
+    link->Prev = CFE_SBR_RDATA.IdleLinks[CFE_SBR_IDLE_LIST].Prev;
+
+    CFE_SBR_RDATA.IdleLinks[link->Prev].Next        = RouteIdx;
+    CFE_SBR_RDATA.IdleLinks[CFE_SBR_IDLE_LIST].Prev = RouteIdx;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -76,10 +137,13 @@ void CFE_SBR_Init(void)
     /* Clear the shared data */
     memset(&CFE_SBR_RDATA, 0, sizeof(CFE_SBR_RDATA));
 
-    /* Only non-zero value for shared data initialization is the invalid MsgId */
+    /* Set the invalid MsgId and place every entry on the idle list */
+    CFE_SBR_RDATA.IdleLinks[CFE_SBR_IDLE_LIST].Next = CFE_SBR_IDLE_LIST;
+    CFE_SBR_RDATA.IdleLinks[CFE_SBR_IDLE_LIST].Prev = CFE_SBR_IDLE_LIST;
     for (routeidx = 0; routeidx < CFE_PLATFORM_SB_MAX_MSG_IDS; routeidx++)
     {
         CFE_SBR_RDATA.RoutingTbl[routeidx].MsgId = CFE_SB_INVALID_MSG_ID;
+        CFE_SBR_IdleAppend(routeidx);
     }
 
     /* Initialize map */
@@ -93,16 +157,32 @@ void CFE_SBR_Init(void)
  *-----------------------------------------------------------------*/
 CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
 {
-    CFE_SBR_RouteId_t routeid    = CFE_SBR_INVALID_ROUTE_ID;
-    uint32            collisions = 0;
+    CFE_SBR_RouteId_t     routeid    = CFE_SBR_INVALID_ROUTE_ID;
+    uint32                collisions = 0;
+    CFE_SB_RouteId_Atom_t routeidx;
+    CFE_SBR_RouteEntry_t *entry;
 
-    if (CFE_SB_IsValidMsgId(MsgId) && (CFE_SBR_RDATA.RouteIdxTop < CFE_PLATFORM_SB_MAX_MSG_IDS))
+    if (CFE_SB_IsValidMsgId(MsgId) && (CFE_SBR_RDATA.ActiveCount < CFE_PLATFORM_SB_MAX_MSG_IDS))
     {
-        routeid    = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
+        /* Reclaim the least recently used idle entry */
+        routeidx = CFE_SBR_RDATA.IdleLinks[CFE_SBR_IDLE_LIST].Next;
+        entry    = &CFE_SBR_RDATA.RoutingTbl[routeidx];
+        routeid  = CFE_SBR_ValueToRouteId(routeidx);
+
+        /* Drop the mapping of the route it previously held, if any */
+        if (CFE_SBR_GetRouteId(entry->MsgId).RouteId == routeid.RouteId)
+        {
+            CFE_SBR_ClearRouteId(entry->MsgId);
+        }
+
         collisions = CFE_SBR_SetRouteId(MsgId, routeid);
 
-        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].MsgId = MsgId;
-        CFE_SBR_RDATA.RouteIdxTop++;
+        entry->MsgId  = MsgId;
+        entry->SeqCnt = 0;
+
+        /* Stays idle until a destination is set, but is now the most recently used */
+        CFE_SBR_IdleUnlink(routeidx);
+        CFE_SBR_IdleAppend(routeidx);
     }
 
     if (CollisionsPtr != NULL)
@@ -135,13 +215,15 @@ CFE_SB_MsgId_t CFE_SBR_GetMsgId(CFE_SBR_RouteId_t RouteId)
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-CFE_SB_DestinationD_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId)
+CFE_SB_DestinationList_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_SB_DestinationD_t *destptr = NULL;
+    CFE_SB_DestinationList_t *destptr = NULL;
+    CFE_SBR_RouteEntry_t *    entry;
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        destptr = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].ListHeadPtr;
+        entry   = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)];
+        destptr = OS_AtomicLoadPtr((void *const volatile *)&entry->ListHeadPtr);
     }
 
     return destptr;
@@ -152,11 +234,37 @@ CFE_SB_DestinationD_t *CFE_SBR_GetDestListHeadPtr(CFE_SBR_RouteId_t RouteId)
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
+void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationList_t *DestPtr)
 {
+    CFE_SB_RouteId_Atom_t routeidx;
+    CFE_SB_RouteId_Atom_t lastidx;
+    CFE_SBR_RouteEntry_t *entry;
+
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].ListHeadPtr = DestPtr;
+        routeidx = CFE_SBR_RouteIdToValue(RouteId);
+        entry    = &CFE_SBR_RDATA.RoutingTbl[routeidx];
+
+        if (entry->ListHeadPtr == NULL && DestPtr != NULL)
+        {
+            /* First destination, route becomes active */
+            CFE_SBR_IdleUnlink(routeidx);
+            entry->ActiveIdx                                    = CFE_SBR_RDATA.ActiveCount;
+            CFE_SBR_RDATA.ActiveList[CFE_SBR_RDATA.ActiveCount] = routeidx;
+            CFE_SBR_RDATA.ActiveCount++;
+        }
+        else if (entry->ListHeadPtr != NULL && DestPtr == NULL)
+        {
+            /* Last destination removed, move the last active entry into the vacated position */
+            CFE_SBR_RDATA.ActiveCount--;
+            lastidx                                     = CFE_SBR_RDATA.ActiveList[CFE_SBR_RDATA.ActiveCount];
+            CFE_SBR_RDATA.ActiveList[entry->ActiveIdx]  = lastidx;
+            CFE_SBR_RDATA.RoutingTbl[lastidx].ActiveIdx = entry->ActiveIdx;
+            CFE_SBR_IdleAppend(routeidx);
+        }
+
+        /* Lookups do not take a lock, so the list must be complete before it is published */
+        OS_AtomicStorePtr((void *volatile *)&entry->ListHeadPtr, DestPtr);
     }
 }
 
@@ -165,15 +273,25 @@ void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
+CFE_MSG_SequenceCount_t CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_MSG_SequenceCount_t *cnt;
+    uint32 *cnt;
+    uint32  oldcnt;
+    uint32  newcnt = 0;
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        cnt  = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
-        *cnt = CFE_MSG_GetNextSequenceCount(*cnt);
+        cnt    = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+        oldcnt = OS_AtomicLoad32(cnt);
+
+        /* On failure this reloads oldcnt with the current counter, so just retry */
+        do
+        {
+            newcnt = CFE_MSG_GetNextSequenceCount(oldcnt);
+        } while (!OS_AtomicCompareAndSwap32(cnt, &oldcnt, newcnt));
     }
+
+    return newcnt;
 }
 
 /*----------------------------------------------------------------
@@ -187,7 +305,7 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId)
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        seqcnt = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+        seqcnt = OS_AtomicLoad32(&CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt);
     }
 
     return seqcnt;
@@ -200,27 +318,53 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId)
  *-----------------------------------------------------------------*/
 void CFE_SBR_ForEachRouteId(CFE_SBR_CallbackPtr_t CallbackPtr, void *ArgPtr, CFE_SBR_Throttle_t *ThrottlePtr)
 {
+    CFE_SB_RouteId_Atom_t activeidx;
     CFE_SB_RouteId_Atom_t routeidx;
     CFE_SB_RouteId_Atom_t startidx = 0;
-    CFE_SB_RouteId_Atom_t endidx   = CFE_SBR_RDATA.RouteIdxTop;
+    CFE_SB_RouteId_Atom_t endidx   = CFE_SBR_RDATA.ActiveCount;
 
     /* Update throttle settings if needed */
     if (ThrottlePtr != NULL)
     {
         startidx = ThrottlePtr->StartIndex;
 
-        /* Return next index of zero if full range is processed */
-        ThrottlePtr->NextIndex = 0;
-
         if ((startidx + ThrottlePtr->MaxLoop) < endidx)
         {
-            endidx                 = startidx + ThrottlePtr->MaxLoop;
-            ThrottlePtr->NextIndex = endidx;
+            endidx = startidx + ThrottlePtr->MaxLoop;
         }
     }
 
-    for (routeidx = startidx; routeidx < endidx; routeidx++)
+    activeidx = startidx;
+    while (activeidx < endidx && activeidx < CFE_SBR_RDATA.ActiveCount)
     {
+        routeidx = CFE_SBR_RDATA.ActiveList[activeidx];
+
         (*CallbackPtr)(CFE_SBR_ValueToRouteId(routeidx), ArgPtr);
+
+        /*
+         * If the callback removed the last destination, the last active route now
+         * occupies this position and still needs to be visited
+         */
+        if (activeidx < CFE_SBR_RDATA.ActiveCount && CFE_SBR_RDATA.ActiveList[activeidx] == routeidx)
+        {
+            activeidx++;
+        }
+        else
+        {
+            endidx--;
+        }
+    }
+
+    /* Return next index of zero if full range is processed */
+    if (ThrottlePtr != NULL)
+    {
+        if (activeidx < CFE_SBR_RDATA.ActiveCount)
+        {
+            ThrottlePtr->NextIndex = activeidx;
+        }
+        else
+        {
+            ThrottlePtr->NextIndex = 0;
+        }
     }
 }
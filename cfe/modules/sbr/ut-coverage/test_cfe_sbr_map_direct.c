@@ -119,6 +119,15 @@ void Test_SBR_Map_Direct(void)
     UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid).RouteId, routeid.RouteId);
     UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid)));
 
+    UtPrintf("Clear an entry");
+    routeid = CFE_SBR_ValueToRouteId(0);
+    CFE_SBR_SetRouteId(msgid, routeid);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_IsValidMsgId), 1, false);
+    CFE_SBR_ClearRouteId(msgid);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid).RouteId, routeid.RouteId);
+    CFE_SBR_ClearRouteId(msgid);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid)));
+
     /* Performance check, 0xFFFFFF on 3.2GHz linux box is around 8-9 seconds */
     count = 0;
     for (i = 0; i <= 0xFFFF; i++)
@@ -124,6 +124,73 @@ void Test_SBR_Map_Hash(void)
     UtPrintf("Valid route id's encountered in performance loop: %u", (unsigned int)count);
 }
 
+void Test_SBR_Map_Hash_Remove(void)
+{
+    CFE_SBR_RouteId_t routeid[4];
+    CFE_SB_MsgId_t    msgid[4];
+    uint32            collisions;
+    uint32            expected[4] = {0, 1, 1, 3};
+    uint32            i;
+
+    UtPrintf("Initialize routing and map");
+    CFE_SBR_Init();
+
+    UtPrintf("Clear an invalid msg");
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(CFE_SB_INVALID_MSG_ID));
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Clear a msg that is not in the map");
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(Test_SBR_Unhash(0)));
+
+    /*
+     * Build a cluster that wraps around the end of the map:
+     *   last slot: msgid[0] (home last)
+     *   slot 0:    msgid[1] (home last)
+     *   slot 1:    msgid[2] (home 0)
+     *   slot 2:    msgid[3] (home last)
+     */
+    msgid[0] = Test_SBR_Unhash(0xFFFFFFFF);
+    msgid[1] = Test_SBR_Unhash(0x7FFFFFFF);
+    msgid[2] = Test_SBR_Unhash(0x80000000);
+    msgid[3] = Test_SBR_Unhash(0x3FFFFFFF);
+    for (i = 0; i < 4; i++)
+    {
+        routeid[i] = CFE_SBR_AddRoute(msgid[i], &collisions);
+        UtAssert_INT32_EQ(collisions, expected[i]);
+    }
+
+    UtPrintf("Remove head of cluster, all following entries shift back");
+    CFE_SBR_ClearRouteId(msgid[0]);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[0])));
+    for (i = 1; i < 4; i++)
+    {
+        UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[i]).RouteId, routeid[i].RouteId);
+    }
+
+    UtPrintf("Remove head again, entry in its home slot stays put");
+    CFE_SBR_ClearRouteId(msgid[1]);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[1])));
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[2]).RouteId, routeid[2].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[3]).RouteId, routeid[3].RouteId);
+
+    /* Re-adding shows the cluster is now two entries long with no holes */
+    routeid[0] = CFE_SBR_AddRoute(msgid[0], &collisions);
+    UtAssert_INT32_EQ(collisions, 2);
+
+    UtPrintf("Remove everything, map is empty again");
+    CFE_SBR_ClearRouteId(msgid[0]);
+    CFE_SBR_ClearRouteId(msgid[2]);
+    CFE_SBR_ClearRouteId(msgid[3]);
+    for (i = 0; i < 4; i++)
+    {
+        UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[i])));
+    }
+    routeid[1] = CFE_SBR_AddRoute(msgid[1], &collisions);
+    UtAssert_INT32_EQ(collisions, 0);
+}
+
 /* Main unit test routine */
 void UtTest_Setup(void)
 {
@@ -131,4 +198,5 @@ void UtTest_Setup(void)
     UtPrintf("Software Bus Routing hash map coverage test...");
 
     UT_ADD_TEST(Test_SBR_Map_Hash);
+    UT_ADD_TEST(Test_SBR_Map_Hash_Remove);
 }
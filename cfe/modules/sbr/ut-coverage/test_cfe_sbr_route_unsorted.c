@@ -38,11 +38,13 @@ void Test_SBR_Callback(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 
 void Test_SBR_Route_Unsort_General(void)
 {
-    CFE_SBR_RouteId_t  routeid;
-    CFE_SB_MsgId_t     msgid;
-    uint32             collisions;
-    uint32             count;
-    CFE_SBR_Throttle_t throttle;
+    CFE_SBR_RouteId_t        routeid;
+    CFE_SBR_RouteId_t        fillid;
+    CFE_SB_MsgId_t           msgid;
+    uint32                   collisions;
+    uint32                   count;
+    CFE_SBR_Throttle_t       throttle;
+    CFE_SB_DestinationList_t dest;
 
     UtPrintf("Initialize map and route");
     CFE_SBR_Init();
@@ -70,16 +72,25 @@ void Test_SBR_Route_Unsort_General(void)
     UtAssert_INT32_EQ(collisions, 0);
     UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(routeid));
 
+    UtPrintf("Callback test with one route without destinations");
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_INT32_EQ(count, 0);
+    CFE_SBR_SetDestListHeadPtr(routeid, &dest);
+
     UtPrintf("Callback test with one route");
     count = 0;
     CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
     UtAssert_INT32_EQ(count, 1);
 
     UtPrintf("Fill routing table");
-    count = 0;
-    while (CFE_SBR_IsValidRouteId(CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count), NULL)))
+    count  = 0;
+    fillid = CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count), NULL);
+    while (CFE_SBR_IsValidRouteId(fillid))
     {
+        CFE_SBR_SetDestListHeadPtr(fillid, &dest);
         count++;
+        fillid = CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count), NULL);
     }
 
     /* Check for expected count indicating full routing table */
@@ -111,13 +122,14 @@ void Test_SBR_Route_Unsort_General(void)
 
 void Test_SBR_Route_Unsort_GetSet(void)
 {
-    CFE_SB_RouteId_Atom_t   routeidx;
-    CFE_SB_MsgId_t          msgid[3];
-    CFE_SBR_RouteId_t       routeid[3];
-    CFE_SB_DestinationD_t   dest[2];
-    CFE_MSG_SequenceCount_t seqcntexpected[] = {1, 2};
-    uint32                  count;
-    uint32                  i;
+    CFE_SB_RouteId_Atom_t    routeidx;
+    CFE_SB_MsgId_t           msgid[3];
+    CFE_SBR_RouteId_t        routeid[3];
+    CFE_SB_DestinationList_t dest0;
+    CFE_SB_DestinationList_t dest1;
+    CFE_MSG_SequenceCount_t  seqcntexpected[] = {1, 2};
+    uint32                   count;
+    uint32                   i;
 
     UtPrintf("Invalid route ID checks");
     routeid[0] = CFE_SBR_INVALID_ROUTE_ID;
@@ -128,7 +140,7 @@ void Test_SBR_Route_Unsort_GetSet(void)
         UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[i]), NULL);
         UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[i]), 0);
         UtAssert_VOIDCALL(CFE_SBR_SetDestListHeadPtr(routeid[i], NULL));
-        UtAssert_VOIDCALL(CFE_SBR_IncrementSequenceCounter(routeid[i]));
+        UtAssert_INT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[i]), 0);
     }
 
     /*
@@ -176,18 +188,134 @@ void Test_SBR_Route_Unsort_GetSet(void)
 
     /* Increment route 1 once and set dest pointers */
     UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), seqcntexpected[1]);
-    CFE_SBR_IncrementSequenceCounter(routeid[1]);
+    UtAssert_UINT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[1]), seqcntexpected[1]);
     UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 4);
-    CFE_SBR_SetDestListHeadPtr(routeid[1], &dest[1]);
-    CFE_SBR_SetDestListHeadPtr(routeid[2], &dest[0]);
+    CFE_SBR_SetDestListHeadPtr(routeid[1], &dest1);
+    CFE_SBR_SetDestListHeadPtr(routeid[2], &dest0);
 
     UtPrintf("Verify remaining set values");
     UtAssert_UINT32_EQ(CFE_SBR_GetSequenceCounter(routeid[0]), seqcntexpected[0]);
     UtAssert_UINT32_EQ(CFE_SBR_GetSequenceCounter(routeid[1]), seqcntexpected[1]);
     UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[2]), 0);
     UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[0]), NULL);
-    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[1]), &dest[1]);
-    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[2]), &dest[0]);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[1]), &dest1);
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[2]), &dest0);
+}
+
+/* Callback function that removes the destinations of every route it visits */
+void Test_SBR_RemoveCallback(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
+{
+    uint32 *count = ArgPtr;
+
+    (*count)++;
+    CFE_SBR_SetDestListHeadPtr(RouteId, NULL);
+}
+
+void Test_SBR_Route_Unsort_Idle(void)
+{
+    CFE_SBR_RouteId_t        routeid[3];
+    CFE_SBR_RouteId_t        fillid;
+    CFE_SB_MsgId_t           msgid[3];
+    CFE_SB_DestinationList_t dest;
+    uint32                   count;
+    uint32                   i;
+    CFE_SBR_Throttle_t       throttle;
+
+    UtPrintf("Initialize map and route");
+    CFE_SBR_Init();
+
+    /* Force valid msgid responses */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    UtPrintf("Routes are only visited while they have destinations");
+    for (i = 0; i < 3; i++)
+    {
+        msgid[i]   = CFE_SB_ValueToMsgId(i + 1);
+        routeid[i] = CFE_SBR_AddRoute(msgid[i], NULL);
+        UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(routeid[i]));
+        CFE_SBR_SetDestListHeadPtr(routeid[i], &dest);
+    }
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_INT32_EQ(count, 3);
+
+    /* Setting the same state again has no effect on the active routes */
+    CFE_SBR_SetDestListHeadPtr(routeid[1], &dest);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 5);
+    CFE_SBR_IncrementSequenceCounter(routeid[1]);
+    CFE_SBR_SetDestListHeadPtr(routeid[1], NULL);
+    CFE_SBR_SetDestListHeadPtr(routeid[1], NULL);
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_INT32_EQ(count, 2);
+
+    UtPrintf("Idle route keeps its mapping and sequence count");
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid[1]).RouteId, routeid[1].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[1]), 5);
+    CFE_SBR_SetDestListHeadPtr(routeid[1], &dest);
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_INT32_EQ(count, 3);
+    CFE_SBR_SetDestListHeadPtr(routeid[1], NULL);
+
+    UtPrintf("Idle route is reclaimed once every other entry is in use");
+    count  = 0;
+    fillid = CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count + 10), NULL);
+    while (CFE_SBR_IsValidRouteId(fillid) && fillid.RouteId != routeid[1].RouteId)
+    {
+        CFE_SBR_SetDestListHeadPtr(fillid, &dest);
+        count++;
+        fillid = CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count + 10), NULL);
+    }
+    UtAssert_INT32_EQ(count, CFE_PLATFORM_SB_MAX_MSG_IDS - 3);
+    UtAssert_INT32_EQ(fillid.RouteId, routeid[1].RouteId);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[1])));
+    UtAssert_INT32_EQ(CFE_SBR_GetRouteId(CFE_SB_ValueToMsgId(count + 10)).RouteId, routeid[1].RouteId);
+    UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[1]), 0);
+
+    /* Now full */
+    CFE_SBR_SetDestListHeadPtr(fillid, &dest);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_AddRoute(msgid[1], NULL)));
+
+    UtPrintf("Remove every destination from within the callback");
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_RemoveCallback, &count, NULL);
+    UtAssert_INT32_EQ(count, CFE_PLATFORM_SB_MAX_MSG_IDS);
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_INT32_EQ(count, 0);
+
+    UtPrintf("Throttled removal from within the callback");
+    for (i = 0; i < 3; i++)
+    {
+        CFE_SBR_SetDestListHeadPtr(routeid[i], &dest);
+    }
+    throttle.MaxLoop    = 2;
+    throttle.StartIndex = 0;
+    count               = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_RemoveCallback, &count, &throttle);
+    UtAssert_INT32_EQ(count, 2);
+    UtAssert_INT32_EQ(throttle.NextIndex, 0);
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_RemoveCallback, &count, NULL);
+    UtAssert_INT32_EQ(count, 1);
+
+    UtPrintf("Churn through more message ids than fit in the routing table");
+    count = 0;
+    for (i = 0; i < 4 * CFE_PLATFORM_SB_MAX_MSG_IDS; i++)
+    {
+        fillid = CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(i % CFE_PLATFORM_SB_HIGHEST_VALID_MSGID), NULL);
+        if (CFE_SBR_IsValidRouteId(fillid))
+        {
+            count++;
+        }
+        CFE_SBR_SetDestListHeadPtr(fillid, &dest);
+        CFE_SBR_SetDestListHeadPtr(fillid, NULL);
+    }
+    UtAssert_UINT32_EQ(count, 4 * CFE_PLATFORM_SB_MAX_MSG_IDS);
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_INT32_EQ(count, 0);
 }
 
 /* Main unit test routine */
@@ -198,4 +326,5 @@ void UtTest_Setup(void)
 
     UT_ADD_TEST(Test_SBR_Route_Unsort_General);
     UT_ADD_TEST(Test_SBR_Route_Unsort_GetSet);
+    UT_ADD_TEST(Test_SBR_Route_Unsort_Idle);
 }
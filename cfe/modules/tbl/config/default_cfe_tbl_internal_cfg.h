@@ -102,6 +102,20 @@
 */
 #define CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE 16384
 
+/**
+**  \cfetblcfg Size of the Chunks Used to Stream a Table Image From a File
+**
+**  \par Description:
+**       Table file loads read the table image into the working buffer in chunks
+**       of at most this many bytes, and fold each chunk into the table CRC while
+**       it is still in the data cache.  Larger values mean fewer file system calls,
+**       smaller values keep each chunk within the cache of the processor.
+**
+**  \par Limits
+**       This parameter must be greater than zero and a multiple of 4.
+*/
+#define CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE 16384
+
 /**
 **  \cfetblcfg Maximum Number of Tables Allowed to be Registered
 **
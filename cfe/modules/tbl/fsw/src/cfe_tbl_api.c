@@ -178,6 +178,8 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
             /* to share the table or get its address because registry entries that */
             /* are unowned are not checked to see if they match names, etc.        */
             RegRecPtr->OwnerAppId = ThisAppId;
+            CFE_ResourceId_NameIndexAdd(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+                                        CFE_TBL_TxnRegId(&Txn), RegRecPtr->Name);
         }
 
         /* Unlock Registry for update */
@@ -316,6 +318,8 @@ CFE_Status_t CFE_TBL_Unregister(CFE_TBL_Handle_t TblHandle)
             /*       removed.  This allows Applications to continue to use the    */
             /*       data until they acknowledge that the table has been removed. */
             RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
+            CFE_ResourceId_NameIndexRemove(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+                                           CFE_TBL_TxnRegId(&Txn));
 
             /* Remove Table Name */
             RegRecPtr->Name[0] = '\0';
@@ -568,6 +568,9 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
     osal_id_t          FileDescriptor = OS_OBJECT_ID_UNDEFINED;
     size_t             FilenameLen    = strlen(Filename);
     uint32             NumBytes;
+    uint32             ChunkSize;
+    uint32             Crc;
+    uint8 *            BufferPtr;
     uint8              ExtraByte;
 
     if (FilenameLen > (OS_MAX_PATH_LEN - 1))
@@ -635,15 +638,37 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
         Status = CFE_TBL_WARN_SHORT_FILE;
     }
 
-    OsStatus =
-        OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset, TblFileHeader.NumBytes);
-    if (OsStatus >= OS_SUCCESS)
-    {
-        NumBytes = OsStatus; /* status code conversion (size) */
-    }
-    else
+    /*
+     * The CRC covers the whole table buffer, including any bytes a partial or
+     * short load retains from the active buffer.  Start it over the retained
+     * leading bytes, then fold in each chunk of the file as soon as it has been
+     * read, while it is still in the cache, rather than making a second pass
+     * over the entire buffer once the read is complete.
+     */
+    BufferPtr = WorkingBufferPtr->BufferPtr;
+    Crc       = CFE_ES_CalculateCRC(BufferPtr, TblFileHeader.Offset, 0, CFE_MISSION_ES_DEFAULT_CRC);
+    BufferPtr += TblFileHeader.Offset;
+    NumBytes = 0;
+
+    while (NumBytes < TblFileHeader.NumBytes)
     {
-        NumBytes = 0;
+        ChunkSize = TblFileHeader.NumBytes - NumBytes;
+        if (ChunkSize > CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE)
+        {
+            ChunkSize = CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE;
+        }
+
+        OsStatus = OS_read(FileDescriptor, BufferPtr, ChunkSize);
+        if (OsStatus <= OS_SUCCESS)
+        {
+            /* End of file or read error, the load is incomplete */
+            break;
+        }
+
+        ChunkSize = OsStatus; /* status code conversion (size) */
+        Crc       = CFE_ES_CalculateCRC(BufferPtr, ChunkSize, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+        BufferPtr += ChunkSize;
+        NumBytes += ChunkSize;
     }
 
     if (NumBytes != TblFileHeader.NumBytes)
@@ -685,9 +710,10 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
     WorkingBufferPtr->FileTime.Seconds    = StdFileHeader.TimeSeconds;
     WorkingBufferPtr->FileTime.Subseconds = StdFileHeader.TimeSubSeconds;
 
-    /* Compute the CRC on the specified table buffer */
+    /* Complete the CRC over any retained bytes following the loaded data */
     WorkingBufferPtr->Crc =
-        CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr, RegRecPtr->Size, 0, CFE_MISSION_ES_DEFAULT_CRC);
+        CFE_ES_CalculateCRC(BufferPtr, RegRecPtr->Size - (TblFileHeader.Offset + TblFileHeader.NumBytes), Crc,
+                            CFE_MISSION_ES_DEFAULT_CRC);
 
     OS_close(FileDescriptor);
 
@@ -1057,6 +1083,8 @@ int32 CFE_TBL_CleanUpApp(CFE_ES_AppId_t AppId)
                 /*       removed.  This allows Applications to continue to use the    */
                 /*       data until they acknowledge that the table has been removed. */
                 Txn.RegRecPtr->OwnerAppId = CFE_TBL_NOT_OWNED;
+                CFE_ResourceId_NameIndexRemove(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES,
+                                               CFE_TBL_TxnRegId(&Txn));
 
                 /* Remove Table Name */
                 Txn.RegRecPtr->Name[0] = '\0';
@@ -172,6 +172,9 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
 ** \par Description
 **        Locates the specified filename in the onboard filesystem
 **        and loads its contents into the specified working buffer.
+**        The table image is read in chunks of #CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE
+**        and the buffer CRC is accumulated as each chunk arrives, so every byte
+**        of the image is only brought into the cache once.
 **
 ** \par Assumptions, External Events, and Notes:
 **        -# This function assumes parameters have been verified.
@@ -363,6 +363,8 @@ typedef struct
     */
     CFE_TBL_AccessDescriptor_t Handles[CFE_PLATFORM_TBL_MAX_NUM_HANDLES]; /**< \brief Array of Access Descriptors */
     CFE_TBL_RegistryRec_t      Registry[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Array of Table Registry Records */
+    CFE_ResourceId_NameIndexEntry_t
+        RegistryNameIndex[CFE_PLATFORM_TBL_MAX_NUM_TABLES]; /**< \brief Name index over owned Registry Records */
     CFE_TBL_CritRegRec_t
         CritReg[CFE_PLATFORM_TBL_MAX_CRITICAL_TABLES]; /**< \brief Array of Critical Table Registry Records */
     CFE_TBL_BufParams_t Buf; /**< \brief Parameters associated with Table Task's Memory Pool */
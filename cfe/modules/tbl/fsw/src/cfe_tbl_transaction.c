@@ -241,6 +241,20 @@ static void CFE_TBL_FindAccessDescHelper(CFE_TBL_AccessDescriptor_t *AccDescPtr,
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Intended to be used with CFE_ResourceId_NameIndexFind()
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_TBL_RegNameMatchHelper(uint32 Slot, const char *Name)
+{
+    CFE_TBL_RegistryRec_t *RegRecPtr = &CFE_TBL_Global.Registry[Slot];
+
+    /* Only records that are currently being used, with a case sensitive name comparison */
+    return (!CFE_RESOURCEID_TEST_EQUAL(RegRecPtr->OwnerAppId, CFE_TBL_NOT_OWNED) && strcmp(Name, RegRecPtr->Name) == 0);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -450,27 +464,16 @@ CFE_Status_t CFE_TBL_TxnGetNextNotification(CFE_TBL_TxnState_t *Txn)
 CFE_Status_t CFE_TBL_TxnFindRegByName(CFE_TBL_TxnState_t *Txn, const char *TblName)
 {
     CFE_Status_t Status = CFE_TBL_ERR_INVALID_NAME;
-    int16        i      = 0;
+    uint32       i;
 
-    while (i < CFE_PLATFORM_TBL_MAX_NUM_TABLES)
+    if (CFE_ResourceId_NameIndexFind(CFE_TBL_Global.RegistryNameIndex, CFE_PLATFORM_TBL_MAX_NUM_TABLES, TblName,
+                                     CFE_TBL_RegNameMatchHelper, &i) == CFE_SUCCESS)
     {
-        /* Check to see if the record is currently being used */
-        if (!CFE_RESOURCEID_TEST_EQUAL(CFE_TBL_Global.Registry[i].OwnerAppId, CFE_TBL_NOT_OWNED))
-        {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_Global.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                Txn->RegId     = i;
-                Txn->RegRecPtr = &CFE_TBL_Global.Registry[i];
+        /* If the names match, then return the index */
+        Txn->RegId     = i;
+        Txn->RegRecPtr = &CFE_TBL_Global.Registry[i];
 
-                Status = CFE_SUCCESS;
-                break;
-            }
-        }
-
-        /* Point to next record in the Table Registry */
-        i++;
+        Status = CFE_SUCCESS;
     }
 
     return Status;
@@ -71,6 +71,10 @@
 #error CFE_PLATFORM_TBL_START_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+#if CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE <= 0
+#error CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE must be greater than zero
+#endif
+
 /*
  * For configuration values that should be multiples of 4
  * as noted in the documentation, this confirms that they are.
@@ -82,4 +86,8 @@
 #error CFE_MISSION_TBL_MAX_FULL_NAME_LEN must be a multiple of 4
 #endif
 
+#if ((CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE % 4) != 0)
+#error CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE must be a multiple of 4
+#endif
+
 #endif /* CFE_TBL_VERIFY_H */
@@ -68,6 +68,9 @@ static union
     uint8              Bytes[UT_TBL_LOAD_BUFFER_SIZE];
 } UT_TBL_LoadBuffer;
 
+/* Table content larger than one load chunk, to exercise a multi-chunk file load */
+static uint8 UT_TBL_LargeTable[CFE_PLATFORM_TBL_LOAD_CHUNK_SIZE + 4];
+
 void * Tbl1Ptr = NULL;
 void * Tbl2Ptr = NULL;
 void **ArrayOfPtrsToTblPtrs[2];
@@ -3258,6 +3261,8 @@ void Test_CFE_TBL_Internal(void)
     CFE_TBL_File_Hdr_t          TblFileHeader;
     osal_id_t                   FileDescriptor;
     void *                      TblPtr;
+    CFE_TBL_LoadBuff_t          LargeBuffer;
+    size_t                      SavedSize;
 
     UtPrintf("Begin Test Internal");
 
@@ -3364,6 +3369,44 @@ void Test_CFE_TBL_Internal(void)
     CFE_UtAssert_EVENTSENT(CFE_TBL_FILE_INCOMPLETE_ERR_EID);
     CFE_UtAssert_EVENTCOUNT(1);
 
+    /* Test CFE_TBL_LoadFromFile continuing after a short read of the file content */
+    UT_InitData();
+    StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    StdFileHeader.SubType     = CFE_FS_SubType_TBL_IMG;
+    strncpy(TblFileHeader.TableName, "ut_cfe_tbl.UT_Table2", sizeof(TblFileHeader.TableName) - 1);
+    TblFileHeader.TableName[sizeof(TblFileHeader.TableName) - 1] = '\0';
+    UT_TBL_SetupHeader(&TblFileHeader, 0, sizeof(UT_Table1_t));
+
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, sizeof(UT_Table1_t) - 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    CFE_UtAssert_SUCCESS(CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, Filename));
+    UtAssert_STUB_COUNT(OS_read, 4);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 4);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test CFE_TBL_LoadFromFile reading a table larger than one chunk */
+    UT_InitData();
+    StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    StdFileHeader.SubType     = CFE_FS_SubType_TBL_IMG;
+    strncpy(TblFileHeader.TableName, "ut_cfe_tbl.UT_Table2", sizeof(TblFileHeader.TableName) - 1);
+    TblFileHeader.TableName[sizeof(TblFileHeader.TableName) - 1] = '\0';
+    UT_TBL_SetupHeader(&TblFileHeader, 0, sizeof(UT_TBL_LargeTable));
+
+    memset(&LargeBuffer, 0, sizeof(LargeBuffer));
+    LargeBuffer.BufferPtr = UT_TBL_LargeTable;
+    SavedSize             = RegRecPtr->Size;
+    RegRecPtr->Size       = sizeof(UT_TBL_LargeTable);
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 4, 0);
+    CFE_UtAssert_SUCCESS(CFE_TBL_LoadFromFile("UT", &LargeBuffer, RegRecPtr, Filename));
+    UtAssert_STUB_COUNT(OS_read, 4);
+    CFE_UtAssert_EVENTCOUNT(0);
+    RegRecPtr->Size = SavedSize;
+
     /* Test CFE_TBL_LoadFromFile with failure of data OS_read */
     UT_InitData();
     StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
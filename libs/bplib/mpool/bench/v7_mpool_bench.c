@@ -0,0 +1,353 @@
+/*
+ * NASA Docket No. GSC-18,587-1 and identified as “The Bundle Protocol Core Flight
+ * System Application (BP) v6.5”
+ *
+ * Copyright © 2020 United States Government as represented by the Administrator of
+ * the National Aeronautics and Space Administration. All Rights Reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/**
+ * @file
+ *
+ * @brief Measures bundle throughput through the memory pool with several
+ * flows moving bundles at once, and how often the mpool locks are taken and
+ * found held.
+ *
+ * Each flow gets two threads, in the pattern bpcat drives the library in:
+ *
+ * - ingress: allocates a primary block, makes a reference and a ref block
+ *   to it, duplicates and releases the reference once more (as the cache
+ *   holding a ref), and pushes the ref block onto the flow ingress queue;
+ * - egress: waits on the ingress queue, forwards what it gets through the
+ *   egress queue (push, move_all, pull) and recycles it, then runs
+ *   bplib_mpool_maintain().
+ *
+ * The mpool sources and v7_rbtree.c are linked as is.  In place of the bplib
+ * OS layer this file has a pthread one that counts every bplib_os_lock() and
+ * the ones that found the lock held.  Build with the BPLIB_MPOOL_BENCH cmake
+ * option, or by hand from the bplib directory:
+ *
+ *   cc -O2 -Iinc -Impool/inc -Impool/src -Ios/inc -Icommon/inc -Iv7/inc -Ilib/inc \
+ *      mpool/bench/v7_mpool_bench.c mpool/src/v7_*.c common/src/v7_rbtree.c -lpthread -o v7_mpool_bench
+ *
+ * and run as "v7_mpool_bench [bundles per flow] [max locks]", by default
+ * 100000 bundles and no limit on locks.  A limit of 2 leaves mpool a single
+ * lock for everything, the way it was before the locks were striped.  Every
+ * block is expected back on the free list at the end of each run.
+ */
+
+/******************************************************************************
+ INCLUDES
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+
+#include "bplib.h"
+#include "bplib_os.h"
+#include "v7_mpool_internal.h"
+
+/******************************************************************************
+ DEFINES
+ ******************************************************************************/
+
+#define UNIX_SECS_AT_2000     946684800
+#define BENCH_MAX_LOCKS       64
+#define BENCH_MAX_FLOWS       8
+#define BENCH_POOL_SIZE       (32u << 20)
+#define BENCH_INGRESS_DEPTH   64
+#define BENCH_EGRESS_DEPTH    128
+#define BENCH_PUSH_TIMEOUT_MS 100
+#define BENCH_PULL_TIMEOUT_MS 10
+
+/******************************************************************************
+ TYPEDEFS
+ ******************************************************************************/
+
+typedef struct
+{
+    pthread_cond_t  cond;
+    pthread_mutex_t mutex;
+} bench_lock_t;
+
+typedef struct
+{
+    bplib_mpool_flow_t *flow;
+    unsigned long       done;
+} bench_flow_t;
+
+/******************************************************************************
+ FILE DATA
+ ******************************************************************************/
+
+static bench_lock_t  locks[BENCH_MAX_LOCKS];
+static int           num_locks;
+static int           max_locks = BENCH_MAX_LOCKS;
+static unsigned long lock_acquires;
+static unsigned long lock_contended;
+
+static bplib_mpool_t *pool;
+static unsigned long  bundles_per_flow;
+
+/******************************************************************************
+ OS LAYER
+ ******************************************************************************/
+
+static bench_lock_t *bench_get_lock(bp_handle_t h)
+{
+    return &locks[bp_handle_to_serial(h, BPLIB_HANDLE_OS_BASE)];
+}
+
+bp_handle_t bplib_os_createlock(void)
+{
+    pthread_mutexattr_t attr;
+
+    if (num_locks >= max_locks)
+    {
+        return BP_INVALID_HANDLE;
+    }
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&locks[num_locks].mutex, &attr);
+    pthread_cond_init(&locks[num_locks].cond, NULL);
+
+    ++num_locks;
+    return bp_handle_from_serial(num_locks - 1, BPLIB_HANDLE_OS_BASE);
+}
+
+void bplib_os_destroylock(bp_handle_t h)
+{
+    /* mpool only gives back the lock it created last */
+    --num_locks;
+}
+
+void bplib_os_lock(bp_handle_t h)
+{
+    bench_lock_t *lock = bench_get_lock(h);
+
+    __atomic_add_fetch(&lock_acquires, 1, __ATOMIC_RELAXED);
+    if (pthread_mutex_trylock(&lock->mutex) != 0)
+    {
+        __atomic_add_fetch(&lock_contended, 1, __ATOMIC_RELAXED);
+        pthread_mutex_lock(&lock->mutex);
+    }
+}
+
+void bplib_os_unlock(bp_handle_t h)
+{
+    pthread_mutex_unlock(&bench_get_lock(h)->mutex);
+}
+
+void bplib_os_broadcast_signal(bp_handle_t h)
+{
+    pthread_cond_broadcast(&bench_get_lock(h)->cond);
+}
+
+uint64_t bplib_os_get_dtntime_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)(ts.tv_sec - UNIX_SECS_AT_2000) * 1000 + ts.tv_nsec / 1000000;
+}
+
+int bplib_os_wait_until_ms(bp_handle_t h, uint64_t abs_dtntime_ms)
+{
+    bench_lock_t   *lock = bench_get_lock(h);
+    struct timespec ts;
+
+    ts.tv_sec  = abs_dtntime_ms / 1000 + UNIX_SECS_AT_2000;
+    ts.tv_nsec = (abs_dtntime_ms % 1000) * 1000000;
+
+    return pthread_cond_timedwait(&lock->cond, &lock->mutex, &ts) == ETIMEDOUT ? BP_TIMEOUT : BP_SUCCESS;
+}
+
+int bplib_os_log(const char *file, unsigned int line, uint32_t *flags, uint32_t event, const char *fmt, ...)
+{
+    return 0;
+}
+
+/******************************************************************************
+ BENCHMARK
+ ******************************************************************************/
+
+/*--------------------------------------------------------------------------------------
+ * bench_ingress - allocates bundles and queues them on the flow ingress
+ *-------------------------------------------------------------------------------------*/
+static void *bench_ingress(void *arg)
+{
+    bench_flow_t        *bf = arg;
+    bplib_mpool_block_t *pblk;
+    bplib_mpool_block_t *rblk;
+    bplib_mpool_ref_t    ref;
+    unsigned long        i;
+
+    for (i = 0; i < bundles_per_flow; ++i)
+    {
+        pblk = NULL;
+        while (pblk == NULL)
+        {
+            pblk = bplib_mpool_bblock_primary_alloc(pool, 0, NULL, BPLIB_MPOOL_ALLOC_PRI_MED, 0);
+            if (pblk == NULL)
+            {
+                bplib_mpool_maintain(pool);
+                sched_yield();
+            }
+        }
+
+        ref  = bplib_mpool_ref_create(pblk);
+        rblk = NULL;
+        while (rblk == NULL)
+        {
+            rblk = bplib_mpool_ref_make_block(ref, 0, NULL);
+            if (rblk == NULL)
+            {
+                bplib_mpool_maintain(pool);
+                sched_yield();
+            }
+        }
+
+        bplib_mpool_ref_release(bplib_mpool_ref_duplicate(ref));
+        bplib_mpool_ref_release(ref);
+
+        while (!bplib_mpool_flow_try_push(&bf->flow->ingress, rblk,
+                                          bplib_os_get_dtntime_ms() + BENCH_PUSH_TIMEOUT_MS))
+        {
+            /* queue full, wait for the egress thread */
+        }
+    }
+
+    return NULL;
+}
+
+/*--------------------------------------------------------------------------------------
+ * bench_egress - forwards bundles from the flow ingress through the egress and recycles them
+ *-------------------------------------------------------------------------------------*/
+static void *bench_egress(void *arg)
+{
+    bench_flow_t        *bf = arg;
+    bplib_mpool_block_t *qblk;
+
+    while (bf->done < bundles_per_flow)
+    {
+        qblk = bplib_mpool_flow_try_pull(&bf->flow->ingress, bplib_os_get_dtntime_ms() + BENCH_PULL_TIMEOUT_MS);
+        if (qblk == NULL)
+        {
+            continue;
+        }
+
+        bplib_mpool_flow_try_push(&bf->flow->egress, qblk, 0);
+        bplib_mpool_flow_try_move_all(&bf->flow->egress, &bf->flow->ingress, 0);
+        while ((qblk = bplib_mpool_flow_try_pull(&bf->flow->egress, 0)) != NULL)
+        {
+            bplib_mpool_recycle_block(qblk);
+            ++bf->done;
+        }
+
+        bplib_mpool_maintain(pool);
+    }
+
+    return NULL;
+}
+
+/*--------------------------------------------------------------------------------------
+ * bench_run - moves bundles_per_flow bundles through each of num_flows flows
+ *
+ * Returns - the elapsed time in seconds
+ *-------------------------------------------------------------------------------------*/
+static double bench_run(bench_flow_t *flows, int num_flows)
+{
+    pthread_t       ingress[BENCH_MAX_FLOWS];
+    pthread_t       egress[BENCH_MAX_FLOWS];
+    struct timespec start;
+    struct timespec end;
+    int             i;
+
+    lock_acquires  = 0;
+    lock_contended = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < num_flows; ++i)
+    {
+        flows[i].done = 0;
+        pthread_create(&ingress[i], NULL, bench_ingress, &flows[i]);
+        pthread_create(&egress[i], NULL, bench_egress, &flows[i]);
+    }
+    for (i = 0; i < num_flows; ++i)
+    {
+        pthread_join(ingress[i], NULL);
+        pthread_join(egress[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    /* return everything recycled to the free list */
+    while (bplib_mpool_collect_blocks(pool, 1000) > 0)
+    {
+    }
+
+    return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+int main(int argc, char *argv[])
+{
+    bench_flow_t flows[BENCH_MAX_FLOWS];
+    size_t       total_free;
+    double       elapsed;
+    int          num_flows;
+    int          i;
+
+    bundles_per_flow = argc > 1 ? strtoul(argv[1], NULL, 0) : 100000;
+    if (argc > 2)
+    {
+        max_locks = atoi(argv[2]);
+    }
+
+    pool = bplib_mpool_create(malloc(BENCH_POOL_SIZE), BENCH_POOL_SIZE);
+    if (pool == NULL || bundles_per_flow == 0)
+    {
+        fprintf(stderr, "cannot create a %u byte pool\n", (unsigned int)BENCH_POOL_SIZE);
+        return 1;
+    }
+
+    for (i = 0; i < BENCH_MAX_FLOWS; ++i)
+    {
+        flows[i].flow = bplib_mpool_flow_cast(bplib_mpool_flow_alloc(pool, 0, NULL));
+        bplib_mpool_flow_enable(&flows[i].flow->ingress, BENCH_INGRESS_DEPTH);
+        bplib_mpool_flow_enable(&flows[i].flow->egress, BENCH_EGRESS_DEPTH);
+    }
+    total_free = bplib_mpool_subq_get_depth(&bplib_mpool_get_admin(pool)->free_blocks);
+
+    printf("%lu bundles per flow, mpool locks: %d\n", bundles_per_flow, num_locks);
+    printf("%6s %12s %14s %14s %11s %10s\n", "flows", "bundles/s", "lock acquires", "held (%)", "per bundle",
+           "all freed");
+
+    for (num_flows = 1; num_flows <= BENCH_MAX_FLOWS; num_flows *= 2)
+    {
+        elapsed = bench_run(flows, num_flows);
+
+        printf("%6d %12.0f %14lu %14.2f %11.1f %10s\n", num_flows, num_flows * bundles_per_flow / elapsed,
+               lock_acquires, lock_acquires ? 100.0 * lock_contended / lock_acquires : 0,
+               (double)lock_acquires / (num_flows * bundles_per_flow),
+               bplib_mpool_subq_get_depth(&bplib_mpool_get_admin(pool)->free_blocks) == total_free ? "yes" : "NO");
+    }
+
+    return 0;
+}
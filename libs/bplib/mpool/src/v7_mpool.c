@@ -35,10 +35,26 @@
  */
 #define BPLIB_MPOOL_MAINTENCE_COLLECT_LIMIT 20
 
-#define BPLIB_MPOOL_NUM_LOCKS 1 /* for now */
+/**
+ * @brief Number of locks in the lock set, must be a power of two
+ *
+ * Resources are spread across the set by address so that unrelated flows can be
+ * operated on concurrently.  If the OS layer cannot supply this many locks then
+ * a smaller power of two is used.
+ */
+#ifndef BPLIB_MPOOL_NUM_LOCKS
+#define BPLIB_MPOOL_NUM_LOCKS 16
+#endif
+
+#if (BPLIB_MPOOL_NUM_LOCKS & (BPLIB_MPOOL_NUM_LOCKS - 1)) != 0
+#error "BPLIB_MPOOL_NUM_LOCKS must be a power of two"
+#endif
 
 bplib_mpool_lock_t BPLIB_MPOOL_LOCK_SET[BPLIB_MPOOL_NUM_LOCKS];
 
+/* selects the lock from a resource hash, set once by bplib_mpool_lock_init() */
+static uint32_t BPLIB_MPOOL_LOCK_MASK;
+
 /*----------------------------------------------------------------
  *
  * Function: bplib_mpool_link_reset
@@ -55,37 +71,72 @@ static inline void bplib_mpool_link_reset(bplib_mpool_block_t *link, bplib_mpool
 
 void bplib_mpool_lock_init(void)
 {
-    uint32_t            i;
-    bplib_mpool_lock_t *lock;
+    uint32_t    num_locks;
+    uint32_t    num_stripes;
+    bp_handle_t lock_id;
 
-    /* note - this relies on the BSS section being properly zero'ed out at start */
-    for (i = 0; i < BPLIB_MPOOL_NUM_LOCKS; ++i)
+    /*
+     * note - this relies on the BSS section being properly zero'ed out at start.
+     * The mapping of resources to locks must not change once any lock is in use,
+     * so this only does anything until the first lock has been created.
+     */
+    if (bp_handle_is_valid(BPLIB_MPOOL_LOCK_SET[0].lock_id))
     {
-        lock = &BPLIB_MPOOL_LOCK_SET[i];
-        if (!bp_handle_is_valid(lock->lock_id))
+        return;
+    }
+
+    for (num_locks = 0; num_locks < BPLIB_MPOOL_NUM_LOCKS; ++num_locks)
+    {
+        lock_id = bplib_os_createlock();
+        if (!bp_handle_is_valid(lock_id))
         {
-            lock->lock_id = bplib_os_createlock();
+            /* the OS layer ran out, so give one back for its other users */
+            if (num_locks > 1)
+            {
+                --num_locks;
+                bplib_os_destroylock(BPLIB_MPOOL_LOCK_SET[num_locks].lock_id);
+                BPLIB_MPOOL_LOCK_SET[num_locks].lock_id = BP_INVALID_HANDLE;
+            }
+            break;
         }
+
+        BPLIB_MPOOL_LOCK_SET[num_locks].lock_id = lock_id;
     }
+
+    /* use the largest power of two that was created, any others would go unused */
+    num_stripes = 1;
+    while ((num_stripes << 1) <= num_locks)
+    {
+        num_stripes <<= 1;
+    }
+
+    while (num_locks > num_stripes)
+    {
+        --num_locks;
+        bplib_os_destroylock(BPLIB_MPOOL_LOCK_SET[num_locks].lock_id);
+        BPLIB_MPOOL_LOCK_SET[num_locks].lock_id = BP_INVALID_HANDLE;
+    }
+
+    BPLIB_MPOOL_LOCK_MASK = num_stripes - 1;
 }
 
 bplib_mpool_lock_t *bplib_mpool_lock_prepare(void *resource_addr)
 {
+    uint32_t hash;
+
     /*
-     * for now, this always uses the same lock (coarse-grained locking) but in the future
-     * it might become a striped or finer-grained bucketed lock for more concurrency
+     * Fibonacci hash of the address, using the upper bits of the product.  Blocks are
+     * all the same size and alignment so the lowest bits of the address say little.
      */
-    return &BPLIB_MPOOL_LOCK_SET[0];
+    hash = (uint32_t)((uintptr_t)resource_addr >> 3) * 0x9E3779B1U;
+
+    return &BPLIB_MPOOL_LOCK_SET[(hash >> 16) & BPLIB_MPOOL_LOCK_MASK];
 }
 
 bplib_mpool_lock_t *bplib_mpool_lock_resource(void *resource_addr)
 {
     bplib_mpool_lock_t *selected_lock;
 
-    /*
-     * for now, this always uses the same lock (coarse-grained locking) but in the future
-     * it might become a striped or finer-grained bucketed lock for more concurrency
-     */
     selected_lock = bplib_mpool_lock_prepare(resource_addr);
     bplib_mpool_lock_acquire(selected_lock);
 
@@ -383,7 +434,7 @@ size_t bplib_mpool_read_refcount(const bplib_mpool_block_t *cb)
     block = bplib_mpool_get_block_content_const(cb);
     if (block != NULL)
     {
-        return block->header.refcount;
+        return __atomic_load_n(&block->header.refcount, __ATOMIC_RELAXED);
     }
     return 0;
 }
@@ -1012,6 +1063,12 @@ uint32_t bplib_mpool_collect_blocks(bplib_mpool_t *pool, uint32_t limit)
         bplib_mpool_subq_push_single(&admin->free_blocks, rblk);
     }
 
+    /* in case any threads were waiting on a free block */
+    if (count > 0)
+    {
+        bplib_mpool_lock_broadcast_signal(lock);
+    }
+
     bplib_mpool_lock_release(lock);
 
     return count;
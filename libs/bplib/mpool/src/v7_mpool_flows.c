@@ -297,19 +297,36 @@ bool bplib_mpool_subq_workitem_wait_for_fill(bplib_mpool_lock_t *lock, bplib_mpo
 
 /*----------------------------------------------------------------
  *
- * Function: bplib_mpool_flow_try_push
+ * Function: bplib_mpool_flow_mark_active
+ *
+ * Internal function, the lock of the subq must NOT be held when invoked
  *
  *-----------------------------------------------------------------*/
-bool bplib_mpool_flow_try_push(bplib_mpool_subq_workitem_t *subq_dst, bplib_mpool_block_t *qblk, uint64_t abs_timeout)
+static void bplib_mpool_flow_mark_active(bplib_mpool_subq_workitem_t *subq)
 {
     bplib_mpool_lock_t                *lock;
-    bool                               got_space;
     bplib_mpool_block_admin_content_t *admin;
     bplib_mpool_t                     *pool;
 
-    pool  = bplib_mpool_get_parent_pool_from_link(&subq_dst->job_header.link);
+    pool  = bplib_mpool_get_parent_pool_from_link(&subq->job_header.link);
     admin = bplib_mpool_get_admin(pool);
-    lock  = bplib_mpool_lock_resource(pool);
+
+    lock = bplib_mpool_lock_resource(pool);
+    bplib_mpool_job_mark_active_internal(&admin->active_list, &subq->job_header);
+    bplib_mpool_lock_release(lock);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: bplib_mpool_flow_try_push
+ *
+ *-----------------------------------------------------------------*/
+bool bplib_mpool_flow_try_push(bplib_mpool_subq_workitem_t *subq_dst, bplib_mpool_block_t *qblk, uint64_t abs_timeout)
+{
+    bplib_mpool_lock_t *lock;
+    bool                got_space;
+
+    lock = bplib_mpool_lock_resource(subq_dst);
 
     got_space = bplib_mpool_subq_workitem_wait_for_space(lock, subq_dst, 1, abs_timeout);
     if (got_space)
@@ -317,15 +334,18 @@ bool bplib_mpool_flow_try_push(bplib_mpool_subq_workitem_t *subq_dst, bplib_mpoo
         /* this does not fail, but must be done under lock to keep things consistent */
         bplib_mpool_subq_push_single(&subq_dst->base_subq, qblk);
 
-        /* mark the flow as "active" - done directly here while the lock is still held */
-        bplib_mpool_job_mark_active_internal(&admin->active_list, &subq_dst->job_header);
-
         /* in case any threads were waiting on a non-empty queue */
         bplib_mpool_lock_broadcast_signal(lock);
     }
 
     bplib_mpool_lock_release(lock);
 
+    if (got_space)
+    {
+        /* mark the flow as "active" - this is under the pool lock, so it must be done after the above */
+        bplib_mpool_flow_mark_active(subq_dst);
+    }
+
     return got_space;
 }
 
@@ -334,11 +354,9 @@ bplib_mpool_block_t *bplib_mpool_flow_try_pull(bplib_mpool_subq_workitem_t *subq
     bplib_mpool_lock_t  *lock;
     bplib_mpool_block_t *qblk;
     bool                 got_space;
-    bplib_mpool_t       *pool;
 
     qblk = NULL;
-    pool = bplib_mpool_get_parent_pool_from_link(&subq_src->job_header.link);
-    lock = bplib_mpool_lock_resource(pool);
+    lock = bplib_mpool_lock_resource(subq_src);
 
     got_space = bplib_mpool_subq_workitem_wait_for_fill(lock, subq_src, 1, abs_timeout);
     if (got_space)
@@ -357,48 +375,64 @@ bplib_mpool_block_t *bplib_mpool_flow_try_pull(bplib_mpool_subq_workitem_t *subq
 uint32_t bplib_mpool_flow_try_move_all(bplib_mpool_subq_workitem_t *subq_dst, bplib_mpool_subq_workitem_t *subq_src,
                                        uint64_t abs_timeout)
 {
-    bplib_mpool_lock_t                *lock;
-    uint32_t                           prev_quantity;
-    uint32_t                           quantity;
-    bool                               got_space;
-    bplib_mpool_block_admin_content_t *admin;
-    bplib_mpool_t                     *pool;
-
-    got_space = false;
-    pool      = bplib_mpool_get_parent_pool_from_link(&subq_dst->job_header.link);
-    admin     = bplib_mpool_get_admin(pool);
-    lock      = bplib_mpool_lock_resource(pool);
+    bplib_mpool_lock_t *dst_lock;
+    bplib_mpool_lock_t *src_lock;
+    uint32_t            quantity;
+    bool                got_space;
+    bool                within_timeout;
+
+    dst_lock       = bplib_mpool_lock_prepare(subq_dst);
+    src_lock       = bplib_mpool_lock_prepare(subq_src);
+    within_timeout = (abs_timeout != 0);
 
     /* note, there is a possibility that while waiting, another task puts more entries
      * into the source queue.  This loop will catch that and wait again.  However it
      * will not catch the case of another thread taking out of the source queue, as
      * it will still wait for the original amount. */
-    quantity = bplib_mpool_subq_get_depth(&subq_src->base_subq);
-    do
+    while (true)
     {
-        prev_quantity = quantity;
-        got_space     = bplib_mpool_subq_workitem_wait_for_space(lock, subq_dst, quantity, abs_timeout);
-        quantity      = bplib_mpool_subq_get_depth(&subq_src->base_subq);
+        bplib_mpool_lock_acquire_pair(dst_lock, src_lock);
+
+        quantity  = bplib_mpool_subq_get_depth(&subq_src->base_subq);
+        got_space = (bplib_mpool_subq_get_depth(&subq_dst->base_subq) + quantity) <= subq_dst->current_depth_limit;
+        if (got_space || !within_timeout)
+        {
+            break;
+        }
+
+        /* wait for something to pull from the destination, holding only its lock */
+        if (src_lock != dst_lock)
+        {
+            bplib_mpool_lock_release(src_lock);
+        }
+        within_timeout = bplib_mpool_lock_wait(dst_lock, abs_timeout);
+        bplib_mpool_lock_release(dst_lock);
     }
-    while (got_space && quantity > prev_quantity);
 
     if (got_space)
     {
         /* this does not fail, but must be done under lock to keep things consistent */
         quantity = bplib_mpool_subq_move_all(&subq_dst->base_subq, &subq_src->base_subq);
 
-        /* mark the flow as "active" - done directly here while the lock is still held */
-        bplib_mpool_job_mark_active_internal(&admin->active_list, &subq_dst->job_header);
-
-        /* in case any threads were waiting on a non-empty queue */
-        bplib_mpool_lock_broadcast_signal(lock);
+        /* in case any threads were waiting on a non-empty or non-full queue */
+        bplib_mpool_lock_broadcast_signal(dst_lock);
+        if (src_lock != dst_lock)
+        {
+            bplib_mpool_lock_broadcast_signal(src_lock);
+        }
     }
     else
     {
         quantity = 0;
     }
 
-    bplib_mpool_lock_release(lock);
+    bplib_mpool_lock_release_pair(dst_lock, src_lock);
+
+    if (got_space)
+    {
+        /* mark the flow as "active" - this is under the pool lock, so it must be done after the above */
+        bplib_mpool_flow_mark_active(subq_dst);
+    }
 
     return quantity;
 }
@@ -410,21 +444,29 @@ uint32_t bplib_mpool_flow_try_move_all(bplib_mpool_subq_workitem_t *subq_dst, bp
  *-----------------------------------------------------------------*/
 uint32_t bplib_mpool_flow_disable(bplib_mpool_subq_workitem_t *subq)
 {
-    bplib_mpool_t      *pool;
-    bplib_mpool_lock_t *lock;
-    uint32_t            quantity_dropped;
+    bplib_mpool_t          *pool;
+    bplib_mpool_lock_t     *lock;
+    bplib_mpool_subq_base_t dropped;
+    uint32_t                quantity_dropped;
 
     pool = bplib_mpool_get_parent_pool_from_link(&subq->job_header.link);
-    lock = bplib_mpool_lock_resource(pool);
+    lock = bplib_mpool_lock_resource(subq);
 
     /* prevents any additional entries in flow queues */
     subq->current_depth_limit = 0;
-    quantity_dropped          = bplib_mpool_subq_drop_all(pool, &subq->base_subq);
 
-    bplib_mpool_job_cancel_internal(&subq->job_header);
+    /* the entries are recycled under the pool lock, so take them out of the queue here */
+    bplib_mpool_subq_init(NULL, &dropped);
+    quantity_dropped = bplib_mpool_subq_move_all(&dropped, &subq->base_subq);
 
     bplib_mpool_lock_release(lock);
 
+    bplib_mpool_subq_drop_all(pool, &dropped);
+
+    lock = bplib_mpool_lock_resource(pool);
+    bplib_mpool_job_cancel_internal(&subq->job_header);
+    bplib_mpool_lock_release(lock);
+
     return quantity_dropped;
 }
 
@@ -435,11 +477,9 @@ uint32_t bplib_mpool_flow_disable(bplib_mpool_subq_workitem_t *subq)
  *-----------------------------------------------------------------*/
 void bplib_mpool_flow_enable(bplib_mpool_subq_workitem_t *subq, uint32_t depth_limit)
 {
-    bplib_mpool_t      *pool;
     bplib_mpool_lock_t *lock;
 
-    pool = bplib_mpool_get_parent_pool_from_link(&subq->job_header.link);
-    lock = bplib_mpool_lock_resource(pool);
+    lock = bplib_mpool_lock_resource(subq);
 
     /* prevents any additional entries in flow queues */
     subq->current_depth_limit = depth_limit;
@@ -50,7 +50,7 @@ typedef struct bplib_mpool_block_header
 
     uint32_t content_type_signature; /* a "signature" (sanity check) value for identifying the data */
     uint16_t user_content_length;    /* actual length of user content (does not include fixed fields) */
-    uint16_t refcount;               /* number of active references to the object */
+    uint16_t refcount;               /* number of active references to the object, only modified atomically */
 
 } bplib_mpool_block_header_t;
 
@@ -215,6 +215,65 @@ static inline void bplib_mpool_lock_broadcast_signal(bplib_mpool_lock_t *lock)
     bplib_os_broadcast_signal(lock->lock_id);
 }
 
+/*
+ * Locks are striped by resource address, so separate resources may or may not share
+ * a lock.  The resources are:
+ *
+ *  - the pool itself, which covers the free and recycle lists, the active job list,
+ *    the blocktype registry, and the state flags of all flows
+ *  - each subq workitem (flow ingress or egress queue), which covers its queue and depth limit
+ *
+ * Refcounts are updated atomically and do not need a lock.  To avoid deadlock:
+ *
+ *  - The pool lock is never held together with any other lock.  Work on the active
+ *    list that follows a queue operation is done after the queue lock is released.
+ *  - Operations between two queues, which may belong to different flows, acquire both
+ *    locks with bplib_mpool_lock_acquire_pair() and never any third lock.
+ *  - A wait is only done with a single lock held, as the wait only releases that lock.
+ */
+
+/**
+ * @brief Acquires the locks for two resources
+ *
+ * The locks are always acquired in the order of their position in the lock set, which
+ * prevents deadlock between threads operating on the same two resources in opposite
+ * directions.  If both resources share a lock, it is only acquired once.
+ *
+ * @param lock1
+ * @param lock2
+ */
+static inline void bplib_mpool_lock_acquire_pair(bplib_mpool_lock_t *lock1, bplib_mpool_lock_t *lock2)
+{
+    if (lock2 < lock1)
+    {
+        bplib_mpool_lock_acquire(lock2);
+        bplib_mpool_lock_acquire(lock1);
+    }
+    else
+    {
+        bplib_mpool_lock_acquire(lock1);
+        if (lock2 != lock1)
+        {
+            bplib_mpool_lock_acquire(lock2);
+        }
+    }
+}
+
+/**
+ * @brief Releases the locks acquired by bplib_mpool_lock_acquire_pair()
+ *
+ * @param lock1
+ * @param lock2
+ */
+static inline void bplib_mpool_lock_release_pair(bplib_mpool_lock_t *lock1, bplib_mpool_lock_t *lock2)
+{
+    if (lock2 != lock1)
+    {
+        bplib_mpool_lock_release(lock2);
+    }
+    bplib_mpool_lock_release(lock1);
+}
+
 /**
  * @brief Prepares for resource-based locking
  *
@@ -38,17 +38,14 @@
  *-----------------------------------------------------------------*/
 bplib_mpool_ref_t bplib_mpool_ref_duplicate(bplib_mpool_ref_t refptr)
 {
-    bplib_mpool_lock_t *lock;
-
     /*
      * If the refcount is 0, that means this is still a regular (non-refcounted) object,
      * or it should have been garbage-collected already, so something is broken.
      */
+    assert(__atomic_load_n(&refptr->header.refcount, __ATOMIC_RELAXED) > 0);
 
-    lock = bplib_mpool_lock_resource(&refptr->header.base_link);
-    assert(refptr->header.refcount > 0);
-    ++refptr->header.refcount;
-    bplib_mpool_lock_release(lock);
+    /* the caller already holds a reference, so no ordering is needed to add another */
+    __atomic_add_fetch(&refptr->header.refcount, 1, __ATOMIC_RELAXED);
 
     return refptr;
 }
@@ -61,7 +58,6 @@ bplib_mpool_ref_t bplib_mpool_ref_duplicate(bplib_mpool_ref_t refptr)
 bplib_mpool_ref_t bplib_mpool_ref_create(bplib_mpool_block_t *blk)
 {
     bplib_mpool_block_content_t *content;
-    bplib_mpool_lock_t          *lock;
 
     /*
      * This drills down to the actual base object (the "root" so to speak), so that the
@@ -75,9 +71,7 @@ bplib_mpool_ref_t bplib_mpool_ref_create(bplib_mpool_block_t *blk)
         return NULL;
     }
 
-    lock = bplib_mpool_lock_resource(content);
-    ++content->header.refcount;
-    bplib_mpool_lock_release(lock);
+    __atomic_add_fetch(&content->header.refcount, 1, __ATOMIC_RELAXED);
 
     return content;
 }
@@ -139,7 +133,7 @@ bplib_mpool_ref_t bplib_mpool_ref_from_block(bplib_mpool_block_t *rblk)
 void bplib_mpool_ref_release(bplib_mpool_ref_t refptr)
 {
     bplib_mpool_block_header_t *block_hdr;
-    bplib_mpool_lock_t         *lock;
+    uint16_t                    prev_count;
     bool                        needs_recycle;
 
     if (refptr != NULL)
@@ -147,16 +141,17 @@ void bplib_mpool_ref_release(bplib_mpool_ref_t refptr)
         block_hdr = &refptr->header;
 
         /*
-         * Refcount decrement must be done under lock, but it can be
-         * a fine-grained lock.
+         * Decrement without going below zero.  This is acquire/release so that the
+         * thread which drops the last reference sees everything done through the
+         * other references before it recycles the block.
          */
-        lock = bplib_mpool_lock_resource(refptr);
-        if (block_hdr->refcount > 0)
+        prev_count = __atomic_load_n(&block_hdr->refcount, __ATOMIC_RELAXED);
+        while (prev_count > 0 && !__atomic_compare_exchange_n(&block_hdr->refcount, &prev_count, prev_count - 1,
+                                                              false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
         {
-            --block_hdr->refcount;
+            /* prev_count was updated to the current value, try again */
         }
-        needs_recycle = (block_hdr->refcount == 0);
-        bplib_mpool_lock_release(lock);
+        needs_recycle = (prev_count <= 1);
 
         if (needs_recycle)
         {
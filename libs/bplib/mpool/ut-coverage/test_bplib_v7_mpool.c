@@ -28,6 +28,8 @@
 
 const uint32 UT_TESTBLOCKTYPE_SIG = 0x5f33c01a;
 
+extern bplib_mpool_lock_t BPLIB_MPOOL_LOCK_SET[];
+
 void UT_AltHandler_PointerReturnForSignature(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     bp_val_t RefSig = UT_Hook_GetArgValueByName(Context, "search_key_value", bp_val_t);
@@ -51,6 +53,13 @@ void test_bplib_mpool_lock_init(void)
     /* Call it twice, first time should init, second time should skip init */
     UtAssert_VOIDCALL(bplib_mpool_lock_init());
     UtAssert_VOIDCALL(bplib_mpool_lock_init());
+    UtAssert_STUB_COUNT(bplib_os_destroylock, 0);
+
+    /* If the OS runs out after 3 locks, one is given back and 2 are used */
+    memset(&BPLIB_MPOOL_LOCK_SET[0], 0, sizeof(BPLIB_MPOOL_LOCK_SET[0]));
+    UT_SetDeferredRetcode(UT_KEY(bplib_os_createlock), 4, 0);
+    UtAssert_VOIDCALL(bplib_mpool_lock_init());
+    UtAssert_STUB_COUNT(bplib_os_destroylock, 1);
 }
 
 void test_bplib_mpool_lock_prepare(void)
@@ -59,7 +68,12 @@ void test_bplib_mpool_lock_prepare(void)
      * bplib_mpool_lock_t *bplib_mpool_lock_prepare(void *resource_addr)
      */
 
+    UT_bplib_mpool_buf_t buf;
+
     UtAssert_NOT_NULL(bplib_mpool_lock_prepare(NULL));
+
+    /* the same resource must always get the same lock */
+    UtAssert_ADDRESS_EQ(bplib_mpool_lock_prepare(&buf.blk[1]), bplib_mpool_lock_prepare(&buf.blk[1]));
 }
 
 void test_bplib_mpool_lock_resource(void)
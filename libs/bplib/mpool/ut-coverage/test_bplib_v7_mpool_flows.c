@@ -174,6 +174,14 @@ void test_bplib_mpool_flow_disable(void)
     test_setup_mpblock(&buf.pool, &buf.blk[0], bplib_mpool_blocktype_flow, 0);
 
     UtAssert_ZERO(bplib_mpool_flow_disable(&buf.blk[0].u.flow.fblock.ingress));
+
+    /* anything still queued is recycled */
+    test_setup_mpblock(&buf.pool, &buf.blk[1], bplib_mpool_blocktype_primary, 0);
+    bplib_mpool_subq_push_single(&buf.blk[0].u.flow.fblock.egress.base_subq, &buf.blk[1].header.base_link);
+    UtAssert_UINT32_EQ(bplib_mpool_flow_disable(&buf.blk[0].u.flow.fblock.egress), 1);
+    UtAssert_UINT32_EQ(buf.blk[0].u.flow.fblock.egress.base_subq.pull_count, 1);
+    UtAssert_ADDRESS_EQ(bplib_mpool_get_prev_block(&bplib_mpool_get_admin(&buf.pool)->recycle_blocks.block_list),
+                        &buf.blk[1]);
 }
 
 void test_bplib_mpool_flow_enable(void)
@@ -230,6 +238,7 @@ void test_bplib_mpool_flow_try_move_all(void)
      * *subq_src, uint64_t abs_timeout)
      */
     UT_bplib_mpool_buf_t buf;
+    uint32               num_locks;
 
     memset(&buf, 0, sizeof(buf));
     test_setup_mpblock(&buf.pool, &buf.pool.admin_block, bplib_mpool_blocktype_admin, 0);
@@ -237,10 +246,21 @@ void test_bplib_mpool_flow_try_move_all(void)
     test_setup_mpblock(&buf.pool, &buf.blk[1], bplib_mpool_blocktype_primary, 0);
     test_setup_mpblock(&buf.pool, &buf.blk[2], bplib_mpool_blocktype_primary, 0);
 
+    /* the two queues may or may not share a lock, each lock involved is signaled */
+    if (bplib_mpool_lock_prepare(&buf.blk[0].u.flow.fblock.egress) ==
+        bplib_mpool_lock_prepare(&buf.blk[0].u.flow.fblock.ingress))
+    {
+        num_locks = 1;
+    }
+    else
+    {
+        num_locks = 2;
+    }
+
     UtAssert_ZERO(
         bplib_mpool_flow_try_move_all(&buf.blk[0].u.flow.fblock.egress, &buf.blk[0].u.flow.fblock.ingress, 0));
     /* Even though the above did nothing it still signals on the lock */
-    UtAssert_STUB_COUNT(bplib_os_broadcast_signal, 1);
+    UtAssert_STUB_COUNT(bplib_os_broadcast_signal, num_locks);
 
     UtAssert_VOIDCALL(bplib_mpool_flow_enable(&buf.blk[0].u.flow.fblock.ingress, 1));
     UtAssert_VOIDCALL(bplib_mpool_flow_enable(&buf.blk[0].u.flow.fblock.egress, 1));
@@ -248,7 +268,7 @@ void test_bplib_mpool_flow_try_move_all(void)
         bplib_mpool_subq_push_single(&buf.blk[0].u.flow.fblock.ingress.base_subq, &buf.blk[1].header.base_link));
     UtAssert_UINT32_EQ(
         bplib_mpool_flow_try_move_all(&buf.blk[0].u.flow.fblock.egress, &buf.blk[0].u.flow.fblock.ingress, 0), 1);
-    UtAssert_STUB_COUNT(bplib_os_broadcast_signal, 2);
+    UtAssert_STUB_COUNT(bplib_os_broadcast_signal, 2 * num_locks);
 
     UT_SetHandlerFunction(UT_KEY(bplib_os_wait_until_ms), UT_AltHandler_MoveQueue, &buf.blk[0].u.flow.fblock);
     UT_SetDeferredRetcode(UT_KEY(bplib_os_wait_until_ms), 2, BP_TIMEOUT);
@@ -256,7 +276,7 @@ void test_bplib_mpool_flow_try_move_all(void)
         bplib_mpool_subq_push_single(&buf.blk[0].u.flow.fblock.ingress.base_subq, &buf.blk[2].header.base_link));
     UtAssert_ZERO(
         bplib_mpool_flow_try_move_all(&buf.blk[0].u.flow.fblock.ingress, &buf.blk[0].u.flow.fblock.egress, 100));
-    UtAssert_STUB_COUNT(bplib_os_broadcast_signal, 2);
+    UtAssert_STUB_COUNT(bplib_os_broadcast_signal, 2 * num_locks);
 }
 
 void test_bplib_mpool_flow_try_pull(void)
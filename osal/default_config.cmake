@@ -206,6 +206,28 @@ set(OSAL_CONFIG_CONSOLE_ASYNC                   TRUE
     CACHE BOOL "Controls spawning of a separate utility task for OS_printf"
 )
 
+#
+# OSAL_CONFIG_POSIX_INPROC_QUEUES
+# ----------------------------------
+#
+# Controls the implementation of OSAL message queues on POSIX targets.
+#
+# If set FALSE (default), each OSAL queue is a POSIX message queue.  Every
+# put/get is a system call, and the depth is limited by the kernel settings
+# in /proc/sys/fs/mqueue unless running as root.
+#
+# If set TRUE, each OSAL queue is a ring buffer in process memory protected
+# by a pthread mutex and condition variable.  Operations stay in user space
+# unless a reader needs to sleep or be woken, and the depth is only limited
+# by OSAL_CONFIG_QUEUE_MAX_DEPTH.  The queue storage is allocated from the
+# heap when the queue is created.
+#
+# This has no effect on other OS implementations.
+#
+set(OSAL_CONFIG_POSIX_INPROC_QUEUES             FALSE
+    CACHE BOOL "Use in-process ring buffers instead of POSIX message queues"
+)
+
 #############################################
 # Resource Limits for the OS API
 #############################################
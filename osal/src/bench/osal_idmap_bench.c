@@ -0,0 +1,225 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Measures the cost of OSAL calls that resolve an object ID, with several
+ * tasks making them at the same time.  Each task works on its own object,
+ * so any slowdown as tasks are added comes from the ID resolution itself:
+ *
+ * - "queue put+get" is OS_QueuePut then OS_QueueGet (OS_CHECK) on the
+ *   task's own queue, the path taken by every SB transmit and receive;
+ * - "mutex take+give" is OS_MutSemTake then OS_MutSemGive on the task's
+ *   own mutex;
+ * - "file lseek" is OS_lseek on the task's own file, which resolves its ID
+ *   in OS_LOCK_MODE_REFCOUNT, the mode that takes the per-type table lock
+ *   when the lock-free reference cannot be used.
+ *
+ * The tasks start together from a binary semaphore flush and the time is
+ * taken until the last one finishes.  Build with the OSAL_IDMAP_BENCH cmake
+ * option, or by hand against an OSAL build:
+ *
+ *   cc -O2 -I../os/inc -I<osal build dir>/inc osal_idmap_bench.c \
+ *      -L<osal build dir> -losal -losal_bsp -lpthread -lrt -o osal_idmap_bench
+ *
+ * and run as "osal_idmap_bench [operations per task] [directory]", by
+ * default 200000 and /tmp.  To compare with the locked ID resolution, build
+ * the same way against the OSAL from before the lock-free fast path.
+ */
+
+#include "osapi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_MAX_TASKS   8
+#define BENCH_STACK_SIZE  16384
+#define BENCH_PRIORITY    100
+#define BENCH_QUEUE_DEPTH 4
+#define BENCH_VIRT_DIR    "/bench"
+
+typedef enum
+{
+    BENCH_QUEUE,
+    BENCH_MUTEX,
+    BENCH_LSEEK,
+    BENCH_NUM_CASES
+} Bench_Case_t;
+
+typedef struct
+{
+    osal_id_t TaskId;
+    osal_id_t QueueId;
+    osal_id_t MutexId;
+    osal_id_t FileId;
+} Bench_Task_t;
+
+static Bench_Task_t BenchTasks[BENCH_MAX_TASKS];
+static uint32       BenchNumTasks;
+static uint32       BenchOps;
+static Bench_Case_t BenchCase;
+static osal_id_t    BenchStartSem;
+static osal_id_t    BenchDoneSem;
+
+static double Now(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return Ts.tv_sec + Ts.tv_nsec / 1e9;
+}
+
+static void BenchTask(void)
+{
+    osal_id_t     Self = OS_TaskGetId();
+    Bench_Task_t *Task = NULL;
+    uint32        Data = 0;
+    size_t        Size;
+    uint32        i;
+
+    OS_BinSemTake(BenchStartSem);
+
+    for (i = 0; i < BenchNumTasks; i++)
+    {
+        if (OS_ObjectIdEqual(BenchTasks[i].TaskId, Self))
+        {
+            Task = &BenchTasks[i];
+        }
+    }
+
+    for (i = 0; Task != NULL && i < BenchOps; i++)
+    {
+        switch (BenchCase)
+        {
+            case BENCH_QUEUE:
+                OS_QueuePut(Task->QueueId, &Data, sizeof(Data), 0);
+                OS_QueueGet(Task->QueueId, &Data, sizeof(Data), &Size, OS_CHECK);
+                break;
+            case BENCH_MUTEX:
+                OS_MutSemTake(Task->MutexId);
+                OS_MutSemGive(Task->MutexId);
+                break;
+            default:
+                OS_lseek(Task->FileId, 0, OS_SEEK_SET);
+                break;
+        }
+    }
+
+    OS_CountSemGive(BenchDoneSem);
+}
+
+static double RunCase(Bench_Case_t Case, uint32 NumTasks)
+{
+    char   Name[OS_MAX_API_NAME];
+    double Start;
+    double Elapsed;
+    uint32 i;
+
+    BenchCase    = Case;
+    BenchNumTasks = NumTasks;
+
+    for (i = 0; i < NumTasks; i++)
+    {
+        snprintf(Name, sizeof(Name), "BenchTask%u", (unsigned int)i);
+        if (OS_TaskCreate(&BenchTasks[i].TaskId, Name, BenchTask, OSAL_TASK_STACK_ALLOCATE,
+                          OSAL_SIZE_C(BENCH_STACK_SIZE), OSAL_PRIORITY_C(BENCH_PRIORITY), 0) != OS_SUCCESS)
+        {
+            printf("cannot create task %s\n", Name);
+            OS_ApplicationExit(1);
+        }
+    }
+
+    /* let every task reach the start semaphore */
+    OS_TaskDelay(100);
+
+    Start = Now();
+    OS_BinSemFlush(BenchStartSem);
+    for (i = 0; i < NumTasks; i++)
+    {
+        OS_CountSemTake(BenchDoneSem);
+    }
+    Elapsed = Now() - Start;
+
+    /* let the tasks exit before their names are used again */
+    OS_TaskDelay(100);
+
+    return Elapsed / ((double)NumTasks * BenchOps);
+}
+
+void OS_Application_Startup(void)
+{
+    static const char *Names[BENCH_NUM_CASES] = {"queue put+get", "mutex take+give", "file lseek"};
+    char *const *      ArgV                   = OS_BSP_GetArgV();
+    uint32             ArgC                   = OS_BSP_GetArgC();
+    const char *       Dir                    = ArgC > 2 ? ArgV[2] : "/tmp";
+    char               Name[OS_MAX_PATH_LEN];
+    osal_id_t          FsId;
+    uint32             NumTasks;
+    uint32             i;
+    int                c;
+
+    BenchOps = ArgC > 1 ? atol(ArgV[1]) : 200000;
+
+    if (OS_API_Init() != OS_SUCCESS || OS_FileSysAddFixedMap(&FsId, Dir, BENCH_VIRT_DIR) != OS_SUCCESS ||
+        OS_BinSemCreate(&BenchStartSem, "BenchStart", 0, 0) != OS_SUCCESS ||
+        OS_CountSemCreate(&BenchDoneSem, "BenchDone", 0, 0) != OS_SUCCESS)
+    {
+        printf("cannot set up OSAL with bench directory %s\n", Dir);
+        OS_ApplicationExit(1);
+    }
+
+    for (i = 0; i < BENCH_MAX_TASKS; i++)
+    {
+        snprintf(Name, sizeof(Name), "BenchQueue%u", (unsigned int)i);
+        OS_QueueCreate(&BenchTasks[i].QueueId, Name, OSAL_BLOCKCOUNT_C(BENCH_QUEUE_DEPTH), OSAL_SIZE_C(sizeof(uint32)),
+                       0);
+        snprintf(Name, sizeof(Name), "BenchMutex%u", (unsigned int)i);
+        OS_MutSemCreate(&BenchTasks[i].MutexId, Name, 0);
+        snprintf(Name, sizeof(Name), BENCH_VIRT_DIR "/osal_idmap_bench%u.dat", (unsigned int)i);
+        OS_OpenCreate(&BenchTasks[i].FileId, Name, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+    }
+
+    printf("%u operations per task, ns per operation\n", (unsigned int)BenchOps);
+    printf("%-16s", "tasks");
+    for (NumTasks = 1; NumTasks <= BENCH_MAX_TASKS; NumTasks *= 2)
+    {
+        printf(" %8u", (unsigned int)NumTasks);
+    }
+    printf("\n");
+
+    for (c = 0; c < BENCH_NUM_CASES; c++)
+    {
+        printf("%-16s", Names[c]);
+        for (NumTasks = 1; NumTasks <= BENCH_MAX_TASKS; NumTasks *= 2)
+        {
+            printf(" %8.1f", RunCase(c, NumTasks) * 1e9);
+            fflush(stdout);
+        }
+        printf("\n");
+    }
+
+    for (i = 0; i < BENCH_MAX_TASKS; i++)
+    {
+        OS_close(BenchTasks[i].FileId);
+        snprintf(Name, sizeof(Name), BENCH_VIRT_DIR "/osal_idmap_bench%u.dat", (unsigned int)i);
+        OS_remove(Name);
+    }
+
+    OS_ApplicationExit(0);
+}
@@ -0,0 +1,260 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Declarations and inline functions for atomic operations on 32-bit values
+ * and pointers
+ *
+ * Where the compiler provides the GCC atomic builtins (GCC and clang), these
+ * compile to lock-free instructions and OS_ATOMIC_LOCKFREE is defined.  With
+ * any other compiler every operation is serialized by an OSAL internal lock,
+ * so the operations are still atomic with respect to each other, but a task
+ * performing one may block.
+ *
+ * All operations are sequentially consistent.
+ */
+
+#ifndef OSAPI_ATOMIC_H
+#define OSAPI_ATOMIC_H
+
+#include "osconfig.h"
+#include "common_types.h"
+
+#if defined(__GNUC__) && defined(__ATOMIC_SEQ_CST)
+#define OS_ATOMIC_LOCKFREE
+#endif
+
+/** @defgroup OSAPIAtomic OSAL Atomic APIs
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Take the lock that serializes atomic operations
+ *
+ * Only used by the atomic operations below when the compiler has no atomic
+ * builtins.  Not intended to be called directly.
+ */
+void OS_AtomicLock(void);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Release the lock that serializes atomic operations
+ *
+ * Only used by the atomic operations below when the compiler has no atomic
+ * builtins.  Not intended to be called directly.
+ */
+void OS_AtomicUnlock(void);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically read a 32-bit value
+ *
+ * @param[in] Ptr Value to read @nonnull
+ * @returns The value
+ */
+static inline uint32 OS_AtomicLoad32(const volatile uint32 *Ptr)
+{
+#ifdef OS_ATOMIC_LOCKFREE
+    return __atomic_load_n(Ptr, __ATOMIC_SEQ_CST);
+#else
+    uint32 Value;
+
+    OS_AtomicLock();
+    Value = *Ptr;
+    OS_AtomicUnlock();
+
+    return Value;
+#endif
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically write a 32-bit value
+ *
+ * @param[out] Ptr   Value to write @nonnull
+ * @param[in]  Value New value
+ */
+static inline void OS_AtomicStore32(volatile uint32 *Ptr, uint32 Value)
+{
+#ifdef OS_ATOMIC_LOCKFREE
+    __atomic_store_n(Ptr, Value, __ATOMIC_SEQ_CST);
+#else
+    OS_AtomicLock();
+    *Ptr = Value;
+    OS_AtomicUnlock();
+#endif
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically replace a 32-bit value, returning the previous value
+ *
+ * @param[inout] Ptr   Value to replace @nonnull
+ * @param[in]    Value New value
+ * @returns The value before it was replaced
+ */
+static inline uint32 OS_AtomicExchange32(volatile uint32 *Ptr, uint32 Value)
+{
+#ifdef OS_ATOMIC_LOCKFREE
+    return __atomic_exchange_n(Ptr, Value, __ATOMIC_SEQ_CST);
+#else
+    uint32 Previous;
+
+    OS_AtomicLock();
+    Previous = *Ptr;
+    *Ptr     = Value;
+    OS_AtomicUnlock();
+
+    return Previous;
+#endif
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically replace a 32-bit value if it holds an expected value
+ *
+ * If the value equals *ExpectedPtr it is set to Desired.  Otherwise the
+ * value is left unchanged and its current contents are stored in *ExpectedPtr,
+ * ready for the caller to retry.
+ *
+ * @param[inout] Ptr         Value to update @nonnull
+ * @param[inout] ExpectedPtr Expected value, updated on failure @nonnull
+ * @param[in]    Desired     New value
+ * @returns true if the value was replaced, false otherwise
+ */
+static inline bool OS_AtomicCompareAndSwap32(volatile uint32 *Ptr, uint32 *ExpectedPtr, uint32 Desired)
+{
+#ifdef OS_ATOMIC_LOCKFREE
+    return __atomic_compare_exchange_n(Ptr, ExpectedPtr, Desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    bool Swapped;
+
+    OS_AtomicLock();
+    Swapped = (*Ptr == *ExpectedPtr);
+    if (Swapped)
+    {
+        *Ptr = Desired;
+    }
+    else
+    {
+        *ExpectedPtr = *Ptr;
+    }
+    OS_AtomicUnlock();
+
+    return Swapped;
+#endif
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically add to a 32-bit value, returning the result
+ *
+ * @param[inout] Ptr   Value to update @nonnull
+ * @param[in]    Delta Amount to add
+ * @returns The value after the addition
+ */
+static inline uint32 OS_AtomicAdd32(volatile uint32 *Ptr, uint32 Delta)
+{
+#ifdef OS_ATOMIC_LOCKFREE
+    return __atomic_add_fetch(Ptr, Delta, __ATOMIC_SEQ_CST);
+#else
+    uint32 Result;
+
+    OS_AtomicLock();
+    Result = *Ptr + Delta;
+    *Ptr   = Result;
+    OS_AtomicUnlock();
+
+    return Result;
+#endif
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically subtract from a 32-bit value, returning the result
+ *
+ * @param[inout] Ptr   Value to update @nonnull
+ * @param[in]    Delta Amount to subtract
+ * @returns The value after the subtraction
+ */
+static inline uint32 OS_AtomicSub32(volatile uint32 *Ptr, uint32 Delta)
+{
+#ifdef OS_ATOMIC_LOCKFREE
+    return __atomic_sub_fetch(Ptr, Delta, __ATOMIC_SEQ_CST);
+#else
+    uint32 Result;
+
+    OS_AtomicLock();
+    Result = *Ptr - Delta;
+    *Ptr   = Result;
+    OS_AtomicUnlock();
+
+    return Result;
+#endif
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically read a pointer
+ *
+ * Allows a pointer to an object to be published by one task and picked up by
+ * others without a lock.  Anything the publishing task wrote to the object
+ * before OS_AtomicStorePtr() is visible after reading the pointer here.
+ *
+ * @param[in] Ptr Pointer to read @nonnull
+ * @returns The pointer
+ */
+static inline void *OS_AtomicLoadPtr(void *const volatile *Ptr)
+{
+#ifdef OS_ATOMIC_LOCKFREE
+    return __atomic_load_n(Ptr, __ATOMIC_SEQ_CST);
+#else
+    void *Value;
+
+    OS_AtomicLock();
+    Value = *Ptr;
+    OS_AtomicUnlock();
+
+    return Value;
+#endif
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically write a pointer
+ *
+ * @param[out] Ptr   Pointer to write @nonnull
+ * @param[in]  Value New pointer
+ */
+static inline void OS_AtomicStorePtr(void *volatile *Ptr, void *Value)
+{
+#ifdef OS_ATOMIC_LOCKFREE
+    __atomic_store_n(Ptr, Value, __ATOMIC_SEQ_CST);
+#else
+    OS_AtomicLock();
+    *Ptr = Value;
+    OS_AtomicUnlock();
+#endif
+}
+
+/**@}*/
+
+#endif /* OSAPI_ATOMIC_H */
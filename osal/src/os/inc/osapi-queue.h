@@ -110,6 +110,43 @@ int32 OS_QueueDelete(osal_id_t queue_id);
  */
 int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copied, int32 timeout);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Receive several messages from a message queue in a single call
+ *
+ * Behaves like OS_QueueGet() for the first message, blocking up to the given timeout
+ * if the queue is empty.  Once a message has been received, any further messages
+ * already pending on the queue are also received, without blocking, until either
+ * the queue is empty or max_items messages have been received.
+ *
+ * Messages are stored consecutively in the data buffer, item_size bytes apart.  This
+ * is intended for queues that carry fixed-size messages (such as pointers or handles),
+ * as the size of each individual message is not reported.  A message that does not
+ * fill exactly item_size bytes ends the batch with #OS_QUEUE_INVALID_SIZE.  That message
+ * has already been removed from the queue, so it is counted in items_copied as the last
+ * item, and the caller must not treat that last slot as a full message; the messages
+ * received before it are still valid.
+ *
+ * @param[in]   queue_id The object ID to operate on
+ * @param[out]  data The buffer to store the received messages, at least item_size * max_items bytes @nonnull
+ * @param[in]   item_size The size of each message slot in the data buffer @nonzero
+ * @param[in]   max_items The maximum number of messages to receive @nonzero
+ * @param[out]  items_copied Set to the number of messages received @nonnull
+ * @param[in]   timeout The maximum amount of time to block for the first message, or OS_PEND to wait forever
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS if at least one message was received
+ * @retval #OS_ERR_INVALID_ID if the given ID does not exist
+ * @retval #OS_INVALID_POINTER if a pointer passed in is NULL
+ * @retval #OS_ERR_INVALID_SIZE if item_size or max_items is zero
+ * @retval #OS_QUEUE_EMPTY if the Queue has no messages on it to be received
+ * @retval #OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+ * @retval #OS_QUEUE_INVALID_SIZE if item_size is too small for the queue, or a message did not fill a slot
+ * @retval #OS_ERROR if the OS call returns an unexpected error @covtest
+ */
+int32 OS_QueueGetBatch(osal_id_t queue_id, void *data, size_t item_size, uint32 max_items, uint32 *items_copied,
+                       int32 timeout);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Put a message on a message queue.
@@ -61,6 +61,7 @@ extern "C"
 /*
 ** Include the OS API modules
 */
+#include "osapi-atomic.h"
 #include "osapi-binsem.h"
 #include "osapi-clock.h"
 #include "osapi-common.h"
@@ -27,6 +27,26 @@
 #define OS_IMPL_QUEUES_H
 
 #include "osconfig.h"
+
+#ifdef OSAL_CONFIG_POSIX_INPROC_QUEUES
+
+#include <pthread.h>
+
+/* queues - in-process ring buffer */
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t  not_empty;
+    uint8 *         storage;   /**< Ring buffer of depth slots, each slot_size bytes */
+    size_t          slot_size; /**< Size of a slot, message size field plus max message size */
+    uint32          depth;     /**< Number of slots in the ring */
+    uint32          read_idx;  /**< Slot of the oldest message */
+    uint32          count;     /**< Number of messages currently in the ring */
+    uint32          waiters;   /**< Number of readers pending on not_empty */
+} OS_impl_queue_internal_record_t;
+
+#else
+
 #include <mqueue.h>
 
 /* queues */
@@ -35,6 +55,8 @@ typedef struct
     mqd_t id;
 } OS_impl_queue_internal_record_t;
 
+#endif
+
 /* Tables where the OS object information is stored */
 extern OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
 
@@ -0,0 +1,393 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * In-process message queue implementation
+ *
+ * OSAL queues are only ever used between tasks of the same process, so
+ * they do not need the kernel persistence of POSIX message queues.  This
+ * implements each queue as a ring buffer in process memory, guarded by a
+ * pthread mutex and condition variable.  On Linux both are futex based,
+ * so a put or get only enters the kernel when a mutex is contended or
+ * when a reader actually needs to sleep/be woken.  This also avoids the
+ * /proc/sys/fs/mqueue depth limits, so no depth truncation is needed.
+ *
+ * Selected by the OSAL_CONFIG_POSIX_INPROC_QUEUES build option.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "bsp-impl.h"
+
+#include "os-impl-queues.h"
+#include "os-shared-queue.h"
+#include "os-shared-idmap.h"
+
+/*
+ * This controls the maximum time that the calling thread will wait to
+ * acquire the queue mutex before returning an error.
+ *
+ * The lock is only ever held for the duration of a single message copy, so
+ * this should never be reached in a normally operating system.  It only
+ * prevents a deadlock if a task is deleted while holding the lock.
+ */
+#define OS_POSIX_QUEUE_MAX_WAIT_SECONDS 2
+
+/* Tables where the OS object information is stored */
+OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for acquiring the queue mutex when beginning a queue operation
+ * This uses timedlock to avoid waiting forever on a lock that was abandoned.
+ ----------------------------------------------------------------------------------------*/
+static int32 OS_Posix_QueueAcquireMutex(pthread_mutex_t *mut)
+{
+    struct timespec timeout;
+
+    if (clock_gettime(CLOCK_REALTIME, &timeout) != 0)
+    {
+        return OS_ERROR;
+    }
+
+    timeout.tv_sec += OS_POSIX_QUEUE_MAX_WAIT_SECONDS;
+
+    if (pthread_mutex_timedlock(mut, &timeout) != 0)
+    {
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for releasing the mutex in case the thread
+ * executing pthread_cond_wait() is canceled.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_QueueReleaseMutex(void *mut)
+{
+    pthread_mutex_unlock(mut);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function to get the address of a ring buffer slot
+ * Each slot holds the size of the message followed by the message content
+ ----------------------------------------------------------------------------------------*/
+static inline size_t *OS_Posix_QueueSlot(const OS_impl_queue_internal_record_t *impl, uint32 idx)
+{
+    return (size_t *)(void *)(impl->storage + ((size_t)idx * impl->slot_size));
+}
+
+/****************************************************************************************
+                                MESSAGE QUEUE API
+ ***************************************************************************************/
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_QueueAPI_Impl_Init
+
+   Purpose: Initialize the Queue data structures
+
+ ----------------------------------------------------------------------------------------*/
+int32 OS_Posix_QueueAPI_Impl_Init(void)
+{
+    memset(OS_impl_queue_table, 0, sizeof(OS_impl_queue_table));
+
+    /*
+     * Queue depth is only limited by process memory in this implementation,
+     * so there is never a need to truncate it
+     */
+    POSIX_GlobalVars.TruncateQueueDepth = OSAL_BLOCKCOUNT_C(0);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
+{
+    int                              ret;
+    int                              mutex_created;
+    int32                            return_code;
+    pthread_mutexattr_t              mutex_attr;
+    OS_impl_queue_internal_record_t *impl;
+    OS_queue_internal_record_t *     queue;
+
+    impl  = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
+
+    memset(impl, 0, sizeof(*impl));
+    mutex_created = 0;
+
+    /* Each slot holds the actual message size, then the content, rounded to keep the size field aligned */
+    impl->slot_size = sizeof(size_t) + queue->max_size;
+    impl->slot_size = (impl->slot_size + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1);
+    impl->depth     = queue->max_depth;
+
+    do
+    {
+        impl->storage = malloc(impl->slot_size * impl->depth);
+        if (impl->storage == NULL)
+        {
+            OS_DEBUG("Error: unable to allocate %lu bytes for queue storage\n",
+                     (unsigned long)(impl->slot_size * impl->depth));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        ret = pthread_mutexattr_init(&mutex_attr);
+        if (ret != 0)
+        {
+            OS_DEBUG("Error: pthread_mutexattr_init failed: %s\n", strerror(ret));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        /*
+         ** Use priority inheritance, as the reader and writers may be of different priorities
+         */
+        ret = pthread_mutexattr_setprotocol(&mutex_attr, PTHREAD_PRIO_INHERIT);
+        if (ret == 0)
+        {
+            ret = pthread_mutex_init(&impl->mutex, &mutex_attr);
+        }
+
+        pthread_mutexattr_destroy(&mutex_attr);
+
+        if (ret != 0)
+        {
+            OS_DEBUG("Error: pthread_mutex_init failed: %s\n", strerror(ret));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        mutex_created = 1;
+
+        ret = pthread_cond_init(&impl->not_empty, NULL);
+        if (ret != 0)
+        {
+            OS_DEBUG("Error: pthread_cond_init failed: %s\n", strerror(ret));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        return_code = OS_SUCCESS;
+    } while (0);
+
+    /* Clean up resources if the operation failed */
+    if (return_code != OS_SUCCESS)
+    {
+        if (mutex_created)
+        {
+            pthread_mutex_destroy(&impl->mutex);
+        }
+
+        free(impl->storage);
+        impl->storage = NULL;
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (pthread_cond_destroy(&impl->not_empty) != 0)
+    {
+        /* a task is still pending on the queue, so it cannot be deleted at this time */
+        OS_DEBUG("OS_QueueDelete Error: queue is busy\n");
+        return OS_ERROR;
+    }
+
+    /* Now that the CV is destroyed this queue is unusable, so clean up everything else */
+    pthread_mutex_destroy(&impl->mutex);
+    free(impl->storage);
+    impl->storage = NULL;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size, size_t *size_copied, int32 timeout)
+{
+    int32                            return_code;
+    int                              ret;
+    size_t *                         slot;
+    struct timespec                  ts;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl         = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+    *size_copied = OSAL_SIZE_C(0);
+
+    if (timeout > 0)
+    {
+        OS_Posix_CompAbsDelayTime(timeout, &ts);
+    }
+
+    if (OS_Posix_QueueAcquireMutex(&impl->mutex) != OS_SUCCESS)
+    {
+        return OS_ERROR;
+    }
+
+    /* pthread_cond_wait() is a cancellation point, so make sure the mutex is released if canceled */
+    pthread_cleanup_push(OS_Posix_QueueReleaseMutex, &impl->mutex);
+
+    return_code = OS_SUCCESS;
+
+    while (impl->count == 0)
+    {
+        if (timeout == OS_CHECK)
+        {
+            return_code = OS_QUEUE_EMPTY;
+            break;
+        }
+
+        /* Only pending readers are counted, so writers know whether a wakeup is needed */
+        ++impl->waiters;
+
+        if (timeout == OS_PEND)
+        {
+            ret = pthread_cond_wait(&impl->not_empty, &impl->mutex);
+        }
+        else
+        {
+            ret = pthread_cond_timedwait(&impl->not_empty, &impl->mutex, &ts);
+        }
+
+        --impl->waiters;
+
+        if (ret == ETIMEDOUT)
+        {
+            return_code = OS_QUEUE_TIMEOUT;
+            break;
+        }
+
+        if (ret != 0)
+        {
+            return_code = OS_ERROR;
+            break;
+        }
+    }
+
+    if (return_code == OS_SUCCESS)
+    {
+        slot = OS_Posix_QueueSlot(impl, impl->read_idx);
+
+        if (*slot > size)
+        {
+            /* should not happen as the shared layer checks the buffer against the max size */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            memcpy(data, &slot[1], *slot);
+            *size_copied = *slot;
+
+            ++impl->read_idx;
+            if (impl->read_idx >= impl->depth)
+            {
+                impl->read_idx = 0;
+            }
+            --impl->count;
+        }
+    }
+
+    /*
+     * Pop the cleanup handler.
+     * Passing "true" means it will be executed, which
+     * handles releasing the mutex.
+     */
+    pthread_cleanup_pop(true);
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t size, uint32 flags)
+{
+    int32                            return_code;
+    uint32                           write_idx;
+    size_t *                         slot;
+    OS_impl_queue_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
+
+    if (OS_Posix_QueueAcquireMutex(&impl->mutex) != OS_SUCCESS)
+    {
+        return OS_ERROR;
+    }
+
+    /* Like the message queue implementation, a put never blocks on a full queue */
+    if (impl->count >= impl->depth)
+    {
+        return_code = OS_QUEUE_FULL;
+    }
+    else
+    {
+        write_idx = impl->read_idx + impl->count;
+        if (write_idx >= impl->depth)
+        {
+            write_idx -= impl->depth;
+        }
+
+        slot  = OS_Posix_QueueSlot(impl, write_idx);
+        *slot = size;
+        memcpy(&slot[1], data, size);
+
+        ++impl->count;
+
+        /* Only wake a reader if one is actually sleeping, otherwise this stays in user space */
+        if (impl->waiters != 0)
+        {
+            pthread_cond_signal(&impl->not_empty);
+        }
+
+        return_code = OS_SUCCESS;
+    }
+
+    pthread_mutex_unlock(&impl->mutex);
+
+    return return_code;
+}
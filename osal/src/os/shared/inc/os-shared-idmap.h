@@ -27,6 +27,7 @@
 #define OS_SHARED_IDMAP_H
 
 #include "osapi-idmap.h"
+#include "osapi-atomic.h"
 #include "os-shared-globaldefs.h"
 
 #define OS_OBJECT_ID_RESERVED ((osal_id_t) {0xFFFFFFFF})
@@ -39,7 +40,7 @@ struct OS_common_record
     const char *name_entry;
     osal_id_t   active_id;
     osal_id_t   creator;
-    uint16      refcount;
+    uint32      refcount;
 };
 
 typedef enum
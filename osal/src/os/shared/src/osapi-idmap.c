@@ -57,6 +57,20 @@
 #define OS_LOCK_KEY_FIXED_VALUE 0x4D000000
 #define OS_LOCK_KEY_INVALID     ((osal_key_t) {0})
 
+/*
+ * If atomic operations are lock-free, the "active_id" and "refcount"
+ * members of the common records are updated atomically.  This allows a
+ * transaction using OS_LOCK_MODE_REFCOUNT to take and drop its reference
+ * without acquiring the global table lock, as long as the record is not
+ * being created or deleted at the same time.
+ *
+ * Otherwise, all transactions other than OS_LOCK_MODE_NONE go through
+ * the global table lock.
+ */
+#ifdef OS_ATOMIC_LOCKFREE
+#define OS_IDMAP_LOCKFREE_REFCOUNT
+#endif
+
 /*
  * A structure containing the user-specified
  * details of a "foreach" iteration request
@@ -103,6 +117,64 @@ OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESY
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
 OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVAR_BASE];
 
+/*
+ * Accessors for the members of the common record which may be read
+ * without holding the global table lock.  Any task may read these at
+ * any time, but the active_id is only ever changed while holding the
+ * global table lock.
+ */
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+static inline osal_id_t OS_ObjectIdGetActive(const OS_common_record_t *obj)
+{
+    return OS_ObjectIdFromInteger(OS_AtomicLoad32((const uint32 *)&obj->active_id));
+}
+
+static inline void OS_ObjectIdSetActive(OS_common_record_t *obj, osal_id_t id)
+{
+    OS_AtomicStore32((uint32 *)&obj->active_id, OS_ObjectIdToInteger(id));
+}
+
+static inline uint32 OS_ObjectIdGetRefcount(const OS_common_record_t *obj)
+{
+    return OS_AtomicLoad32(&obj->refcount);
+}
+
+static inline void OS_ObjectIdIncrRefcount(OS_common_record_t *obj)
+{
+    OS_AtomicAdd32(&obj->refcount, 1);
+}
+
+static inline void OS_ObjectIdDecrRefcount(OS_common_record_t *obj)
+{
+    OS_AtomicSub32(&obj->refcount, 1);
+}
+#else
+static inline osal_id_t OS_ObjectIdGetActive(const OS_common_record_t *obj)
+{
+    return obj->active_id;
+}
+
+static inline void OS_ObjectIdSetActive(OS_common_record_t *obj, osal_id_t id)
+{
+    obj->active_id = id;
+}
+
+static inline uint32 OS_ObjectIdGetRefcount(const OS_common_record_t *obj)
+{
+    return obj->refcount;
+}
+
+static inline void OS_ObjectIdIncrRefcount(OS_common_record_t *obj)
+{
+    ++obj->refcount;
+}
+
+static inline void OS_ObjectIdDecrRefcount(OS_common_record_t *obj)
+{
+    --obj->refcount;
+}
+#endif
+
 /*
  *********************************************************************************
  *          IDENTIFIER MAP / UNMAP FUNCTIONS
@@ -415,7 +487,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
     {
         /* Validate the integrity of the ID.  As the "active_id" is a single
          * integer, we can do this check regardless of whether global is locked or not. */
-        if (OS_ObjectIdEqual(obj->active_id, expected_id))
+        if (OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), expected_id))
         {
             /*
              * Got an ID match...
@@ -428,15 +500,15 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                  */
                 if (!OS_ObjectIdEqual(expected_id, OS_OBJECT_ID_RESERVED))
                 {
-                    expected_id    = OS_OBJECT_ID_RESERVED;
-                    obj->active_id = expected_id;
+                    expected_id = OS_OBJECT_ID_RESERVED;
+                    OS_ObjectIdSetActive(obj, expected_id);
                 }
 
                 /*
                  * Also confirm that reference count is zero
                  * If not zero, will need to wait for other tasks to release.
                  */
-                if (obj->refcount == 0)
+                if (OS_ObjectIdGetRefcount(obj) == 0)
                 {
                     return_code = OS_SUCCESS;
                     break;
@@ -451,7 +523,8 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
                 break;
             }
         }
-        else if (token->lock_mode == OS_LOCK_MODE_NONE || !OS_ObjectIdEqual(obj->active_id, OS_OBJECT_ID_RESERVED))
+        else if (token->lock_mode == OS_LOCK_MODE_NONE ||
+                 !OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), OS_OBJECT_ID_RESERVED))
         {
             /* Not an ID match and not RESERVED - fail out */
             return_code = OS_ERR_INVALID_ID;
@@ -491,7 +564,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
         {
             /* always increment the refcount, which means a task is actively
              * using or modifying this record. */
-            ++obj->refcount;
+            OS_ObjectIdIncrRefcount(obj);
 
             /*
              * On a successful operation, the global is unlocked if it is
@@ -516,7 +589,7 @@ int32 OS_ObjectIdConvertToken(OS_object_token_t *token)
              * it back to the original value which is in the token.
              * (note it had to match initially before overwrite)
              */
-            obj->active_id = OS_ObjectIdFromToken(token);
+            OS_ObjectIdSetActive(obj, OS_ObjectIdFromToken(token));
         }
     }
 
@@ -635,11 +708,14 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
         token->obj_idx = OSAL_INDEX_C(local_id);
         OS_ObjectIdCompose_Impl(token->obj_type, serial, &token->obj_id);
 
-        /* Ensure any data in the record has been cleared */
-        obj->active_id  = token->obj_id;
+        /*
+         * Ensure any data in the record has been cleared.  Note the refcount
+         * is not reset here; every increment is paired with a decrement, and a
+         * task using a stale ID may briefly hold a reference on a free record.
+         */
         obj->name_entry = NULL;
         obj->creator    = OS_TaskGetId();
-        obj->refcount   = 0;
+        OS_ObjectIdSetActive(obj, token->obj_id);
 
         /* preemptively update the last id issued */
         objtype_state->last_id_issued = token->obj_id;
@@ -983,6 +1059,68 @@ int32 OS_ObjectIdFindByName(osal_objtype_t idtype, const char *name, osal_id_t *
     return return_code;
 }
 
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Drops a reference which was taken without the global table lock.
+ *
+ *           If the ID in the record has been changed to RESERVED, a task
+ *           waiting for an exclusive lock may be blocked on this reference.
+ *           Cycling the table lock ensures that the waiting task is woken
+ *           up to check the refcount again.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectIdRefcountRelease(OS_object_token_t *token)
+{
+    OS_common_record_t *obj;
+
+    obj = OS_ObjectIdGlobalFromToken(token);
+
+    OS_ObjectIdDecrRefcount(obj);
+
+    if (OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), OS_OBJECT_ID_RESERVED))
+    {
+        OS_Lock_Global(token);
+        OS_Unlock_Global(token);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Attempts to take a reference on the record without the global table lock.
+ *
+ *           The refcount is incremented first and the ID is checked afterwards.
+ *           A task getting an exclusive lock does the opposite (it sets the ID to
+ *           RESERVED and then checks the refcount), so at least one of the two
+ *           will always see the other.
+ *
+ *  returns: true if the reference was taken, false if the ID did not match,
+ *           in which case the caller should use the locked path instead.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_ObjectIdRefcountTryAcquire(OS_object_token_t *token)
+{
+    OS_common_record_t *obj;
+
+    obj              = OS_ObjectIdGlobalFromToken(token);
+    token->lock_mode = OS_LOCK_MODE_REFCOUNT;
+
+    OS_ObjectIdIncrRefcount(obj);
+
+    if (OS_ObjectIdEqual(OS_ObjectIdGetActive(obj), OS_ObjectIdFromToken(token)))
+    {
+        return true;
+    }
+
+    OS_ObjectIdRefcountRelease(token);
+    token->lock_mode = OS_LOCK_MODE_NONE;
+
+    return false;
+}
+#endif
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Local helper routine, not part of OSAL API.
@@ -1001,6 +1139,36 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
 {
     int32 return_code;
 
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+    /*
+     * For REFCOUNT, first try to take the reference without locking the table.
+     * If the ID does not match (i.e. the object is being created or deleted,
+     * or the ID is stale) then fall back to the locked path below, which
+     * waits for a RESERVED ID to be resolved and returns the appropriate error.
+     */
+    if (lock_mode == OS_LOCK_MODE_REFCOUNT)
+    {
+        return_code = OS_ObjectIdTransactionInit(OS_LOCK_MODE_NONE, idtype, token);
+        if (return_code != OS_SUCCESS)
+        {
+            return return_code;
+        }
+
+        return_code = OS_ObjectIdToArrayIndex(idtype, id, &token->obj_idx);
+        if (return_code != OS_SUCCESS)
+        {
+            return return_code;
+        }
+
+        token->obj_id = id;
+
+        if (OS_ObjectIdRefcountTryAcquire(token))
+        {
+            return OS_SUCCESS;
+        }
+    }
+#endif
+
     return_code = OS_ObjectIdTransactionInit(lock_mode, idtype, token);
     if (return_code != OS_SUCCESS)
     {
@@ -1053,6 +1221,19 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         return;
     }
 
+#ifdef OS_IDMAP_LOCKFREE_REFCOUNT
+    /*
+     * A REFCOUNT transaction does not change the ID, so the reference
+     * can be dropped without the global table lock.
+     */
+    if (token->lock_mode == OS_LOCK_MODE_REFCOUNT && final_id == NULL)
+    {
+        OS_ObjectIdRefcountRelease(token);
+        token->lock_mode = OS_LOCK_MODE_NONE;
+        return;
+    }
+#endif
+
     record = OS_ObjectIdGlobalFromToken(token);
 
     /* re-acquire global table lock to adjust refcount */
@@ -1061,9 +1242,9 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
         OS_Lock_Global(token);
     }
 
-    if (record->refcount > 0)
+    if (OS_ObjectIdGetRefcount(record) > 0)
     {
-        --record->refcount;
+        OS_ObjectIdDecrRefcount(record);
     }
 
     /*
@@ -1076,7 +1257,7 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
      */
     if (final_id != NULL)
     {
-        record->active_id = *final_id;
+        OS_ObjectIdSetActive(record, *final_id);
     }
     else if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
     {
@@ -1085,7 +1266,7 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
          * was reset to OS_OBJECT_ID_RESERVED.  This must restore the original
          * object ID from the token.
          */
-        record->active_id = token->obj_id;
+        OS_ObjectIdSetActive(record, token->obj_id);
     }
 
     /* always unlock (this also covers OS_LOCK_MODE_GLOBAL case) */
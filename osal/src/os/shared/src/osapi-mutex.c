@@ -42,6 +42,7 @@
 /*
  * Other OSAL public APIs used by this module
  */
+#include "osapi-atomic.h"
 #include "osapi-task.h"
 
 /*
@@ -252,3 +253,30 @@ int32 OS_MutSemGetInfo(osal_id_t sem_id, OS_mut_sem_prop_t *mut_prop)
 
     return return_code;
 }
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_AtomicLock(void)
+{
+    /*
+     * Atomic operations only get here when the compiler has no atomic builtins.
+     * They borrow the mutex table lock, which OSAL only ever holds briefly and
+     * never while performing an atomic operation, so no extra object is used.
+     */
+    OS_Lock_Global_Impl(LOCAL_OBJID_TYPE);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_AtomicUnlock(void)
+{
+    OS_Unlock_Global_Impl(LOCAL_OBJID_TYPE);
+}
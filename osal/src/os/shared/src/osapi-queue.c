@@ -178,6 +178,87 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_QueueGetBatch(osal_id_t queue_id, void *data, size_t item_size, uint32 max_items, uint32 *items_copied,
+                       int32 timeout)
+{
+    OS_object_token_t           token;
+    int32                       return_code;
+    OS_queue_internal_record_t *queue;
+    uint8 *                     item_ptr;
+    size_t                      size_copied;
+    int32                       item_timeout;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(data);
+    OS_CHECK_POINTER(items_copied);
+    OS_CHECK_SIZE(item_size);
+    OS_CHECK_SIZE(max_items);
+
+    *items_copied = 0;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
+
+        if (item_size < queue->max_size)
+        {
+            /*
+            ** Each slot in the user buffer must be able to hold a full message
+            */
+            return_code = OS_QUEUE_INVALID_SIZE;
+        }
+        else
+        {
+            /*
+             * Only the first message is subject to the caller's timeout.  Once
+             * something has been received, the remainder of the batch is whatever
+             * is already pending on the queue, so the rest are read with OS_CHECK.
+             */
+            item_ptr     = data;
+            item_timeout = timeout;
+            while (*items_copied < max_items)
+            {
+                return_code = OS_QueueGet_Impl(&token, item_ptr, item_size, &size_copied, item_timeout);
+                if (return_code != OS_SUCCESS)
+                {
+                    break;
+                }
+
+                if (size_copied != item_size)
+                {
+                    /*
+                    ** The caller cannot tell the size of individual messages, so
+                    ** a short message ends the batch.  It has already been taken
+                    ** off the queue, so it is still counted, as the last item.
+                    */
+                    ++(*items_copied);
+                    return_code = OS_QUEUE_INVALID_SIZE;
+                    break;
+                }
+
+                ++(*items_copied);
+                item_ptr += item_size;
+                item_timeout = OS_CHECK;
+            }
+
+            /* Draining the queue after receiving at least one message is not an error */
+            if (return_code == OS_QUEUE_EMPTY && *items_copied > 0)
+            {
+                return_code = OS_SUCCESS;
+            }
+        }
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  *  Purpose: Implemented per public OSAL API
@@ -0,0 +1,339 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** Queue Speed Test
+**
+** This is a simple way to gauge the performance of the
+** OSAL message queue implementation on a given machine,
+** and to compare queue implementations against each other
+** (e.g. POSIX message queues vs. in-process queues).
+**
+** The messages are pointer-sized, the same as the buffer
+** descriptor pointers that the software bus passes through
+** its pipes.
+**
+** Two scenarios are run:
+**
+** 1. Ping-pong: Task 1 waits on queue 1 and puts to queue 2,
+**    while task 2 waits on queue 2 and puts to queue 1.  Every
+**    message requires a blocking wakeup of the other task.
+**
+** 2. Burst: A writer task fills the queue as fast as it can,
+**    while a reader task drains it.  This is the typical
+**    pattern of a software bus pipe under load.
+**
+** Each scenario runs continuously for 5 seconds.  At the end
+** of the test, the total number of messages passed is indicated.
+** Higher numbers indicate better performance.
+**
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Note the worker priority must be lower than that of
+ * the executive (init) task.  Otherwise, the QueueRun()
+ * function may never get CPU time to stop the test.
+ */
+#define QUEUETEST_TASK_PRIORITY 150
+
+/*
+ * A limit for the maximum amount of iterations that this
+ * test will perform.  This prevents the test from running
+ * infinitely in case the time-based stop routine does not
+ * work correctly.  See note above about priority requirements.
+ */
+#define QUEUETEST_WORK_LIMIT 100000000
+
+/* Depth of the queues, same as the default SB pipe depth */
+#define QUEUETEST_DEPTH 32
+
+/* Run time of each scenario in milliseconds */
+#define QUEUETEST_DURATION 5000
+
+/* Define setup and test functions for UT assert */
+void QueueSetup(void);
+void QueuePingPongRun(void);
+void QueueBurstRun(void);
+void QueueBurstBatchRun(void);
+
+osal_id_t task_1_id;
+uint32    task_1_work;
+
+osal_id_t task_2_id;
+uint32    task_2_work;
+
+osal_id_t queue_id_1;
+osal_id_t queue_id_2;
+
+volatile bool stop_request;
+
+void pingpong_task_1(void)
+{
+    int32  status;
+    void * msg;
+    size_t size;
+
+    while (!stop_request && task_1_work < QUEUETEST_WORK_LIMIT)
+    {
+        status = OS_QueueGet(queue_id_1, &msg, sizeof(msg), &size, 100);
+        if (status == OS_QUEUE_TIMEOUT)
+        {
+            continue;
+        }
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("TASK 1: Error calling QueueGet 1: %d\n", (int)status);
+            break;
+        }
+
+        ++task_1_work;
+
+        status = OS_QueuePut(queue_id_2, &msg, sizeof(msg), 0);
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("TASK 1: Error calling QueuePut 2: %d\n", (int)status);
+            break;
+        }
+    }
+}
+
+void pingpong_task_2(void)
+{
+    int32  status;
+    void * msg;
+    size_t size;
+
+    while (!stop_request && task_2_work < QUEUETEST_WORK_LIMIT)
+    {
+        status = OS_QueueGet(queue_id_2, &msg, sizeof(msg), &size, 100);
+        if (status == OS_QUEUE_TIMEOUT)
+        {
+            continue;
+        }
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("TASK 2: Error calling QueueGet 2: %d\n", (int)status);
+            break;
+        }
+
+        ++task_2_work;
+
+        status = OS_QueuePut(queue_id_1, &msg, sizeof(msg), 0);
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("TASK 2: Error calling QueuePut 1: %d\n", (int)status);
+            break;
+        }
+    }
+}
+
+void burst_writer_task(void)
+{
+    int32 status;
+    void *msg;
+
+    msg = &task_1_work;
+
+    while (!stop_request && task_1_work < QUEUETEST_WORK_LIMIT)
+    {
+        status = OS_QueuePut(queue_id_1, &msg, sizeof(msg), 0);
+        if (status == OS_SUCCESS)
+        {
+            ++task_1_work;
+        }
+        else if (status == OS_QUEUE_FULL)
+        {
+            /* Let the reader catch up */
+            OS_TaskDelay(0);
+        }
+        else
+        {
+            OS_printf("WRITER: Error calling QueuePut: %d\n", (int)status);
+            break;
+        }
+    }
+}
+
+void burst_reader_task(void)
+{
+    int32  status;
+    void * msg;
+    size_t size;
+
+    while (!stop_request && task_2_work < QUEUETEST_WORK_LIMIT)
+    {
+        status = OS_QueueGet(queue_id_1, &msg, sizeof(msg), &size, 100);
+        if (status == OS_QUEUE_TIMEOUT)
+        {
+            continue;
+        }
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("READER: Error calling QueueGet: %d\n", (int)status);
+            break;
+        }
+
+        ++task_2_work;
+    }
+}
+
+void burst_batch_reader_task(void)
+{
+    int32  status;
+    void * msg[QUEUETEST_DEPTH];
+    uint32 count;
+
+    while (!stop_request && task_2_work < QUEUETEST_WORK_LIMIT)
+    {
+        status = OS_QueueGetBatch(queue_id_1, msg, sizeof(msg[0]), QUEUETEST_DEPTH, &count, 100);
+        if (status == OS_QUEUE_TIMEOUT)
+        {
+            continue;
+        }
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("READER: Error calling QueueGetBatch: %d\n", (int)status);
+            break;
+        }
+
+        task_2_work += count;
+    }
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(QueuePingPongRun, QueueSetup, NULL, "QueuePingPongSpeedTest");
+    UtTest_Add(QueueBurstRun, QueueSetup, NULL, "QueueBurstSpeedTest");
+    UtTest_Add(QueueBurstBatchRun, QueueSetup, NULL, "QueueBurstBatchSpeedTest");
+}
+
+void QueueSetup(void)
+{
+    int32 status;
+
+    task_1_work  = 0;
+    task_2_work  = 0;
+    stop_request = false;
+
+    status = OS_QueueCreate(&queue_id_1, "Queue1", OSAL_BLOCKCOUNT_C(QUEUETEST_DEPTH), sizeof(void *), 0);
+    UtAssert_True(status == OS_SUCCESS, "Queue 1 create Id=%lx Rc=%d", OS_ObjectIdToInteger(queue_id_1), (int)status);
+    status = OS_QueueCreate(&queue_id_2, "Queue2", OSAL_BLOCKCOUNT_C(QUEUETEST_DEPTH), sizeof(void *), 0);
+    UtAssert_True(status == OS_SUCCESS, "Queue 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(queue_id_2), (int)status);
+}
+
+void QueueTeardown(void)
+{
+    int32 status;
+
+    /* Let the tasks see the stop request and exit on their own, then clean up */
+    stop_request = true;
+    OS_TaskDelay(500);
+
+    status = OS_TaskDelete(task_1_id);
+    UtAssert_True(status == OS_SUCCESS || status == OS_ERR_INVALID_ID, "Task 1 delete Rc=%d", (int)status);
+
+    status = OS_TaskDelete(task_2_id);
+    UtAssert_True(status == OS_SUCCESS || status == OS_ERR_INVALID_ID, "Task 2 delete Rc=%d", (int)status);
+
+    status = OS_QueueDelete(queue_id_1);
+    UtAssert_True(status == OS_SUCCESS, "Queue 1 delete Rc=%d", (int)status);
+    status = OS_QueueDelete(queue_id_2);
+    UtAssert_True(status == OS_SUCCESS, "Queue 2 delete Rc=%d", (int)status);
+}
+
+void QueuePingPongRun(void)
+{
+    int32 status;
+    void *msg;
+
+    status = OS_TaskCreate(&task_1_id, "Task 1", pingpong_task_1, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                           OSAL_PRIORITY_C(QUEUETEST_TASK_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Task 1 create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_1_id), (int)status);
+
+    status = OS_TaskCreate(&task_2_id, "Task 2", pingpong_task_2, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                           OSAL_PRIORITY_C(QUEUETEST_TASK_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Task 2 create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_2_id), (int)status);
+
+    /* A small delay just to allow the tasks to start and pend on the queues */
+    OS_TaskDelay(10);
+
+    /* Put the initial message that starts the loop */
+    msg    = &task_1_work;
+    status = OS_QueuePut(queue_id_1, &msg, sizeof(msg), 0);
+    UtAssert_True(status == OS_SUCCESS, "Initial QueuePut Rc=%d", (int)status);
+
+    /* Time Limited Execution */
+    OS_TaskDelay(QUEUETEST_DURATION);
+
+    QueueTeardown();
+
+    /* Task 1 and 2 should have both executed */
+    UtAssert_True(task_1_work != 0, "Task 1 work counter = %u", (unsigned int)task_1_work);
+    UtAssert_True(task_2_work != 0, "Task 2 work counter = %u", (unsigned int)task_2_work);
+    UtAssert_MIR("Ping-pong rate: %lu messages/sec",
+                 (unsigned long)(((uint64)task_1_work + task_2_work) * 1000 / QUEUETEST_DURATION));
+}
+
+static void QueueBurstCommon(osal_task_entry reader_func, const char *label)
+{
+    int32 status;
+
+    status = OS_TaskCreate(&task_2_id, "Reader", reader_func, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                           OSAL_PRIORITY_C(QUEUETEST_TASK_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Reader create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_2_id), (int)status);
+
+    status = OS_TaskCreate(&task_1_id, "Writer", burst_writer_task, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                           OSAL_PRIORITY_C(QUEUETEST_TASK_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "Writer create Id=%lx Rc=%d", OS_ObjectIdToInteger(task_1_id), (int)status);
+
+    /* Time Limited Execution */
+    OS_TaskDelay(QUEUETEST_DURATION);
+
+    QueueTeardown();
+
+    UtAssert_True(task_1_work != 0, "Writer work counter = %u", (unsigned int)task_1_work);
+    UtAssert_True(task_2_work != 0, "Reader work counter = %u", (unsigned int)task_2_work);
+    UtAssert_MIR("%s rate: %lu messages/sec", label, (unsigned long)((uint64)task_2_work * 1000 / QUEUETEST_DURATION));
+}
+
+void QueueBurstRun(void)
+{
+    QueueBurstCommon(burst_reader_task, "Burst");
+}
+
+void QueueBurstBatchRun(void)
+{
+    QueueBurstCommon(burst_batch_reader_task, "Burst batch");
+}
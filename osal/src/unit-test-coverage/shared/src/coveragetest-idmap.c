@@ -542,6 +542,9 @@ void Test_OS_ObjectIdGetById(void)
     UtAssert_UINT32_EQ(token1.obj_idx, local_idx);
     UtAssert_True(rptr->refcount == 1, "refcount (%u) == 1", (unsigned int)rptr->refcount);
 
+    /* the reference is taken without locking the global table */
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 0);
+
     /* attempting to get an exclusive lock should return IN_USE error */
     expected = OS_ERR_OBJECT_IN_USE;
     actual   = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_TASK, refobjid, &token2);
@@ -555,6 +558,32 @@ void Test_OS_ObjectIdGetById(void)
     OS_ObjectIdRelease(&token1);
     UtAssert_True(rptr->refcount == 0, "refcount (%u) == 0", (unsigned int)rptr->refcount);
 
+    /* REFCOUNT while the ID is RESERVED falls back to the locked path, which waits and gives up */
+    rptr->active_id = OS_OBJECT_ID_RESERVED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_ERR_OBJECT_IN_USE);
+    UtAssert_UINT32_EQ(rptr->refcount, 0);
+    UtAssert_UINT32_EQ(token1.lock_mode, OS_LOCK_MODE_NONE);
+
+    /* REFCOUNT with a stale ID also falls back to the locked path, which rejects it */
+    OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1000 + OS_MAX_TASKS, &rptr->active_id);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(rptr->refcount, 0);
+    UtAssert_UINT32_EQ(token1.lock_mode, OS_LOCK_MODE_NONE);
+    rptr->active_id = refobjid;
+
+    /* REFCOUNT with an ID of the wrong type fails before touching the record */
+    OSAPI_TEST_FUNCTION_RC(
+        OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_QUEUE, refobjid, &token1), OS_ERR_INVALID_ID);
+    UtAssert_UINT32_EQ(rptr->refcount, 0);
+
+    /* REFCOUNT during shutdown should fail */
+    OS_SharedGlobalVars.GlobalState = OS_SHUTDOWN_MAGIC_NUMBER;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_TASK, refobjid, &token1),
+                           OS_ERR_INCORRECT_OBJ_STATE);
+    OS_SharedGlobalVars.GlobalState = OS_INIT_MAGIC_NUMBER;
+
     /* attempt to get non-exclusive lock during shutdown should fail */
     OS_SharedGlobalVars.GlobalState = OS_SHUTDOWN_MAGIC_NUMBER;
     expected                        = OS_ERR_INCORRECT_OBJ_STATE;
@@ -898,21 +927,42 @@ void Test_OS_ObjectIdTransaction(void)
     OSAPI_TEST_OBJID(record->active_id, ==, token.obj_id);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
-    /* refcount finish (no change to ID) */
+    /* refcount finish (no change to ID, does not need the global lock) */
     token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
     record->refcount  = 1;
     record->active_id = UT_OBJID_1;
     OS_ObjectIdTransactionFinish(&token, NULL);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 3);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 3);
+    OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+    UtAssert_UINT32_EQ(token.lock_mode, OS_LOCK_MODE_NONE);
+
+    /* refcount finish while an exclusive lock is pending cycles the global lock to wake it */
+    token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
+    record->refcount  = 1;
+    record->active_id = OS_OBJECT_ID_RESERVED;
+    OS_ObjectIdTransactionFinish(&token, NULL);
     UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
     UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 4);
+    OSAPI_TEST_OBJID(record->active_id, ==, OS_OBJECT_ID_RESERVED);
+    UtAssert_UINT32_EQ(record->refcount, 0);
+
+    /* refcount finish with an ID update goes through the global lock */
+    objid             = UT_OBJID_1;
+    token.lock_mode   = OS_LOCK_MODE_REFCOUNT;
+    record->refcount  = 1;
+    OS_ObjectIdTransactionFinish(&token, &objid);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 5);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 5);
     OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
     /* other finish with refcount already 0 */
     token.lock_mode = OS_LOCK_MODE_GLOBAL;
     OS_ObjectIdTransactionFinish(&token, NULL);
-    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 4);
-    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 5);
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 5);
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 6);
     OSAPI_TEST_OBJID(record->active_id, ==, UT_OBJID_1);
     UtAssert_UINT32_EQ(record->refcount, 0);
 
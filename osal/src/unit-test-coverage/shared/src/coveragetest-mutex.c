@@ -168,6 +168,54 @@ void Test_OS_MutSemGetInfo(void)
     OSAPI_TEST_FUNCTION_RC(OS_MutSemGetInfo(UT_OBJID_1, &prop), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_AtomicLock(void)
+{
+    /*
+     * Test Case For:
+     * void OS_AtomicLock(void)
+     * void OS_AtomicUnlock(void)
+     */
+    UtAssert_VOIDCALL(OS_AtomicLock());
+    UtAssert_STUB_COUNT(OS_Lock_Global_Impl, 1);
+    UtAssert_VOIDCALL(OS_AtomicUnlock());
+    UtAssert_STUB_COUNT(OS_Unlock_Global_Impl, 1);
+}
+
+void Test_OS_Atomic32(void)
+{
+    /*
+     * Test Case For:
+     * The inline atomic operations in osapi-atomic.h
+     */
+    uint32 Value    = 5;
+    uint32 Expected = 4;
+
+    UtAssert_UINT32_EQ(OS_AtomicLoad32(&Value), 5);
+    UtAssert_VOIDCALL(OS_AtomicStore32(&Value, 6));
+    UtAssert_UINT32_EQ(OS_AtomicExchange32(&Value, 7), 6);
+    UtAssert_BOOL_FALSE(OS_AtomicCompareAndSwap32(&Value, &Expected, 8));
+    UtAssert_UINT32_EQ(Expected, 7);
+    UtAssert_BOOL_TRUE(OS_AtomicCompareAndSwap32(&Value, &Expected, 8));
+    UtAssert_UINT32_EQ(OS_AtomicAdd32(&Value, 2), 10);
+    UtAssert_UINT32_EQ(OS_AtomicSub32(&Value, 10), 0);
+    UtAssert_UINT32_EQ(Value, 0);
+}
+
+void Test_OS_AtomicPtr(void)
+{
+    /*
+     * Test Case For:
+     * void *OS_AtomicLoadPtr(void *const volatile *Ptr)
+     * void OS_AtomicStorePtr(void *volatile *Ptr, void *Value)
+     */
+    uint32 Value = 0;
+    void * Ptr   = NULL;
+
+    UtAssert_NULL(OS_AtomicLoadPtr(&Ptr));
+    UtAssert_VOIDCALL(OS_AtomicStorePtr(&Ptr, &Value));
+    UtAssert_ADDRESS_EQ(OS_AtomicLoadPtr(&Ptr), &Value);
+}
+
 /* Osapi_Test_Setup
  *
  * Purpose:
@@ -198,4 +246,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_MutSemTake);
     ADD_TEST(OS_MutSemGetIdByName);
     ADD_TEST(OS_MutSemGetInfo);
+    ADD_TEST(OS_AtomicLock);
+    ADD_TEST(OS_Atomic32);
+    ADD_TEST(OS_AtomicPtr);
 }
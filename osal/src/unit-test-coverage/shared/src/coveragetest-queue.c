@@ -110,6 +110,103 @@ void Test_OS_QueueGet(void)
     OSAPI_TEST_FUNCTION_RC(OS_QueueGet(UT_OBJID_1, Buf, sizeof(Buf), &actual_size, 0), OS_ERROR);
 }
 
+/*
+ * Sets the size_copied output of OS_QueueGet_Impl, which the generated stub does not do.
+ * Every message is full size, other than the one received by call number ShortCall.
+ */
+typedef struct
+{
+    size_t FullSize;
+    uint32 ShortCall;
+} UT_QueueGetImpl_Size_t;
+
+static void UT_QueueGetImpl_SizeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_QueueGetImpl_Size_t *SizeCfg     = UserObj;
+    size_t *                size_copied = UT_Hook_GetArgValueByName(Context, "size_copied", size_t *);
+    int32                   status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *size_copied = SizeCfg->FullSize;
+        if (UT_GetStubCount(FuncKey) == SizeCfg->ShortCall)
+        {
+            --(*size_copied);
+        }
+    }
+}
+
+void Test_OS_QueueGetBatch(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_QueueGetBatch(osal_id_t queue_id, void *data, size_t item_size, uint32 max_items,
+     *                        uint32 *items_copied, int32 timeout)
+     */
+    uint32                 Buf[4];
+    uint32                 count;
+    UT_QueueGetImpl_Size_t SizeCfg;
+
+    OS_queue_table[1].max_size = sizeof(Buf[0]);
+    SizeCfg.FullSize           = sizeof(Buf[0]);
+    SizeCfg.ShortCall          = 0;
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet_Impl), UT_QueueGetImpl_SizeHandler, &SizeCfg);
+
+    /* Nominal, queue has 2 messages pending - the first uses the timeout, the rest are OS_CHECK */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 3, OS_QUEUE_EMPTY);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, 100), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 2);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 3);
+
+    /* Nominal, batch limited by max_items */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, OS_PEND), OS_SUCCESS);
+    UtAssert_UINT32_EQ(count, 4);
+
+    /* Nothing pending is passed through */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 1, OS_QUEUE_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, 100), OS_QUEUE_TIMEOUT);
+    UtAssert_ZERO(count);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 1, OS_QUEUE_EMPTY);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, OS_CHECK), OS_QUEUE_EMPTY);
+    UtAssert_ZERO(count);
+
+    /* An error after the first message is still reported */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet_Impl), 2, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, OS_CHECK), OS_ERROR);
+    UtAssert_UINT32_EQ(count, 1);
+
+    /* A short message ends the batch, but it was dequeued so it is counted as the last item */
+    UT_ResetState(UT_KEY(OS_QueueGet_Impl));
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet_Impl), UT_QueueGetImpl_SizeHandler, &SizeCfg);
+    SizeCfg.ShortCall = 1;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, OS_CHECK),
+                           OS_QUEUE_INVALID_SIZE);
+    UtAssert_UINT32_EQ(count, 1);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 1);
+
+    UT_ResetState(UT_KEY(OS_QueueGet_Impl));
+    UT_SetHandlerFunction(UT_KEY(OS_QueueGet_Impl), UT_QueueGetImpl_SizeHandler, &SizeCfg);
+    SizeCfg.ShortCall = 2;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, OS_CHECK),
+                           OS_QUEUE_INVALID_SIZE);
+    UtAssert_UINT32_EQ(count, 2);
+    UtAssert_STUB_COUNT(OS_QueueGet_Impl, 2);
+
+    /* test error cases */
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, NULL, sizeof(Buf[0]), 4, &count, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, OSAL_SIZE_C(0), 4, &count, 0), OS_ERR_INVALID_SIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 0, &count, 0), OS_ERR_INVALID_SIZE);
+
+    OS_queue_table[1].max_size = sizeof(Buf[0]) + 10;
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, 0), OS_QUEUE_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_QueueGetBatch(UT_OBJID_1, Buf, sizeof(Buf[0]), 4, &count, 0), OS_ERROR);
+}
+
 void Test_OS_QueuePut(void)
 {
     /*
@@ -202,6 +299,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_QueueCreate);
     ADD_TEST(OS_QueueDelete);
     ADD_TEST(OS_QueueGet);
+    ADD_TEST(OS_QueueGetBatch);
     ADD_TEST(OS_QueuePut);
     ADD_TEST(OS_QueueGetIdByName);
     ADD_TEST(OS_QueueGetInfo);
@@ -286,6 +286,86 @@ void UT_os_queue_get_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_QueueGetBatch
+** Purpose: Retrieves all pending data items, up to a limit, from an existing queue
+** Parameters: To-be-filled-in
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in does not exist
+**          OS_ERR_INVALID_SIZE if the item size or item count is zero
+**          OS_QUEUE_EMPTY if the queue has no message on it to be received
+**          OS_QUEUE_TIMEOUT if the timeout was OS_PEND and the time expired
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_queue_get_batch_test()
+{
+    osal_id_t queue_id = OS_OBJECT_ID_UNDEFINED;
+    uint32    queue_data_out;
+    uint32    queue_data_in[4];
+    uint32    items_copied;
+    uint32    i;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_QueueGetBatch(UT_OBJID_INCORRECT, queue_data_in, sizeof(uint32), 4, &items_copied, OS_CHECK),
+              OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_QueueGetBatch(OS_OBJECT_ID_UNDEFINED, queue_data_in, sizeof(uint32), 4, &items_copied, OS_CHECK),
+              OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #2 Invalid-pointer-arg */
+    /* #3 Invalid-size-arg */
+
+    if (UT_SETUP(OS_QueueCreate(&queue_id, "QueueGetBatch", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+    {
+        UT_RETVAL(OS_QueueGetBatch(queue_id, NULL, sizeof(uint32), 4, &items_copied, OS_CHECK), OS_INVALID_POINTER);
+        UT_RETVAL(OS_QueueGetBatch(queue_id, queue_data_in, sizeof(uint32), 4, NULL, OS_CHECK), OS_INVALID_POINTER);
+        UT_RETVAL(OS_QueueGetBatch(queue_id, queue_data_in, 0, 4, &items_copied, OS_CHECK), OS_ERR_INVALID_SIZE);
+        UT_RETVAL(OS_QueueGetBatch(queue_id, queue_data_in, sizeof(uint32), 0, &items_copied, OS_CHECK),
+                  OS_ERR_INVALID_SIZE);
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #4 Queue-empty */
+    /* #5 Queue-timed-out */
+
+    if (UT_SETUP(OS_QueueCreate(&queue_id, "QueueEmpty", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+    {
+        UT_RETVAL(OS_QueueGetBatch(queue_id, queue_data_in, sizeof(uint32), 4, &items_copied, OS_CHECK),
+                  OS_QUEUE_EMPTY);
+        UtAssert_UINT32_EQ(items_copied, 0);
+        UT_RETVAL(OS_QueueGetBatch(queue_id, queue_data_in, sizeof(uint32), 4, &items_copied, 2), OS_QUEUE_TIMEOUT);
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+
+    /*-----------------------------------------------------*/
+    /* #6 Nominal - partial batch then limited batch, in FIFO order */
+
+    if (UT_SETUP(OS_QueueCreate(&queue_id, "QueueGetBatch", OSAL_BLOCKCOUNT_C(10), sizeof(uint32), 0)))
+    {
+        for (i = 0; i < 6; ++i)
+        {
+            queue_data_out = 0x11223344 + i;
+            UT_SETUP(OS_QueuePut(queue_id, &queue_data_out, sizeof(uint32), 0));
+        }
+
+        UT_NOMINAL(OS_QueueGetBatch(queue_id, queue_data_in, sizeof(uint32), 4, &items_copied, OS_PEND));
+        UtAssert_UINT32_EQ(items_copied, 4);
+        UtAssert_UINT32_EQ(queue_data_in[0], 0x11223344);
+        UtAssert_UINT32_EQ(queue_data_in[3], 0x11223347);
+
+        UT_NOMINAL(OS_QueueGetBatch(queue_id, queue_data_in, sizeof(uint32), 4, &items_copied, 20));
+        UtAssert_UINT32_EQ(items_copied, 2);
+        UtAssert_UINT32_EQ(queue_data_in[1], 0x11223349);
+
+        UT_TEARDOWN(OS_QueueDelete(queue_id));
+    }
+}
+
 /*--------------------------------------------------------------------------------*
 ** Syntax: OS_QueuePut
 ** Purpose: Sends data on an existing queue
@@ -56,6 +56,7 @@ void UT_os_queue_create_test(void);
 void UT_os_queue_delete_test(void);
 void UT_os_queue_put_test(void);
 void UT_os_queue_get_test(void);
+void UT_os_queue_get_batch_test(void);
 void UT_os_queue_get_id_by_name_test(void);
 void UT_os_queue_get_info_test(void);
 
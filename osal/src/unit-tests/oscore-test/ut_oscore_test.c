@@ -222,6 +222,7 @@ void UtTest_Setup(void)
     UtTest_Add(UT_os_queue_delete_test, NULL, NULL, "OS_QueueDelete");
     UtTest_Add(UT_os_queue_put_test, NULL, NULL, "OS_QueuePut");
     UtTest_Add(UT_os_queue_get_test, NULL, NULL, "OS_QueueGet");
+    UtTest_Add(UT_os_queue_get_batch_test, NULL, NULL, "OS_QueueGetBatch");
     UtTest_Add(UT_os_queue_get_id_by_name_test, NULL, NULL, "OS_QueueGetIdByName");
     UtTest_Add(UT_os_queue_get_info_test, NULL, NULL, "OS_QueueGetInfo");
 
@@ -117,6 +117,41 @@ void UT_DefaultHandler_OS_QueuePut(void *UserObj, UT_EntryKey_t FuncKey, const U
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_QueueGetBatch' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_QueueGetBatch(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t queue_id     = UT_Hook_GetArgValueByName(Context, "queue_id", osal_id_t);
+    uint8 *   data         = UT_Hook_GetArgValueByName(Context, "data", uint8 *);
+    size_t    item_size    = UT_Hook_GetArgValueByName(Context, "item_size", size_t);
+    uint32    max_items    = UT_Hook_GetArgValueByName(Context, "max_items", uint32);
+    uint32 *  items_copied = UT_Hook_GetArgValueByName(Context, "items_copied", uint32 *);
+    int32     status;
+
+    *items_copied = 0;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* Drain whole items from the same buffer used by OS_QueueGet() */
+        while (*items_copied < max_items &&
+               UT_Stub_CopyToLocal((UT_EntryKey_t)OS_ObjectIdToInteger(queue_id), data, item_size) == item_size)
+        {
+            ++(*items_copied);
+            data += item_size;
+        }
+
+        if (*items_copied == 0)
+        {
+            status = OS_QUEUE_EMPTY;
+        }
+
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_QueueGetIdByName' stub
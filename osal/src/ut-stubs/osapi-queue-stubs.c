@@ -28,6 +28,7 @@
 void UT_DefaultHandler_OS_QueueCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_OS_QueueGetBatch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueueGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_OS_QueuePut(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -89,6 +90,28 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
     return UT_GenStub_GetReturnValue(OS_QueueGet, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_QueueGetBatch()
+ * ----------------------------------------------------
+ */
+int32 OS_QueueGetBatch(osal_id_t queue_id, void *data, size_t item_size, uint32 max_items, uint32 *items_copied,
+                       int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_QueueGetBatch, int32);
+
+    UT_GenStub_AddParam(OS_QueueGetBatch, osal_id_t, queue_id);
+    UT_GenStub_AddParam(OS_QueueGetBatch, void *, data);
+    UT_GenStub_AddParam(OS_QueueGetBatch, size_t, item_size);
+    UT_GenStub_AddParam(OS_QueueGetBatch, uint32, max_items);
+    UT_GenStub_AddParam(OS_QueueGetBatch, uint32 *, items_copied);
+    UT_GenStub_AddParam(OS_QueueGetBatch, int32, timeout);
+
+    UT_GenStub_Execute(OS_QueueGetBatch, Basic, UT_DefaultHandler_OS_QueueGetBatch);
+
+    return UT_GenStub_GetReturnValue(OS_QueueGetBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_QueueGetIdByName()
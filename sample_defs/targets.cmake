@@ -102,12 +102,12 @@ SET(FT_INSTALL_SUBDIR "host/functional-test")
 # Native linux / raspberry pi
 SET(MISSION_CPUNAMES cpu1)
 SET(cpu1_PROCESSORID 3)
-SET(cpu1_STATIC_APPLIST cs cf fm hs lc mm sc ds hk md io_lib ci_lab to_lab sch_lab atsam_test sbn sbn_udp sbn_f_remap)
+SET(cpu1_STATIC_APPLIST cs cf fm hs lc mm sc ds hk md io_lib ci_lab to_lab sch_lab atsam_test sbn sbn_udp sbn_f_remap sbn_shmem)
 SET(cpu1_FILELIST cfe_es_startup.scr)
 SET(cpu1_SYSTEM i686-linux-gnu)
 SET(cpu1_STATIC_SYMLIST CS_AppMain,CS CF_AppMain,CF FM_AppMain,FM HS_AppMain,HS LC_AppMain,LC MM_AppMain,MM SC_AppMain,SC
     DS_AppMain,DS HK_AppMain,HK MD_AppMain,MD IO_LibInit,IO_LIB CI_LAB_AppMain,CI_LAB_APP TO_LAB_AppMain,TO_LAB_APP 
-    SCH_LAB_AppMain,SCH_LAB_APP ATSAM_TEST_AppMain,ATSAM_TEST SBN_AppMain,SBN SBN_UDP_Ops,SBN_UDP SBN_F_Remap,SBN_F_REMAP)
+    SCH_LAB_AppMain,SCH_LAB_APP ATSAM_TEST_AppMain,ATSAM_TEST SBN_AppMain,SBN SBN_UDP_Ops,SBN_UDP SBN_F_Remap,SBN_F_REMAP SBN_SHMEM_Ops,SBN_SHMEM)
 
 # # ARM RTEMS6 ATSAMV71Q21B
 # SET(MISSION_CPUNAMES arm-rtems6-atsamv)